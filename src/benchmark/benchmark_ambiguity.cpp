@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "algorithm/ambiguity_fixer.hpp"
+#include "rtklib.h"
+#include "utils/eigen.hpp"
+
+using namespace navp;
+using utils::NavMatrixDf64;
+using utils::NavVectorDf64;
+
+// synthetic double difference ambiguities of a short baseline (cycle), Q = G Cb G' + s I
+struct AmbiguityModel {
+  AmbiguityModel(u16 n) {
+    std::mt19937 gen(20241120);
+    std::normal_distribution<f64> noise(0, 1), g(0, 5);
+    NavMatrixDf64 G(n, 3);
+    for (auto& v : G.reshaped()) v = g(gen);
+    covariance = 1e-3 * G * G.transpose();
+    covariance.diagonal().array() += 1e-3;
+    NavVectorDf64 e(n);
+    for (auto& v : e) v = noise(gen);
+    NavMatrixDf64 L = covariance.llt().matrixL();
+    ambiguity = NavVectorDf64::LinSpaced(n, -1e5, 1e5).array().round().matrix() + 0.1 * L * e;
+    // rtklib has no time budget, keep the comparison fair
+    options.max_search_time = std::chrono::seconds(1);
+  }
+
+  NavVectorDf64 ambiguity;
+  NavMatrixDf64 covariance;
+  algorithm::AmbiguityFixer::Options options;
+};
+
+static void rtklib_lambda(benchmark::State& state) {
+  AmbiguityModel model(state.range(0));
+  i32 n = state.range(0);
+  // rtklib takes double arrays, converted once out of the loop
+  Eigen::VectorXd a = model.ambiguity.cast<double>();
+  Eigen::MatrixXd Q = model.covariance.cast<double>();
+  std::vector<double> F(2 * n), s(2);
+  for (auto _ : state) {
+    if (lambda(n, 2, a.data(), Q.data(), F.data(), s.data()) != 0) {
+      state.SkipWithError("rtklib lambda failed");
+      return;
+    }
+    benchmark::DoNotOptimize(F.data());
+  }
+}
+
+BENCHMARK(rtklib_lambda)->Arg(10)->Arg(20)->Arg(40)->Iterations(10000)->MinWarmUpTime(1);
+
+static void navp_lambda(benchmark::State& state) {
+  AmbiguityModel model(state.range(0));
+  algorithm::AmbiguityFixer fixer(state.range(0), model.options);
+  for (auto _ : state) {
+    if (!fixer.resolve(model.ambiguity, model.covariance)) {
+      state.SkipWithError("navp lambda failed");
+      return;
+    }
+    benchmark::DoNotOptimize(fixer.fixed_ambiguity().data());
+  }
+}
+
+BENCHMARK(navp_lambda)->Arg(10)->Arg(20)->Arg(40)->Iterations(10000)->MinWarmUpTime(1);
+
+// partial ambiguity resolution, the leading ambiguities are poorly determined
+static void navp_lambda_partial(benchmark::State& state) {
+  AmbiguityModel model(state.range(0));
+  model.covariance.topLeftCorner(4, 4).diagonal().array() += 4.0;
+  algorithm::AmbiguityFixer fixer(state.range(0), model.options);
+  for (auto _ : state) {
+    fixer.resolve(model.ambiguity, model.covariance);
+    benchmark::DoNotOptimize(fixer.fixed_ambiguity().data());
+  }
+  state.counters["fixed"] = fixer.fixed_size();
+}
+
+BENCHMARK(navp_lambda_partial)->Arg(10)->Arg(20)->Arg(40)->Iterations(10000)->MinWarmUpTime(1);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,195 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <barrier>
+#include <random>
+#include <thread>
+
+#include "sensors/gnss/constants.hpp"
+#include "solution/base_station.hpp"
+#include "solution/rtk.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+using solution::BaseEpoch;
+using solution::BaseStation;
+using SystemPayload = solution::__RtkPayload::SystemPayload;
+
+constexpr u8 SatsPerSystem = 10;
+
+// synthetic base observation : 4 systems, 3 codes for each system
+struct BaseScene {
+  BaseScene() {
+    std::mt19937 gen(20241202);
+    std::uniform_real_distribution<f64> angle(0, 2 * EIGEN_PI), elevation(0.2, 1.5);
+    std::normal_distribution<f64> noise(0, 1);
+    base = utils::CoordinateXyz(utils::NavVector3f64(-2267810.0, 5009330.0, 3221000.0));
+    for (auto& [sys, codes] : systems) {
+      for (u8 i = 0; i < SatsPerSystem; ++i) {
+        Sv sv{.prn = static_cast<u8>(i + 1), .constellation = Constellation{.id = sys}};
+        auto& eph = sv_map[sv];
+        eph.sv = sv;
+        f64 az = angle(gen), el = elevation(gen);
+        utils::NavVector3f64 los(std::cos(el) * std::sin(az), std::cos(el) * std::cos(az), std::sin(el));
+        eph.pos = utils::CoordinateXyz(utils::NavVector3f64(base + 2.2e7 * los));
+        auto obs = std::make_shared<GObs>();
+        obs->sv = sv;
+        for (auto code : codes) {
+          Sig sig;
+          sig.code = code, sig.freq = Constants::code_to_freq_enum(sys, code);
+          sig.pseudorange = 2.2e7 + noise(gen), sig.carrier = 1.1e8 + noise(gen);
+          sig.doppler = 1000.0f, sig.snr = 45.0f;
+          obs->sigs_list[sig.freq].push_back(sig);
+        }
+        obs_map.emplace(sv, obs);
+      }
+    }
+  }
+
+  auto preprocess(EpochUtc epoch) const {
+    return BaseStation::preprocess(epoch, base, obs_map, sv_map, RandomModelEnum::STANDARD);
+  }
+
+  const std::array<std::pair<ConstellationEnum, std::array<ObsCodeEnum, 3>>, 4> systems = {{
+      {ConstellationEnum::GPS, {ObsCodeEnum::L1C, ObsCodeEnum::L2W, ObsCodeEnum::L5Q}},
+      {ConstellationEnum::BDS, {ObsCodeEnum::L2I, ObsCodeEnum::L6I, ObsCodeEnum::L7I}},
+      {ConstellationEnum::GAL, {ObsCodeEnum::L1C, ObsCodeEnum::L5Q, ObsCodeEnum::L7Q}},
+      {ConstellationEnum::QZS, {ObsCodeEnum::L1C, ObsCodeEnum::L2L, ObsCodeEnum::L5Q}},
+  }};
+  utils::CoordinateXyz base;
+  GnssObsRecord::ObsMap obs_map;
+  EphemerisSolver::SvMap sv_map;
+};
+
+// the base dependent part of the double difference model of one rover
+struct Rover {
+  Rover(const BaseScene& scene, u32 seed) {
+    std::mt19937 gen(seed);
+    std::normal_distribution<f64> noise(0, 1);
+    position = utils::CoordinateXyz(utils::NavVector3f64(scene.base + 1e3 * utils::NavVector3f64::Random()));
+    u16 ambiguity_size = 0;
+    for (auto& [sys, codes] : scene.systems) {
+      auto& payload = payloads.emplace_back();
+      for (u8 i = 0; i < SatsPerSystem; ++i) {
+        Sv sv{.prn = static_cast<u8>(i + 1), .constellation = Constellation{.id = sys}};
+        payload.public_view_satellites.emplace_back(sv);
+        payload.rover_eph.emplace_back(std::addressof(scene.sv_map.at(sv)));
+      }
+      payload.available_code_set.insert(codes.begin(), codes.end());
+      for (u8 c = 0; c < payload.available_code_set.size(); ++c) {
+        for (u8 i = 0; i < SatsPerSystem; ++i) {
+          auto& sig = sigs.emplace_back(std::make_unique<Sig>());
+          sig->pseudorange = 2.2e7 + noise(gen), sig->carrier = 1.1e8 + noise(gen);
+          sig->code_var = 0.09, sig->phase_var = 9e-6;
+          payload.rover_sigs.emplace_back(sig.get());
+        }
+      }
+      ambiguity_size += payload.dd_ambiguity_size();
+    }
+    wls = std::make_unique<algorithm::WeightedLeastSquare<f64>>(3 + ambiguity_size, 2 * ambiguity_size,
+                                                                spdlog::default_logger());
+    wls->parameter().block(0, 0, 3, 1) = position;
+  }
+
+  void solve(const BaseEpoch& base) {
+    u16 index = 0;
+    for (auto& payload : payloads) {
+      payload.bt_base_satellites_distance.clear();
+      payload.base_sigs.clear();
+      for (auto sv : payload.public_view_satellites) {
+        payload.bt_base_satellites_distance.emplace_back(base.find(sv)->distance);
+      }
+      for (auto code : payload.available_code_set) {
+        for (auto sv : payload.public_view_satellites) payload.base_sigs.emplace_back(base.find(sv)->find_code(code));
+      }
+      payload.reset_bt_sta_sd_obs_cache();
+      payload.reset_dd_obs_cache();
+      payload.reset_bt_sta_sd_random_cache();
+      payload.build_dd_model(wls.get(), index, position);
+      index += payload.dd_ambiguity_size();
+    }
+  }
+
+  utils::CoordinateXyz position;
+  std::vector<SystemPayload> payloads;
+  std::vector<std::unique_ptr<Sig>> sigs;
+  std::unique_ptr<algorithm::WeightedLeastSquare<f64>> wls;
+};
+
+// rovers served by a fixed pool of worker threads, one `run` per epoch
+class RoverPool {
+ public:
+  template <typename Work>
+  RoverPool(u16 rover_number, Work work)
+      : threads_(std::min<u16>(rover_number, std::max(1u, std::thread::hardware_concurrency()))),
+        start_(threads_ + 1),
+        done_(threads_ + 1) {
+    for (u16 t = 0; t < threads_; ++t) {
+      workers_.emplace_back([=, this] {
+        while (true) {
+          start_.arrive_and_wait();
+          if (stop_) return;
+          for (u16 rover = t; rover < rover_number; rover += threads_) work(rover);
+          done_.arrive_and_wait();
+        }
+      });
+    }
+  }
+
+  void run() {
+    start_.arrive_and_wait();
+    done_.arrive_and_wait();
+  }
+
+  ~RoverPool() {
+    stop_ = true;
+    start_.arrive_and_wait();
+  }
+
+ private:
+  u16 threads_;
+  std::barrier<> start_, done_;
+  std::atomic<bool> stop_ = false;
+  std::vector<std::jthread> workers_;
+};
+
+// the base epoch is preprocessed once and shared by every rover
+static void base_shared(benchmark::State& state) {
+  BaseScene scene;
+  BaseStation base(1);
+  u16 rover_number = state.range(0);
+  std::vector<Rover> rovers;
+  rovers.reserve(rover_number);
+  for (u16 i = 0; i < rover_number; ++i) rovers.emplace_back(scene, i);
+  RoverPool pool(rover_number, [&](u16 rover) { rovers[rover].solve(*base.latest()); });
+  i32 t = 0;
+  for (auto _ : state) {
+    base.publish(scene.preprocess(EpochUtc() + std::chrono::seconds(t++)));
+    pool.run();
+  }
+  state.counters["rovers"] =
+      benchmark::Counter(static_cast<f64>(rover_number * state.iterations()), benchmark::Counter::kIsRate);
+}
+
+// each rover preprocesses the base epoch by itself
+static void base_per_rover(benchmark::State& state) {
+  BaseScene scene;
+  u16 rover_number = state.range(0);
+  std::vector<Rover> rovers;
+  rovers.reserve(rover_number);
+  for (u16 i = 0; i < rover_number; ++i) rovers.emplace_back(scene, i);
+  i32 t = 0;
+  RoverPool pool(rover_number,
+                 [&](u16 rover) { rovers[rover].solve(*scene.preprocess(EpochUtc() + std::chrono::seconds(t))); });
+  for (auto _ : state) {
+    pool.run();
+    ++t;
+  }
+  state.counters["rovers"] =
+      benchmark::Counter(static_cast<f64>(rover_number * state.iterations()), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(base_per_rover)->RangeMultiplier(4)->Range(1, 256)->Iterations(200)->MinWarmUpTime(1)->UseRealTime();
+BENCHMARK(base_shared)->RangeMultiplier(4)->Range(1, 256)->Iterations(200)->MinWarmUpTime(1)->UseRealTime();
+
+BENCHMARK_MAIN();
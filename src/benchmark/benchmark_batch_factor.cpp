@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+#include <ceres/autodiff_cost_function.h>
+#include <ceres/problem.h>
+#include <ceres/solver.h>
+
+#include <random>
+
+#include "algorithm/factor/batch_factor.hpp"
+#include "algorithm/factor/pseudorange_factor.hpp"
+
+using namespace navp;
+using namespace navp::fgo;
+
+constexpr u8 ClockNumber = 4;
+
+// pseudorange residual with automatic derivatives
+struct PseudorangeAutoDiff {
+  template <typename T>
+  bool operator()(const T* position, const T* clock, T* residual) const {
+    using std::sqrt;
+    T dx = position[0] - sv_pos.x(), dy = position[1] - sv_pos.y(), dz = position[2] - sv_pos.z();
+    residual[0] = (pseudorange - sqrt(dx * dx + dy * dy + dz * dz) - clock[0]) / std;
+    return true;
+  }
+
+  // double as the jets of ceres
+  Eigen::Vector3d sv_pos;
+  double pseudorange, std;
+};
+
+// one epoch of `satellite_number` satellites on `ClockNumber` constellations, solved from 10 m away
+struct EpochScene {
+  EpochScene(u16 satellite_number) {
+    std::mt19937 gen(20241212);
+    std::uniform_real_distribution<f64> angle(0, 2 * EIGEN_PI), elevation(0.2, 1.5);
+    std::normal_distribution<f64> noise(0, 1);
+    receiver = utils::NavVector3f64(-2267810.0, 5009330.0, 3221000.0);
+    for (u16 i = 0; i < satellite_number; ++i) {
+      f64 az = angle(gen), el = elevation(gen);
+      utils::NavVector3f64 los(std::cos(el) * std::sin(az), std::cos(el) * std::cos(az), std::sin(el));
+      auto& sv = sv_pos.emplace_back(receiver + 2.2e7 * los);
+      clock.push_back(i % ClockNumber);
+      pseudorange.push_back((receiver - sv).norm() + 100.0 * (clock.back() + 1) + noise(gen));
+    }
+  }
+
+  void reset_parameters() {
+    for (u8 i = 0; i < 3; ++i) position[i] = receiver[i] + 10.0;
+    clocks.fill(0.0);
+  }
+
+  utils::NavVector3f64 receiver;
+  std::vector<utils::NavVector3f64> sv_pos;
+  std::vector<f64> pseudorange;
+  std::vector<u8> clock;
+  std::array<double, 3> position;  // parameter blocks of ceres
+  std::array<double, ClockNumber> clocks;
+};
+
+enum class Variant : u8 { PerSatellite, Batched, AutoDiff };
+
+template <Variant variant>
+static void pseudorange_epoch(benchmark::State& state) {
+  EpochScene scene(state.range(0));
+  scene.reset_parameters();
+  ceres::Problem problem;
+  if constexpr (variant == Variant::Batched) {
+    auto factor = new PseudorangeBatchFactor(ClockNumber);
+    for (size_t i = 0; i < scene.sv_pos.size(); ++i) {
+      factor->add(scene.sv_pos[i], scene.pseudorange[i], 1.0, scene.clock[i]);
+    }
+    std::vector<double*> blocks{scene.position.data()};
+    for (auto& clock : scene.clocks) blocks.push_back(&clock);
+    problem.AddResidualBlock(factor, nullptr, blocks);
+  } else {
+    for (size_t i = 0; i < scene.sv_pos.size(); ++i) {
+      ceres::CostFunction* factor = nullptr;
+      if constexpr (variant == Variant::PerSatellite) {
+        factor = PseudorangeFactor::Create(&scene.sv_pos[i], scene.pseudorange[i], 1.0);
+      } else {
+        factor = new ceres::AutoDiffCostFunction<PseudorangeAutoDiff, 1, 3, 1>(
+            new PseudorangeAutoDiff{scene.sv_pos[i].cast<double>(), scene.pseudorange[i], 1.0});
+      }
+      problem.AddResidualBlock(factor, nullptr, scene.position.data(), &scene.clocks[scene.clock[i]]);
+    }
+  }
+  ceres::Solver::Options options;
+  options.linear_solver_type = ceres::DENSE_QR;
+  options.max_num_iterations = 5;
+  options.logging_type = ceres::SILENT;
+  ceres::Solver::Summary summary;
+  for (auto _ : state) {
+    scene.reset_parameters();
+    ceres::Solve(options, &problem, &summary);
+    benchmark::DoNotOptimize(scene.position.data());
+  }
+  state.counters["residual_blocks"] = problem.NumResidualBlocks();
+  state.counters["satellites"] =
+      benchmark::Counter(static_cast<f64>(scene.sv_pos.size() * state.iterations()), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_TEMPLATE(pseudorange_epoch, Variant::PerSatellite)->ArgsProduct({{10, 20, 40, 80}})->ArgNames({"satellites"});
+BENCHMARK_TEMPLATE(pseudorange_epoch, Variant::Batched)->ArgsProduct({{10, 20, 40, 80}})->ArgNames({"satellites"});
+BENCHMARK_TEMPLATE(pseudorange_epoch, Variant::AutoDiff)->ArgsProduct({{10, 20, 40, 80}})->ArgNames({"satellites"});
+
+BENCHMARK_MAIN();
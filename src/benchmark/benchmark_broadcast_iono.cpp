@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "sensors/gnss/atmosphere.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+
+static constexpr u16 Stations = 20, Satellites = 12;
+
+struct Network {
+  Network() {
+    add(ConstellationEnum::GPS, NavMsgTypeEnum::LNAV,
+        {0.1118E-07, -0.7451E-08, -0.5961E-07, 0.1192E-06, 0.1167E+06, -0.2294E+06, -0.1311E+06, 0.1049E+07});
+    add(ConstellationEnum::BDS, NavMsgTypeEnum::D1D2,
+        {0.1397E-07, -0.7451E-08, -0.5960E-07, 0.1192E-06, 0.1270E+06, -0.1966E+06, 0.6554E+05, 0.3932E+06});
+    add(ConstellationEnum::GAL, NavMsgTypeEnum::IFNV, {80.25, 0.3906, 0.0});
+    std::mt19937 gen(20241212);
+    std::uniform_real_distribution<f64> lat(-1.2, 1.2), lon(-3.1, 3.1), az(0, 2 * std::numbers::pi), el(0.1, 1.5);
+    for (u16 i = 0; i < Stations; ++i) {
+      stations.emplace_back(lat(gen), lon(gen), 50.0);
+      azimuth.emplace_back(), elevation.emplace_back();
+      for (u16 k = 0; k < Satellites; ++k) azimuth.back().push_back(az(gen)), elevation.back().push_back(el(gen));
+    }
+  }
+
+  void add(ConstellationEnum system, NavMsgTypeEnum type, std::initializer_list<f64> values) {
+    auto& ion = nav.ionMap[system][type][utils::GTime{}];
+    ion.type = type;
+    ion.sv.system() = system;
+    std::ranges::copy(values, ion.vals);
+  }
+
+  Navigation nav;
+  EpochUtc epoch = EpochUtc::from_date(navp::details::Date{.year = 2021, .month = 11, .day = 14, .hour = 5});
+  std::vector<utils::CoordinateBlh> stations;
+  std::vector<std::vector<f64>> azimuth, elevation;
+};
+
+// 1 Hz epochs of the network, each station with its handler as in spp, the satellites one by one or at once
+static void broadcast_iono(benchmark::State& state, IonoModelEnum model, f64 cell, bool batched) {
+  Network network;
+  std::vector<IonoHandler> handlers(Stations);
+  for (auto& handler : handlers) handler.set_iono_model(model).set_navigation({&network.nav}).set_nequick_cell(cell);
+  std::vector<f64> iono(Satellites);
+  auto epoch = network.epoch;
+  for (auto _ : state) {
+    epoch = epoch + std::chrono::seconds(1);
+    for (u16 i = 0; i < Stations; ++i) {
+      auto& handler = handlers[i];
+      handler.set_station(epoch, network.stations[i]);
+      if (batched) {
+        handler.handle(network.azimuth[i], network.elevation[i], iono);
+      } else {
+        for (u16 k = 0; k < Satellites; ++k) {
+          handler.handle({&network.azimuth[i][k], 1}, {&network.elevation[i][k], 1}, {&iono[k], 1});
+        }
+      }
+      benchmark::DoNotOptimize(iono.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * Stations * Satellites);
+}
+
+BENCHMARK_CAPTURE(broadcast_iono, klobuchar_per_satellite, IonoModelEnum::KLOBUCHAR, 0.0, false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(broadcast_iono, klobuchar_batched, IonoModelEnum::KLOBUCHAR, 0.0, true)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(broadcast_iono, nequick_per_satellite, IonoModelEnum::NEQUICK_APPROX, 0.0, false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(broadcast_iono, nequick_batched, IonoModelEnum::NEQUICK_APPROX, 0.0, true)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(broadcast_iono, nequick_memoized, IonoModelEnum::NEQUICK_APPROX, 2.5, true)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "sensors/gnss/constants.hpp"
+#include "sensors/gnss/cycle_slip.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+
+constexpr i32 Epochs = 1000;
+
+// synthetic dual-frequency (L1C, L2W) observations at 1 Hz, a few slips
+struct SlipScene {
+  static constexpr f64 f1 = 1575.42E6, f2 = 1227.60E6;
+  static constexpr f64 lambda1 = Constants::CLIGHT / f1, lambda2 = Constants::CLIGHT / f2;
+
+  SlipScene(u16 sat_number) {
+    std::mt19937 gen(20241201);
+    std::normal_distribution<f64> noise(0, 1);
+    std::uniform_int_distribution<i32> slip(0, 199);
+    for (i32 t = 0; t < Epochs; ++t) {
+      auto& obs_map = epochs.emplace_back();
+      for (u16 i = 0; i < sat_number; ++i) {
+        auto obs = std::make_shared<GObs>();
+        obs->sv = Sv{.prn = static_cast<u8>(i + 1), .constellation = Constellation{.id = ConstellationEnum::GPS}};
+        f64 velocity = -800.0 + 1600.0 * i / sat_number;
+        f64 rho = 2.0e7 + 1.0e5 * i + velocity * t;
+        f64 i1 = 2.0 + 1e-4 * t, i2 = i1 * (f1 * f1) / (f2 * f2);
+        f64 n1 = slip(gen) == 0 ? 1.0 : 0.0;
+        Sig sig1, sig2;
+        sig1.code = ObsCodeEnum::L1C, sig1.freq = FreTypeEnum::F1;
+        sig1.pseudorange = rho + i1 + 0.3 * noise(gen);
+        sig1.carrier = (rho - i1) / lambda1 + n1 + 0.01 * noise(gen);
+        sig1.doppler = static_cast<f32>(-velocity / lambda1);
+        sig2.code = ObsCodeEnum::L2W, sig2.freq = FreTypeEnum::F2;
+        sig2.pseudorange = rho + i2 + 0.3 * noise(gen);
+        sig2.carrier = (rho - i2) / lambda2 + 0.01 * noise(gen);
+        sig2.doppler = static_cast<f32>(-velocity / lambda2);
+        obs->sigs_list[FreTypeEnum::F1].push_back(sig1);
+        obs->sigs_list[FreTypeEnum::F2].push_back(sig2);
+        obs_map.emplace(obs->sv, obs);
+      }
+    }
+  }
+
+  std::vector<GnssObsRecord::ObsMap> epochs;
+};
+
+static void cycle_slip_detect(benchmark::State& state) {
+  SlipScene scene(state.range(0));
+  CycleSlip detector;
+  i32 t = 0;
+  for (auto _ : state) {
+    auto count = detector.detect(EpochUtc() + std::chrono::seconds(t), scene.epochs[t % Epochs]);
+    benchmark::DoNotOptimize(count);
+    ++t;
+  }
+  state.counters["signals"] =
+      benchmark::Counter(static_cast<f64>(2 * state.range(0) * state.iterations()), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(cycle_slip_detect)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Iterations(Epochs)->MinWarmUpTime(1);
+
+BENCHMARK_MAIN();
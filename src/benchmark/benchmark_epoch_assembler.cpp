@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "io/rtcm/epoch_assembler.hpp"
+
+using namespace navp;
+using namespace navp::io::rtcm;
+
+static constexpr u32 Epochs = 1000, Satellites = 10;
+static constexpr u16 Types[] = {1074, 1094, 1124};  // gps, galileo, beidou msm4 of every epoch
+
+// msm4 of 10 satellites and one signal per constellation, one epoch a second
+static auto recording() -> std::vector<u8> {
+  std::vector<u8> data;
+  for (u32 epoch = 0; epoch < Epochs; ++epoch) {
+    for (auto type : Types) {
+      std::vector<u8> payload;
+      u32 pos = 0;
+      auto put = [&](i64 value, u32 len) {
+        for (u32 i = 0; i < len; ++i, ++pos) {
+          if (pos % 8 == 0) payload.push_back(0);
+          if ((static_cast<u64>(value) >> (len - 1 - i)) & 1) payload.back() |= 0x80 >> (pos % 8);
+        }
+      };
+      // beidou time is 14 s behind gps time
+      u32 tow = 100000000 + epoch * 1000 - (type == 1124 ? 14000 : 0);
+      put(type, 12), put(1, 12), put(tow, 30), put(type != 1124, 1), put(0, 18);
+      for (u32 i = 0; i < 64; ++i) put(i < Satellites, 1);
+      for (u32 i = 1; i <= 32; ++i) put(i == 2, 1);
+      put(-1, Satellites);
+      for (u32 i = 0; i < Satellites; ++i) put(70 + i, 8);
+      for (u32 i = 0; i < Satellites; ++i) put(512, 10);
+      for (u32 i = 0; i < Satellites; ++i) put(1000, 15), put(2000 + epoch, 22), put(10, 4), put(0, 1), put(720, 6);
+
+      auto size = payload.size();
+      std::vector<u8> frame{Rtcm3Decoder::Preamble, static_cast<u8>(size >> 8), static_cast<u8>(size)};
+      frame.insert(frame.end(), payload.begin(), payload.end());
+      auto crc = crc24q(frame);
+      frame.insert(frame.end(), {static_cast<u8>(crc >> 16), static_cast<u8>(crc >> 8), static_cast<u8>(crc)});
+      data.insert(data.end(), frame.begin(), frame.end());
+    }
+  }
+  return data;
+}
+
+// epochs assembled from network sized reads and taken as soon as released
+static void epoch_assembly(benchmark::State& state) {
+  auto data = recording();
+  constexpr size_t Chunk = 1460;
+  for (auto _ : state) {
+    EpochAssembler assembler({.capacity = Epochs});
+    assembler.decoder().set_reference_time(utils::GTime(utils::GWeek(2200), utils::GTow(100000.0)));
+    for (size_t pos = 0; pos < data.size(); pos += Chunk) {
+      assembler.decode(std::span(data).subspan(pos, std::min(Chunk, data.size() - pos)));
+      while (auto epoch = assembler.next()) benchmark::DoNotOptimize(epoch->obs_map.size());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * Epochs);
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+BENCHMARK(epoch_assembly)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "algorithm/factor_graph.hpp"
+
+using namespace navp;
+using fgo::GnssFactorGraph;
+using fgo::PseudorangeObservation;
+
+constexpr u8 SatNumber = 20, ClockNumber = 4;
+
+// static receiver tracking `SatNumber` satellites of `ClockNumber` constellations at 1 Hz
+struct GraphScene {
+  GraphScene() : gen(20241210) {
+    std::uniform_real_distribution<f64> angle(0, 2 * EIGEN_PI), elevation(0.2, 1.5);
+    receiver = utils::NavVector3f64(-2267810.0, 5009330.0, 3221000.0);
+    for (u8 i = 0; i < SatNumber; ++i) {
+      f64 az = angle(gen), el = elevation(gen);
+      utils::NavVector3f64 los(std::cos(el) * std::sin(az), std::cos(el) * std::cos(az), std::sin(el));
+      sv_pos[i] = receiver + 2.2e7 * los;
+    }
+  }
+
+  auto next_epoch() {
+    std::normal_distribution<f64> noise(0, 1);
+    epoch = epoch + std::chrono::seconds(1);
+    observations.clear();
+    for (u8 i = 0; i < SatNumber; ++i) {
+      u8 clock = i % ClockNumber;
+      observations.push_back({.sv_pos = sv_pos[i],
+                              .pseudorange = (receiver - sv_pos[i]).norm() + 100.0 * (clock + 1) + noise(gen),
+                              .variance = 1.0,
+                              .clock = clock});
+    }
+    return std::span<const PseudorangeObservation>(observations);
+  }
+
+  std::mt19937 gen;
+  EpochUtc epoch;
+  utils::NavVector3f64 receiver;
+  std::array<utils::NavVector3f64, SatNumber> sv_pos;
+  std::vector<PseudorangeObservation> observations;
+};
+
+// one epoch slides into a full window : marginalization of the oldest epoch, new factors and optimization
+static void factor_graph_epoch(benchmark::State& state) {
+  GraphScene scene;
+  fgo::FactorGraph::Options options;
+  options.threads = state.range(1);
+  GnssFactorGraph graph(state.range(0), options);
+  utils::NavVector3f64 initial = scene.receiver + utils::NavVector3f64::Constant(5.0);
+  for (u8 i = 0; i < graph.slide_window_length(); ++i) {
+    graph.add_epoch(scene.epoch, initial, scene.next_epoch());
+    graph.optimize();
+  }
+  f64 latency = 0;
+  for (auto _ : state) {
+    graph.add_epoch(scene.epoch, initial, scene.next_epoch());
+    graph.optimize();
+    latency += graph.latency().count() * 1e-3;
+    benchmark::DoNotOptimize(graph.position());
+  }
+  state.counters["optimize_us"] = benchmark::Counter(latency / state.iterations());
+}
+
+BENCHMARK(factor_graph_epoch)
+    ->ArgsProduct({{5, 10, 20, 40}, {1, 4}})
+    ->ArgNames({"window", "threads"})
+    ->Iterations(200)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <fstream>
+#include <numbers>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../test/gnss/ionex_writer.hpp"
+#include "sensors/gnss/atmosphere.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+using namespace navp::test;
+
+static constexpr u16 Stations = 100, Satellites = 40;
+
+// a day of 2 hourly global maps (2.5 x 5 degree) like the ones of the analysis centers
+static auto ionex_path() -> std::filesystem::path {
+  auto path = std::filesystem::temp_directory_path() / "benchmark_ionex.21i";
+  std::ofstream stream(path);
+  stream << ionex_record("    13", "# OF MAPS IN FILE");
+  write_ionex_grid(stream);
+  for (u32 map = 0; map < 13; ++map) {
+    write_ionex_map(stream, false, map, ionex_epoch(2021, 11, 14 + map / 12, 2 * map % 24), [map](f64 lat, f64 lon) {
+      f64 phase = (lon + 180 + map * 30) * std::numbers::pi / 180;
+      return 200 + 150 * std::cos(lat * std::numbers::pi / 180) * std::cos(phase);
+    });
+  }
+  return path;
+}
+
+struct Network {
+  Network() {
+    std::mt19937 gen(20241212);
+    std::uniform_real_distribution<f64> lat(-1.2, 1.2), lon(-3.1, 3.1), az(0, 2 * std::numbers::pi), el(0.1, 1.5);
+    for (u16 i = 0; i < Stations; ++i) {
+      stations.emplace_back(lat(gen), lon(gen), 50.0);
+      azimuth.emplace_back(), elevation.emplace_back();
+      for (u16 k = 0; k < Satellites; ++k) azimuth.back().push_back(az(gen)), elevation.back().push_back(el(gen));
+    }
+  }
+
+  std::shared_ptr<const Ionex> ionex = Ionex::load(ionex_path());
+  EpochUtc epoch = EpochUtc::from_date(navp::details::Date{.year = 2021, .month = 11, .day = 14, .hour = 5});
+  std::vector<utils::CoordinateBlh> stations;
+  std::vector<std::vector<f64>> azimuth, elevation;
+};
+
+// the epoch is reduced to its maps and the pierce point computed again for every satellite
+static void ionex_per_satellite(benchmark::State& state) {
+  Network network;
+  IonoHandler handler;
+  handler.set_iono_model(IonoModelEnum::IONEX).set_ionex(network.ionex);
+  f64 iono;
+  for (auto _ : state) {
+    for (u16 i = 0; i < Stations; ++i) {
+      for (u16 k = 0; k < Satellites; ++k) {
+        handler.set_station(network.epoch, network.stations[i])
+            .handle({&network.azimuth[i][k], 1}, {&network.elevation[i][k], 1}, {&iono, 1});
+        benchmark::DoNotOptimize(iono);
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * Stations * Satellites);
+}
+
+// one 1 Hz epoch of the network, every satellite of a station at once
+static void ionex_batched(benchmark::State& state) {
+  Network network;
+  IonoHandler handler;
+  handler.set_iono_model(IonoModelEnum::IONEX).set_ionex(network.ionex);
+  std::vector<f64> iono(Satellites);
+  for (auto _ : state) {
+    for (u16 i = 0; i < Stations; ++i) {
+      handler.set_station(network.epoch, network.stations[i]).handle(network.azimuth[i], network.elevation[i], iono);
+      benchmark::DoNotOptimize(iono.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * Stations * Satellites);
+}
+
+BENCHMARK(ionex_per_satellite)->Unit(benchmark::kMicrosecond);
+BENCHMARK(ionex_batched)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
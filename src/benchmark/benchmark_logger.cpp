@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+
+#include "sensors/gnss/sv.hpp"
+#include "utils/logger.hpp"
+#include "utils/time.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+
+static const Sv sv{.prn = 12, .constellation = {.id = ConstellationEnum::GPS}};
+
+// a disabled call as it was expanded, the source location and the arguments are formatted before the level check
+static void log_disabled_eager(benchmark::State& state) {
+  EpochUtc time;
+  for (auto _ : state) {
+    details::global_formatted_logger->log(spdlog::level::trace, "{}", source_information());
+    details::global_pure_logger->log(spdlog::level::trace, "{} {} missing {} pseudorange", time, sv, "L1C");
+  }
+}
+
+// a disabled call, nothing is evaluated
+static void log_disabled(benchmark::State& state) {
+  EpochUtc time;
+  for (auto _ : state) {
+    nav_trace("{} {} missing {} pseudorange", time, sv, "L1C");
+  }
+}
+
+// a repeated warning of a satellite, let through once
+static void log_rate_limited(benchmark::State& state) {
+  EpochUtc time;
+  for (auto _ : state) {
+    nav_warn_limited(std::hash<Sv>{}(sv), "{} {} missing {} pseudorange", time, sv, "L1C");
+  }
+}
+
+BENCHMARK(log_disabled_eager);
+BENCHMARK(log_disabled);
+BENCHMARK(log_rate_limited);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "filter/filter.hpp"
+
+using namespace navp;
+using namespace navp::filter;
+
+static constexpr u16 Satellites = 40, Signals = 3;
+
+// checks of an epoch as in the rover handler and the rtk satellite selection
+struct Scene {
+  Scene() {
+    std::mt19937 gen(20241212);
+    std::uniform_real_distribution<f64> el(0.0, 1.5), az(0.0, 6.28), snr(20, 55);
+    std::uniform_int_distribution<u16> prn(1, 35), system(0, 3);
+    for (u16 i = 0; i < Satellites; ++i) {
+      Sv sv{.prn = static_cast<u8>(prn(gen)),
+            .constellation = {.id = static_cast<sensors::gnss::ConstellationEnum>(system(gen))}};
+      satellites.push_back(sv), elevation.push_back(el(gen)), azimuth.push_back(az(gen));
+      for (u16 k = 0; k < Signals; ++k) this->snr.push_back(snr(gen));
+    }
+  }
+
+  std::vector<Sv> satellites;
+  std::vector<f64> elevation, azimuth, snr;
+};
+
+static auto mask_filters() -> MaskFilters {
+  return MaskFilters::from_str(">=2024-10-01 08:00:00, <2024-10-02 00:00:00, !=G01, !=C05, >15e, >35s, !=GLO, !=L1")
+      .unwrap_throw();
+}
+
+static void mask_filter_sequential(benchmark::State& state) {
+  Scene scene;
+  auto filters = mask_filters();
+  auto apply = [&](const FilterItem& item) {
+    return std::ranges::all_of(filters.__filter, [&](const Filter& filter) { return filter.apply(item); });
+  };
+  for (auto _ : state) {
+    u32 accepted = 0;
+    for (u16 i = 0; i < Satellites; ++i) {
+      auto sv = scene.satellites[i];
+      if (!apply(sv.constellation) || !apply(sv) || !apply(ElevationItem(scene.elevation[i])) ||
+          !apply(AzimuthItem(scene.azimuth[i])))
+        continue;
+      for (u16 k = 0; k < Signals; ++k) accepted += apply(SnrItem(scene.snr[i * Signals + k]));
+    }
+    benchmark::DoNotOptimize(accepted);
+  }
+  state.SetItemsProcessed(state.iterations() * Satellites);
+}
+
+static void mask_filter_compiled(benchmark::State& state) {
+  Scene scene;
+  auto filters = mask_filters();
+  for (auto _ : state) {
+    u32 accepted = 0;
+    for (u16 i = 0; i < Satellites; ++i) {
+      auto sv = scene.satellites[i];
+      if (!filters.apply(sv.constellation) || !filters.apply(sv) || !filters.apply(ElevationItem(scene.elevation[i])) ||
+          !filters.apply(AzimuthItem(scene.azimuth[i])))
+        continue;
+      for (u16 k = 0; k < Signals; ++k) accepted += filters.apply(SnrItem(scene.snr[i * Signals + k]));
+    }
+    benchmark::DoNotOptimize(accepted);
+  }
+  state.SetItemsProcessed(state.iterations() * Satellites);
+}
+
+static void mask_filter_vectorized(benchmark::State& state) {
+  Scene scene;
+  auto filters = mask_filters();
+  std::vector<u8> satellite_mask(Satellites), signal_mask(Satellites * Signals);
+  for (auto _ : state) {
+    std::ranges::fill(satellite_mask, 1), std::ranges::fill(signal_mask, 1);
+    filters.__predicate.apply_elevation(scene.elevation, satellite_mask);
+    filters.__predicate.apply_azimuth(scene.azimuth, satellite_mask);
+    filters.__predicate.apply_snr(scene.snr, signal_mask);
+    benchmark::DoNotOptimize(satellite_mask.data());
+    benchmark::DoNotOptimize(signal_mask.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Satellites);
+}
+
+BENCHMARK(mask_filter_sequential);
+BENCHMARK(mask_filter_compiled);
+BENCHMARK(mask_filter_vectorized);
+
+BENCHMARK_MAIN();
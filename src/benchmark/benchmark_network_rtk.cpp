@@ -0,0 +1,139 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "sensors/gnss/constants.hpp"
+#include "solution/network_rtk.hpp"
+#include "utils/thread_pool.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+using solution::BaseEpoch;
+using solution::BaseStation;
+using SystemPayload = solution::__RtkPayload::SystemPayload;
+
+constexpr u8 SatsPerSystem = 10;
+
+const std::array<std::pair<ConstellationEnum, std::array<ObsCodeEnum, 3>>, 4> Systems = {{
+    {ConstellationEnum::GPS, {ObsCodeEnum::L1C, ObsCodeEnum::L2W, ObsCodeEnum::L5Q}},
+    {ConstellationEnum::BDS, {ObsCodeEnum::L2I, ObsCodeEnum::L6I, ObsCodeEnum::L7I}},
+    {ConstellationEnum::GAL, {ObsCodeEnum::L1C, ObsCodeEnum::L5Q, ObsCodeEnum::L7Q}},
+    {ConstellationEnum::QZS, {ObsCodeEnum::L1C, ObsCodeEnum::L2L, ObsCodeEnum::L5Q}},
+}};
+
+// synthetic rover and `baseline_number` surrounding base stations : 4 systems, 3 codes for each system
+struct NetworkScene {
+  NetworkScene(u16 baseline_number) {
+    std::mt19937 gen(20241203);
+    std::uniform_real_distribution<f64> angle(0, 2 * EIGEN_PI), elevation(0.2, 1.5);
+    std::normal_distribution<f64> noise(0, 1);
+    rover = utils::CoordinateXyz(utils::NavVector3f64(-2267810.0, 5009330.0, 3221000.0));
+    for (auto& [sys, codes] : Systems) {
+      for (u8 i = 0; i < SatsPerSystem; ++i) {
+        Sv sv{.prn = static_cast<u8>(i + 1), .constellation = Constellation{.id = sys}};
+        auto& eph = sv_map[sv];
+        eph.sv = sv;
+        f64 az = angle(gen), el = elevation(gen);
+        utils::NavVector3f64 los(std::cos(el) * std::sin(az), std::cos(el) * std::cos(az), std::sin(el));
+        eph.pos = utils::CoordinateXyz(utils::NavVector3f64(rover + 2.2e7 * los));
+        sv_codes.emplace(sv, codes);
+      }
+    }
+    auto observe = [&](const utils::CoordinateXyz& station) {
+      GnssObsRecord::ObsMap obs_map;
+      for (auto& [sv, eph] : sv_map) {
+        auto obs = std::make_shared<GObs>();
+        obs->sv = sv;
+        for (auto code : sv_codes.at(sv)) {
+          Sig sig;
+          sig.code = code, sig.freq = Constants::code_to_freq_enum(sv.constellation.id, code);
+          sig.pseudorange = (station - eph.pos).norm() + noise(gen), sig.carrier = 1.1e8 + noise(gen);
+          sig.code_var = 0.09, sig.phase_var = 9e-6;
+          obs->sigs_list[sig.freq].push_back(sig);
+        }
+        obs_map.emplace(sv, obs);
+      }
+      return obs_map;
+    };
+    rover_obs = observe(rover);
+    for (u16 i = 0; i < baseline_number; ++i) {
+      utils::CoordinateXyz base(utils::NavVector3f64(rover + 3e4 * utils::NavVector3f64::Random()));
+      bases.emplace_back(BaseStation::preprocess(EpochUtc(), base, observe(base), sv_map, GnssRandomHandler{}));
+    }
+  }
+
+  utils::CoordinateXyz rover;
+  EphemerisSolver::SvMap sv_map;
+  std::unordered_map<Sv, std::array<ObsCodeEnum, 3>> sv_codes;
+  GnssObsRecord::ObsMap rover_obs;
+  std::vector<std::shared_ptr<const BaseEpoch>> bases;
+};
+
+// the payloads of one baseline, the rover signals are shared by every baseline
+struct Baseline {
+  Baseline(const NetworkScene& scene, const BaseEpoch& base) {
+    for (auto& [sys, codes] : Systems) {
+      auto& payload = payloads.emplace_back();
+      for (u8 i = 0; i < SatsPerSystem; ++i) {
+        Sv sv{.prn = static_cast<u8>(i + 1), .constellation = Constellation{.id = sys}};
+        payload.public_view_satellites.emplace_back(sv);
+        payload.rover_eph.emplace_back(std::addressof(scene.sv_map.at(sv)));
+        payload.bt_base_satellites_distance.emplace_back(base.find(sv)->distance);
+      }
+      payload.available_code_set.insert(codes.begin(), codes.end());
+      for (auto code : payload.available_code_set) {
+        for (auto sv : payload.public_view_satellites) {
+          payload.rover_sigs.emplace_back(scene.rover_obs.at(sv)->find_code(code));
+          payload.base_sigs.emplace_back(base.find(sv)->find_code(code));
+        }
+      }
+      dd_ambiguity_size += payload.dd_ambiguity_size();
+    }
+  }
+
+  void build_model(algorithm::WeightedLeastSquare<f64>* wls, u16 dd_ambiguity_index,
+                   const utils::CoordinateXyz& position) {
+    for (auto& payload : payloads) {
+      payload.reset_bt_sta_sd_obs_cache();
+      payload.reset_dd_obs_cache();
+      payload.reset_bt_sta_sd_random_cache();
+      payload.build_dd_model(wls, dd_ambiguity_index, position);
+      dd_ambiguity_index += payload.dd_ambiguity_size();
+    }
+  }
+
+  std::vector<SystemPayload> payloads;
+  u16 dd_ambiguity_size = 0;
+};
+
+// joint dd model of every baseline, built by `threads` threads
+static void network_joint_model(benchmark::State& state) {
+  NetworkScene scene(state.range(0));
+  utils::ThreadPool pool(state.range(1));
+  std::vector<Baseline> baselines;
+  std::vector<u16> dd_ambiguity_index;
+  u16 dd_ambiguity_size = 0;
+  for (auto& base : scene.bases) {
+    auto& baseline = baselines.emplace_back(scene, *base);
+    dd_ambiguity_index.push_back(dd_ambiguity_size);
+    dd_ambiguity_size += baseline.dd_ambiguity_size;
+  }
+  algorithm::WeightedLeastSquare<f64> wls(3 + dd_ambiguity_size, 2 * dd_ambiguity_size, spdlog::default_logger());
+  wls.parameter().block(0, 0, 3, 1) = scene.rover;
+  for (auto _ : state) {
+    pool.parallel_for(baselines.size(),
+                      [&](size_t i) { baselines[i].build_model(&wls, dd_ambiguity_index[i], scene.rover); });
+    benchmark::DoNotOptimize(wls.observation().data());
+  }
+  state.counters["baselines"] =
+      benchmark::Counter(static_cast<f64>(baselines.size() * state.iterations()), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(network_joint_model)
+    ->ArgsProduct({{1, 2, 4, 8, 16}, {1, 4}})
+    ->ArgNames({"baselines", "threads"})
+    ->Iterations(500)
+    ->MinWarmUpTime(1)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
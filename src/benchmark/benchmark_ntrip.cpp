@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "io/ntrip/ntrip.hpp"
+#include "io/rtcm/rtcm3.hpp"
+
+using namespace navp;
+using namespace navp::io::ntrip;
+using namespace navp::io::rtcm;
+
+static constexpr u16 Frames = 2000;
+
+// 1005 frames of a station, the file replayed by the caster
+static auto recording() -> std::string {
+  std::vector<u8> data;
+  for (u16 i = 0; i < Frames; ++i) {
+    std::vector<u8> frame{Rtcm3Decoder::Preamble, 0, 19, 1005 >> 4, (1005 & 0xF) << 4, 1};
+    frame.resize(3 + 19);
+    auto crc = crc24q(frame);
+    frame.insert(frame.end(), {static_cast<u8>(crc >> 16), static_cast<u8>(crc >> 8), static_cast<u8>(crc)});
+    data.insert(data.end(), frame.begin(), frame.end());
+  }
+  auto filename = (std::filesystem::temp_directory_path() / "navp_benchmark.rtcm3").string();
+  std::ofstream file(filename, std::ios::binary);
+  file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+  return filename;
+}
+
+// streams of the local caster decoded on two event loops, connections included
+static void ntrip_ingestion(benchmark::State& state) {
+  auto streams = static_cast<u32>(state.range(0));
+  LocalCaster caster;
+  caster.add_mountpoint("BENCH", recording(), 1460);
+  caster.start();
+  for (auto _ : state) {
+    IngestionLoop loop({.threads = 2, .min_backoff = std::chrono::seconds(60)});
+    std::vector<std::unique_ptr<Rtcm3Decoder>> decoders;
+    for (u32 i = 0; i < streams; ++i) {
+      auto& decoder = *decoders.emplace_back(std::make_unique<Rtcm3Decoder>());
+      loop.add_stream({.port = caster.port(), .mountpoint = "BENCH"},
+                      [&decoder](std::span<const u8> frames) { decoder.decode(frames); });
+    }
+    loop.start();
+    for (u32 i = 0; i < streams; ++i) {
+      while (loop.statistics(i).frames < Frames) std::this_thread::yield();
+    }
+    loop.stop();
+  }
+  state.SetItemsProcessed(state.iterations() * streams * Frames);
+}
+
+BENCHMARK(ntrip_ingestion)->Arg(16)->Arg(256)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "algorithm/raim.hpp"
+#include "utils/eigen.hpp"
+
+using namespace navp;
+using Fde = algorithm::FaultDetectionExclusion<f64>;
+
+// synthetic multi-constellation geometry, two signals per satellite
+struct RaimModel {
+  RaimModel(u16 sat_number, u8 clock_number = 4, u8 sig_per_sat = 2) {
+    std::mt19937 gen(20241120);
+    std::normal_distribution<f64> noise(0, 1);
+    u16 rows = sat_number * sig_per_sat;
+    jacobian.setZero(rows, 3 + clock_number);
+    observation.resize(rows);
+    weight.resize(rows);
+    for (u16 sat = 0; sat < sat_number; ++sat) {
+      group.push_back(sat * sig_per_sat);
+      utils::NavVector3f64 los(noise(gen), noise(gen), std::abs(noise(gen)));
+      los.normalize();
+      for (u8 k = 0; k < sig_per_sat; ++k) {
+        u16 row = sat * sig_per_sat + k;
+        jacobian.row(row).head(3) = -los;
+        jacobian(row, 3 + sat % clock_number) = 1;
+        weight(row) = 1.0 / (k + 1);
+        observation(row) = noise(gen) / std::sqrt(weight(row));
+      }
+    }
+    group.push_back(rows);
+    observation.segment(group[sat_number / 2], sig_per_sat).array() += 50.0;  // blunder
+  }
+
+  utils::NavMatrixDf64 jacobian;
+  utils::NavVectorDf64 observation, weight;
+  std::vector<u16> group;
+};
+
+static void wls_solve(benchmark::State& state) {
+  RaimModel model(state.range(0));
+  for (auto _ : state) {
+    utils::NavMatrixDf64 normal = model.jacobian.transpose() * model.weight.asDiagonal() * model.jacobian;
+    utils::NavVectorDf64 dx =
+        normal.llt().solve(model.jacobian.transpose() * (model.weight.array() * model.observation.array()).matrix());
+    benchmark::DoNotOptimize(dx);
+  }
+}
+
+BENCHMARK(wls_solve)->Arg(12)->Arg(24)->Arg(48)->Iterations(10000)->MinWarmUpTime(1);
+
+// leave-one-out by rank-one downdates of a single cholesky factor
+static void fde_downdate(benchmark::State& state) {
+  RaimModel model(state.range(0));
+  Fde fde(model.jacobian.cols());
+  for (auto _ : state) {
+    fde.factorize(model.jacobian, model.weight, model.observation);
+    auto stat = fde.statistic();
+    benchmark::DoNotOptimize(stat);
+    auto worst = fde.worst_group(model.group);
+    benchmark::DoNotOptimize(worst);
+  }
+}
+
+BENCHMARK(fde_downdate)->Arg(12)->Arg(24)->Arg(48)->Iterations(10000)->MinWarmUpTime(1);
+
+// leave-one-out by re-solving the normal equation for every satellite
+static void fde_brute_force(benchmark::State& state) {
+  RaimModel model(state.range(0));
+  for (auto _ : state) {
+    i32 worst = -1;
+    f64 min_sse = std::numeric_limits<f64>::infinity();
+    for (size_t g = 0; g + 1 < model.group.size(); ++g) {
+      utils::NavVectorDf64 weight = model.weight;
+      weight.segment(model.group[g], model.group[g + 1] - model.group[g]).setZero();
+      utils::NavMatrixDf64 normal = model.jacobian.transpose() * weight.asDiagonal() * model.jacobian;
+      utils::NavVectorDf64 dx =
+          normal.llt().solve(model.jacobian.transpose() * (weight.array() * model.observation.array()).matrix());
+      f64 sse = ((model.observation - model.jacobian * dx).array().square() * weight.array()).sum();
+      if (sse < min_sse) min_sse = sse, worst = static_cast<i32>(g);
+    }
+    benchmark::DoNotOptimize(worst);
+  }
+}
+
+BENCHMARK(fde_brute_force)->Arg(12)->Arg(24)->Arg(48)->Iterations(10000)->MinWarmUpTime(1);
+
+BENCHMARK_MAIN();
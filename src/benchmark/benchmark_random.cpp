@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "sensors/gnss/random.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+
+static constexpr u16 Signals = 60;
+
+struct Epoch {
+  Epoch() {
+    std::mt19937 gen(20241212);
+    std::uniform_real_distribution<f64> el(0.1, 1.5), snr(25, 50);
+    signals.resize(Signals);
+    for (auto& sig : signals) {
+      sig.snr = static_cast<f32>(snr(gen));
+      sigs.push_back(&sig), elevation.push_back(el(gen));
+    }
+  }
+
+  std::vector<Sig> signals;
+  std::vector<Sig*> sigs;
+  std::vector<f64> elevation;
+};
+
+// variances of the signals of an epoch, a handler per signal or the epoch at once
+static void random_model(benchmark::State& state, RandomModelEnum model, bool batched) {
+  Epoch epoch;
+  auto expression = RandomExpression::compile("(carrier ? 0.003^2 : 0.3^2) * (1 + 1 / sin(el)^2)");
+  auto handler = GnssRandomHandler{}.set_model(model).set_expression(expression);
+  for (auto _ : state) {
+    if (batched) {
+      handler.handle(epoch.sigs, epoch.elevation);
+    } else {
+      for (u16 i = 0; i < Signals; ++i) {
+        GnssRandomHandler{}.set_model(model).set_expression(expression).handle({&epoch.sigs[i], 1},
+                                                                              {&epoch.elevation[i], 1});
+      }
+    }
+    benchmark::DoNotOptimize(epoch.signals.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Signals);
+}
+
+BENCHMARK_CAPTURE(random_model, elevation_per_signal, RandomModelEnum::ELEVATION_DEPENDENT, false);
+BENCHMARK_CAPTURE(random_model, elevation_batched, RandomModelEnum::ELEVATION_DEPENDENT, true);
+BENCHMARK_CAPTURE(random_model, snr_per_signal, RandomModelEnum::SNR_DEPENDENT, false);
+BENCHMARK_CAPTURE(random_model, snr_batched, RandomModelEnum::SNR_DEPENDENT, true);
+BENCHMARK_CAPTURE(random_model, custom_per_signal, RandomModelEnum::CUSTOM, false);
+BENCHMARK_CAPTURE(random_model, custom_batched, RandomModelEnum::CUSTOM, true);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "io/rtcm/rtcm3.hpp"
+#include "sensors/gnss/observation.hpp"
+
+using namespace navp;
+using namespace navp::io::rtcm;
+
+static constexpr u32 Epochs = 1000, Satellites = 12;
+
+// msm7 of 12 satellites and two signals, one epoch a second
+static auto recording() -> std::vector<u8> {
+  std::vector<u8> data;
+  for (u32 epoch = 0; epoch < Epochs; ++epoch) {
+    std::vector<u8> payload;
+    u32 pos = 0;
+    auto put = [&](i64 value, u32 len) {
+      for (u32 i = 0; i < len; ++i, ++pos) {
+        if (pos % 8 == 0) payload.push_back(0);
+        if ((static_cast<u64>(value) >> (len - 1 - i)) & 1) payload.back() |= 0x80 >> (pos % 8);
+      }
+    };
+    put(1077, 12), put(1, 12), put(100000000 + epoch * 1000, 30), put(0, 1 + 18);
+    for (u32 i = 0; i < 64; ++i) put(i < Satellites, 1);
+    for (u32 i = 1; i <= 32; ++i) put(i == 2 || i == 16, 1);
+    put(-1, 2 * Satellites);
+    auto fields = [&](i64 value, u32 len, u32 count) {
+      for (u32 i = 0; i < count; ++i) put(value, len);
+    };
+    for (u32 i = 0; i < Satellites; ++i) put(70 + i, 8);
+    fields(0, 4, Satellites), fields(512, 10, Satellites), fields(100, 14, Satellites);
+    fields(1000 + epoch, 20, 2 * Satellites), fields(2000 + epoch, 24, 2 * Satellites), fields(500, 10, 2 * Satellites);
+    fields(0, 1, 2 * Satellites), fields(720, 10, 2 * Satellites), fields(100, 15, 2 * Satellites);
+
+    auto size = payload.size();
+    std::vector<u8> frame{Rtcm3Decoder::Preamble, static_cast<u8>(size >> 8), static_cast<u8>(size)};
+    frame.insert(frame.end(), payload.begin(), payload.end());
+    auto crc = crc24q(frame);
+    frame.insert(frame.end(), {static_cast<u8>(crc >> 16), static_cast<u8>(crc >> 8), static_cast<u8>(crc)});
+    data.insert(data.end(), frame.begin(), frame.end());
+  }
+  return data;
+}
+
+// messages decoded into the observation record, fed in network sized chunks
+static void rtcm3_decode(benchmark::State& state) {
+  auto data = recording();
+  auto chunk = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    sensors::gnss::GnssObsRecord record(nullptr);
+    record.set_storage(5);
+    Rtcm3Decoder decoder;
+    decoder.set_observation(&record).set_reference_time(utils::GTime(utils::GWeek(2200), utils::GTow(100000.0)));
+    for (size_t pos = 0; pos < data.size(); pos += chunk) {
+      decoder.decode(std::span(data).subspan(pos, std::min(chunk, data.size() - pos)));
+    }
+    benchmark::DoNotOptimize(decoder.messages());
+  }
+  state.SetItemsProcessed(state.iterations() * Epochs);
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+BENCHMARK(rtcm3_decode)->Arg(1460)->Arg(65536)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,195 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "sensors/gnss/constants.hpp"
+#include "solution/rtk.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+using SystemPayload = solution::__RtkPayload::SystemPayload;
+
+// synthetic double difference model : 4 systems, 3 codes for each system
+struct RtkModel {
+  RtkModel(u8 sats_per_system) {
+    std::mt19937 gen(20241120);
+    std::uniform_real_distribution<f64> angle(0, 2 * EIGEN_PI), elevation(0.2, 1.5);
+    std::normal_distribution<f64> noise(0, 1);
+    const std::array<std::pair<ConstellationEnum, std::array<ObsCodeEnum, 3>>, 4> systems = {{
+        {ConstellationEnum::GPS, {ObsCodeEnum::L1C, ObsCodeEnum::L2W, ObsCodeEnum::L5Q}},
+        {ConstellationEnum::BDS, {ObsCodeEnum::L2I, ObsCodeEnum::L6I, ObsCodeEnum::L7I}},
+        {ConstellationEnum::GAL, {ObsCodeEnum::L1C, ObsCodeEnum::L5Q, ObsCodeEnum::L7Q}},
+        {ConstellationEnum::QZS, {ObsCodeEnum::L1C, ObsCodeEnum::L2L, ObsCodeEnum::L5Q}},
+    }};
+    rover = utils::CoordinateXyz(utils::NavVector3f64(-2267800.0, 5009340.0, 3220990.0));
+    base = utils::CoordinateXyz(utils::NavVector3f64(-2267810.0, 5009330.0, 3221000.0));
+    for (auto& [sys, codes] : systems) {
+      auto& payload = payloads.emplace_back();
+      for (u8 i = 0; i < sats_per_system; ++i) {
+        auto& eph = ephs.emplace_back(std::make_unique<EphemerisResult>());
+        eph->sv = Sv{.prn = static_cast<u8>(i + 1), .constellation = Constellation{.id = sys}};
+        f64 az = angle(gen), el = elevation(gen);
+        utils::NavVector3f64 los(std::cos(el) * std::sin(az), std::cos(el) * std::cos(az), std::sin(el));
+        eph->pos = utils::CoordinateXyz(utils::NavVector3f64(rover + 2.2e7 * los));
+        payload.public_view_satellites.emplace_back(eph->sv);
+        payload.rover_eph.emplace_back(eph.get());
+        payload.bt_base_satellites_distance.emplace_back((base - eph->pos).norm());
+      }
+      payload.available_code_set.insert(codes.begin(), codes.end());
+      for (u8 c = 0; c < payload.available_code_set.size(); ++c) {
+        for (u8 i = 0; i < sats_per_system; ++i) {
+          auto& rover_sig = sigs.emplace_back(std::make_unique<Sig>());
+          auto& base_sig = sigs.emplace_back(std::make_unique<Sig>());
+          rover_sig->pseudorange = 2.2e7 + noise(gen), base_sig->pseudorange = 2.2e7 + noise(gen);
+          rover_sig->carrier = 1.1e8 + noise(gen), base_sig->carrier = 1.1e8 + noise(gen);
+          rover_sig->code_var = base_sig->code_var = 0.09 + 0.01 * i;
+          rover_sig->phase_var = base_sig->phase_var = 9e-6 + 1e-6 * i;
+          payload.rover_sigs.emplace_back(rover_sig.get());
+          payload.base_sigs.emplace_back(base_sig.get());
+        }
+      }
+      ambiguity_size += payload.dd_ambiguity_size();
+    }
+    wls = std::make_unique<algorithm::WeightedLeastSquare<f64>>(3 + ambiguity_size, 2 * ambiguity_size,
+                                                                spdlog::default_logger());
+    wls->parameter().block(0, 0, 3, 1) = rover;
+  }
+
+  void build() {
+    u16 index = 0;
+    for (auto& payload : payloads) {
+      payload.build_dd_model(wls.get(), index, rover);
+      index += payload.dd_ambiguity_size();
+    }
+  }
+
+  void update() {
+    u16 index = 0;
+    for (auto& payload : payloads) {
+      payload.update_dd_geometry(wls.get(), index, rover);
+      index += payload.dd_ambiguity_size();
+    }
+  }
+
+  // weight of every system, closed form
+  void build_weight() {
+    u16 index = 0;
+    for (auto& payload : payloads) {
+      auto row_index = 2 * index, row_size = 2 * payload.dd_ambiguity_size();
+      payload.build_dd_weight(wls->weight().block(row_index, row_index, row_size, row_size));
+      index += payload.dd_ambiguity_size();
+    }
+  }
+
+  // weight of every system, dense covariance then inverse
+  void build_weight_dense() {
+    u16 index = 0;
+    for (auto& payload : payloads) {
+      if (!payload.is_bt_sta_sd_random_cached()) payload.update_bt_sta_sd_random_cache();
+      auto row_index = 2 * index, row_size = 2 * payload.dd_ambiguity_size();
+      auto dd_sats = payload.public_view_satellites.size() - 1;
+      utils::NavMatrixDf64 covariance = utils::NavMatrixDf64::Zero(row_size, row_size);
+      for (u8 c = 0; c < payload.available_code_set.size(); ++c) {
+        auto ref_sv_index = c * payload.public_view_satellites.size();
+        auto& ref = payload.btsta_sd_random_cache->at(ref_sv_index);
+        auto pseudorange = covariance.block(2 * c * dd_sats, 2 * c * dd_sats, dd_sats, dd_sats);
+        auto carrier = covariance.block(2 * c * dd_sats + dd_sats, 2 * c * dd_sats + dd_sats, dd_sats, dd_sats);
+        pseudorange.array() = ref.pseudorange;
+        carrier.array() = ref.carrier;
+        for (u8 i = 0; i < dd_sats; ++i) {
+          pseudorange(i, i) += payload.btsta_sd_random_cache->at(ref_sv_index + i + 1).pseudorange;
+          carrier(i, i) += payload.btsta_sd_random_cache->at(ref_sv_index + i + 1).carrier;
+        }
+      }
+      wls->weight().block(row_index, row_index, row_size, row_size) = covariance.inverse();
+      index += payload.dd_ambiguity_size();
+    }
+  }
+
+  void reset_cache() {
+    for (auto& payload : payloads) {
+      payload.reset_dd_obs_cache();
+      payload.reset_bt_sta_sd_obs_cache();
+      payload.reset_bt_sta_sd_random_cache();
+    }
+  }
+
+  utils::CoordinateXyz rover, base;
+  std::vector<std::unique_ptr<EphemerisResult>> ephs;
+  std::vector<std::unique_ptr<Sig>> sigs;
+  std::vector<SystemPayload> payloads;
+  std::unique_ptr<algorithm::WeightedLeastSquare<f64>> wls;
+  u16 ambiguity_size = 0;
+};
+
+// rebuild the whole model every iteration, dropping the caches
+static void rtk_iteration_rebuild(benchmark::State& state) {
+  RtkModel model(state.range(0));
+  for (auto _ : state) {
+    model.reset_cache();
+    model.build();
+    model.wls->correct();
+  }
+}
+
+BENCHMARK(rtk_iteration_rebuild)->Arg(6)->Arg(10)->Iterations(1000)->MinWarmUpTime(1);
+
+// rebuild the whole model every iteration from the caches
+static void rtk_iteration_cached(benchmark::State& state) {
+  RtkModel model(state.range(0));
+  model.build();
+  for (auto _ : state) {
+    model.build();
+    model.wls->correct();
+  }
+}
+
+BENCHMARK(rtk_iteration_cached)->Arg(6)->Arg(10)->Iterations(1000)->MinWarmUpTime(1);
+
+// refresh only the geometry rows in place
+static void rtk_iteration_geometry(benchmark::State& state) {
+  RtkModel model(state.range(0));
+  model.build();
+  for (auto _ : state) {
+    model.update();
+    model.wls->correct();
+  }
+}
+
+BENCHMARK(rtk_iteration_geometry)->Arg(6)->Arg(10)->Iterations(1000)->MinWarmUpTime(1);
+
+// model refresh only, without the least square correction
+static void rtk_geometry_only(benchmark::State& state) {
+  RtkModel model(state.range(0));
+  model.build();
+  for (auto _ : state) {
+    model.update();
+    benchmark::DoNotOptimize(model.wls->observation().data());
+  }
+}
+
+BENCHMARK(rtk_geometry_only)->Arg(6)->Arg(10)->Iterations(1000)->MinWarmUpTime(1);
+
+// dd weight of 4 systems x 3 codes, dense inverse of the covariance
+static void rtk_weight_dense(benchmark::State& state) {
+  RtkModel model(state.range(0));
+  for (auto _ : state) {
+    model.build_weight_dense();
+    benchmark::DoNotOptimize(model.wls->weight().data());
+  }
+}
+
+BENCHMARK(rtk_weight_dense)->Arg(6)->Arg(10)->Iterations(1000)->MinWarmUpTime(1);
+
+// dd weight of 4 systems x 3 codes, Sherman-Morrison closed form
+static void rtk_weight_closed_form(benchmark::State& state) {
+  RtkModel model(state.range(0));
+  for (auto _ : state) {
+    model.build_weight();
+    benchmark::DoNotOptimize(model.wls->weight().data());
+  }
+}
+
+BENCHMARK(rtk_weight_closed_form)->Arg(6)->Arg(10)->Iterations(1000)->MinWarmUpTime(1);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "io/custom/solution_stream.hpp"
+#include "io/custom/solution_writer.hpp"
+#include "solution/solution.hpp"
+
+using namespace navp;
+using namespace navp::io::custom;
+
+static constexpr size_t Records = 10000;
+
+static auto solutions() -> std::vector<solution::PvtSolutionRecord> {
+  std::vector<solution::PvtSolutionRecord> records(Records);
+  for (size_t i = 0; i < Records; ++i) {
+    auto& record = records[i];
+    record.time = EpochUtc::from_seconds(1.4e9 + static_cast<f64>(i) * 0.05);
+    record.position = utils::CoordinateXyz(utils::NavVector3f64(-2267750.1234 + i * 1e-3, 5009154.5678, 3221290.9));
+    record.velocity = utils::CoordinateXyz(utils::NavVector3f64(0.0125, -0.5, 12.75));
+    record.blh = record.position.to_blh();
+    record.mode = solution::SolutionModeEnum::SINGLE;
+    record.ns = 24;
+  }
+  return records;
+}
+
+static auto output_file() -> std::string {
+  return (std::filesystem::temp_directory_path() / "navp_benchmark.sol").string();
+}
+
+// records written by the solving thread through std::format
+static void solution_stream(benchmark::State& state) {
+  auto records = solutions();
+  for (auto _ : state) {
+    SolutionStream stream(output_file(), std::ios::out);
+    for (const auto& record : records) record.put_record(stream);
+  }
+  state.SetItemsProcessed(state.iterations() * Records);
+}
+
+// records pushed by the solving thread, `close` included
+static void solution_writer(benchmark::State& state, SolutionFileEnum file_type) {
+  auto records = solutions();
+  for (auto _ : state) {
+    SolutionWriter writer(output_file(), file_type);
+    for (const auto& record : records) writer.push(record);
+  }
+  state.SetItemsProcessed(state.iterations() * Records);
+}
+
+BENCHMARK(solution_stream)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(solution_writer, text, SolutionFileEnum::TEXT)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(solution_writer, binary, SolutionFileEnum::BINARY)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "sensors/gnss/atmosphere.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+
+// satellites of one epoch above the horizon
+static auto satellites(u16 number) -> std::vector<EphemerisResult> {
+  std::mt19937 gen(20241212);
+  std::uniform_real_distribution<f64> elevation(0.1, 1.5);
+  std::vector<EphemerisResult> sv_info(number);
+  for (auto& info : sv_info) info.elevation = elevation(gen);
+  return sv_info;
+}
+
+// zenith delays and mapping functions again for every satellite
+static void trop_per_satellite(benchmark::State& state) {
+  auto sv_info = satellites(static_cast<u16>(state.range(0)));
+  auto epoch = EpochUtc::from_date(navp::details::Date{.year = 2021, .month = 11, .day = 14});
+  utils::CoordinateBlh pos(0.53, 1.99, 30.0);
+  std::vector<f64> trop(sv_info.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < sv_info.size(); ++i) {
+      trop[i] = AtmosphereHandler{}.set_time(epoch).set_sv_info(&sv_info[i]).handle_trop(&pos);
+    }
+    benchmark::DoNotOptimize(trop.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// zenith delays once per station, mapping functions of the epoch at once
+static void trop_batched(benchmark::State& state) {
+  auto sv_info = satellites(static_cast<u16>(state.range(0)));
+  auto epoch = EpochUtc::from_date(navp::details::Date{.year = 2021, .month = 11, .day = 14});
+  utils::CoordinateBlh pos(0.53, 1.99, 30.0);
+  std::vector<f64> elevation, trop(sv_info.size());
+  for (auto& info : sv_info) elevation.push_back(info.elevation);
+  TropHandler handler;
+  for (auto _ : state) {
+    handler.set_station(epoch, pos).handle(elevation, trop);
+    benchmark::DoNotOptimize(trop.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(trop_per_satellite)->RangeMultiplier(2)->Range(8, 64);
+BENCHMARK(trop_batched)->RangeMultiplier(2)->Range(8, 64);
+
+BENCHMARK_MAIN();
@@ -33,4 +33,130 @@ target("benchmark_sv")
     add_files("benchmark_sv.cpp")
     add_packages("benchmark")
     add_deps("nav_core")
-target_end()
\ No newline at end of file
+target_end()
+
+target("benchmark_raim")
+    set_kind("binary")
+    add_files("benchmark_raim.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_rtk")
+    set_kind("binary")
+    add_files("benchmark_rtk.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_ambiguity")
+    set_kind("binary")
+    add_files("benchmark_ambiguity.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core","rtklib")
+target_end()
+
+target("benchmark_cycle_slip")
+    set_kind("binary")
+    add_files("benchmark_cycle_slip.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_base_station")
+    set_kind("binary")
+    add_files("benchmark_base_station.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_network_rtk")
+    set_kind("binary")
+    add_files("benchmark_network_rtk.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_factor_graph")
+    set_kind("binary")
+    add_files("benchmark_factor_graph.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_batch_factor")
+    set_kind("binary")
+    add_files("benchmark_batch_factor.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_troposphere")
+    set_kind("binary")
+    add_files("benchmark_troposphere.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_ionex")
+    set_kind("binary")
+    add_files("benchmark_ionex.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_broadcast_iono")
+    set_kind("binary")
+    add_files("benchmark_broadcast_iono.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_random")
+    set_kind("binary")
+    add_files("benchmark_random.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_mask_filter")
+    set_kind("binary")
+    add_files("benchmark_mask_filter.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_solution_writer")
+    set_kind("binary")
+    add_files("benchmark_solution_writer.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_logger")
+    set_kind("binary")
+    add_files("benchmark_logger.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_rtcm3")
+    set_kind("binary")
+    add_files("benchmark_rtcm3.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_ntrip")
+    set_kind("binary")
+    add_files("benchmark_ntrip.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
+
+target("benchmark_epoch_assembler")
+    set_kind("binary")
+    add_files("benchmark_epoch_assembler.cpp")
+    add_packages("benchmark")
+    add_deps("nav_core")
+target_end()
@@ -1,43 +1,131 @@
 #pragma once
 
+#include <chrono>
+#include <limits>
+
 #include "utils/eigen.hpp"
 #include "utils/macro.hpp"
 
 namespace navp::algorithm {
 
+// Integer least square ambiguity resolution, LAMBDA decorrelation and MLAMBDA search
+// - workspaces are allocated once for `capacity` ambiguities, resolving a problem up to that size
+//   does not allocate
+// - partial ambiguity resolution : only the decorrelated ambiguities of the smallest conditional
+//   variances are fixed, the subset is selected by the bootstrapped success rate and the conditional
+//   variance, then shrunk one by one while the ratio test fails
+// - the search is bounded by a loop budget and a deadline shared by all subsets of one resolution,
+//   so the worst-case latency is predictable
 class NAVP_EXPORT AmbiguityFixer {
  public:
-  AmbiguityFixer(utils::NavVector3f64 float_baseline, f64* float_ambiguity, const utils::NavMatrixDf64& float_qxx);
+  struct Options {
+    f64 ratio_threshold = 3.0;                                // ratio test threshold
+    f64 min_success_rate = 0.999;                             // bootstrapped success rate of the fixed subset
+    f64 max_variance = std::numeric_limits<f64>::infinity();  // max conditional variance to fix (cycle^2)
+    u16 min_fixed = 4;                                        // min number of fixed ambiguities
+    u32 max_search_loop = 10000;                              // search loop budget
+    std::chrono::microseconds max_search_time{2000};          // search time budget
+  };
+
+  enum class State : u8 {
+    Idle = 0,
+    InvalidInput = 1,     // size mismatch or covariance not positive definite
+    LowSuccessRate = 2,   // no subset reaches the success rate
+    SearchExhausted = 3,  // loop or time budget exhausted
+    RatioFail = 4,        // no subset passes the ratio test
+    Fixed = 5,
+  };
+
+  AmbiguityFixer() noexcept = default;
+
+  AmbiguityFixer(u16 capacity) noexcept;
+
+  AmbiguityFixer(u16 capacity, const Options& options) noexcept;
+
+  // preallocate the workspace for `capacity` ambiguities
+  void reserve(u16 capacity) noexcept;
 
-  bool fix() noexcept;
+  inline u16 capacity() const noexcept { return static_cast<u16>(D_.size()); }
+
+  inline Options& options() noexcept { return options_; }
+
+  inline const Options& options() const noexcept { return options_; }
+
+  // resolve the float ambiguities (cycle) with their covariance (cycle^2)
+  bool resolve(const Eigen::Ref<const utils::NavVectorDf64>& float_ambiguity,
+               const Eigen::Ref<const utils::NavMatrixDf64>& float_qaa) noexcept;
+
+  // resolve the ambiguities and fix the baseline, `float_qxx` is the covariance of
+  // | baseline (3) | ambiguities (n) |
+  bool fix(const utils::NavVector3f64& float_baseline, const Eigen::Ref<const utils::NavVectorDf64>& float_ambiguity,
+           const Eigen::Ref<const utils::NavMatrixDf64>& float_qxx) noexcept;
+
+  inline State state() const noexcept { return state_; }
 
   inline f64 ratio() const noexcept { return ratio_; }
 
+  // bootstrapped success rate of the fixed subset
+  inline f64 success_rate() const noexcept { return success_rate_; }
+
+  // number of fixed (decorrelated) ambiguities, equals to the ambiguity size for a full fix
+  inline u16 fixed_size() const noexcept { return fixed_size_; }
+
+  // search loops of the last resolution
+  inline u32 search_loop() const noexcept { return search_loop_; }
+
+  // ambiguities conditioned on the fixed subset, integers for a full fix
+  inline auto fixed_ambiguity() const noexcept { return fixed_ambiguity_.head(size_); }
+
   inline auto fixed_baseline() const noexcept -> const utils::NavVector3f64& { return fixed_baseline_; }
 
-  inline auto fixed_ambiguity() const noexcept -> const utils::NavVectorDf64& { return fixed_ambiguity_; }
+  inline auto fixed_qbb() const noexcept -> const utils::NavMatrix33f64& { return fixed_qbb_; }
 
   ~AmbiguityFixer() = default;
 
  private:
-  bool _valid() const noexcept;
+  static constexpr u16 Candidates = 2;  // candidates kept by the search, the best two for the ratio test
 
-  utils::NavMatrixDf64 _construct_k1() const noexcept;  // a = K1 * x
-  utils::NavMatrixDf64 _construct_k2() const noexcept;  // b = K2 * x
+  // Q = L'diag(D)L
+  bool _factorize(const Eigen::Ref<const utils::NavMatrixDf64>& float_qaa) noexcept;
+
+  // lambda reduction, z = Z'a, Qz = Z'QZ = L'diag(D)L
+  void _reduction() noexcept;
+
+  void _gauss(u16 i, u16 j) noexcept;
+
+  void _permute(u16 j, f64 delta) noexcept;
+
+  // size of the largest trailing subset passing the success rate and variance test
+  u16 _select_subset() noexcept;
+
+  // mlambda search over the trailing subset [begin, size)
+  bool _search(u16 begin) noexcept;
+
+  // t = Qz^-1 v over the trailing subset [begin, size), in place
+  void _solve_subset(u16 begin, Eigen::Ref<utils::NavVectorDf64> v) const noexcept;
+
+  Options options_;
+  State state_ = State::Idle;
+  u16 size_ = 0, fixed_size_ = 0;
+  u32 search_loop_ = 0;
+  f64 ratio_ = 0, success_rate_ = 0;
+  std::chrono::steady_clock::time_point deadline_;
+
+  utils::NavMatrixDf64 L_;                     // unit lower triangular factor    L
+  utils::NavVectorDf64 D_;                     // conditional variance            D
+  utils::NavMatrixDf64 Z_;                     // integer transform               z = Z'a
+  utils::NavVectorDf64 z_;                     // decorrelated float ambiguity    z
+  utils::NavMatrixDf64 candidates_;            // decorrelated integer candidates
+  utils::NavVectorf64<Candidates> residuals_;  // squared norm of the candidates
+  utils::NavMatrixDf64 qzb_;                   // Qzb of the fixed subset
+
+  // search and conditioning workspace
+  utils::NavMatrixDf64 S_;
+  utils::NavVectorDf64 dist_, zb_, zi_, step_, t_, u_;
 
-  enum class State : u8 {
-    InitializeSucceed = 1,
-    InitializeFail = 2,
-    FixSuccess = 3,
-    FixFail = 4,
-  } state_{1};
-
-  f32 ratio_{1.0f};
-  utils::NavVector3f64 float_baseline_, fixed_baseline_;
-  Eigen::Map<utils::NavVectorDf64> float_ambiguity_;
   utils::NavVectorDf64 fixed_ambiguity_;
-  const utils::NavMatrixDf64* float_qxx_;
-  utils::NavMatrix33f64 float_qbb_, fixed_qbb_;
+  utils::NavVector3f64 fixed_baseline_;
+  utils::NavMatrix33f64 fixed_qbb_;
 };
 
 }  // namespace navp::algorithm
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <Eigen/Eigen>
+
+#include "utils/types.hpp"
+
+namespace navp::algorithm {
+
+// weight (inverse covariance) of n double differences sharing one reference
+// - covariance   Q = D + a * 11',  D = diag(d_1, ..., d_n), a = single difference variance of the reference
+// - weight       P = D^-1 - (D^-1 1)(D^-1 1)' / (1/a + sum(1/d_i))        (Sherman-Morrison)
+// O(n^2) and no allocation, the result is written into `weight` (n x n)
+template <typename WeightT, typename VarianceT>
+void dd_weight(Eigen::Block<WeightT> weight, f64 ref_variance, const Eigen::MatrixBase<VarianceT>& mov_variance) {
+  auto n = mov_variance.size();
+  f64 s = 1.0 / ref_variance;
+  // diagonal holds D^-1 until the end
+  for (Eigen::Index i = 0; i < n; ++i) {
+    weight(i, i) = 1.0 / mov_variance(i);
+    s += weight(i, i);
+  }
+  for (Eigen::Index j = 0; j < n; ++j) {
+    for (Eigen::Index i = j + 1; i < n; ++i) {
+      weight(i, j) = weight(j, i) = -weight(i, i) * weight(j, j) / s;
+    }
+  }
+  for (Eigen::Index i = 0; i < n; ++i) weight(i, i) -= weight(i, i) * weight(i, i) / s;
+}
+
+}  // namespace navp::algorithm
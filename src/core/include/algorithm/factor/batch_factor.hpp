@@ -0,0 +1,222 @@
+#pragma once
+
+#include <ceres/cost_function.h>
+
+#include <vector>
+
+#include "utils/eigen.hpp"
+#include "utils/macro.hpp"
+
+namespace navp::fgo {
+
+namespace details {
+
+using BatchArray = Eigen::Map<const Eigen::ArrayXd>;
+using BatchJacobian = Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, 3, Eigen::RowMajor>>;
+
+// satellite positions of a batch stored column wise
+struct BatchSatellites {
+  inline void clear() noexcept { x.clear(), y.clear(), z.clear(); }
+
+  inline void push_back(const utils::NavVector3f64& pos) {
+    x.push_back(pos.x()), y.push_back(pos.y()), z.push_back(pos.z());
+  }
+
+  // satellite to receiver vectors (dx, dy, dz) and distances of the batch at `position`
+  inline void geometry(const double* position, Eigen::ArrayX4d& out) const {
+    auto n = static_cast<Eigen::Index>(x.size());
+    if (out.rows() != n) out.resize(n, 4);
+    out.col(0) = position[0] - BatchArray(x.data(), n);
+    out.col(1) = position[1] - BatchArray(y.data(), n);
+    out.col(2) = position[2] - BatchArray(z.data(), n);
+    out.col(3) = (out.col(0).square() + out.col(1).square() + out.col(2).square()).sqrt();
+  }
+
+  std::vector<double> x, y, z;  // double as the parameter blocks they are evaluated against
+};
+
+}  // namespace details
+
+//   Pseudorange factor of every satellite of an epoch
+//   Discription      Dimension         Meaning
+// - Residual            n          Pseudorange residuals
+// - Parameter1          3          ECEF coordinate parameter(XYZ,m)
+// - Parameter2..        1          receiver clock bias of each constellation(m)
+// the satellites are stored column wise and evaluated as array expressions, one residual block for the epoch
+struct NAVP_EXPORT PseudorangeBatchFactor : ceres::CostFunction {
+  explicit PseudorangeBatchFactor(u8 clock_number = 1) { reset(clock_number); }
+
+  ~PseudorangeBatchFactor() override = default;
+
+  // drop the satellites, only when the factor is not in a problem
+  void reset(u8 clock_number) {
+    sv_pos.clear(), pseudorange.clear(), weight.clear(), clock.clear();
+    set_num_residuals(0);
+    mutable_parameter_block_sizes()->assign(1 + clock_number, 1);
+    mutable_parameter_block_sizes()->front() = 3;
+  }
+
+  // corrected pseudorange of a satellite, `clock` is the index of its clock parameter block (from 0)
+  void add(const utils::NavVector3f64& _sv_pos, f64 _pseudorange, f64 _std, u8 _clock) {
+    sv_pos.push_back(_sv_pos);
+    pseudorange.push_back(_pseudorange), weight.push_back(1.0 / _std), clock.push_back(_clock);
+    set_num_residuals(static_cast<int>(pseudorange.size()));
+  }
+
+  inline u8 clock_number() const noexcept { return static_cast<u8>(parameter_block_sizes().size() - 1); }
+
+  bool Evaluate(double const* const* parameters, double* residuals, double** jacobians) const override {
+    if (!parameters || !parameters[0]) return false;
+    auto n = static_cast<Eigen::Index>(pseudorange.size());
+    sv_pos.geometry(parameters[0], geometry_);
+    Eigen::Map<Eigen::ArrayXd> residual(residuals, n);
+    for (Eigen::Index i = 0; i < n; ++i) residual[i] = parameters[1 + clock[i]][0];
+    auto w = details::BatchArray(weight.data(), n);
+    residual = (details::BatchArray(pseudorange.data(), n) - geometry_.col(3) - residual) * w;
+    if (!jacobians) return true;
+    // set parameter[0] jacobians
+    if (jacobians[0]) {
+      details::BatchJacobian jacobian(jacobians[0], n, 3);
+      auto scale = -w / geometry_.col(3);
+      for (int k = 0; k < 3; ++k) jacobian.col(k) = (geometry_.col(k) * scale).matrix();
+    }
+    // set clock jacobians
+    for (u8 k = 0; k < clock_number(); ++k) {
+      if (!jacobians[1 + k]) continue;
+      Eigen::Map<Eigen::ArrayXd> jacobian(jacobians[1 + k], n);
+      for (Eigen::Index i = 0; i < n; ++i) jacobian[i] = clock[i] == k ? -w[i] : 0.0;
+    }
+    return true;
+  }
+
+  details::BatchSatellites sv_pos;  //< satellite positions
+  std::vector<double> pseudorange;  //< corrected pseudorange
+  std::vector<double> weight;       //< 1 / std
+  std::vector<u8> clock;            //< clock parameter block of each satellite
+
+ private:
+  mutable Eigen::ArrayX4d geometry_;  //< dx, dy, dz, distance of the last evaluation
+};
+
+//   Doppler factor of every satellite of an epoch
+//   Discription      Dimension         Meaning
+// - Residual            n          range rate residuals
+// - Parameter1          3          ECEF velocity parameter(m/s)
+// - Parameter2          1          receiver clock drift(m/s)
+// the range rate is corrected by the satellite velocity and clock drift, see `add`
+struct NAVP_EXPORT DopplerBatchFactor : ceres::CostFunction {
+  DopplerBatchFactor() {
+    mutable_parameter_block_sizes()->assign({3, 1});
+    reset();
+  }
+
+  ~DopplerBatchFactor() override = default;
+
+  // drop the satellites, only when the factor is not in a problem
+  void reset() {
+    los_x.clear(), los_y.clear(), los_z.clear(), range_rate.clear(), weight.clear();
+    set_num_residuals(0);
+  }
+
+  // `los` is the unit vector from the satellite to the receiver, the range rate is -lambda * doppler +
+  // los.dot(sv_vel) + c * fd_dtsv
+  void add(const utils::NavVector3f64& los, f64 _range_rate, f64 _std) {
+    los_x.push_back(los.x()), los_y.push_back(los.y()), los_z.push_back(los.z());
+    range_rate.push_back(_range_rate), weight.push_back(1.0 / _std);
+    set_num_residuals(static_cast<int>(range_rate.size()));
+  }
+
+  bool Evaluate(double const* const* parameters, double* residuals, double** jacobians) const override {
+    if (!parameters || !parameters[0] || !parameters[1]) return false;
+    auto n = static_cast<Eigen::Index>(range_rate.size());
+    auto x = details::BatchArray(los_x.data(), n), y = details::BatchArray(los_y.data(), n),
+         z = details::BatchArray(los_z.data(), n), w = details::BatchArray(weight.data(), n);
+    const double* v = parameters[0];
+    Eigen::Map<Eigen::ArrayXd> residual(residuals, n);
+    residual = (details::BatchArray(range_rate.data(), n) - x * v[0] - y * v[1] - z * v[2] - parameters[1][0]) * w;
+    if (!jacobians) return true;
+    if (jacobians[0]) {
+      details::BatchJacobian jacobian(jacobians[0], n, 3);
+      jacobian.col(0) = (-x * w).matrix(), jacobian.col(1) = (-y * w).matrix(), jacobian.col(2) = (-z * w).matrix();
+    }
+    if (jacobians[1]) {
+      Eigen::Map<Eigen::ArrayXd> jacobian(jacobians[1], n);
+      jacobian = -w;
+    }
+    return true;
+  }
+
+  std::vector<double> los_x, los_y, los_z;  //< satellite to receiver unit vectors
+  std::vector<double> range_rate;           //< corrected range rate
+  std::vector<double> weight;               //< 1 / std
+};
+
+//   Double differenced carrier factor of every satellite pair of an epoch
+//   Discription      Dimension         Meaning
+// - Residual            n          dd carrier residuals(m)
+// - Parameter1          3          ECEF coordinate parameter(XYZ,m)
+// - Parameter2          n          dd ambiguity of each pair(cycle)
+// the dd carrier is corrected by the base station ranges, the dd correlation is not weighted
+struct NAVP_EXPORT DdCarrierBatchFactor : ceres::CostFunction {
+  DdCarrierBatchFactor() {
+    mutable_parameter_block_sizes()->assign({3, 0});
+    reset();
+  }
+
+  ~DdCarrierBatchFactor() override = default;
+
+  // drop the satellite pairs, only when the factor is not in a problem
+  void reset() {
+    ref_sv_pos.clear(), sv_pos.clear(), dd_carrier.clear(), wave_length.clear(), weight.clear();
+    set_num_residuals(0);
+    (*mutable_parameter_block_sizes())[1] = 0;
+  }
+
+  // dd carrier of `sv_pos` against `ref_sv_pos` (m) : rover minus base single differences, the base ranges removed
+  void add(const utils::NavVector3f64& _ref_sv_pos, const utils::NavVector3f64& _sv_pos, f64 _dd_carrier,
+           f64 _wave_length, f64 _std) {
+    ref_sv_pos.push_back(_ref_sv_pos), sv_pos.push_back(_sv_pos);
+    dd_carrier.push_back(_dd_carrier), wave_length.push_back(_wave_length), weight.push_back(1.0 / _std);
+    auto n = static_cast<int>(dd_carrier.size());
+    set_num_residuals(n);
+    (*mutable_parameter_block_sizes())[1] = n;
+  }
+
+  bool Evaluate(double const* const* parameters, double* residuals, double** jacobians) const override {
+    if (!parameters || !parameters[0] || !parameters[1]) return false;
+    auto n = static_cast<Eigen::Index>(dd_carrier.size());
+    ref_sv_pos.geometry(parameters[0], ref_geometry_);
+    sv_pos.geometry(parameters[0], geometry_);
+    auto lambda = details::BatchArray(wave_length.data(), n), w = details::BatchArray(weight.data(), n);
+    auto ambiguity = details::BatchArray(parameters[1], n);
+    Eigen::Map<Eigen::ArrayXd> residual(residuals, n);
+    auto dd_distance = geometry_.col(3) - ref_geometry_.col(3);
+    residual = (details::BatchArray(dd_carrier.data(), n) - dd_distance - lambda * ambiguity) * w;
+    if (!jacobians) return true;
+    // set parameter[0] jacobians, unit vector of the reference satellite minus the one of the moving satellite
+    if (jacobians[0]) {
+      details::BatchJacobian jacobian(jacobians[0], n, 3);
+      auto ref_scale = w / ref_geometry_.col(3), scale = w / geometry_.col(3);
+      for (int k = 0; k < 3; ++k) {
+        jacobian.col(k) = (ref_geometry_.col(k) * ref_scale - geometry_.col(k) * scale).matrix();
+      }
+    }
+    // row major n x n, one ambiguity for each pair
+    if (jacobians[1]) {
+      Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> jacobian(jacobians[1], n, n);
+      jacobian.setZero();
+      jacobian.diagonal() = (-lambda * w).matrix();
+    }
+    return true;
+  }
+
+  details::BatchSatellites ref_sv_pos, sv_pos;  //< reference and moving satellite positions
+  std::vector<double> dd_carrier;               //< corrected dd carrier (m)
+  std::vector<double> wave_length;              //< wave length of each pair (m)
+  std::vector<double> weight;                   //< 1 / std
+
+ private:
+  mutable Eigen::ArrayX4d ref_geometry_, geometry_;  //< dx, dy, dz, distance of the last evaluation
+};
+
+}  // namespace navp::fgo
@@ -11,9 +11,9 @@ struct NAVP_EXPORT DdCarrierFactor : ceres::SizedCostFunction<1, 3, 1, 1> {
   ~DdCarrierFactor() override = default;
 
   bool Evaluate(double const* const* parameters, double* residuals, double** jacobians) const override {
-    if (!jacobians || !jacobians[0]) return false;
     residuals[0] = dd_carrier - dd_carrier0;
     residuals[0] /= std;  // todo 此处可能存在问题
+    if (!jacobians || !jacobians[0]) return true;
     // set parameter[0] jacobians
     jacobians[0][0] = jaco00;
     jacobians[0][1] = jaco01;
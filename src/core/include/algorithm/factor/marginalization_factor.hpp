@@ -0,0 +1,37 @@
+#pragma once
+
+#include <ceres/sized_cost_function.h>
+
+#include "utils/eigen.hpp"
+#include "utils/macro.hpp"
+
+namespace navp::fgo {
+
+//   Prior of the marginalized states on the position of an epoch
+//   Discription      Dimension         Meaning
+// - Residual            3          r0 + sqrt_information * (x - x0)
+// - Parameter1          3          ECEF coordinate parameter(XYZ,m)
+// the information and gradient of the removed states are folded into (sqrt_information, r0) by the schur
+// complement, x0 is the linearization point
+struct NAVP_EXPORT MarginalizationFactor : ceres::SizedCostFunction<3, 3> {
+  ~MarginalizationFactor() override = default;
+
+  bool Evaluate(double const* const* parameters, double* residuals, double** jacobians) const override {
+    if (!parameters || !parameters[0]) return false;
+    Eigen::Map<const Eigen::Vector3d> x(parameters[0]);
+    Eigen::Map<Eigen::Vector3d> residual(residuals);
+    residual = residual0 + sqrt_information * (x - x0);
+    if (jacobians && jacobians[0]) {
+      Eigen::Map<Eigen::Matrix<double, 3, 3, Eigen::RowMajor>> jacobian(jacobians[0]);
+      jacobian = sqrt_information;
+    }
+    return true;
+  }
+
+  // double as the parameter block, set from the f64 schur complement
+  Eigen::Matrix3d sqrt_information = Eigen::Matrix3d::Zero();  //< upper cholesky factor of the prior
+  Eigen::Vector3d residual0 = Eigen::Vector3d::Zero();         //< residual at the linearization point
+  Eigen::Vector3d x0 = Eigen::Vector3d::Zero();                //< linearization point
+};
+
+}  // namespace navp::fgo
@@ -9,7 +9,6 @@ namespace navp::fgo {
 
 using utils::NavVector3f64;
 
-// todo
 //   Psedorange factor
 //   Discription      Dimension         Meaning
 // - Residual            1          Pseudorange residual
@@ -26,27 +25,29 @@ struct NAVP_EXPORT PseudorangeFactor : ceres::SizedCostFunction<1, 3, 1> {
     double dx2 = dx * dx, dy2 = dy * dy, dz2 = dz * dz, d = sqrt(dx2 + dy2 + dz2);
     residuals[0] = pseudorange - d - parameters[1][0];
     residuals[0] /= std;
-    if (!jacobians || !jacobians[0] || !jacobians[1]) return false;
+    if (!jacobians) return true;
     // set parameter[0] jacobians
-    double factor = 1.0 / d;
-    jacobians[0][0] = dx * factor;
-    jacobians[0][1] = dy * factor;
-    jacobians[0][1] = dz * factor;
+    if (jacobians[0]) {
+      double factor = -1.0 / (d * std);
+      jacobians[0][0] = dx * factor;
+      jacobians[0][1] = dy * factor;
+      jacobians[0][2] = dz * factor;
+    }
     // set parameter[1] jacobians
-    jacobians[1][0] = -1;
+    if (jacobians[1]) jacobians[1][0] = -1.0 / std;
     return true;
   }
 
-  static PseudorangeFactor* Create(const NavVector3f64* _sv_pos, f64 _pseudorange, f64 _var) {
-    return new PseudorangeFactor(_sv_pos, _pseudorange, _var);
+  static PseudorangeFactor* Create(const NavVector3f64* _sv_pos, f64 _pseudorange, f64 _std) {
+    return new PseudorangeFactor(_sv_pos, _pseudorange, _std);
   }
 
   const NavVector3f64* sv_pos;  //< satellite position
-  double_t pseudorange, std;    //< corrected pseudorange and its variances
+  double_t pseudorange, std;    //< corrected pseudorange and its standard deviation
 
  protected:
-  explicit PseudorangeFactor(const NavVector3f64* _sv_pos, f64 _pseudorange, f64 _var)
-      : sv_pos(_sv_pos), pseudorange(_pseudorange), std(_var) {}
+  explicit PseudorangeFactor(const NavVector3f64* _sv_pos, f64 _pseudorange, f64 _std)
+      : sv_pos(_sv_pos), pseudorange(_pseudorange), std(_std) {}
 };
 
 //   Double differenced pseudorange factor
@@ -57,13 +58,13 @@ struct NAVP_EXPORT DdPseudorangeFunctor : ceres::SizedCostFunction<1, 3, 1, 1> {
   virtual ~DdPseudorangeFunctor() = default;
 
   bool Evaluate(double const* const* parameters, double* residuals, double** jacobians) const override {
-    if (!jacobians || !jacobians[0]) return false;
     residuals[0] = dd_pseudorange - dd_pseudorange0;
     residuals[0] /= std;  // todo 此处可能存在问题
+    if (!jacobians || !jacobians[0]) return true;
     // set parameter[0] jacobians
     jacobians[0][0] = jaco00;
     jacobians[0][1] = jaco01;
-    jacobians[0][1] = jaco02;
+    jacobians[0][2] = jaco02;
     return true;
   }
 
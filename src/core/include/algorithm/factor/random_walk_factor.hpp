@@ -0,0 +1,43 @@
+#pragma once
+
+#include <ceres/sized_cost_function.h>
+
+#include "utils/eigen.hpp"
+#include "utils/macro.hpp"
+
+namespace navp::fgo {
+
+//   Position random walk factor between two epochs
+//   Discription      Dimension         Meaning
+// - Residual            3          position change / std
+// - Parameter1          3          ECEF coordinate of the previous epoch(XYZ,m)
+// - Parameter2          3          ECEF coordinate of the current epoch(XYZ,m)
+struct NAVP_EXPORT RandomWalkFactor : ceres::SizedCostFunction<3, 3, 3> {
+  ~RandomWalkFactor() override = default;
+
+  bool Evaluate(double const* const* parameters, double* residuals, double** jacobians) const override {
+    if (!parameters || !parameters[0] || !parameters[1]) return false;
+    for (int i = 0; i < 3; ++i) residuals[i] = (parameters[1][i] - parameters[0][i]) / std;
+    if (!jacobians) return true;
+    // row major 3x3 jacobians
+    for (int k = 0; k < 2; ++k) {
+      if (!jacobians[k]) continue;
+      Eigen::Map<Eigen::Matrix<double, 3, 3, Eigen::RowMajor>> jacobian(jacobians[k]);
+      jacobian.setIdentity();
+      jacobian *= (k == 0 ? -1.0 : 1.0) / std;
+    }
+    return true;
+  }
+
+  static RandomWalkFactor* Create(f64 _std) { return new RandomWalkFactor(_std); }
+
+  // reuse the factor for another pair of epochs
+  void reset(f64 _std) noexcept { std = _std; }
+
+  double_t std;  //< standard deviation of the position change
+
+ protected:
+  explicit RandomWalkFactor(f64 _std) : std(_std) {}
+};
+
+}  // namespace navp::fgo
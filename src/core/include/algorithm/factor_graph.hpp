@@ -1,35 +1,140 @@
 #pragma once
 
+#include <ceres/problem.h>
 #include <ceres/solver.h>
 
+#include <array>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "algorithm/factor/batch_factor.hpp"
+#include "algorithm/factor/marginalization_factor.hpp"
+#include "algorithm/factor/random_walk_factor.hpp"
 #include "algorithm/parameter_block.hpp"
+#include "utils/time.hpp"
 
 namespace navp::fgo {
 
 class FactorGraph;
 class GnssFactorGraph;
 
-class FactorGraph {
+// ceres problem kept alive between epochs, parameter blocks and residual blocks are added and removed in place
+// - cost functions are owned by the graph, so that they can be reused after their residual block is removed
+// - the latency of the last optimization is recorded
+class NAVP_EXPORT FactorGraph {
  public:
+  struct Options {
+    u16 threads = 1;                                             // ceres threads
+    ceres::LinearSolverType linear_solver = ceres::DENSE_SCHUR;  // linear solver
+    u16 max_iterations = 10;                                     // max iterations of one optimization
+  };
+
   FactorGraph();
 
+  explicit FactorGraph(const Options& options);
+
   virtual ~FactorGraph();
 
+  inline auto options() const noexcept -> const Options& { return options_; }
+
+  inline void set_options(const Options& options) noexcept { options_ = options; }
+
+  // optimize every state in the graph, false if the solution is not usable
+  bool optimize() noexcept;
+
+  inline auto summary() const noexcept -> const ceres::Solver::Summary& { return summary_; }
+
+  // wall time of the last optimization
+  inline auto latency() const noexcept -> std::chrono::nanoseconds { return latency_; }
+
  protected:
+  Options options_;
   ceres::Problem problem_;
-  ceres::Solver solver_;
+  ceres::Solver::Summary summary_;
+  std::chrono::nanoseconds latency_{0};
+};
+
+using utils::NavVector3f64;
+
+// pseudorange of one signal, corrected by the satellite clock and the atmosphere errors
+struct PseudorangeObservation {
+  NavVector3f64 sv_pos;  // satellite position
+  f64 pseudorange;       // corrected pseudorange (m)
+  f64 variance;          // pseudorange variance (m^2)
+  u8 clock;              // receiver clock parameter index, one per constellation
 };
 
-class GnssFactorGraph : public FactorGraph {
+// sliding window of receiver positions and clocks
+// | position(3) | clock(one per constellation) | for each epoch
+// - the pseudoranges of an epoch are one batched residual block, a position random walk links consecutive epochs
+// - once the window is full, the oldest epoch is marginalized into a prior on the position of the next one
+class NAVP_EXPORT GnssFactorGraph : public FactorGraph {
  public:
-  GnssFactorGraph();
+  static constexpr u8 DefaultWindowLength = 10, MaxClock = 21;
+  static constexpr f64 DefaultPositionNoise = 1e2;  // position random walk (m^2/s)
+
+  GnssFactorGraph(u8 window_length = DefaultWindowLength);
+
+  GnssFactorGraph(u8 window_length, const Options& options);
+
   virtual ~GnssFactorGraph() override;
 
-  void set_slide_window_length(this auto& self, u8 length) noexcept;
-  u8 slide_window_length(this const auto& self) noexcept;
+  // the window holds at least two epochs, the first ones are marginalized if it shrinks
+  void set_slide_window_length(u8 length) noexcept;
+
+  inline u8 slide_window_length() const noexcept { return window_length_; }
+
+  inline void set_position_noise(f64 noise) noexcept { position_noise_ = noise; }
+
+  // epochs in the window
+  inline size_t size() const noexcept { return window_.size(); }
+
+  // add an epoch to the window at `position`, the oldest epoch is marginalized if the window is full
+  void add_epoch(const EpochUtc& epoch, const NavVector3f64& position,
+                 std::span<const PseudorangeObservation> observations);
+
+  // optimized position of the latest epoch
+  auto position() const noexcept -> NavVector3f64;
+
+  // optimized receiver clock of the latest epoch (m), 0 if the clock is not observed
+  f64 clock(u8 index) const noexcept;
+
+  // drop every epoch and the prior
+  void clear() noexcept;
+
+ protected:
+  // the parameter blocks are double as ceres takes them, converted from and to f64 by the graph
+  struct State {
+    EpochUtc time;
+    std::array<double, 3> position;            // receiver position (m)
+    std::array<double, MaxClock> clock{};      // receiver clocks (m)
+    std::array<bool, MaxClock> clock_used{};   // clock parameter blocks in the problem
+    PseudorangeBatchFactor* factor = nullptr;  // pseudoranges of the epoch
+    RandomWalkFactor* motion = nullptr;        // random walk from the previous epoch
+  };
+
+  void marginalize_oldest() noexcept;
+
+  // remove the oldest epoch and give its factors back to the pools
+  void remove_oldest() noexcept;
+
+  PseudorangeBatchFactor* acquire_pseudorange(u8 clock_number);
+
+  RandomWalkFactor* acquire_random_walk(f64 std);
+
+  u8 window_length_;
+  f64 position_noise_ = DefaultPositionNoise;
+  std::deque<State> window_;  // states of the window, the addresses are stable for ceres
 
- private:
-  u8 window_length_;  ///> sliding window length
+  std::vector<std::unique_ptr<PseudorangeBatchFactor>> pseudorange_factors_;  // every pseudorange factor
+  std::vector<PseudorangeBatchFactor*> free_pseudorange_factors_;             // not in the problem
+  std::vector<std::unique_ptr<RandomWalkFactor>> random_walk_factors_;        // every random walk factor
+  std::vector<RandomWalkFactor*> free_random_walk_factors_;                   // not in the problem
+  MarginalizationFactor prior_;                                               // prior on the oldest epoch
+  ceres::ResidualBlockId prior_id_ = nullptr;                                 // nullptr if not in the problem
 };
 
-}  // namespace navp::fgo
\ No newline at end of file
+}  // namespace navp::fgo
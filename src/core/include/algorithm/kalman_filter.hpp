@@ -0,0 +1,122 @@
+#pragma once
+
+#include <Eigen/Eigen>
+#include <format>
+#include <limits>
+#include <span>
+
+#include "utils/exception.hpp"
+#include "utils/types.hpp"
+
+namespace navp::algorithm {
+
+REGISTER_NAV_RUNTIME_ERROR_CHILD(KalmanRuntimeError, NavRuntimeError);
+
+// Kalman filter with a variable number of active states
+// - storage is allocated once for `capacity` states, only the leading `size` states are active,
+//   so every operation costs O(size) or O(size^2) regardless of the capacity
+// - measurements are processed one by one (diagonal measurement noise), the covariance is
+//   updated in the Joseph form, which keeps it symmetric positive semi-definite
+// - sparse measurement rows are given by (index, coefficient) pairs
+template <std::floating_point _Float_t>
+class KalmanFilter {
+ public:
+  using DynamicVector = Eigen::Vector<_Float_t, Eigen::Dynamic>;
+  using DynamicMatrix = Eigen::Matrix<_Float_t, Eigen::Dynamic, Eigen::Dynamic>;
+
+  KalmanFilter() noexcept = default;
+
+  KalmanFilter(size_t capacity) noexcept
+      : state_(DynamicVector::Zero(capacity)),
+        covariance_(DynamicMatrix::Zero(capacity, capacity)),
+        pht_(capacity),
+        gain_(capacity) {}
+
+  constexpr inline size_t size() const noexcept { return size_; }
+
+  constexpr inline size_t capacity() const noexcept { return static_cast<size_t>(state_.size()); }
+
+  inline auto state() noexcept { return state_.head(size_); }
+
+  inline auto state() const noexcept { return state_.head(size_); }
+
+  inline auto covariance() noexcept { return covariance_.topLeftCorner(size_, size_); }
+
+  inline auto covariance() const noexcept { return covariance_.topLeftCorner(size_, size_); }
+
+  // append a state uncorrelated with the others, return its index
+  size_t add_state(_Float_t value, _Float_t variance) {
+    if (size_ >= capacity()) {
+      throw KalmanRuntimeError(std::format("Kalman filter capacity {} exceeded", capacity()));
+    }
+    auto index = size_++;
+    reset_state(index, value, variance);
+    return index;
+  }
+
+  // remove a state, the last active state is moved to its place
+  // return the previous index of the moved state (equals to `index` if nothing is moved)
+  size_t remove_state(size_t index) noexcept {
+    auto last = size_ - 1;
+    if (index != last) {
+      std::swap(state_(index), state_(last));
+      covariance_.row(index).head(size_).swap(covariance_.row(last).head(size_));
+      covariance_.col(index).head(size_).swap(covariance_.col(last).head(size_));
+    }
+    --size_;
+    return last;
+  }
+
+  // remove all states
+  void clear() noexcept { size_ = 0; }
+
+  // reinitialize a state, the correlations with the other states are dropped
+  void reset_state(size_t index, _Float_t value, _Float_t variance) noexcept {
+    state_(index) = value;
+    covariance_.row(index).head(size_).setZero();
+    covariance_.col(index).head(size_).setZero();
+    covariance_(index, index) = variance;
+  }
+
+  // x(i) += dt * x(j), i.e. the transition F = I + dt * e_i * e_j'
+  void integrate(size_t i, size_t j, _Float_t dt) noexcept {
+    state_(i) += dt * state_(j);
+    covariance_.row(i).head(size_) += dt * covariance_.row(j).head(size_);
+    covariance_.col(i).head(size_) += dt * covariance_.col(j).head(size_);
+  }
+
+  // add process noise to a state
+  inline void add_process_noise(size_t index, _Float_t variance) noexcept { covariance_(index, index) += variance; }
+
+  // scalar measurement update, innovation = z - h(x), measurement row h is given by (index, coefficient)
+  // the measurement is rejected if innovation^2 > gate * (hPh' + variance)
+  // return false if the measurement is rejected
+  bool update(std::span<const u16> index, std::span<const _Float_t> coeff, _Float_t innovation, _Float_t variance,
+              _Float_t gate = std::numeric_limits<_Float_t>::infinity()) noexcept {
+    auto covariance = covariance_.topLeftCorner(size_, size_);
+    auto pht = pht_.head(size_);
+    auto gain = gain_.head(size_);
+    pht.setZero();
+    for (size_t k = 0; k < index.size(); ++k) pht += coeff[k] * covariance.col(index[k]);
+    _Float_t hph = 0;
+    for (size_t k = 0; k < index.size(); ++k) hph += coeff[k] * pht(index[k]);
+    _Float_t s = hph + variance;  // innovation variance
+    if (!(s > 0) || innovation * innovation > gate * s) return false;
+    gain = pht / s;
+    state_.head(size_) += gain * innovation;
+    // Joseph form, P = (I - Kh)P(I - Kh)' + KRK' = P - K(Ph')' - (Ph')K' + (hPh' + R)KK'
+    covariance.noalias() -= gain * pht.transpose();
+    covariance.noalias() -= pht * gain.transpose();
+    covariance.noalias() += (s * gain) * gain.transpose();
+    return true;
+  }
+
+ protected:
+  DynamicVector state_;       // state vector         x
+  DynamicMatrix covariance_;  // state covariance     P
+  DynamicVector pht_;         // workspace            Ph'
+  DynamicVector gain_;        // workspace            K
+  size_t size_ = 0;           // active state number
+};
+
+}  // namespace navp::algorithm
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <Eigen/Eigen>
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <span>
+
+#include "utils/types.hpp"
+
+namespace navp::algorithm {
+
+namespace details {
+
+// chi-square(n) (alpha=0.001), n = 1, 2, ..., 100
+inline constexpr f64 chisqr_alpha001[100] = {
+    10.8, 13.8, 16.3, 18.5, 20.5, 22.5, 24.3, 26.1, 27.9, 29.6, 31.3, 32.9, 34.5, 36.1, 37.7, 39.3, 40.8,
+    42.3, 43.8, 45.3, 46.8, 48.3, 49.7, 51.2, 52.6, 54.1, 55.5, 56.9, 58.3, 59.7, 61.1, 62.5, 63.9, 65.2,
+    66.6, 68.0, 69.3, 70.7, 72.1, 73.4, 74.7, 76.0, 77.3, 78.6, 80.0, 81.3, 82.6, 84.0, 85.4, 86.7, 88.0,
+    89.3, 90.6, 91.9, 93.3, 94.7, 96.0, 97.4, 98.7, 100,  101,  102,  103,  104,  105,  107,  108,  109,
+    110,  112,  113,  114,  115,  116,  118,  119,  120,  122,  123,  125,  126,  127,  128,  129,  131,
+    132,  133,  134,  135,  137,  138,  139,  140,  142,  143,  144,  145,  147,  148,  149};
+
+// chi-square threshold (alpha=0.001) of the given degree of freedom,
+// Wilson-Hilferty approximation is used when the degree of freedom exceeds the table
+inline f64 chisqr_threshold(size_t dof) noexcept {
+  if (dof == 0) return std::numeric_limits<f64>::infinity();
+  if (dof <= 100) return chisqr_alpha001[dof - 1];
+  constexpr f64 z = 3.090232;  // standard normal quantile of 1 - 0.001
+  f64 k = static_cast<f64>(dof), h = 2.0 / (9.0 * k);
+  f64 t = 1.0 - h + z * std::sqrt(h);
+  return k * t * t * t;
+}
+
+}  // namespace details
+
+// Fault detection and exclusion (RAIM/FDE) over a linearized weighted least square model
+// - the weight matrix is assumed to be diagonal (uncorrelated observations)
+// - observations are tested by groups (e.g. all signals of one satellite), a group is a
+//   contiguous range of rows [begin, begin + count)
+// - detection : global chi-square test of the weighted residual sum of squares
+// - exclusion : leave-one-group-out statistics, evaluated by rank-one downdates of the
+//               cholesky factor of the normal equation instead of re-solving N times
+template <std::floating_point _Float_t>
+class FaultDetectionExclusion {
+ public:
+  using DynamicVector = Eigen::Vector<_Float_t, Eigen::Dynamic>;
+  using DynamicMatrix = Eigen::Matrix<_Float_t, Eigen::Dynamic, Eigen::Dynamic>;
+  using Cholesky = Eigen::LLT<DynamicMatrix>;
+
+  struct Statistic {
+    _Float_t sse = std::numeric_limits<_Float_t>::infinity();  // weighted residual sum of squares
+    size_t dof = 0;                                             // degree of freedom
+
+    // true if the residuals pass the chi-square test
+    inline bool consistent() const noexcept { return dof > 0 && sse <= details::chisqr_threshold(dof); }
+
+    // false if the group can not be removed (the geometry becomes singular)
+    inline bool valid() const noexcept { return std::isfinite(sse); }
+  };
+
+  FaultDetectionExclusion() noexcept = default;
+
+  FaultDetectionExclusion(size_t parameter_size) noexcept { reserve(parameter_size); }
+
+  // preallocate the workspace, no allocation happens afterwards for the same parameter size
+  void reserve(size_t parameter_size) noexcept {
+    normal_.resize(parameter_size, parameter_size);
+    b_.resize(parameter_size);
+    b_loo_.resize(parameter_size);
+    x_.resize(parameter_size);
+    row_.resize(parameter_size);
+    llt_ = Cholesky(parameter_size);
+    llt_loo_ = Cholesky(parameter_size);
+  }
+
+  // factorize the normal equation N = H'PH, b = H'PL of the linearized model L = H dx
+  // parameters that are not observed by any row are pinned to zero, so that they are neither
+  // estimated nor counted in the degree of freedom
+  // the jacobian is referenced (not copied) and must outlive the following calls
+  template <typename WeightT, typename ObservationT>
+  bool factorize(const DynamicMatrix& jacobian, const Eigen::MatrixBase<WeightT>& weight_diagonal,
+                 const Eigen::MatrixBase<ObservationT>& observation) noexcept {
+    jacobian_ = &jacobian;
+    excluded_rows_ = 0;
+    auto parameter_size = static_cast<size_t>(jacobian.cols());
+    if (static_cast<size_t>(normal_.rows()) != parameter_size) reserve(parameter_size);
+    weight_ = weight_diagonal;
+    observation_ = observation;
+    normal_.noalias() = jacobian.transpose() * weight_.asDiagonal() * jacobian;
+    b_.noalias() = jacobian.transpose() * (weight_.array() * observation_.array()).matrix();
+    lpl_ = (weight_.array() * observation_.array().square()).sum();
+    observed_ = 0;
+    for (Eigen::Index i = 0; i < normal_.rows(); ++i) {
+      if (normal_(i, i) == 0) {
+        normal_(i, i) = 1;
+        b_(i) = 0;
+      } else {
+        ++observed_;
+      }
+    }
+    llt_.compute(normal_);
+    factorized_ = llt_.info() == Eigen::Success;
+    return factorized_;
+  }
+
+  // statistic of the full observation set
+  Statistic statistic() const noexcept {
+    Statistic stat;
+    if (!factorized_) return stat;
+    x_ = llt_.solve(b_);
+    return make_statistic(lpl_ - b_.dot(x_), observation_size() - excluded_rows_);
+  }
+
+  // statistic with the group [begin, begin + count) removed, evaluated by `count` rank-one downdates
+  // a group whose removal leaves a parameter unobserved (e.g. the only satellite of a constellation)
+  // is reported as invalid
+  Statistic leave_out(u16 begin, u16 count) const noexcept {
+    Statistic stat;
+    if (!factorized_) return stat;
+    llt_loo_ = llt_;
+    b_loo_ = b_;
+    _Float_t lpl = lpl_;
+    for (u16 r = begin; r < begin + count; ++r) {
+      _Float_t w = weight_(r);
+      if (w == 0) continue;
+      row_ = jacobian_->row(r).transpose();
+      b_loo_ -= (w * observation_(r)) * row_;
+      lpl -= w * observation_(r) * observation_(r);
+      row_ *= std::sqrt(w);
+      llt_loo_.rankUpdate(row_, -1);
+      if (llt_loo_.info() != Eigen::Success) return stat;
+    }
+    x_ = llt_loo_.solve(b_loo_);
+    return make_statistic(lpl - b_loo_.dot(x_), observation_size() - excluded_rows_ - count);
+  }
+
+  // commit the removal of a group into the factorization (rank-one downdates, no refactorization)
+  bool exclude(u16 begin, u16 count) noexcept {
+    if (!factorized_) return false;
+    for (u16 r = begin; r < begin + count; ++r) {
+      _Float_t w = weight_(r);
+      if (w == 0) continue;
+      row_ = jacobian_->row(r).transpose();
+      b_ -= (w * observation_(r)) * row_;
+      lpl_ -= w * observation_(r) * observation_(r);
+      row_ *= std::sqrt(w);
+      llt_.rankUpdate(row_, -1);
+      weight_(r) = 0;
+      ++excluded_rows_;
+    }
+    factorized_ = llt_.info() == Eigen::Success;
+    return factorized_;
+  }
+
+  // find the group whose removal reduces the residuals most
+  // groups are given by their begin rows, the last element is the total row count
+  // return the index of the group, or -1 if none of the groups can be removed
+  i32 worst_group(std::span<const u16> group_begin) const noexcept {
+    i32 worst = -1;
+    _Float_t min_sse = std::numeric_limits<_Float_t>::infinity();
+    for (size_t g = 0; g + 1 < group_begin.size(); ++g) {
+      auto begin = group_begin[g], count = static_cast<u16>(group_begin[g + 1] - group_begin[g]);
+      if (count == 0 || weight_.segment(begin, count).isZero()) continue;
+      auto stat = leave_out(begin, count);
+      if (stat.valid() && stat.dof > 0 && stat.sse < min_sse) {
+        min_sse = stat.sse;
+        worst = static_cast<i32>(g);
+      }
+    }
+    return worst;
+  }
+
+  inline size_t parameter_size() const noexcept { return static_cast<size_t>(normal_.rows()); }
+
+  inline size_t observation_size() const noexcept { return static_cast<size_t>(observation_.size()); }
+
+ protected:
+  Statistic make_statistic(_Float_t sse, size_t rows) const noexcept {
+    Statistic stat;
+    stat.sse = sse < 0 ? 0 : sse;  // may be slightly negative due to rounding
+    stat.dof = rows > observed_ ? rows - observed_ : 0;
+    return stat;
+  }
+
+  const DynamicMatrix* jacobian_ = nullptr;  // jacobian matrix          H
+  DynamicVector weight_;                     // diagonal of weight       P
+  DynamicVector observation_;                // observation vector       L
+  DynamicMatrix normal_;                     // normal matrix            N = H'PH
+  DynamicVector b_;                          // normal vector            b = H'PL
+  _Float_t lpl_ = 0;                         // L'PL
+  Cholesky llt_;                             // cholesky factor of N
+  size_t observed_ = 0;                      // observed parameter number
+  size_t excluded_rows_ = 0;                 // rows removed by `exclude`
+  bool factorized_ = false;
+
+  // leave-one-out workspace
+  mutable Cholesky llt_loo_;
+  mutable DynamicVector b_loo_, x_, row_;
+};
+
+}  // namespace navp::algorithm
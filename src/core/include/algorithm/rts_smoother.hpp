@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <vector>
+
+#include "utils/eigen.hpp"
+#include "utils/exception.hpp"
+#include "utils/macro.hpp"
+#include "utils/time.hpp"
+
+namespace navp::algorithm {
+
+REGISTER_NAV_RUNTIME_ERROR_CHILD(SmootherRuntimeError, NavRuntimeError);
+
+// Rauch-Tung-Striebel smoother of a kalman filter forward pass
+// - the forward pass streams each epoch to an append-only store file : the predicted state and covariance, the
+//   transition from the previous epoch (non-zero entries) and the filtered state and covariance, covariances are
+//   kept as upper triangles
+// - the backward pass maps the store and walks it from the end, only one record and the smoothed state are held in
+//   memory and the pages behind are released, so day-long high rate runs stay out of RAM
+// - the states may change between epochs, the transition maps the filtered states of the previous epoch onto the
+//   predicted ones (a zero row for a new or reinitialized state)
+// - an epoch without prediction starts a new segment, e.g. the filter is reinitialized after a gap
+class NAVP_EXPORT RtsSmoother {
+ public:
+  using Vector = utils::NavVectorDf64;
+  using Matrix = utils::NavMatrixDf64;
+  // smoothed epochs from the last to the first
+  using Callback = std::function<void(const EpochUtc& epoch, const Vector& state, const Matrix& covariance)>;
+
+  // the store file is truncated, and removed with the smoother
+  explicit RtsSmoother(std::filesystem::path path);
+
+  RtsSmoother(const RtsSmoother&) = delete;
+  RtsSmoother& operator=(const RtsSmoother&) = delete;
+
+  ~RtsSmoother() noexcept;
+
+  // state and covariance of `epoch` right after the prediction, before its measurement updates
+  void predicted(const EpochUtc& epoch, const Eigen::Ref<const Vector>& state,
+                 const Eigen::Ref<const Matrix>& covariance, const Eigen::Ref<const Matrix>& transition);
+
+  // state and covariance of the epoch after its measurement updates, return false if the store is not writable
+  bool filtered(const EpochUtc& epoch, const Eigen::Ref<const Vector>& state,
+                const Eigen::Ref<const Matrix>& covariance) noexcept;
+
+  // epochs in the store
+  inline size_t size() const noexcept { return size_; }
+
+  inline auto path() const noexcept -> const std::filesystem::path& { return path_; }
+
+  // backward pass, the forward pass may continue afterwards
+  // return false if the store is not readable or a predicted covariance is singular
+  bool smooth(const Callback& callback);
+
+ private:
+  std::filesystem::path path_;
+  std::FILE* file_ = nullptr;
+  std::vector<char> record_;  // record being written
+  EpochUtc predicted_epoch_;  // epoch of the staged prediction
+  bool has_predicted_ = false;
+  size_t size_ = 0;
+};
+
+}  // namespace navp::algorithm
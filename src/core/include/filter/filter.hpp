@@ -1,5 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <bitset>
+#include <limits>
+#include <optional>
+#include <span>
+
 #include "filter/items.hpp"
 #include "sensors/gnss/carrier.hpp"
 #include "sensors/gnss/sv.hpp"
@@ -21,13 +27,106 @@ struct NAVP_EXPORT Filter {
   auto apply(const FilterItem& item) const noexcept -> bool;
 };
 
+// mask filters compiled into a predicate of a few instructions per check
+// - satellites, constellations and carriers are allowed by bitsets evaluated from the filters once
+// - snr, elevation and azimuth keep the intersection of their bounds as a closed interval, strict bounds are moved to
+//   the next representable value, and the values excluded by `!=`
+// - epochs keep the intersection of their bounds and the excluded epochs
+class NAVP_EXPORT MaskPredicate {
+ public:
+  static constexpr size_t ConstellationCount = magic_enum::enum_count<sensors::gnss::ConstellationEnum>();
+  static constexpr size_t CarrierCount = magic_enum::enum_count<sensors::gnss::CarrierEnum>();
+  static constexpr size_t PrnCount = 256;
+
+  // allows everything, the predicate of no filter
+  MaskPredicate() noexcept { sv_.set(), constellation_.set(), carrier_.set(); }
+
+  static auto compile(const std::vector<Filter>& filters) -> MaskPredicate;
+
+  inline bool apply(const EpochItem& epoch) const noexcept {
+    if (!epoch_.active) return true;
+    if (epoch_.begin && (epoch < *epoch_.begin || (epoch_.begin_strict && epoch == *epoch_.begin))) return false;
+    if (epoch_.end && (epoch > *epoch_.end || (epoch_.end_strict && epoch == *epoch_.end))) return false;
+    return std::ranges::find(epoch_.excluded, epoch) == epoch_.excluded.end();
+  }
+
+  inline bool apply(CarrierItem carrier) const noexcept {
+    auto index = static_cast<size_t>(carrier.id);
+    return index >= CarrierCount || carrier_[index];
+  }
+
+  inline bool apply(ConstellationItem constellation) const noexcept {
+    auto index = static_cast<size_t>(constellation.id);
+    return index >= ConstellationCount || constellation_[index];
+  }
+
+  inline bool apply(SvItem sv) const noexcept {
+    auto index = static_cast<size_t>(sv.constellation.id);
+    return index >= ConstellationCount || sv_[index * PrnCount + sv.prn];
+  }
+
+  inline bool apply(SnrItem snr) const noexcept { return snr_.apply(snr.val); }
+
+  inline bool apply(ElevationItem elevation) const noexcept { return elevation_.apply(elevation.val); }
+
+  inline bool apply(AzimuthItem azimuth) const noexcept { return azimuth_.apply(azimuth.val); }
+
+  // clear `mask[i]` of the filtered values, `mask` has the size of the values
+  void apply_snr(std::span<const f64> snr, std::span<u8> mask) const noexcept;
+  void apply_elevation(std::span<const f64> elevation, std::span<u8> mask) const noexcept;
+  void apply_azimuth(std::span<const f64> azimuth, std::span<u8> mask) const noexcept;
+
+ protected:
+  struct Interval {
+    bool active = false;                              // a filter bounds the item
+    f64 min = -std::numeric_limits<f64>::infinity();  // closed lower bound
+    f64 max = std::numeric_limits<f64>::infinity();   // closed upper bound
+    std::vector<f64> excluded;                        // values excluded by `!=`
+
+    void bound(CompareOperatorEnum op, f64 value) noexcept;
+
+    inline bool apply(f64 value) const noexcept {
+      return !active || (value >= min && value <= max &&
+                         (excluded.empty() || std::ranges::find(excluded, value) == excluded.end()));
+    }
+
+    void apply(std::span<const f64> values, std::span<u8> mask) const noexcept;
+  };
+
+  struct EpochInterval {
+    bool active = false;                            // a filter bounds the epochs
+    std::optional<EpochItem> begin, end;            // bounds of the epochs
+    bool begin_strict = false, end_strict = false;  // the bounds are excluded
+    std::vector<EpochItem> excluded;                // epochs excluded by `!=`
+
+    void bound(CompareOperatorEnum op, const EpochItem& epoch) noexcept;
+  };
+
+  std::bitset<ConstellationCount * PrnCount> sv_;  // allowed satellites [constellation][prn]
+  std::bitset<ConstellationCount> constellation_;  // allowed constellations
+  std::bitset<CarrierCount> carrier_;              // allowed carriers
+  Interval snr_, elevation_, azimuth_;             // bounds of the numeric items
+  EpochInterval epoch_;                            // bounds of the epochs
+};
+
 struct NAVP_EXPORT MaskFilters {
   static auto from_str(std::vector<std::string_view> str) -> Result<MaskFilters, FilterParseError>;
   static auto from_str(std::string_view str) -> Result<MaskFilters, FilterParseError>;
 
+  // compile the filters into the predicate, done by `from_str`; a default constructed instance allows everything
+  // until its filters are compiled
+  MaskFilters& compile() noexcept;
+
   auto apply(const FilterItem& item) const noexcept -> bool;
 
+  template <typename _ItemT>
+    requires requires(const MaskPredicate& predicate, const _ItemT& item) { predicate.apply(item); }
+  inline bool apply(const _ItemT& item) const noexcept {
+    return __predicate.apply(item);
+  }
+
   std::vector<Filter> __filter;
+  MaskPredicate __predicate;
 };
 
 }  // namespace navp::filter
\ No newline at end of file
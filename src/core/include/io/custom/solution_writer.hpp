@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+#include "io/format_options.hpp"
+#include "utils/exception.hpp"
+#include "utils/macro.hpp"
+#include "utils/spsc_queue.hpp"
+#include "utils/types.hpp"
+
+namespace navp::solution {
+// forward declaration
+struct PvtSolutionRecord;
+
+}  // namespace navp::solution
+
+namespace navp::io::custom {
+
+REGISTER_NAV_RUNTIME_ERROR_CHILD(SolutionWriterRuntimeError, NavRuntimeError);
+
+enum class NAVP_EXPORT SolutionFileEnum : u8 {
+  TEXT = 0,    // lines of `SolutionStream`
+  BINARY = 1,  // header then fixed `SolutionBinaryRecord`
+};
+
+// fixed record of the binary solution file, native byte order
+// - the epoch is kept exactly, the excluded satellites are not kept
+struct NAVP_EXPORT SolutionBinaryRecord {
+  static constexpr char Magic[8] = "NAVPSOL";  // header of the binary file
+
+  i64 seconds;                         // utc epoch, seconds
+  i64 attoseconds;                     // utc epoch, fractional attoseconds
+  f64 position[3], velocity[3];        // ecef position/velocity (m|m/s)
+  f64 blh[3];                          // latitude/longitude/height (rad|rad|m)
+  f64 sigma_r, sigma_v;                // position/velocity sigma
+  f64 dtr[6];                          // receiver clock biases (s)
+  f32 qr[6], qv[6];                    // position/velocity variance/covariance xx,xy,xz,yy,yz,zz
+  u8 mode, type, syss, ns, iter, nex;  // fields of `PvtSolutionRecord`
+  u8 reserved[2];
+
+  static auto from(const solution::PvtSolutionRecord& record) noexcept -> SolutionBinaryRecord;
+
+  void to(solution::PvtSolutionRecord& record) const noexcept;
+};
+
+static_assert(sizeof(SolutionBinaryRecord) == 208 && std::is_trivially_copyable_v<SolutionBinaryRecord>);
+
+// append the text line of a record to `buffer`, the same line as `SolutionStream` writes
+NAVP_EXPORT void format_solution(const SolutionBinaryRecord& record, const FormatOptions& options,
+                                 std::string& buffer);
+
+// convert a binary solution file to the text format, return the number of records
+// throw SolutionWriterRuntimeError if a file can not be opened or the binary file is not a solution file
+NAVP_EXPORT size_t convert_solution_binary(std::string_view binary_file, std::string_view text_file,
+                                           const FormatOptions& options = {});
+
+// asynchronous solution writer
+// - the solving thread pushes records to a lock-free queue, a dedicated thread formats them into a large buffer
+//   written to the file once full, numbers are formatted by `std::to_chars`
+// - `push` waits while the queue is full, records are never dropped
+// - the binary file is meant for high rate runs, see `convert_solution_binary`
+class NAVP_EXPORT SolutionWriter {
+ public:
+  static constexpr size_t BufferSize = 1 << 20;
+
+  // throw SolutionWriterRuntimeError if the file can not be opened
+  SolutionWriter(std::string_view filename, SolutionFileEnum file_type, const FormatOptions& options = {},
+                 size_t capacity = 4096);
+
+  SolutionWriter(const SolutionWriter&) = delete;
+  SolutionWriter& operator=(const SolutionWriter&) = delete;
+
+  ~SolutionWriter();
+
+  // called by the solving thread
+  void push(const solution::PvtSolutionRecord& record) noexcept;
+
+  // write the pushed records and close the file, the writer does not accept records anymore
+  void close() noexcept;
+
+  // records formatted by the writer thread
+  inline size_t records() const noexcept { return records_.load(std::memory_order_relaxed); }
+
+ protected:
+  void consume() noexcept;
+
+  void encode(const SolutionBinaryRecord& record) noexcept;
+
+  void write_buffer() noexcept;
+
+  SolutionFileEnum file_type_;                    // text or binary
+  FormatOptions options_;                         // options of the text format
+  std::ofstream file_;                            // output file, written by the writer thread only
+  std::string buffer_;                            // formatted records, written once `BufferSize` is reached
+  utils::SpscQueue<SolutionBinaryRecord> queue_;  // records pushed by the solving thread
+  std::atomic<bool> stop_{};                      // set by `close`
+  std::atomic<size_t> records_{};                 // records written
+  std::thread thread_;                            // writer thread
+};
+
+}  // namespace navp::io::custom
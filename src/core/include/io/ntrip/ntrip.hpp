@@ -0,0 +1,203 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "utils/exception.hpp"
+#include "utils/macro.hpp"
+#include "utils/types.hpp"
+
+namespace navp::io::ntrip {
+
+REGISTER_NAV_RUNTIME_ERROR_CHILD(NtripRuntimeError, NavRuntimeError);
+
+using SteadyClock = std::chrono::steady_clock;
+
+// caster and mountpoint of a stream, a stream without mountpoint is a raw tcp stream
+struct NAVP_EXPORT StreamEndpoint {
+  std::string host = "127.0.0.1";
+  u16 port = 2101;
+  std::string mountpoint;
+  std::string user, password;
+
+  // "[user[:password]@]host[:port][/mountpoint]", throw NtripRuntimeError if the port is invalid
+  static auto from_str(std::string_view url) -> StreamEndpoint;
+};
+
+enum class NAVP_EXPORT StreamStateEnum : u8 {
+  CONNECTING = 0,  // tcp connection in progress
+  REQUESTING = 1,  // waiting for the response of the caster
+  STREAMING = 2,   // receiving frames
+  WAITING = 3,     // waiting for the next connection attempt
+};
+
+// counters of a stream
+struct NAVP_EXPORT StreamStatistics {
+  StreamStateEnum state = StreamStateEnum::WAITING;
+  u64 bytes = 0;          // received bytes, responses of the caster included
+  u64 frames = 0;         // complete frames handed to the handler
+  u64 dropped_bytes = 0;  // bytes out of frames
+  u32 connects = 0;       // accepted connections
+  u32 failures = 0;       // failed or lost connections
+  f64 last_latency = 0;   // seconds from the socket being readable until the handler returned, last read
+  f64 max_latency = 0;    // the largest of them
+  f64 mean_latency = 0;   // the mean of them
+};
+
+struct NAVP_EXPORT IngestionOptions {
+  u32 threads = 1;                               // event loops, the streams are shared out between them
+  std::chrono::milliseconds min_backoff{500};    // first reconnection delay, doubled after every failure
+  std::chrono::milliseconds max_backoff{30000};  // largest reconnection delay
+  std::chrono::milliseconds timeout{10000};      // silence after which a connection is dropped
+  std::string user_agent = "NTRIP navp/1.0";     // user agent of the ntrip requests
+};
+
+// event driven ingestion of rtcm3 streams from ntrip casters or tcp servers
+// - every event loop waits on the sockets of its streams by epoll, a few loops hold hundreds of streams
+// - bytes are received into a fixed buffer of the stream, the complete frames of a read are handed to the handler
+//   as a span of that buffer, only the tail of a frame split across two reads is moved to the front
+// - frames are checked by their crc, bytes between frames are dropped
+// - a lost, silent or refused connection is retried after an exponential backoff, reset once frames arrive
+class NAVP_EXPORT IngestionLoop {
+ public:
+  using StreamId = u32;
+
+  // complete frames of one read, valid during the call, called on the event loop of the stream
+  using FrameHandler = std::function<void(std::span<const u8> frames)>;
+
+  // throw NtripRuntimeError if an event loop can not be created
+  explicit IngestionLoop(const IngestionOptions& options = {});
+
+  IngestionLoop(const IngestionLoop&) = delete;
+  IngestionLoop& operator=(const IngestionLoop&) = delete;
+
+  ~IngestionLoop();
+
+  // add a stream, connected once the loops run, thread safe
+  // the host is resolved here once, the event loops never wait on a name lookup
+  // throw NtripRuntimeError if the host can not be resolved
+  StreamId add_stream(const StreamEndpoint& endpoint, FrameHandler handler);
+
+  // run the event loops
+  void start();
+
+  // stop the event loops and close the connections, the handlers are not called anymore
+  void stop() noexcept;
+
+  // counters of a stream, thread safe
+  auto statistics(StreamId id) const -> StreamStatistics;
+
+  // number of streams
+  size_t streams() const noexcept;
+
+  static constexpr size_t BufferSize = 1 << 16;  // receive buffer of a stream
+
+ protected:
+  struct Stream {
+    StreamId id;
+    StreamEndpoint endpoint;
+    FrameHandler handler;
+    std::string request;                         // ntrip request, empty for raw tcp streams
+    u32 address = 0;                             // ipv4 address of the host, network byte order
+    std::unique_ptr<u8[]> buffer;                // receive buffer
+    size_t size = 0;                             // bytes kept in `buffer`
+    i32 fd = -1;                                 // socket
+    SteadyClock::time_point last_activity;       // connection or last received bytes
+    std::chrono::milliseconds backoff;           // next reconnection delay
+    std::atomic<StreamStateEnum> state = StreamStateEnum::WAITING;
+    std::atomic<u64> bytes = 0, frames = 0, dropped_bytes = 0, reads = 0;
+    std::atomic<u32> connects = 0, failures = 0;
+    std::atomic<i64> last_latency = 0, max_latency = 0, total_latency = 0;  // ns
+  };
+
+  struct Worker;
+
+  void run(Worker& worker) noexcept;
+
+  void connect(Worker& worker, Stream& stream) noexcept;
+
+  void fail(Worker& worker, Stream& stream, std::string_view reason) noexcept;
+
+  void on_connected(Worker& worker, Stream& stream) noexcept;
+
+  void on_readable(Worker& worker, Stream& stream, SteadyClock::time_point ready) noexcept;
+
+  bool accept_response(Worker& worker, Stream& stream) noexcept;
+
+  void deliver(Stream& stream) noexcept;
+
+  IngestionOptions options_;
+  std::vector<std::unique_ptr<Worker>> workers_;  // event loops
+  std::vector<std::unique_ptr<Stream>> streams_;  // streams, indexed by id
+  mutable std::mutex mutex_;                      // guards `streams_`
+  std::atomic<bool> running_ = false;
+};
+
+// local ntrip caster replaying recorded files over the loopback, stands in for a caster in tests and benchmarks
+// - every client of a mountpoint receives its file from the beginning, `chunk` bytes every `interval`
+// - unknown mountpoints are refused by 404
+class NAVP_EXPORT LocalCaster {
+ public:
+  // listen on an ephemeral port of 127.0.0.1, throw NtripRuntimeError if it fails
+  LocalCaster();
+
+  LocalCaster(const LocalCaster&) = delete;
+  LocalCaster& operator=(const LocalCaster&) = delete;
+
+  ~LocalCaster();
+
+  // add a mountpoint before `start`, `repeat` replays the file endlessly instead of closing the connection
+  // throw NtripRuntimeError if the file can not be read
+  LocalCaster& add_mountpoint(std::string_view name, std::string_view filename, size_t chunk = 1024,
+                              std::chrono::milliseconds interval = {}, bool repeat = false);
+
+  void start();
+
+  void stop() noexcept;
+
+  // drop the connected clients, thread safe
+  void disconnect_all() noexcept;
+
+  inline u16 port() const noexcept { return port_; }
+
+  // accepted requests
+  inline u32 clients() const noexcept { return clients_.load(std::memory_order_relaxed); }
+
+ protected:
+  struct Mountpoint {
+    std::string name;
+    std::vector<u8> data;
+    size_t chunk;
+    std::chrono::milliseconds interval;
+    bool repeat;
+  };
+
+  struct Client {
+    i32 fd;
+    std::string request;                     // request received so far
+    const Mountpoint* mountpoint = nullptr;  // streaming once known
+    size_t offset = 0;                       // bytes of the mountpoint sent
+    SteadyClock::time_point next;            // time of the next chunk
+  };
+
+  void run() noexcept;
+
+  void on_request(Client& client) noexcept;
+
+  i32 listen_fd_ = -1, epoll_fd_ = -1, event_fd_ = -1;
+  u16 port_ = 0;
+  std::vector<Mountpoint> mountpoints_;
+  std::atomic<u32> clients_ = 0;
+  std::atomic<bool> running_ = false, disconnect_ = false;
+  std::thread thread_;
+};
+
+}  // namespace navp::io::ntrip
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+#include "io/rtcm/rtcm3.hpp"
+#include "sensors/gnss/navigation.hpp"
+#include "sensors/gnss/observation.hpp"
+
+namespace navp::io::rtcm {
+
+struct NAVP_EXPORT EpochAssemblerOptions {
+  std::chrono::milliseconds deadline{1000};  // a partial epoch is released this long after its first message
+  std::chrono::milliseconds max_wait{0};     // longest wait of `load_next` for an epoch, until closed if zero
+  size_t capacity = 32;                      // released epochs waiting to be loaded, the oldest dropped beyond
+};
+
+// observations of one epoch released by the assembler
+struct NAVP_EXPORT AssembledEpoch {
+  EpochUtc epoch;                                // observation epoch
+  sensors::gnss::GnssObsRecord::ObsMap obs_map;  // observations of the epoch
+  u8 messages = 0;                               // msm of the epoch
+  bool complete = false;                         // released on its last msm, else by the deadline or the next epoch
+  f64 latency = 0;                               // seconds from the first msm to the release
+};
+
+// counters of an assembler
+struct NAVP_EXPORT AssemblyStatistics {
+  u64 complete = 0;      // epochs released on their last msm
+  u64 incomplete = 0;    // epochs released by the deadline or the first msm of the next epoch
+  u64 late = 0;          // msm of released epochs, dropped
+  u64 overflows = 0;     // released epochs dropped before being loaded
+  f64 last_latency = 0;  // seconds from the first msm of an epoch to its release, last epoch
+  f64 max_latency = 0;   // the largest of them
+  f64 mean_latency = 0;  // the mean of them
+
+  // share of the released epochs that were complete, 0 if none
+  inline f64 completeness() const noexcept {
+    return complete + incomplete == 0 ? 0.0 : static_cast<f64>(complete) / static_cast<f64>(complete + incomplete);
+  }
+};
+
+// real-time epoch assembly of one station stream
+// - the msm of an epoch, one per constellation, arrive over several frames and reads, they are decoded into a
+//   staging record and the epoch is released once complete : on the msm without the `multiple message` bit
+// - a partial epoch is released incomplete when its deadline passes or the first msm of the next epoch arrives,
+//   so a lost message delays an epoch by the deadline at most
+// - late data policy : msm of an epoch already released, or older than the partial one, are dropped and counted
+// - frames are decoded on the ingestion thread, epochs are loaded into the station record on the solution thread;
+//   the ephemerides of the stream are staged as well and handed over with the epochs
+class NAVP_EXPORT EpochAssembler {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  explicit EpochAssembler(const EpochAssemblerOptions& options = {});
+
+  EpochAssembler(const EpochAssembler&) = delete;
+  EpochAssembler& operator=(const EpochAssembler&) = delete;
+
+  ~EpochAssembler();
+
+  // decoder of the stream, its reference time is set before the frames arrive
+  inline Rtcm3Decoder& decoder() noexcept { return decoder_; }
+
+  // decode the frames of the stream received at `now`, thread safe
+  // return the number of decoded messages
+  size_t decode(std::span<const u8> frames, Clock::time_point now = Clock::now()) noexcept;
+
+  // release the partial epoch if its deadline passed at `now`, thread safe
+  // return true if an epoch was released
+  bool poll(Clock::time_point now = Clock::now()) noexcept;
+
+  // take the oldest released epoch, thread safe
+  auto next() noexcept -> std::optional<AssembledEpoch>;
+
+  // wait up to `max_wait` for the next released epoch and move it into `record`, the ephemerides staged meanwhile
+  // into `nav`, thread safe; false on timeout, or once closed and every epoch loaded
+  bool load_next(sensors::gnss::GnssObsRecord& record, sensors::gnss::Navigation* nav = nullptr) noexcept;
+
+  // end of the stream, the partial epoch is released and the waiting loads return
+  void close() noexcept;
+
+  bool closed() const noexcept;
+
+  // counters, thread safe
+  auto statistics() const noexcept -> AssemblyStatistics;
+
+ protected:
+  struct PartialEpoch {
+    EpochUtc epoch;
+    Clock::time_point first;  // arrival of the first msm
+    u8 messages = 0;          // msm received
+  };
+
+  // msm decoded into the staging record
+  void on_message(const Rtcm3Message& message) noexcept;
+
+  // move the partial epoch out of the staging record into the released epochs
+  void release(bool complete, Clock::time_point now) noexcept;
+
+  EpochAssemblerOptions options_;
+  Rtcm3Decoder decoder_;                   // decoder of the stream, writes the staging record
+  sensors::gnss::GnssObsRecord staging_;   // partial epochs
+  sensors::gnss::Navigation staged_nav_;   // ephemerides not handed over yet
+  std::optional<PartialEpoch> partial_;    // epoch being assembled
+  std::optional<EpochUtc> last_released_;  // the latest released epoch
+  std::deque<AssembledEpoch> released_;    // epochs waiting to be loaded, the oldest at front
+  AssemblyStatistics statistics_;          // counters
+  f64 total_latency_ = 0;                  // sum of the release latencies (s)
+  Clock::time_point now_;                  // arrival of the frames being decoded
+  bool closed_ = false;                    // end of the stream
+  mutable std::mutex mutex_;               // guards all of the above
+  std::condition_variable released_cv_;    // signaled on release and close
+};
+
+}  // namespace navp::io::rtcm
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <array>
+#include <functional>
+#include <span>
+
+#include "io/stream.hpp"
+#include "sensors/gnss/enums.hpp"
+#include "utils/eigen.hpp"
+#include "utils/gTime.hpp"
+#include "utils/macro.hpp"
+#include "utils/types.hpp"
+
+// forward declaration
+namespace navp::sensors::gnss {
+class GnssObsRecord;
+struct Navigation;
+}  // namespace navp::sensors::gnss
+
+namespace navp::io::rtcm {
+
+using sensors::gnss::ConstellationEnum;
+
+// crc-24q of rtcm3 frames, computed over the header and the payload
+NAVP_EXPORT u32 crc24q(std::span<const u8> data) noexcept;
+
+// information of the last decoded message
+struct NAVP_EXPORT Rtcm3Message {
+  u16 type = 0;                                        // message number
+  u16 station = 0;                                     // reference station id, msm and station messages
+  ConstellationEnum system = ConstellationEnum::NONE;  // constellation of msm and ephemeris messages
+  bool multiple = false;                               // msm, more messages of the epoch follow
+  u8 satellites = 0;                                   // msm, satellites of the message
+  utils::GTime time = {};                              // msm, epoch (GPST)
+
+  // multiple signal message 4-7
+  inline bool is_msm() const noexcept { return type >= 1071 && type <= 1127 && type % 10 >= 4 && type % 10 <= 7; }
+
+  // last msm of an epoch
+  inline bool is_epoch_end() const noexcept { return is_msm() && !multiple; }
+};
+
+// rtcm 3 decoder, modeled on the rtcm3 decoder of rtklib and ginan
+// - msm4-7 of gps/glonass/galileo/qzss/beidou are decoded into the epoch slots of the observation record,
+//   ephemerides 1019/1020/1042/1044/1045/1046 into the navigation, station coordinates from 1005/1006
+// - frames are decoded in place from the given buffers, only a frame split across two buffers is copied to a fixed
+//   frame buffer; the decoder itself does not allocate
+// - gps weeks and glonass days are resolved near the reference time, which follows the decoded epochs
+class NAVP_EXPORT Rtcm3Decoder {
+ public:
+  static constexpr u8 Preamble = 0xD3;
+  static constexpr size_t HeaderSize = 3, CrcSize = 3, MaxPayload = 1023;
+  static constexpr size_t MaxFrame = HeaderSize + MaxPayload + CrcSize;
+
+  using Callback = std::function<void(const Rtcm3Message&)>;
+
+  Rtcm3Decoder() noexcept;
+
+  // observation record filled by the msm, not owned
+  Rtcm3Decoder& set_observation(sensors::gnss::GnssObsRecord* obs) noexcept;
+
+  // navigation filled by the ephemerides, not owned
+  Rtcm3Decoder& set_navigation(sensors::gnss::Navigation* nav) noexcept;
+
+  // time near the decoded messages (GPST), the current time by default
+  Rtcm3Decoder& set_reference_time(const utils::GTime& time) noexcept;
+
+  // called after every decoded message
+  Rtcm3Decoder& set_callback(Callback callback) noexcept;
+
+  // decode the frames of `data`, the tail of a frame split across calls is kept until the next call
+  // return the number of decoded messages
+  size_t decode(std::span<const u8> data) noexcept;
+
+  // decode one complete frame beginning with the preamble, false if the frame is invalid or not supported
+  bool decode_frame(std::span<const u8> frame) noexcept;
+
+  // frame size given by a header, 0 if `header` is not a frame header
+  static size_t frame_size(const u8* header) noexcept;
+
+  // last decoded message
+  inline const Rtcm3Message& message() const noexcept { return message_; }
+
+  // decoded messages
+  inline u64 messages() const noexcept { return messages_; }
+
+  // frames of a bad crc
+  inline u64 crc_errors() const noexcept { return crc_errors_; }
+
+  // antenna reference point of the station (ecef), zero before 1005/1006
+  inline const utils::NavVector3f64& station_position() const noexcept { return station_position_; }
+
+  // antenna height of the station (m), 1006
+  inline f64 antenna_height() const noexcept { return antenna_height_; }
+
+ protected:
+  bool decode_msm(const u8* payload, size_t size) noexcept;
+
+  bool decode_station(const u8* payload, size_t size) noexcept;
+
+  bool decode_gps_ephemeris(const u8* payload, size_t size) noexcept;
+
+  bool decode_glo_ephemeris(const u8* payload, size_t size) noexcept;
+
+  bool decode_bds_ephemeris(const u8* payload, size_t size) noexcept;
+
+  bool decode_qzs_ephemeris(const u8* payload, size_t size) noexcept;
+
+  bool decode_gal_ephemeris(const u8* payload, size_t size) noexcept;
+
+  // gps time of a msm epoch field
+  auto msm_time(ConstellationEnum system, u32 epoch) const noexcept -> utils::GTime;
+
+  static constexpr u8 Systems = 5, MaxSatellites = 64, MaxSignals = 32;
+
+  sensors::gnss::GnssObsRecord* obs_ = nullptr;                           // observation target
+  sensors::gnss::Navigation* nav_ = nullptr;                              // navigation target
+  utils::GTime reference_;                                                // time near the messages (GPST)
+  Callback callback_;                                                     // called after every decoded message
+  Rtcm3Message message_;                                                  // last decoded message
+  u64 messages_ = 0, crc_errors_ = 0;                                     // counters
+  utils::NavVector3f64 station_position_ = utils::NavVector3f64::Zero();  // station arp (ecef)
+  f64 antenna_height_ = 0;                                                // station antenna height
+  i8 glo_fcn_[MaxSatellites];                                             // glonass frequency channel, -128 if unknown
+  u32 lock_[Systems][MaxSatellites][MaxSignals] = {};                     // last lock time (ms) of the msm cells
+  std::array<u8, MaxFrame> frame_;                                        // frame split across two `decode` calls
+  size_t frame_size_ = 0;                                                 // bytes kept in `frame_`
+};
+
+// recorded rtcm 3 stream, every record reads the messages until an epoch of observations is complete
+class NAVP_EXPORT Rtcm3Stream : public Fstream {
+ public:
+  using Fstream::Fstream;
+
+  virtual ~Rtcm3Stream() override;
+
+  inline Rtcm3Decoder& decoder() noexcept { return decoder_; }
+
+  // true if the file begins with a rtcm3 frame
+  static bool is_rtcm3_file(std::string_view filename) noexcept;
+
+ protected:
+  virtual void decode_record(Record& record) override;
+
+  virtual void encode_record(const Record& record) override;
+
+  Rtcm3Decoder decoder_;                          // decoder
+  std::array<u8, Rtcm3Decoder::MaxFrame> frame_;  // frame read from the file
+};
+
+}  // namespace navp::io::rtcm
@@ -1,7 +1,15 @@
 #pragma once
 
+#include <array>
+#include <memory>
+#include <optional>
+#include <span>
+
+#include "sensors/gnss/broadcast_iono.hpp"
 #include "sensors/gnss/ephemeris_solver.hpp"
+#include "sensors/gnss/ionex.hpp"
 #include "sensors/gnss/sv.hpp"
+#include "sensors/gnss/trop_grid.hpp"
 #include "utils/eigen.hpp"
 #include "utils/macro.hpp"
 #include "utils/space.hpp"
@@ -39,4 +47,95 @@ class NAVP_EXPORT AtmosphereHandler {
   const EphemerisResult* sv_info_ = nullptr;
 };
 
+// tropospheric delay of every satellite of a station at an epoch
+// - the zenith delays and the mapping coefficients only depend on the station and the day of year, they are computed
+//   once and kept while the station moves less than the tolerances below in the same day
+// - `VMF3` and `GPT2` read a troposphere grid of the same kind (gpt2 or gpt2w for `GPT2`), the nodes around the
+//   station are kept with the station, see `TropGridStation`
+// - the mapping functions of the satellites are evaluated at once from their elevations
+class NAVP_EXPORT TropHandler {
+ public:
+  static constexpr f64 LatitudeTolerance = 1e-6;   // station latitude change (rad) before the zenith delays are updated
+  static constexpr f64 LongitudeTolerance = 1e-6;  // station longitude change (rad), only for the grid models
+  static constexpr f64 HeightTolerance = 1.0;      // station height change (m) before the zenith delays are updated
+
+  TropHandler& set_trop_model(TropModelEnum model) noexcept;
+
+  // grid of `VMF3` and `GPT2`
+  TropHandler& set_grid(std::shared_ptr<const TropGrid> grid) noexcept;
+
+  // station of the following satellites at `time`
+  TropHandler& set_station(const EpochUtc& time, const utils::CoordinateBlh& pos) noexcept;
+
+  // slant tropospheric delays (m) at satellite elevations (rad), 0 below the horizon, `trop` has the size of
+  // `elevation`
+  void handle(std::span<const f64> elevation, std::span<f64> trop) const noexcept;
+
+  // zenith hydrostatic and wet delays of the station (m)
+  inline f64 dry_zenith() const noexcept { return dry_ztd_; }
+
+  inline f64 wet_zenith() const noexcept { return wet_ztd_; }
+
+ protected:
+  // grid of the model, nullptr if the model reads none or the grid is of another kind
+  auto model_grid() const noexcept -> const TropGrid*;
+
+  TropModelEnum trop_model_ = TropModelEnum::STANDARD;
+  f64 doy_ = -1, lat_ = 0, lon_ = 0, hgt_ = 0;    // day of year and station of the zenith delays
+  f64 dry_ztd_ = 0, wet_ztd_ = 0;                 // zenith delays (m)
+  std::array<f64, 3> dry_coeff_{}, wet_coeff_{};  // mapping coefficients
+  bool valid_ = false;                            // station in the range of the model
+  std::shared_ptr<const TropGrid> grid_;          // grid of `VMF3` and `GPT2`
+  TropGridStation grid_station_;                  // grid nodes around the station
+};
+
+// ionospheric delay of every satellite of a station at an epoch
+// - `IONEX` reduces the epoch to its two maps once, the pierce points of the satellites are computed at once from
+//   their azimuths and elevations, then each point interpolates the two maps bilinearly
+// - `KLOBUCHAR`, `NEQUICK_APPROX` and `BROADCAST` read the newest coefficients of the navigation records once an
+//   epoch leaves the validity of the selected messages, the satellites of each broadcast model are evaluated at once,
+//   see `BroadcastIonoCoefficients` and `NequickApprox`
+class NAVP_EXPORT IonoHandler {
+ public:
+  IonoHandler& set_iono_model(IonoModelEnum model) noexcept;
+
+  // maps of `IONEX`
+  IonoHandler& set_ionex(std::shared_ptr<const Ionex> ionex) noexcept;
+
+  // navigation records of the broadcast models
+  IonoHandler& set_navigation(std::vector<const Navigation*> navigation) noexcept;
+
+  // cell size of the memoized nequick-approx profiles (deg), 0 evaluates the profile at every node
+  IonoHandler& set_nequick_cell(f64 cell) noexcept;
+
+  // station of the following satellites at `time`
+  IonoHandler& set_station(const EpochUtc& time, const utils::CoordinateBlh& pos) noexcept;
+
+  // slant ionospheric delays (m) on GPS L1 at satellite azimuths and elevations (rad), 0 below the horizon or out
+  // of the maps, `iono` has the size of `elevation`
+  void handle(std::span<const f64> azimuth, std::span<const f64> elevation, std::span<f64> iono) noexcept;
+
+  // the same with the constellations of the satellites, which choose their broadcast model, GPS if empty
+  void handle(std::span<const ConstellationEnum> system, std::span<const f64> azimuth, std::span<const f64> elevation,
+              std::span<f64> iono) noexcept;
+
+ protected:
+  // broadcast model of a constellation, falls back to another model with a message, none without any message
+  auto broadcast_model(ConstellationEnum system) const noexcept -> std::optional<BroadcastIonoModel>;
+
+  IonoModelEnum iono_model_ = IonoModelEnum::NONE;
+  std::shared_ptr<const Ionex> ionex_;                            // maps of `IONEX`
+  Ionex::MapTime map_time_{};                                     // maps around the epoch
+  bool valid_ = false;                                            // epoch in the maps or of the broadcast messages
+  f64 lat_ = 0, lon_ = 0;                                         // station (rad)
+  Eigen::Array<f64, Eigen::Dynamic, 1> pierce_lat_, pierce_lon_;  // pierce points of the satellites (deg)
+  Eigen::Array<f64, Eigen::Dynamic, 1> mapping_;                  // single layer mapping functions of the satellites
+  BroadcastIonoCoefficients coefficients_;                        // messages of the broadcast models
+  NequickApprox nequick_;                                         // nequick-approx of the station
+  f64 gps_tow_ = 0, bds_tow_ = 0;                                 // times of week of the klobuchar models
+  std::vector<u16> group_;                                        // satellites of a broadcast model
+  std::vector<f64> group_azimuth_, group_elevation_;              // azimuths and elevations of the group
+  std::vector<f64> group_iono_;                                   // delays of the group
+};
+
 }  // namespace navp::sensors::gnss
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <array>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "sensors/gnss/navigation.hpp"
+#include "utils/eigen.hpp"
+#include "utils/gTime.hpp"
+#include "utils/macro.hpp"
+#include "utils/types.hpp"
+
+namespace navp::sensors::gnss {
+
+// ionosphere models of the broadcast navigation messages
+enum class BroadcastIonoModel : u8 {
+  GPS_KLOBUCHAR,  ///< klobuchar of GPS (and QZS) LNAV/CNAV
+  BDS_KLOBUCHAR,  ///< klobuchar of BDS D1/D2
+  NEQUICK_G,      ///< nequick-g coefficients of GAL INAV/FNAV
+};
+
+// newest ionosphere coefficients of the navigation records at a time
+// - a message is kept with its validity, from its transmission to the next message of its model, the records are only
+//   searched again once an epoch leaves it
+// - the messages of a rinex header have no transmission time and are valid from the beginning
+class NAVP_EXPORT BroadcastIonoCoefficients {
+ public:
+  static constexpr u8 ModelCount = 3;
+
+  BroadcastIonoCoefficients& set_navigation(std::vector<const Navigation*> navigation) noexcept;
+
+  // select the messages at `time`, true if a message changed
+  bool select(const utils::GTime& time) noexcept;
+
+  // selected message of a model, nullptr if none was transmitted before the time
+  inline auto ion(BroadcastIonoModel model) const noexcept -> const ION* {
+    return selected_[static_cast<u8>(model)].ion;
+  }
+
+ protected:
+  struct Selection {
+    const ION* ion = nullptr;  // newest message
+    utils::GTime begin, end;   // validity of the message
+    bool bounded = false;      // a later message ends the validity
+    bool valid = false;        // the selection was searched
+  };
+
+  void search(BroadcastIonoModel model, const utils::GTime& time, Selection& selection) const noexcept;
+
+  std::vector<const Navigation*> navigation_;    // records of the messages
+  std::array<Selection, ModelCount> selected_{};  // selection of each model
+};
+
+// klobuchar delays (m) on GPS L1 of the satellites at azimuths and elevations (rad) of a station (rad)
+// - `GPS_KLOBUCHAR` follows IS-GPS-200 at the gps time of week `tow`
+// - `BDS_KLOBUCHAR` follows the BDS-SIS-ICD with a 375 km layer at the bds time of week, scaled from B1I to GPS L1
+// - 0 below the horizon, `iono` has the size of `elevation`
+NAVP_EXPORT void klobuchar(const ION& ion, BroadcastIonoModel model, f64 tow, f64 lat, f64 lon,
+                           std::span<const f64> azimuth, std::span<const f64> elevation, std::span<f64> iono) noexcept;
+
+// electron density of the galileo broadcast coefficients, integrated along the rays of a station, an approximation of
+// nequick-g and not nequick-g itself
+// - adapted from the galileo ionospheric model for single frequency users: the effective ionisation level, the solar
+//   geometry, the E and F1 layers, the F2 thicknesses and the topside follow it, while the CCIR foF2 and M(3000)F2
+//   maps are replaced by a day and night climatology of the solar activity and the modip grid by a centred dipole
+// - the delays are not validated against the reference nequick-g, the regional structure of the F2 peak is lost
+// - the rays of an epoch are integrated at once on fixed gauss-legendre nodes from 100 km to 20000 km
+// - with a cell size, the profile of a ray is the one of its pierce point cell and memoized while the coefficients,
+//   the station and the quarter of an hour are the same, without it the profile is evaluated at every node
+class NAVP_EXPORT NequickApprox {
+ public:
+  static constexpr f64 AzTolerance = 0.1;        // change of the effective ionisation level kept by the profiles
+  static constexpr f64 EarthRadius = 6371.2;     // earth radius (km)
+  static constexpr f64 PierceHeight = 350.0;     // height of the pierce points of the memoized profiles (km)
+  static constexpr f64 ProfileLifetime = 900.0;  // seconds of day of the memoized profiles
+  static constexpr f64 TopHeight = 20000.0;      // upper limit of the integration (km)
+
+  // vertical profile of a location, peak heights and thicknesses (km), amplitudes (1e11 m^-3)
+  struct Profile {
+    f64 hmE, BEbot, BEtop, AE;
+    f64 hmF1, B1bot, B1top, AF1;
+    f64 hmF2, B2bot, H0, AF2;
+  };
+
+  NequickApprox& set_coefficients(const std::array<f64, 3>& ai) noexcept;
+
+  // cell size of the memoized profiles (deg), 0 evaluates the profile at every node
+  NequickApprox& set_cell_size(f64 cell) noexcept;
+
+  // station (rad, m) at a month and universal time (hour)
+  NequickApprox& set_station(f64 lat, f64 lon, f64 hgt, u8 month, f64 ut) noexcept;
+
+  // effective ionisation level of the station (sfu)
+  inline f64 az() const noexcept { return az_; }
+
+  // profiles kept in the cells
+  inline size_t memoized() const noexcept { return cells_.size(); }
+
+  // profile at a location (rad) and universal time (hour) of the month
+  auto profile(f64 lat, f64 lon, f64 ut) const noexcept -> Profile;
+
+  // electron density (1e11 m^-3) of a profile at a height (km)
+  static f64 density(const Profile& profile, f64 height) noexcept;
+
+  // slant tec (TECU) to the satellites at azimuths and elevations (rad), 0 below the horizon, `tec` has the size of
+  // `elevation`
+  void stec(std::span<const f64> azimuth, std::span<const f64> elevation, std::span<f64> tec) noexcept;
+
+ protected:
+  using Nodes = Eigen::Array<f64, Eigen::Dynamic, Eigen::Dynamic>;  // values of the nodes [node][ray]
+
+  std::array<f64, 3> ai_{};                   // effective ionisation level coefficients
+  f64 az_ = 0, r12_ = 0;                      // effective ionisation level and sunspot number of the station
+  f64 lat_ = 0, lon_ = 0, hgt_ = 0, ut_ = 0;  // station (rad, km) and universal time (hour)
+  u8 month_ = 0;                              // month of the station
+  f64 cell_ = 0;                              // cell size of the memoized profiles (deg)
+  i64 bin_ = -1;                              // quarter of an hour of the memoized profiles
+  std::unordered_map<u64, Profile> cells_;    // memoized profiles
+  Nodes s_, weight_, height_;                 // nodes of the rays, distance and height (km)
+  Nodes lat_node_, lon_node_;                 // locations of the nodes (rad)
+  std::array<Nodes, 12> parameters_;          // profile parameters of the nodes, in the order of `Profile`
+};
+
+}  // namespace navp::sensors::gnss
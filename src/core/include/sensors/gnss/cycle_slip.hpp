@@ -1,10 +1,85 @@
 #pragma once
 
+#include <unordered_map>
+#include <vector>
+
 #include "sensors/gnss/analysis.hpp"
+#include "sensors/gnss/observation.hpp"
+#include "utils/eigen.hpp"
 #include "utils/time.hpp"
 
 namespace navp::sensors::gnss {
 
-class CycleSlip;
+// Cycle slip detector of one receiver
+// - each satellite is tracked on one frequency pair, the two lowest frequencies with carrier phase
+// - geometry-free     : jump of L1 - L2 (m) between two epochs
+// - Melbourne-Wubbena : deviation of the wide-lane ambiguity from its running mean
+// - doppler           : misclosure between the carrier phase change and the integrated doppler of each
+//                       frequency, the common part (receiver clock jump) is removed by the epoch median
+// - the rolling state lives in dense arrays indexed by track, an epoch is gathered once and the tests of
+//   all satellites run as array expressions
+class NAVP_EXPORT CycleSlip {
+ public:
+  struct Options {
+    f64 gf_threshold = 0.05;      // geometry-free jump (m)
+    f64 mw_sigma_factor = 4.0;    // MW deviation, in running standard deviation
+    f64 mw_min_threshold = 1.0;   // lower bound of the MW deviation (cycle)
+    f64 doppler_threshold = 1.0;  // doppler misclosure (m)
+    f64 max_gap = 30.0;           // max gap of a track, otherwise re-initialized (s)
+  };
+
+  CycleSlip() noexcept = default;
+
+  CycleSlip(const Options& options) noexcept;
+
+  inline Options& options() noexcept { return options_; }
+
+  inline const Options& options() const noexcept { return options_; }
+
+  // detect the cycle slips of one epoch, flag `Sig::CycleSlip` on the slipped signals and return their number
+  u32 detect(EpochUtc epoch, const GnssObsRecord::ObsMap& obs_map) noexcept;
+
+  // drop all tracks
+  void reset() noexcept;
+
+  // number of tracks
+  inline size_t size() const noexcept { return track_index_.size(); }
+
+  ~CycleSlip() = default;
+
+ private:
+  // columns of the track state
+  enum Track : u8 { Time, Gf, MwMean, MwM2, MwCount, Carrier1, Carrier2, Doppler1, Doppler2, TrackSize };
+  // columns of the epoch input
+  enum Input : u8 { L1, L2, P1, P2, D1, D2, F1, F2, Lli1, Lli2, InputSize };
+  // columns of the epoch workspace
+  enum Work : u8 { Dt, GfValue, MwValue, Misclosure1, Misclosure2, WorkSize };
+  // columns of the epoch flags
+  enum Flag : u8 { Fresh, Slip1, Slip2, FlagSize };
+
+  // fill the input of one epoch, return the number of satellites
+  u32 _gather(const GnssObsRecord::ObsMap& obs_map) noexcept;
+
+  // track of a satellite and frequency pair, created on first use
+  i32 _track(Sv sv, ObsCodeEnum code1, ObsCodeEnum code2) noexcept;
+
+  // median of the doppler misclosure over the epoch (m)
+  f64 _clock_jump(u32 size) noexcept;
+
+  Options options_;
+  EpochUtc origin_;  // time origin of the track state
+
+  std::unordered_map<u64, i32> track_index_;            // satellite and frequency pair to track
+  Eigen::Array<f64, Eigen::Dynamic, TrackSize> state_;  // rolling state, one row per track
+
+  // epoch workspace, one row per satellite
+  std::vector<i32> slot_;
+  std::vector<Sig*> sig1_, sig2_;
+  std::vector<f64> misclosure_;
+  Eigen::Array<f64, Eigen::Dynamic, InputSize> input_;
+  Eigen::Array<f64, Eigen::Dynamic, TrackSize> prev_, next_;
+  Eigen::Array<f64, Eigen::Dynamic, WorkSize> work_;
+  Eigen::Array<bool, Eigen::Dynamic, FlagSize> flag_;
+};
 
-}  // namespace navp::sensors::gnss
\ No newline at end of file
+}  // namespace navp::sensors::gnss
@@ -299,7 +299,11 @@ enum class NAVP_EXPORT IonoModelEnum : u8 {
   BSPLINE,
   SPHERICAL_CAPS,
   SPHERICAL_HARMONICS,
-  LOCAL
+  LOCAL,
+  IONEX,           ///< global ionosphere maps
+  KLOBUCHAR,       ///< broadcast klobuchar, of BDS for BDS and of GPS for the others
+  NEQUICK_APPROX,  ///< broadcast nequick-g coefficients of GAL, not nequick-g but `NequickApprox`
+  BROADCAST        ///< broadcast model of each constellation, nequick-approx for GAL and klobuchar for the others
 };
 
 /// unused
@@ -307,7 +311,7 @@ enum class NAVP_EXPORT RandomModelEnum : u8 {
   STANDARD,             /// Setting fixed error
   ELEVATION_DEPENDENT,  /// Elevation model
   SNR_DEPENDENT,        /// SNR model
-  CUSTOM,               /// Custom Model(not support now)
+  CUSTOM,               /// Custom expression model
 };
 
 /// unused
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "filter/filter.hpp"
+#include "io/ntrip/ntrip.hpp"
+#include "io/rtcm/epoch_assembler.hpp"
 #include "io/stream.hpp"
 #include "sensors/gnss/analysis.hpp"
 #include "sensors/gnss/atmosphere.hpp"
+#include "sensors/gnss/cycle_slip.hpp"
 #include "sensors/gnss/ephemeris_solver.hpp"
 #include "sensors/gnss/observation.hpp"
 #include "sensors/gnss/random.hpp"
@@ -45,22 +48,30 @@ struct NAVP_EXPORT GnssRuntimeInfo {
 };
 
 struct NAVP_EXPORT GnssRecord {
-  std::list<GnssNavRecord> nav;                 // record of gnss navigation
-  std::unique_ptr<EphemerisSolver> eph_solver;  // ephemeris solver
-  std::unique_ptr<GnssObsRecord> obs;           // record of gnss observation
-  std::unique_ptr<io::Fstream> obs_stream;      // obs stream
+  std::list<GnssNavRecord> nav;                         // record of gnss navigation
+  std::unique_ptr<EphemerisSolver> eph_solver;          // ephemeris solver
+  std::unique_ptr<GnssObsRecord> obs;                   // record of gnss observation
+  std::unique_ptr<io::Fstream> obs_stream;              // obs stream, nullptr for network sources
+  std::unique_ptr<CycleSlip> cycle_slip;                // cycle slip detector of the observation
+  std::shared_ptr<io::rtcm::EpochAssembler> assembler;  // epochs of a network source, nullptr for files
+  std::unique_ptr<io::ntrip::IngestionLoop> ingestion;  // receives the network source, stopped before `assembler`
 
   // return true if update observation succeed, false if not
+  // a network source waits for its next assembled epoch, the ephemerides of the stream go to the last `nav`
   bool update();
 };
 
 struct NAVP_EXPORT GnssSettings {
-  TropModelEnum trop;                         // trop model
-  IonoModelEnum iono;                         // iono model
-  RandomModelEnum random;                     // random model
-  i32 capacity;                               // observation capacity
-  std::unique_ptr<CodeMap> enabled_obs_code;  // enabled observation Type Map, when it is empty,
-                                              // meaning > all system and codes are defaultly enabled
+  TropModelEnum trop;                                         // trop model
+  std::shared_ptr<const TropGrid> trop_grid;                  // grid of the vmf3 and gpt2 trop models, nullptr if none
+  IonoModelEnum iono;                                         // iono model
+  std::shared_ptr<const Ionex> ionex;                         // maps of the ionex iono model, nullptr if none
+  f64 nequick_cell;                                           // cell of the memoized nequick-approx profiles (deg)
+  RandomModelEnum random;                                     // random model
+  std::shared_ptr<const RandomExpression> random_expression;  // expression of the custom random model, nullptr if none
+  i32 capacity;                                               // observation capacity
+  std::unique_ptr<CodeMap> enabled_obs_code;                  // enabled observation Type Map, when it is empty,
+                                                              // meaning > all system and codes are defaultly enabled
 
   bool enabled(Sv sv, const Sig& sig) const noexcept {
     return enabled_obs_code->empty() ||
@@ -72,6 +83,10 @@ struct NAVP_EXPORT GnssSettings {
   auto enabled_codes(Sv sv) const noexcept -> const std::unordered_set<ObsCodeEnum>& {
     return enabled_obs_code->at(sv.system());
   };
+
+  auto random_handler() const noexcept -> GnssRandomHandler {
+    return GnssRandomHandler{}.set_model(random).set_expression(random_expression);
+  }
 };
 
 // - Gnss Raw Observation Handler
@@ -79,10 +94,7 @@ struct NAVP_EXPORT GnssSettings {
 struct NAVP_EXPORT GnssRawObsHandler {
   const GObs* obs;                 // observation
   const EphemerisResult* sv_info;  // satellite information
-  std::vector<const Sig*> sig;     // sigs vector
-
-  void handle_signal_variance(RandomModelEnum model, GnssRandomHandler::EvaluateRandomOptions options =
-                                                         GnssRandomHandler::Pseudorange) const noexcept;
+  std::vector<Sig*> sig;           // sigs vector
 
   f64 trop_corr(const utils::CoordinateBlh* station_pos, TropModelEnum model) const noexcept;
 
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "utils/exception.hpp"
+#include "utils/macro.hpp"
+#include "utils/types.hpp"
+
+namespace navp::sensors::gnss {
+
+REGISTER_NAV_RUNTIME_ERROR_CHILD(IonexRuntimeError, NavRuntimeError);
+
+// global ionosphere maps of an IONEX file (single layer, 2-dimensional maps)
+// - the tec and rms maps are dense arrays [map][lat][lon] in TECU, a missing value is NaN
+// - a time is first reduced to the two maps around it and their weights, see `MapTime`, so that the points of an
+//   epoch only interpolate bilinearly in each map
+class NAVP_EXPORT Ionex {
+ public:
+  // two maps around a time, linear in time after the maps are rotated with the sun
+  struct MapTime {
+    std::array<u32, 2> map;       // maps before and after the time
+    std::array<f64, 2> weight;    // weights of the maps
+    std::array<f64, 2> rotation;  // longitude shift of each map (deg)
+  };
+
+  explicit Ionex(const std::filesystem::path& path);
+
+  // maps of a file, shared by every station loading the same file
+  static auto load(const std::filesystem::path& path) -> std::shared_ptr<const Ionex>;
+
+  // epochs of the maps (mjd)
+  inline auto epochs() const noexcept -> std::span<const f64> { return epochs_; }
+
+  inline u32 rows() const noexcept { return rows_; }
+
+  inline u32 cols() const noexcept { return cols_; }
+
+  // height of the single layer and the earth radius (m)
+  inline f64 height() const noexcept { return height_; }
+
+  inline f64 radius() const noexcept { return radius_; }
+
+  inline bool has_rms() const noexcept { return !rms_.empty(); }
+
+  // tec of a node (TECU)
+  inline f32 tec(u32 map, u32 row, u32 col) const noexcept { return tec_[(map * rows_ + row) * cols_ + col]; }
+
+  // maps around `mjd`, false out of the maps
+  bool map_time(f64 mjd, MapTime& time) const noexcept;
+
+  // vertical tec (TECU) and its rms at a point (deg), NaN out of the maps
+  f64 vtec(const MapTime& time, f64 lat, f64 lon, f64* rms = nullptr) const noexcept;
+
+ protected:
+  // bilinear interpolation of a map, NaN out of the grid
+  f64 interpolate(const std::vector<f32>& values, u32 map, f64 lat, f64 lon) const noexcept;
+
+  std::vector<f64> epochs_;      // epochs of the maps (mjd)
+  f64 lat0_ = 0, dlat_ = 0;      // first latitude and spacing (deg)
+  f64 lon0_ = 0, dlon_ = 0;      // first longitude and spacing (deg)
+  u32 rows_ = 0, cols_ = 0;      // nodes in latitude and longitude
+  bool global_ = false;          // longitudes wrap around the earth
+  f64 height_ = 0, radius_ = 0;  // single layer height and earth radius (m)
+  std::vector<f32> tec_, rms_;   // maps [map][row][col] (TECU)
+};
+
+}  // namespace navp::sensors::gnss
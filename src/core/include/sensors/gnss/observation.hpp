@@ -13,6 +13,10 @@
 namespace navp::io::rinex {
 class RinexStream;
 }
+namespace navp::io::rtcm {
+class Rtcm3Decoder;
+class EpochAssembler;
+}
 namespace navp::filter {
 class MaskFilters;
 }
@@ -33,7 +37,7 @@ struct NAVP_EXPORT RawSig {
     MissingCarrierPhase = 0b10,
     MissingDoppler = 0b100,
     MissingSnr = 0b1000,
-    CycleSlip,
+    CycleSlip = 0b10000,  // flag, combined with the others
   };
 
   ObsCodeEnum code = ObsCodeEnum::NONE;          // Reported code type
@@ -49,10 +53,11 @@ struct NAVP_EXPORT RawSig {
 
   bool is_valid(const filter::MaskFilters* mask_filter = nullptr) const noexcept;
 
-  inline bool is_cycle_slip() const noexcept { return valid == CycleSlip; }
+  inline bool is_cycle_slip() const noexcept { return valid & CycleSlip; }
 };
 
-/** Per signal data that is calculated from the raw signals.
+/** Per signal data that is calculated from the raw signals. The variances are evaluated by the random model on the
+ * published signals
  */
 struct NAVP_EXPORT Sig : RawSig {
   f64 code_var = 0;                // Variance of code measurement
@@ -72,6 +77,8 @@ struct NAVP_EXPORT GObs {
 
   const Sig* find_code(ObsCodeEnum code) const noexcept;
 
+  Sig* find_code(ObsCodeEnum code) noexcept;
+
   u8 frequency_count() const noexcept;
 
   u8 code_count() const noexcept;
@@ -83,8 +90,9 @@ struct NAVP_EXPORT GObs {
     }
   }
 
+  // the signals are mutable through a mutable observation
   template <typename Func>
-  void for_each_code(this const auto& self, Func&& func) {
+  void for_each_code(this auto& self, Func&& func) {
     for (auto&& [_, sigs] : self.sigs_list) {
       for (auto&& sig : sigs) {
         std::invoke(std::forward<Func>(func), sig);
@@ -161,6 +169,8 @@ class NAVP_EXPORT GnssObsRecord : public io::Record {
   auto latest() const -> const StorageType::value_type&;
 
   friend class io::rinex::RinexStream;
+  friend class io::rtcm::Rtcm3Decoder;
+  friend class io::rtcm::EpochAssembler;
 
  protected:
   // add obs list and update obs_map
@@ -1,16 +1,66 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
 #include "sensors/gnss/enums.hpp"
+#include "sensors/gnss/gnss_exception.hpp"
 #include "sensors/gnss/observation.hpp"
 
 namespace navp::sensors::gnss {
 
+REGISTER_NAV_RUNTIME_ERROR_CHILD(RandomModelRuntimeError, GnssRuntimeError);
+
 // forward declaration
 class EphemerisResult;
 
 class GnssRandomHandler;
 
-class GnssRandomHandler {
+// variance expression of the custom random model, compiled by exprtk
+// - the variables are `el` the elevation (rad), `snr` the signal to noise ratio (dB-Hz) and `carrier` 1 for the
+//   carrier phase and 0 for the pseudorange, the value is the variance (m^2), e.g.
+//   "(carrier ? 0.003^2 : 0.3^2) * (1 + 1 / sin(el)^2)"
+// - exprtk binds the variables by reference, so each concurrent evaluation takes a compiled copy of its own from a
+//   pool, the copies are compiled once and reused by the following evaluations
+class NAVP_EXPORT RandomExpression {
+ public:
+  // throw RandomModelRuntimeError if the expression does not compile
+  static auto compile(const std::string& expression) -> std::shared_ptr<const RandomExpression>;
+
+  ~RandomExpression();
+
+  inline auto expression() const noexcept -> const std::string& { return expression_; }
+
+  // variance (m^2) of a signal
+  f64 evaluate(f64 el, f64 snr, bool carrier) const noexcept;
+
+  // variances (m^2) of signals, `snr` and `var` have the size of `el`
+  void evaluate(std::span<const f64> el, std::span<const f64> snr, bool carrier, std::span<f64> var) const noexcept;
+
+ protected:
+  struct Compiled;
+
+  explicit RandomExpression(std::string expression);
+
+  // a compiled copy not in use by another thread, compiled if every copy is in use
+  auto acquire() const noexcept -> std::unique_ptr<Compiled>;
+
+  void release(std::unique_ptr<Compiled> compiled) const noexcept;
+
+  std::string expression_;                                   // source of the expression
+  mutable std::mutex mutex_;                                 // guards the pool
+  mutable std::vector<std::unique_ptr<Compiled>> compiled_;  // compiled copies not in use
+};
+
+// variances of the signals
+// - `STANDARD` sets fixed variances, `ELEVATION_DEPENDENT` is a^2 + b^2 / sin^2(el), `SNR_DEPENDENT` is
+//   c * 10^(-snr/10) and `CUSTOM` evaluates a `RandomExpression`
+// - a signal without snr falls back to the elevation model, the custom model without expression to the standard one
+// - the variances of the signals of an epoch are evaluated at once over contiguous arrays
+class NAVP_EXPORT GnssRandomHandler {
  public:
   enum EvaluateRandomOptions : u8 {
     Pseudorange = 0b01,
@@ -21,12 +71,19 @@ class GnssRandomHandler {
   GnssRandomHandler& set_model(RandomModelEnum model) noexcept;
   GnssRandomHandler& set_options(EvaluateRandomOptions options) noexcept;
   GnssRandomHandler& set_sv_info(const EphemerisResult* eph_result) noexcept;
+  GnssRandomHandler& set_expression(std::shared_ptr<const RandomExpression> expression) noexcept;
+
+  // variance of a signal of the satellite of `set_sv_info`, at the zenith without it
+  Sig* handle(Sig* sig) const noexcept;
 
-  const Sig* handle(const Sig* sig) const noexcept;
+  // variances of the signals, `elevation` (rad) of the satellite of each signal, null signals are skipped
+  // - the signals are written, so the caller owns them mutably, e.g. not through a published base epoch
+  void handle(std::span<Sig* const> sigs, std::span<const f64> elevation) const noexcept;
 
  protected:
   EvaluateRandomOptions options_ = EvaluateRandomOptions::Both;
   RandomModelEnum model_ = RandomModelEnum::STANDARD;
   const EphemerisResult* sv_info_ = nullptr;
+  std::shared_ptr<const RandomExpression> expression_;
 };
-}  // namespace navp::sensors::gnss
\ No newline at end of file
+}  // namespace navp::sensors::gnss
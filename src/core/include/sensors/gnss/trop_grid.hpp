@@ -0,0 +1,143 @@
+#pragma once
+
+#include <array>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+#include "utils/exception.hpp"
+#include "utils/macro.hpp"
+#include "utils/types.hpp"
+
+namespace navp::sensors::gnss {
+
+REGISTER_NAV_RUNTIME_ERROR_CHILD(TropGridRuntimeError, NavRuntimeError);
+
+enum class NAVP_EXPORT TropGridKind : u32 {
+  GPT2 = 1,   // gpt2 grid, pressure, temperature, humidity and vmf1 coefficients
+  GPT2W = 2,  // gpt2w grid, gpt2 plus water vapour decrease factor and mean temperature
+  VMF3 = 3,   // vmf3 grids of several epochs and their orography
+};
+
+// troposphere grid mapped from a binary file
+// | header | grid epochs (mjd) | nodes [epoch][row][col][field] |
+// - nodes are cell centered, rows from north to south and columns east from 0 degree longitude
+// - the binary file is converted once from the text grids and read in place, see `load`
+class NAVP_EXPORT TropGrid {
+ public:
+  static constexpr u32 Version = 1;
+
+  // fields of a gpt2/gpt2w node, seasonal ones are mean, cos and sin annual, cos and sin semi-annual
+  struct Gpt2Node {
+    std::array<f64, 5> pressure;     // pressure (Pa)
+    std::array<f64, 5> temperature;  // temperature (K)
+    std::array<f64, 5> humidity;     // specific humidity (kg/kg)
+    std::array<f64, 5> lapse_rate;   // temperature lapse rate (K/m)
+    std::array<f64, 5> ah, aw;       // vmf1 hydrostatic and wet coefficients
+    std::array<f64, 5> lambda;       // water vapour decrease factor, only for gpt2w
+    std::array<f64, 5> tm;           // weighted mean temperature (K), only for gpt2w
+    f64 undulation;                  // geoid undulation (m)
+    f64 height;                      // orthometric height (m)
+  };
+
+  // fields of a vmf3 node
+  struct Vmf3Node {
+    f64 ah, aw;     // hydrostatic and wet coefficients
+    f64 zhd, zwd;   // zenith hydrostatic and wet delays at the orography (m)
+    f64 orography;  // ellipsoidal height of the node (m)
+  };
+
+  struct Header {
+    char magic[8];      // "NAVTROP"
+    u32 version;        // `Version`
+    TropGridKind kind;  // grid kind
+    u32 rows, cols;     // nodes in latitude and longitude
+    u32 epochs;         // grid epochs, 1 for gpt2/gpt2w
+    u32 fields;         // values of a node
+    f64 lat0, lon0;     // first node (deg)
+    f64 step;           // node spacing (deg)
+  };
+
+  // map a binary grid
+  explicit TropGrid(const std::filesystem::path& path);
+
+  TropGrid(const TropGrid&) = delete;
+  TropGrid& operator=(const TropGrid&) = delete;
+
+  ~TropGrid() noexcept;
+
+  // grid of a text or binary file, a text grid is converted to `<path>.bin` beside it unless that is up to date
+  // the grids are shared by every station loading the same file
+  static auto load(const std::filesystem::path& path) -> std::shared_ptr<const TropGrid>;
+
+  // convert a gpt2 (34 columns) or gpt2w (44 columns) text grid
+  static void convert_gpt2(const std::filesystem::path& text, const std::filesystem::path& binary);
+
+  // convert vmf3 text grids (one epoch each) and the orography of their nodes
+  static void convert_vmf3(std::span<const std::filesystem::path> grids, const std::filesystem::path& orography,
+                           const std::filesystem::path& binary);
+
+  inline auto header() const noexcept -> const Header& { return *header_; }
+
+  inline TropGridKind kind() const noexcept { return header_->kind; }
+
+  // grid epochs (mjd)
+  inline auto epochs() const noexcept -> std::span<const f64> { return {epochs_, header_->epochs}; }
+
+  // index of the node (north to south, east from 0 degree)
+  inline u32 node_index(u32 row, u32 col) const noexcept { return row * header_->cols + col; }
+
+  inline auto gpt2(u32 index) const noexcept -> const Gpt2Node& {
+    return reinterpret_cast<const Gpt2Node*>(nodes_)[index];
+  }
+
+  inline auto vmf3(u32 epoch, u32 index) const noexcept -> const Vmf3Node& {
+    return reinterpret_cast<const Vmf3Node*>(nodes_)[epoch * header_->rows * header_->cols + index];
+  }
+
+  // four nodes around a station and their bilinear weights, the nearest node only near the poles
+  void surrounding(f64 lat, f64 lon, std::array<u32, 4>& index, std::array<f64, 4>& weight) const noexcept;
+
+ protected:
+  void* map_ = nullptr;
+  size_t length_ = 0;
+  const Header* header_ = nullptr;
+  const f64* epochs_ = nullptr;
+  const f64* nodes_ = nullptr;
+};
+
+// zenith delays and vienna mapping coefficients (a, b, c) of a station
+struct TropGridZenith {
+  f64 dry_ztd = 0, wet_ztd = 0;                 // zenith delays (m)
+  std::array<f64, 3> dry_coeff{}, wet_coeff{};  // mapping coefficients
+};
+
+// evaluation of a grid at a station
+// - the four surrounding nodes and their weights are kept until the station moves, see `set_station`
+// - gpt2/gpt2w are evaluated once a day, the vmf3 nodes of the two grid epochs around the time are interpolated
+//   once, so that an epoch only interpolates them in time and reduces them to the station height
+class NAVP_EXPORT TropGridStation {
+ public:
+  // station (rad, rad, m)
+  void set_station(const TropGrid& grid, f64 lat, f64 lon, f64 hgt) noexcept;
+
+  // zenith delays and mapping coefficients at `mjd`, false if the grid is not usable
+  bool evaluate(const TropGrid& grid, f64 mjd, TropGridZenith& zenith) noexcept;
+
+ protected:
+  bool evaluate_gpt2(const TropGrid& grid, f64 mjd, TropGridZenith& zenith) noexcept;
+
+  bool evaluate_vmf3(const TropGrid& grid, f64 mjd, TropGridZenith& zenith) noexcept;
+
+  f64 lat_ = 0, lon_ = 0, hgt_ = 0;  // station
+  std::array<u32, 4> index_{};       // surrounding nodes
+  std::array<f64, 4> weight_{};      // bilinear weights
+  bool located_ = false;             // nodes of the station found
+  f64 day_ = -1;                     // day (mjd) of the gpt2 zenith or the vmf3 b and c coefficients
+  TropGridZenith daily_;             // gpt2 zenith, or vmf3 b and c coefficients of the day
+  u32 epoch_ = 0;                    // first grid epoch of the interpolated vmf3 nodes
+  bool interpolated_ = false;        // vmf3 nodes interpolated at the station
+  TropGrid::Vmf3Node vmf3_[2]{};     // vmf3 nodes at the station of the two grid epochs
+};
+
+}  // namespace navp::sensors::gnss
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <map>
+#include <span>
+#include <vector>
+
+#include "sensors/gnss/enums.hpp"
+#include "sensors/gnss/sv.hpp"
+#include "utils/eigen.hpp"
+#include "utils/macro.hpp"
+#include "utils/time.hpp"
+
+namespace navp::solution {
+
+// double difference ambiguity N(sv, ref) = SD(sv) - SD(ref) of one code (cycle)
+struct NAVP_EXPORT AmbiguityKey {
+  sensors::gnss::Sv sv;             // moving satellite
+  sensors::gnss::ObsCodeEnum code;  // observation code
+  sensors::gnss::Sv ref;            // reference satellite
+
+  auto operator<=>(const AmbiguityKey& rhs) const = default;
+};
+
+// Double difference ambiguities carried from one epoch to the next
+// - the float estimates are carried with their joint covariance (sequential least square of constant
+//   parameters), fixed integers are held with a tight variance
+// - a reference satellite change is handled by re-differencing, N(s, r') = N(s, r) - N(r', r)
+// - an ambiguity is only dropped on a cycle slip of either satellite, a loss of track or a data gap
+class NAVP_EXPORT AmbiguityState {
+ public:
+  static constexpr f64 MaxGap = 30.0;        // max gap between epochs, otherwise reset (s)
+  static constexpr f64 HoldVariance = 1e-6;  // variance of a held integer (cycle^2)
+
+  // drop all ambiguities
+  void reset() noexcept;
+
+  // drop the ambiguities involving the signal (as moving or reference satellite)
+  void reset(sensors::gnss::Sv sv, sensors::gnss::ObsCodeEnum code) noexcept;
+
+  // map the carried ambiguities onto the ambiguities of the new epoch, return the number of the prior
+  u16 predict(EpochUtc epoch, std::span<const AmbiguityKey> keys) noexcept;
+
+  // index into the prior of each ambiguity of the current epoch, -1 if it has no prior
+  inline auto prior_index() const noexcept -> const std::vector<i32>& { return prior_index_; }
+
+  inline auto prior_value() const noexcept { return prior_value_.head(prior_size_); }
+
+  inline auto prior_covariance() const noexcept { return prior_covariance_.topLeftCorner(prior_size_, prior_size_); }
+
+  inline u16 prior_size() const noexcept { return prior_size_; }
+
+  // replace the carried state by the estimate of the current epoch (keys given to `predict`)
+  void update(const Eigen::Ref<const utils::NavVectorDf64>& value,
+              const Eigen::Ref<const utils::NavMatrixDf64>& covariance) noexcept;
+
+  // hold the ambiguities of the current epoch as integers
+  void hold(const Eigen::Ref<const utils::NavVectorDf64>& integer) noexcept;
+
+  inline size_t size() const noexcept { return keys_.size(); }
+
+  inline bool contains(const AmbiguityKey& key) const noexcept { return index_.contains(key); }
+
+  inline bool is_held(const AmbiguityKey& key) const noexcept {
+    auto it = index_.find(key);
+    return it != index_.end() && held_[it->second];
+  }
+
+ protected:
+  // N(sv, ref) = sum of coeff * carried ambiguity, at most two terms
+  struct Combination {
+    i32 index[2] = {-1, -1};
+    f64 coeff[2] = {0, 0};
+    u8 size = 0;
+  };
+
+  bool _combine(const AmbiguityKey& key, Combination& combination) const noexcept;
+
+  void _rebuild_index() noexcept;
+
+  // carried state
+  EpochUtc epoch_;
+  std::vector<AmbiguityKey> keys_;
+  std::vector<u8> held_;
+  std::map<AmbiguityKey, u16> index_;
+  std::map<std::pair<sensors::gnss::ConstellationEnum, sensors::gnss::ObsCodeEnum>, sensors::gnss::Sv> ref_;
+  utils::NavVectorDf64 value_;
+  utils::NavMatrixDf64 covariance_;
+
+  // prior of the current epoch
+  EpochUtc current_epoch_;
+  std::vector<AmbiguityKey> current_keys_;
+  std::vector<Combination> combination_;
+  std::vector<i32> prior_index_;
+  std::vector<u8> prior_held_;
+  utils::NavVectorDf64 prior_value_;
+  utils::NavMatrixDf64 prior_covariance_;
+  u16 prior_size_ = 0;
+};
+
+}  // namespace navp::solution
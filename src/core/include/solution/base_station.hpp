@@ -0,0 +1,112 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+
+#include "solution/spp.hpp"
+
+namespace navp::solution {
+
+using sensors::gnss::Sv;
+
+// base signal with its variance and observation minus computed residual, immutable once published
+struct NAVP_EXPORT BaseSignal : sensors::gnss::Sig {
+  f64 pseudorange_residual = 0;  // pseudorange - geometric range (m)
+  f64 carrier_residual = 0;      // carrier * wave length - geometric range (m)
+  f64 pseudorange_rate = 0;      // pseudorange residual rate since the previous epoch (m/s)
+  f64 carrier_rate = 0;          // carrier residual rate since the previous epoch (m/s)
+};
+
+struct NAVP_EXPORT BaseSatellite {
+  sensors::gnss::EphemerisResult eph;  // satellite status at the base receive time
+  f64 distance = 0;                    // geometric range between base station and satellite (m)
+  std::vector<BaseSignal> sigs;        // signals of the satellite
+
+  auto find_code(sensors::gnss::ObsCodeEnum code) const noexcept -> const BaseSignal*;
+};
+
+// preprocessed base products of one epoch
+struct NAVP_EXPORT BaseEpoch {
+  EpochUtc epoch;                         // observation epoch
+  utils::CoordinateXyz position;          // base position, reference position if fixed
+  std::vector<BaseSatellite> satellites;  // sorted by satellite
+  f64 clock_drift = 0;                    // base receiver clock drift (m/s)
+  f64 rate_interval = 0;                  // interval to the previous epoch the rates come from (s), 0 if none
+  f64 age = 0;                            // distance to the observed epochs it is predicted from (s), 0 if observed
+
+  auto find(Sv sv) const noexcept -> const BaseSatellite*;
+};
+
+// Base station preprocessing shared by any number of rtk rovers
+// - each base epoch is read and preprocessed once : satellite status, geometric range, variance and
+//   observation minus computed residual of every signal
+// - the products are published as an immutable `BaseEpoch`, rovers on other threads hold them by shared_ptr
+//   and never touch the base observation record
+// - the last `history` epochs are kept, so rovers lagging behind the base still find their epoch
+// - rovers faster than the base get a base epoch predicted at their own epoch : the residuals are interpolated
+//   between the published epochs, or extrapolated with the residual rates (base clock drift if the carrier is
+//   not continuous), and the geometric range is recomputed from the cached satellite position and velocity
+class NAVP_EXPORT BaseStation {
+ public:
+  static constexpr u16 DefaultHistory = 16;
+  static constexpr f64 MaxRateInterval = 30.0;  // residual rates are not estimated across longer gaps (s)
+
+  // base station of the task, read from its observation source by `load_next_epoch`
+  BaseStation(const TaskConfig& task_config, bool enabled_mt = false, u16 history = DefaultHistory);
+
+  // base station read from `station`, e.g. one of the network stations
+  BaseStation(const TaskConfig& task_config, std::shared_ptr<sensors::gnss::GnssHandler> station,
+              u16 history = DefaultHistory);
+
+  // base station without source, epochs are published by the owner
+  BaseStation(u16 history = DefaultHistory) noexcept;
+
+  // read and preprocess the next base epoch and publish it, false at the end of the source
+  bool load_next_epoch() noexcept;
+
+  // preprocess the base observation of one epoch, the variances of `random` with its options
+  static auto preprocess(EpochUtc epoch, const utils::CoordinateXyz& position,
+                         const sensors::gnss::GnssObsRecord::ObsMap& obs_map,
+                         const sensors::gnss::EphemerisSolver::SvMap& sv_map,
+                         const sensors::gnss::GnssRandomHandler& random) noexcept -> std::shared_ptr<BaseEpoch>;
+
+  // estimate the residual rates from the previous published epoch and publish the epoch
+  void publish(std::shared_ptr<BaseEpoch> base_epoch) noexcept;
+
+  // latest published epoch, nullptr if none
+  auto latest() const noexcept -> std::shared_ptr<const BaseEpoch>;
+
+  // published epoch at `epoch`, nullptr if not kept
+  auto at(EpochUtc epoch) const noexcept -> std::shared_ptr<const BaseEpoch>;
+
+  // published epoch at `epoch`, else predicted at `epoch` from the published epochs at most `max_age` seconds away,
+  // nullptr if none
+  auto predict(EpochUtc epoch, f64 max_age) const noexcept -> std::shared_ptr<const BaseEpoch>;
+
+  // true if the epochs are read from a source by `load_next_epoch`
+  inline bool has_source() const noexcept { return base_ != nullptr; }
+
+  // true if the epochs are read from a live network stream, where `load_next_epoch` fails when the next epoch
+  // does not arrive in time rather than at the end of the source
+  bool is_realtime() const noexcept;
+
+  ~BaseStation() = default;
+
+ private:
+  // estimate the residual rates and clock drift of `current` from `previous`
+  static void estimate_rates(const BaseEpoch& previous, BaseEpoch& current) noexcept;
+
+  // move `anchor` to `epoch` with the residual rates of `rates`
+  static auto predict_from(const BaseEpoch& anchor, const BaseEpoch& rates, EpochUtc epoch) noexcept
+      -> std::shared_ptr<BaseEpoch>;
+
+  std::unique_ptr<Spp> base_;                               // base station server, nullptr if without source
+  bool fixed_ = false;                                      // fixed base uses its reference position
+  u16 history_;                                             // published epochs kept
+  mutable std::mutex mutex_;                                // guards the published epochs
+  std::deque<std::shared_ptr<const BaseEpoch>> published_;  // published epochs, the latest at back
+  mutable std::shared_ptr<const BaseEpoch> predicted_;      // last prediction, shared by rovers at the same epoch
+  u64 generation_ = 0;                                      // number of published epochs
+};
+
+}  // namespace navp::solution
@@ -3,6 +3,7 @@
 #include <spdlog/logger.h>
 
 #include "algorithm/algorithm.hpp"
+#include "io/format_options.hpp"
 #include "sensors/gnss/enums.hpp"
 #include "solution/solution.hpp"
 #include "toml++/toml.hpp"
@@ -79,6 +80,10 @@ class NAVP_EXPORT NavConfigManger : public toml::parse_result {
   NAV_NODISCARD_ERROR_HANDLE auto base_station(bool enabled_mt = false) const noexcept
       -> std::shared_ptr<sensors::gnss::GnssHandler>;
 
+  // base stations of network rtk, empty if absent
+  NAV_NODISCARD_ERROR_HANDLE auto network_stations(bool enabled_mt = false) const noexcept
+      -> std::vector<std::shared_ptr<sensors::gnss::GnssHandler>>;
+
   // solution rover station
   NAV_NODISCARD_ERROR_HANDLE auto rover_station(bool enabled_mt = false) const noexcept
       -> std::shared_ptr<sensors::gnss::GnssHandler>;
@@ -95,8 +100,35 @@ class NAVP_EXPORT NavConfigManger : public toml::parse_result {
   // ratio limit
   NAV_NODISCARD_ERROR_HANDLE auto ratio() const noexcept -> f32;
 
+  // fault detection and exclusion, disabled if absent
+  NAV_NODISCARD_ERROR_HANDLE auto raim() const noexcept -> bool;
+
+  // warm start from the previous epoch, disabled if absent
+  NAV_NODISCARD_ERROR_HANDLE auto warm_start() const noexcept -> bool;
+
+  // max age of a base epoch predicted at the rover epoch (s), only exactly aligned epochs if absent
+  NAV_NODISCARD_ERROR_HANDLE auto base_max_age() const noexcept -> f64;
+
+  // combination of the network rtk baselines, 0 independent or 1 joint, independent if absent
+  NAV_NODISCARD_ERROR_HANDLE auto network_mode() const noexcept -> u8;
+
+  // sliding window length of the factor graph (epochs), 10 if absent
+  NAV_NODISCARD_ERROR_HANDLE auto window() const noexcept -> u8;
+
+  // ceres threads of the factor graph, 1 if absent
+  NAV_NODISCARD_ERROR_HANDLE auto graph_threads() const noexcept -> u16;
+
+  // store file of the forward-backward smoother of the kalman filter, disabled if absent or empty
+  NAV_NODISCARD_ERROR_HANDLE auto smoother() const noexcept -> std::string;
+
   // output stream
   NAV_NODISCARD_ERROR_HANDLE auto output_dir() const noexcept -> std::string;
+
+  // solution file, 0 text or 1 binary, text if absent
+  NAV_NODISCARD_ERROR_HANDLE auto output_format() const noexcept -> u8;
+
+  // options of the text solution, the defaults of `io::FormatOptions` for the absent keys
+  NAV_NODISCARD_ERROR_HANDLE auto output_options() const noexcept -> io::FormatOptions;
 };
 
 }  // namespace navp::solution
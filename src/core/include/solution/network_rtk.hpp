@@ -0,0 +1,122 @@
+#pragma once
+
+#include <chrono>
+#include <span>
+
+#include "solution/rtk.hpp"
+#include "utils/thread_pool.hpp"
+
+namespace navp::solution {
+
+// One rover against several base stations, the baselines are built and solved concurrently on a thread pool
+// - the rover epoch, its spp solution and the rover signal variance are computed once and shared by every baseline
+// - each baseline predicts its base epoch at the rover epoch, see `BaseStation::predict`
+// - `Independent` solves every baseline with its own ambiguities carried between epochs, the position is the
+//   inverse covariance weighted mean of the fixed baselines, of the float ones if none is fixed
+// - `Joint` stacks the dd models of every baseline on one rover position and resolves the ambiguities of the epoch
+//   together, the rover noise shared by the baselines is not correlated in the weight
+// - the baselines are only combined, `solution.network_mode` selects one of the two above; inter-base virtual
+//   observations (network corrections interpolated between the base stations) are not formed, every baseline uses
+//   the observations of its own base station only
+class NAVP_EXPORT NetworkRtk {
+ public:
+  enum SolveMode : u8 {
+    Independent = 0,
+    Joint = 1,
+  };
+
+  class NAVP_EXPORT Baseline : protected __RtkPayload {
+   public:
+    // time spent on the baseline at the last epoch
+    struct Timing {
+      std::chrono::nanoseconds prepare{0};  // base epoch prediction and payload
+      std::chrono::nanoseconds solve{0};    // independent solution, or its part of the joint model
+    };
+
+    Baseline(const TaskConfig& task_config, std::shared_ptr<BaseStation> base) noexcept;
+
+    inline auto base() const noexcept -> const std::shared_ptr<BaseStation>& { return base_station_; }
+
+    // solution of the baseline, valid in `Independent` mode
+    inline auto solution() const noexcept -> const PvtSolutionRecord& { return solution_; }
+
+    inline auto timing() const noexcept -> const Timing& { return timing_; }
+
+    // true if the baseline takes part in the solution of the last epoch
+    inline bool available() const noexcept { return available_; }
+
+   private:
+    friend class NetworkRtk;
+
+    // base epoch at the rover epoch and the payload of the baseline, the rover signal variance is handled before
+    bool prepare(const Spp* rover, f64 base_max_age) noexcept;
+
+    bool solve(f32 ratio_threshold, const std::shared_ptr<spdlog::logger>& logger) noexcept;
+
+    // model rows and ambiguity columns of the baseline in the joint model start from `dd_ambiguity_index`
+    void build_joint_model(algorithm::WeightedLeastSquare<f64>* wls, u16 dd_ambiguity_index,
+                           const utils::CoordinateXyz& rover_pos) noexcept;
+
+    void update_joint_geometry(algorithm::WeightedLeastSquare<f64>* wls, u16 dd_ambiguity_index,
+                               const utils::CoordinateXyz& rover_pos) noexcept;
+
+    std::shared_ptr<BaseStation> base_station_;    // base station, may be shared with other rovers
+    std::shared_ptr<const BaseEpoch> base_epoch_;  // base epoch at the rover epoch
+    PvtSolutionRecord solution_;                   // solution of the baseline
+    Timing timing_;                                // time spent at the last epoch
+    bool available_ = false;                       // takes part in the last epoch
+  };
+
+  // network of the task stations (`solution.bases`), the base stations are owned
+  NetworkRtk(const TaskConfig& task_config, bool enabled_mt = false);
+
+  // network of base stations shared with other rovers, the base epochs are loaded by their owner
+  NetworkRtk(const TaskConfig& task_config, std::vector<std::shared_ptr<BaseStation>> bases, bool enabled_mt = false);
+
+  ~NetworkRtk() noexcept = default;
+
+  // load the next rover epoch, owned base stations are read up to it, false at the end of the rover
+  bool load_next_epoch() noexcept;
+
+  // solve the rover epoch against every available baseline, false if none is available or solved
+  bool solve() noexcept;
+
+  inline auto solution() const noexcept -> const PvtSolutionRecord* { return std::addressof(solution_.last()); }
+
+  inline auto baselines() const noexcept -> const std::vector<std::unique_ptr<Baseline>>& { return baselines_; }
+
+  inline auto mode() const noexcept -> SolveMode { return mode_; }
+
+  inline void set_mode(SolveMode mode) noexcept { mode_ = mode; }
+
+  // inverse covariance weighted mean of the baseline solutions into `sol`, of the fixed ones if any is fixed
+  // return false if there is no solution
+  static bool combine(std::span<const PvtSolutionRecord* const> solutions, PvtSolutionRecord& sol) noexcept;
+
+ protected:
+  // variance of every rover signal, computed once before the baselines read it concurrently
+  void handle_rover_variance() noexcept;
+
+  bool solve_independent() noexcept;
+
+  bool solve_joint() noexcept;
+
+  f32 ratio_threshold_;
+  f64 base_max_age_;  // max age of a predicted base epoch (s)
+  SolveMode mode_;    // `solution.network_mode`
+  bool own_bases_;    // the base epochs are loaded by this rtk
+  bool enabled_mt_;   // owned base stations are read concurrently
+
+  std::shared_ptr<spdlog::logger> logger_;  ///> logger
+
+  std::unique_ptr<Spp> rover_;                        ///> rover server, shared by the baselines
+  std::vector<std::unique_ptr<Baseline>> baselines_;  ///> baselines, one for each base station
+  utils::ThreadPool pool_;                            ///> workers of the baselines
+
+  std::unique_ptr<algorithm::WeightedLeastSquare<f64>> wls_;  ///> joint model
+  algorithm::AmbiguityFixer ambiguity_fixer_;                 ///> integer ambiguity resolution of the joint model
+
+  utils::RingBuffer<PvtSolutionRecord> solution_;  ///> solution
+};
+
+}  // namespace navp::solution
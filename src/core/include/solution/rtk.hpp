@@ -2,6 +2,9 @@
 
 #include <set>
 
+#include "algorithm/ambiguity_fixer.hpp"
+#include "solution/ambiguity_state.hpp"
+#include "solution/base_station.hpp"
 #include "solution/spp.hpp"
 #include "solution/task.hpp"
 
@@ -15,10 +18,6 @@ class Rtk;
 struct __RtkPayload;
 
 struct __RtkPayload {
-  struct Indicator {
-    i64 base_fixed : 1;
-  } indicator_;
-
   struct SystemPayload {
     struct ObservationCache {
       f64 pseudorange, carrier;
@@ -29,19 +28,18 @@ struct __RtkPayload {
     std::vector<Sv> public_view_satellites;        // the first should be reference satellite
     std::vector<f64> bt_base_satellites_distance;  // the distance between base station and public view satellites
     std::vector<const sensors::gnss::EphemerisResult*> rover_eph;  // rover ephemeris result
-    std::vector<const sensors::gnss::Sig*> rover_sigs, base_sigs;  // rover/base signals, the size should be
+    std::vector<sensors::gnss::Sig*> rover_sigs;                   // rover signals, the size should be
                                                                    // num_sigs = num_code * num_satellites;
+    std::vector<const sensors::gnss::Sig*> base_sigs;              // base signals of the same size, read only
     std::set<sensors::gnss::ObsCodeEnum> available_code_set;       // available codes
-    const PvtSolutionRecord* rover_spp_sol_;                       // rover spp solution record
 
     mutable std::unique_ptr<ViewVectorCache> view_vector_cache;  // view vector cache
     mutable std::unique_ptr<ObservationCacheVector> btsta_sd_obs_cache, rover_btsat_sd_obs_cache,
         base_btsat_sd_obs_cache, dd_obs_cache;  // differential observation cache
     mutable std::unique_ptr<ObservationCacheVector> btsta_sd_random_cache, rover_btsat_sd_random_cache,
-        base_btsat_sd_random_cache;
-    mutable std::unique_ptr<utils::NavMatrixDf64> dd_weight_cache;  // differential random cache
+        base_btsat_sd_random_cache;  // differential random cache
 
-    void select_available_sigs(const GnssHandler* rover, const GnssHandler* base,
+    void select_available_sigs(const GnssHandler* rover, const BaseEpoch* base,
                                const filter::MaskFilters* mask_filter) noexcept;
 
     inline u16 bt_station_ambiguity_size() const noexcept {
@@ -52,12 +50,12 @@ struct __RtkPayload {
       return static_cast<u16>(available_code_set.size() * (public_view_satellites.size() - 1));
     }
 
-    inline u8 dd_ambiguity_size() const noexcept {
-      return static_cast<u8>(available_code_set.size() * (public_view_satellites.size() - 1));
+    inline u16 dd_ambiguity_size() const noexcept {
+      return static_cast<u16>(available_code_set.size() * (public_view_satellites.size() - 1));
     }
 
     bool is_view_vector_cached() const noexcept;
-    void update_view_vector_cache() const noexcept;
+    void update_view_vector_cache(const utils::CoordinateXyz& rover_pos) const noexcept;
     void reset_view_vector_cache() const noexcept;
 
     bool is_bt_sta_sd_obs_cached() const noexcept;
@@ -80,20 +78,31 @@ struct __RtkPayload {
     void update_bt_sat_sd_random_cache() const noexcept;
     void reset_bt_sat_sd_random_cache() const noexcept;
 
-    bool is_dd_weight_cached() const noexcept;
-    void update_dd_weight_cache() const noexcept;
-    void reset_dd_weight_cache() const noexcept;
+    // variance of the rover signals at once, the base signals are published with their variance
+    void handle_variance(const sensors::gnss::GnssRandomHandler& rover_random) const noexcept;
 
-    void handle_variance(sensors::gnss::RandomModelEnum rover_model,
-                         sensors::gnss::RandomModelEnum base_model) const noexcept;
+    // model rows of each code : | pseudorange (dd sats) | carrier (dd sats) |
+    // parameters : | rover position (3) | dd ambiguity of each code and dd satellite (cycle) |
 
+    // geometry columns of the jacobian
     void build_dd_jacobian(Eigen::Block<utils::NavMatrixDf64> jacobian) const noexcept;
 
-    void build_dd_observation(Eigen::Block<utils::NavVectorDf64> observation) const noexcept;
+    // ambiguity columns of the jacobian
+    void build_dd_ambiguity_jacobian(Eigen::Block<utils::NavMatrixDf64> jacobian) const noexcept;
+
+    void build_dd_observation(Eigen::Block<utils::NavVectorDf64> observation, const f64* ambiguity) const noexcept;
 
+    // closed form inverse of the dd covariance, written directly into the weight block
     void build_dd_weight(Eigen::Block<utils::NavMatrixDf64> weight) const noexcept;
 
-    void build_dd_model(algorithm::WeightedLeastSquare<f64>* wls, u16 dd_ambiguity_index) const noexcept;
+    // build the whole model of the epoch
+    void build_dd_model(algorithm::WeightedLeastSquare<f64>* wls, u16 dd_ambiguity_index,
+                        const utils::CoordinateXyz& rover_pos) const noexcept;
+
+    // refresh the rover geometry dependent part of the model in place (view vectors, geometry columns and
+    // observation), the dd observation cache and the weight block are kept
+    void update_dd_geometry(algorithm::WeightedLeastSquare<f64>* wls, u16 dd_ambiguity_index,
+                            const utils::CoordinateXyz& rover_pos) const noexcept;
   };
 
   __RtkPayload() = default;
@@ -102,8 +111,20 @@ struct __RtkPayload {
 
   auto epoch() const noexcept -> EpochUtc;
 
+  // position, covariance and sigma of the float solution
+  static void evaluate_float(PvtSolutionRecord& sol, const algorithm::WeightedLeastSquare<f64>& wls,
+                             const utils::NavMatrixDf64& covariance) noexcept;
+
+  // position and covariance of the fixed solution, the fixed baseline starts from `base_pos`
+  static void evaluate_fixed(PvtSolutionRecord& sol, const algorithm::AmbiguityFixer& fixer,
+                             const utils::CoordinateXyz& base_pos) noexcept;
+
+  static constexpr u8 MaxIteration = 10;      // max iteration of the float solution
+  static constexpr f64 ConvergeLimit = 1e-4;  // position correction to stop iterating (m)
+
  protected:
-  bool _reset(const Spp* rover, const Spp* base) noexcept;
+  // the rover signal variance can be left to the caller when the rover is shared by several payloads
+  bool _reset(const Spp* rover, const BaseEpoch* base, bool handle_rover_variance = true) noexcept;
 
   __RtkPayload& _set_maskfilters(const TaskConfig& config) noexcept;
 
@@ -112,19 +133,49 @@ struct __RtkPayload {
 
   void _build_dd_model() noexcept;
 
+  void _update_dd_geometry() noexcept;
+
+  // the dd model of the epoch placed in `wls` from `dd_ambiguity_index`, several payloads share one model this way
+  void _build_dd_model(algorithm::WeightedLeastSquare<f64>* wls, u16 dd_ambiguity_index,
+                       const utils::CoordinateXyz& rover_pos) noexcept;
+
+  void _update_dd_geometry(algorithm::WeightedLeastSquare<f64>* wls, u16 dd_ambiguity_index,
+                           const utils::CoordinateXyz& rover_pos) noexcept;
+
+  // float solution linearized at the position of `sol` and integer ambiguity resolution, false if the float
+  // solution does not converge
+  bool _solve(PvtSolutionRecord& sol, f32 ratio_threshold, const std::shared_ptr<spdlog::logger>& logger) noexcept;
+
   f64 _iter_once() noexcept;
 
   void _update_rover_position(const utils::CoordinateXyz* pos) noexcept;
 
-  void _fix_ambiguity(f32 ratio_threshold) noexcept;
+  // collect the dd ambiguities of the epoch in parameter order, drop the carried ones broken by cycle slips
+  // and map the rest onto the epoch
+  void _predict_ambiguity() noexcept;
+
+  // the carried ambiguities are appended to the model as prior observations, N = N_prior
+  void _build_ambiguity_prior() noexcept;
+
+  void _update_ambiguity_prior() noexcept;
+
+  // carry the float ambiguities of the epoch, `float_qxx` is the covariance of the float solution
+  void _update_ambiguity_state(const utils::NavMatrixDf64& float_qxx) noexcept;
+
+  // integer ambiguity resolution of the float solution, partially fixed if the whole set is not reliable
+  // the ambiguities are held if the whole set is fixed
+  bool _fix_ambiguity(const utils::NavMatrixDf64& float_qxx, f32 ratio_threshold) noexcept;
 
   u16 _bt_station_ambiguity_size() const noexcept;
 
   u16 _bt_satellite_ambiguity_size() const noexcept;
 
-  u8 _dd_ambiguity_size() const noexcept;
+  u16 _dd_ambiguity_size() const noexcept;
 
   std::unique_ptr<algorithm::WeightedLeastSquare<f64>> wls_;  // weighted least square
+  algorithm::AmbiguityFixer ambiguity_fixer_;                 // integer ambiguity resolution
+  AmbiguityState ambiguity_state_;                            // ambiguities carried between epochs
+  std::vector<AmbiguityKey> ambiguity_keys_;                  // ambiguities of the epoch, in parameter order
   std::unordered_map<ConstellationEnum, SystemPayload> system_payload_map_;
   const utils::CoordinateXyz* rover_pos_;
 
@@ -150,7 +201,8 @@ struct __RtkPayload {
 
   void _handle_variance() noexcept;
 
-  const GnssHandler *rover_, *base_;        // gnsshandler pointer
+  const GnssHandler* rover_;                // rover gnsshandler pointer
+  const BaseEpoch* base_;                   // preprocessed base epoch
   const filter::MaskFilters* mask_filter_;  // filters
   const utils::CoordinateXyz* base_pos_;    // position
 };
@@ -161,10 +213,18 @@ class NAVP_EXPORT Rtk : protected __RtkPayload {
     DdBasic = 0,
   };
 
+  // rtk with its own base station
   Rtk(const TaskConfig& task_config, bool enabled_mt = false);
 
+  // rtk of a base station shared with other rovers, the base epochs are loaded by its owner
+  Rtk(const TaskConfig& task_config, std::shared_ptr<BaseStation> base, bool enabled_mt = false);
+
   ~Rtk() noexcept = default;
 
+  // load the next rover epoch and its base epoch, false at the end of the rover (or of an owned base), or if a
+  // shared base has not reached the rover epoch
+  // - the base epoch is predicted at the rover epoch from base epochs at most `base_max_age` seconds away, rover
+  //   epochs without one are skipped
   bool load_next_epoch() noexcept;
 
   bool load_rtk_payload() noexcept;
@@ -172,21 +232,17 @@ class NAVP_EXPORT Rtk : protected __RtkPayload {
   bool solve(RtkModel model = DdBasic) noexcept;
 
  protected:
-  void model(RtkModel model = DdBasic) noexcept;
-
-  void model_dd_basic() noexcept;
-
-  void update_position_after_iter() noexcept;
-
-  void evaluate() noexcept;
-
   bool align_time() noexcept;
 
   f32 ratio_threshold_;
+  f64 base_max_age_;  // max age of a predicted base epoch (s), 0 for exactly aligned epochs only
 
   std::shared_ptr<spdlog::logger> logger_;  ///> logger
 
-  std::unique_ptr<Spp> rover_, base_;  ///> rover server and base server
+  std::unique_ptr<Spp> rover_;                   ///> rover server
+  std::shared_ptr<BaseStation> base_;            ///> base station, may be shared by many rovers
+  std::shared_ptr<const BaseEpoch> base_epoch_;  ///> base epoch aligned with the rover
+  bool own_base_;                                ///> the base epochs are loaded by this rtk
 
   utils::RingBuffer<PvtSolutionRecord> solution_;  ///> solution
 };
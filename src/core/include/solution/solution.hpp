@@ -1,6 +1,7 @@
 #pragma once
 
 #include "io/record.hpp"
+#include "sensors/gnss/sv.hpp"
 #include "utils/macro.hpp"
 #include "utils/space.hpp"
 #include "utils/time.hpp"
@@ -38,6 +39,9 @@ struct NAVP_EXPORT PvtSolutionRecord : public io::Record {
   u8 type; /* type (0:xyz-ecef,1:enu-baseline) */
   u8 syss; /* number of systems */
   u8 ns;   /* number of valid satellites */
+  u8 iter = 0;                    /* number of position iterations */
+  u8 nex = 0;                     /* number of satellites excluded by fault detection */
+  sensors::gnss::Sv excluded[8];  /* excluded satellites */
 };
 
 }  // namespace navp::solution
\ No newline at end of file
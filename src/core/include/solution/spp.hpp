@@ -1,6 +1,11 @@
 #pragma once
 
+#include "algorithm/factor_graph.hpp"
+#include "algorithm/kalman_filter.hpp"
+#include "algorithm/raim.hpp"
+#include "algorithm/rts_smoother.hpp"
 #include "algorithm/wls.hpp"
+#include "sensors/gnss/atmosphere.hpp"
 #include "sensors/gnss/gnss.hpp"
 #include "solution/solution.hpp"
 #include "solution/task.hpp"
@@ -26,12 +31,20 @@ struct __SppPayload {
 
   __SppPayload& _set_clock_map(const std::shared_ptr<GnssHandler>& handler) noexcept;
 
+  __SppPayload& _set_trop_grid(const std::shared_ptr<GnssHandler>& handler) noexcept;
+
+  __SppPayload& _set_ionex(const std::shared_ptr<GnssHandler>& handler) noexcept;
+
+  __SppPayload& _set_broadcast_iono(const std::shared_ptr<GnssHandler>& handler) noexcept;
+
   __SppPayload& _set_wls(u32 parameter_size, u32 observation_size, std::shared_ptr<spdlog::logger> logger) noexcept;
 
   __SppPayload& _set_atmosphere_error(u16 number) noexcept;
 
   __SppPayload& _set_solution(PvtSolutionRecord* sol) noexcept;
 
+  __SppPayload& _predict_solution(const PvtSolutionRecord* previous) noexcept;
+
   auto _raw_obs_at(u16 index) const noexcept -> const sensors::gnss::GnssRawObsHandler&;
 
   auto _trop_error_at(u16 index) const noexcept -> f64;
@@ -50,6 +63,8 @@ struct __SppPayload {
 
   inline auto _iono_error() noexcept -> AtmosphereError& { return *iono_error_; }
 
+  inline bool _warm_started() const noexcept { return warm_started_; }
+
   void _calculate_atmosphere_error(TropModelEnum trop, IonoModelEnum iono) noexcept;
 
   f64 _position_iter_once() noexcept;
@@ -60,6 +75,10 @@ struct __SppPayload {
 
   void _velocity_evaluate() noexcept;
 
+  bool _position_fde(std::shared_ptr<spdlog::logger> logger) noexcept;
+
+  void _exclude_satellite(u16 index, std::shared_ptr<spdlog::logger> logger) noexcept;
+
   EpochUtc epoch() const noexcept;
 
   u16 satellite_number() const noexcept;
@@ -70,7 +89,10 @@ struct __SppPayload {
 
   u8 clock_parameter_index(sensors::gnss::Sv sv) const noexcept;
 
-  void _handle_variance(sensors::gnss::RandomModelEnum model) const noexcept;
+  i32 clock_parameter_index(sensors::gnss::ConstellationEnum sys) const noexcept;
+
+  // variances of the signals of the epoch at once
+  void _handle_variance(const sensors::gnss::GnssRandomHandler& random_handler) const noexcept;
 
   void _reset() noexcept;
 
@@ -79,6 +101,12 @@ struct __SppPayload {
   bool _velocity_solvable() const noexcept;
 
  private:
+  struct AtmosphereCache {
+    EpochUtc epoch;  // epoch of calculation
+    f64 elevation;   // elevation of calculation (rad)
+    f64 trop, iono;  // atmosphere error
+  };
+
   const sensors::gnss::GnssRuntimeInfo* info_;                // current epoch information
   std::unique_ptr<ObsHandlerType> obs_handler_;               // observation handler
   mutable ClockParameterMap clock_map_;                       // clock parameter map
@@ -86,14 +114,50 @@ struct __SppPayload {
   std::unique_ptr<algorithm::WeightedLeastSquare<f64>> wls_;  // weighted least square
   const filter::MaskFilters* filters_;                        // maskfilters
   PvtSolutionRecord* sol_;                                    // solution
+  algorithm::FaultDetectionExclusion<f64> fde_;               // fault detection and exclusion
+  std::vector<u16> sig_group_;                                // first signal index of each satellite
+  bool warm_started_ = false;                                 // position predicted from the previous epoch
+  std::unordered_map<sensors::gnss::Sv, AtmosphereCache> atmosphere_cache_;  // atmosphere error of the last calculation
+  sensors::gnss::TropHandler trop_handler_;                                  // zenith delays of the station
+  sensors::gnss::IonoHandler iono_handler_;                                  // ionosphere models of the station
+  std::vector<u16> batch_index_;                                             // satellites of the atmosphere batch
+  std::vector<sensors::gnss::ConstellationEnum> batch_system_;               // constellations of the batch
+  std::vector<f64> batch_azimuth_, batch_elevation_;                         // azimuths and elevations of the batch
+  std::vector<f64> trop_slant_, iono_slant_;                                 // atmosphere error of the batch
+};
+
+// kalman filter state of spp
+// | position(3) | velocity(3) | clock drift(1) | clock(one per constellation) |
+struct __SppFilterPayload {
+  static constexpr u16 PositionIndex = 0, VelocityIndex = 3, ClockDriftIndex = 6, ClockIndex = 7;
+
+  __SppFilterPayload(u16 capacity) noexcept;
+
+  void _initialize(const PvtSolutionRecord& sol, u8 clock_number) noexcept;
+
+  void _predict(f64 dt) noexcept;
+
+  bool _initialized() const noexcept { return initialized_; }
+
+  inline auto _kf() noexcept -> algorithm::KalmanFilter<f64>& { return kf_; }
+
+  inline auto _kf() const noexcept -> const algorithm::KalmanFilter<f64>& { return kf_; }
+
+ private:
+  algorithm::KalmanFilter<f64> kf_;  // kalman filter
+  bool initialized_ = false;
 };
 
 class NAVP_EXPORT Spp : protected __SppPayload {
   friend class Rtk;
+  friend class BaseStation;
 
  public:
   Spp(const TaskConfig& task_config, bool enabled_mt = false);
 
+  // spp of the given station instead of the rover of the task
+  Spp(const TaskConfig& task_config, std::shared_ptr<GnssHandler> station);
+
   using __SppPayload::epoch;
 
   auto station() const noexcept -> const GnssHandler*;
@@ -108,6 +172,14 @@ class NAVP_EXPORT Spp : protected __SppPayload {
 
   virtual bool solve_velocity() noexcept;
 
+  virtual bool solve_filter() noexcept;
+
+  virtual bool solve_graph() noexcept;
+
+  // forward-backward smoothing of the kalman filter solutions so far, from the last epoch to the first
+  // return false if the smoother is disabled (see `solution.smoother`) or the backward pass failed
+  bool smooth(const std::function<void(const PvtSolutionRecord&)>& callback);
+
   ~Spp() = default;
 
  protected:
@@ -115,8 +187,14 @@ class NAVP_EXPORT Spp : protected __SppPayload {
   virtual void model_spp_position() noexcept;
   virtual void model_spp_velocity() noexcept;
 
-  utils::RingBuffer<PvtSolutionRecord> solution_;  // solution
-  std::shared_ptr<GnssHandler> rover_;             // rover station
+  utils::RingBuffer<PvtSolutionRecord> solution_;     // solution
+  std::shared_ptr<GnssHandler> rover_;                // rover station
+  bool raim_;                                         // enable fault detection and exclusion
+  bool warm_start_;                                   // predict the position from the previous epoch
+  algorithm::AlgorithmEnum algorithm_;                // position algorithm
+  std::unique_ptr<__SppFilterPayload> filter_;        // kalman filter, only for AlgorithmEnum::KalmanFilter
+  std::unique_ptr<fgo::GnssFactorGraph> graph_;       // sliding window, only for AlgorithmEnum::FactorGraphOptimization
+  std::unique_ptr<algorithm::RtsSmoother> smoother_;  // forward pass store, only for the kalman filter of the rover
 };
 
 class NAVP_EXPORT SppServer : public Task, public Spp {
@@ -3,6 +3,7 @@
 #include <solution/config.hpp>
 
 #include "filter/filter.hpp"
+#include "io/custom/solution_writer.hpp"
 #include "utils/macro.hpp"
 
 namespace navp::solution {
@@ -21,10 +22,19 @@ struct NAVP_EXPORT TaskConfig {
     SolutionModeEnum mode;
     algorithm::AlgorithmEnum algorithm;
     i32 capacity;
+    bool raim;
+    bool warm_start;
+    f64 base_max_age;
+    u8 network_mode;
+    u8 window;
+    u16 graph_threads;
+    std::string smoother;
   };
 
   struct Output {
     std::string output_dir;
+    io::custom::SolutionFileEnum file_type;  // solution file
+    io::FormatOptions format_options;        // options of the text solution
   };
 
   struct Filter {
@@ -41,7 +51,11 @@ struct NAVP_EXPORT TaskConfig {
     return config_.rover_station(enabled_mt);
   }
   inline auto base_station(bool enabled_mt = false) const noexcept -> std::shared_ptr<sensors::gnss::GnssHandler> {
-    return config_.rover_station(enabled_mt);
+    return config_.base_station(enabled_mt);
+  }
+  inline auto network_stations(bool enabled_mt = false) const noexcept
+      -> std::vector<std::shared_ptr<sensors::gnss::GnssHandler>> {
+    return config_.network_stations(enabled_mt);
   }
 
  private:
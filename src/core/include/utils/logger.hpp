@@ -3,9 +3,14 @@
 #include <spdlog/logger.h>
 #include <spdlog/spdlog.h>
 
+#include <chrono>
+#include <mutex>
+#include <optional>
 #include <source_location>
+#include <unordered_map>
 
 #include "utils/macro.hpp"
+#include "utils/types.hpp"
 namespace navp {
 
 using spdlog::level::level_enum;
@@ -16,9 +21,17 @@ inline static std::string LogDirection = "/root/project/nav_cxx/log/nav/";
 
 NAVP_EXPORT std::string source_information(std::source_location location = std::source_location::current());
 
-#define nav_log(level, ...)                                                             \
-  navp::details::global_formatted_logger->log(level, "{}", navp::source_information()); \
-  navp::details::global_pure_logger->log(level, __VA_ARGS__);
+// the level is checked before any argument is evaluated, the source location is a constant of the call site
+#define nav_log(level, ...)                                                                                       \
+  do {                                                                                                            \
+    if (navp::details::global_pure_logger->should_log(level)) {                                                   \
+      constexpr auto _nav_location = std::source_location::current();                                            \
+      navp::details::global_formatted_logger->log(level, "{}({}:{}) `{}`", _nav_location.file_name(),             \
+                                                  _nav_location.line(), _nav_location.column(),                   \
+                                                  _nav_location.function_name());                                 \
+      navp::details::global_pure_logger->log(level, __VA_ARGS__);                                                 \
+    }                                                                                                             \
+  } while (false)
 #define nav_trace(...) nav_log(spdlog::level::trace, __VA_ARGS__)
 #define nav_debug(...) nav_log(spdlog::level::debug, __VA_ARGS__)
 #define nav_info(...) nav_log(spdlog::level::info, __VA_ARGS__)
@@ -26,6 +39,44 @@ NAVP_EXPORT std::string source_information(std::source_location location = std::
 #define nav_error(...) nav_log(spdlog::level::err, __VA_ARGS__)
 #define nav_critical(...) nav_log(spdlog::level::critical, __VA_ARGS__)
 
+// log a message repeated for a key, e.g. a satellite, through the rate limiter of the call site
+#define nav_log_limited(level, key, ...)                                                                          \
+  do {                                                                                                            \
+    if (navp::details::global_pure_logger->should_log(level)) {                                                   \
+      static navp::LogRateLimiter _nav_limiter;                                                                   \
+      if (auto _nav_suppressed = _nav_limiter.allow(key)) {                                                       \
+        nav_log(level, __VA_ARGS__);                                                                              \
+        if (*_nav_suppressed) navp::details::global_pure_logger->log(level, "{} similar messages suppressed",     \
+                                                                      *_nav_suppressed);                          \
+      }                                                                                                           \
+    }                                                                                                             \
+  } while (false)
+#define nav_debug_limited(key, ...) nav_log_limited(spdlog::level::debug, key, __VA_ARGS__)
+#define nav_warn_limited(key, ...) nav_log_limited(spdlog::level::warn, key, __VA_ARGS__)
+
+// let through `burst` messages of a key each `period`, the messages suppressed in between are counted and
+// reported with the next message let through
+class NAVP_EXPORT LogRateLimiter {
+ public:
+  explicit LogRateLimiter(u32 burst = 1, std::chrono::milliseconds period = std::chrono::seconds(10)) noexcept
+      : burst_(burst), period_(period) {}
+
+  // the count of suppressed messages if the message of `key` is let through
+  auto allow(u64 key) noexcept -> std::optional<u32>;
+
+ protected:
+  struct KeyState {
+    std::chrono::steady_clock::time_point begin;  // begin of the period
+    u32 passed;                                    // messages let through in the period
+    u32 suppressed;                                // messages suppressed since the last one let through
+  };
+
+  u32 burst_;
+  std::chrono::steady_clock::duration period_;
+  std::mutex mutex_;
+  std::unordered_map<u64, KeyState> states_;
+};
+
 std::shared_ptr<spdlog::logger> create_common_spdlogger(const std::string& loggerFileName,
                                                         const std::string& loggerName,
                                                         const std::string& direction = constants::LogDirection);
@@ -25,9 +25,17 @@ class RingBuffer {
     }
   }
 
-  auto last() -> T& { return data_[index_]; }
+  // the latest pushed element
+  auto last() -> T& { return data_[(index_ + max_size_ - 1) % max_size_]; }
 
-  auto last() const -> const T& { return data_.at(index_); }
+  auto last() const -> const T& { return data_.at((index_ + max_size_ - 1) % max_size_); }
+
+  // the element pushed `n` times before the latest one, n < max_size
+  auto previous(size_t n = 1) -> T& { return data_[(index_ + max_size_ - 1 - n % max_size_) % max_size_]; }
+
+  auto previous(size_t n = 1) const -> const T& {
+    return data_.at((index_ + max_size_ - 1 - n % max_size_) % max_size_);
+  }
 
   auto data() -> std::vector<T>& { return data_; }
 
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <optional>
+
+#include "utils/types.hpp"
+
+namespace navp::utils {
+
+// bounded lock-free queue of one producer thread and one consumer thread
+// - the capacity is rounded up to a power of two, `push` fails when the queue is full
+// - the consumer may sleep on `wait` until an element is pushed or `wake` is called
+template <typename T>
+class SpscQueue {
+ public:
+  explicit SpscQueue(size_t capacity) : mask_(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1) {
+    data_ = std::make_unique<T[]>(mask_ + 1);
+  }
+
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  inline size_t capacity() const noexcept { return mask_ + 1; }
+
+  // producer, false if full
+  bool push(const T& value) noexcept {
+    auto tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_cache_ > mask_) {
+      head_cache_ = head_.load(std::memory_order_acquire);
+      if (tail - head_cache_ > mask_) return false;
+    }
+    data_[tail & mask_] = value;
+    // sequentially consistent with `sleeping_`, either the consumer sees the element or it is woken
+    tail_.store(tail + 1, std::memory_order_seq_cst);
+    if (sleeping_.load(std::memory_order_seq_cst)) wake();
+    return true;
+  }
+
+  // consumer, nullopt if empty
+  auto pop() noexcept -> std::optional<T> {
+    auto head = head_.load(std::memory_order_relaxed);
+    if (head == tail_cache_) {
+      tail_cache_ = tail_.load(std::memory_order_acquire);
+      if (head == tail_cache_) return std::nullopt;
+    }
+    std::optional<T> value(std::move(data_[head & mask_]));
+    head_.store(head + 1, std::memory_order_release);
+    return value;
+  }
+
+  // consumer, sleep while the queue is empty and nothing woke it
+  void wait() noexcept {
+    sleeping_.store(true, std::memory_order_seq_cst);
+    auto signal = signal_.load(std::memory_order_seq_cst);
+    if (head_.load(std::memory_order_relaxed) == tail_.load(std::memory_order_seq_cst) &&
+        !woken_.exchange(false, std::memory_order_seq_cst)) {
+      signal_.wait(signal, std::memory_order_acquire);
+    }
+    sleeping_.store(false, std::memory_order_relaxed);
+  }
+
+  // wake the consumer, e.g. to stop it, a wake before `wait` is not lost
+  void wake() noexcept {
+    woken_.store(true, std::memory_order_seq_cst);
+    signal_.fetch_add(1, std::memory_order_seq_cst);
+    signal_.notify_one();
+  }
+
+ private:
+  static constexpr size_t CacheLine = 64;
+
+  const size_t mask_;                                // capacity - 1
+  std::unique_ptr<T[]> data_;                        // elements
+  alignas(CacheLine) std::atomic<size_t> head_{};    // next element to pop
+  size_t tail_cache_ = 0;                            // tail seen by the consumer
+  alignas(CacheLine) std::atomic<size_t> tail_{};    // next element to push
+  size_t head_cache_ = 0;                            // head seen by the producer
+  alignas(CacheLine) std::atomic<bool> sleeping_{};  // the consumer waits
+  std::atomic<bool> woken_{};                        // woken since the last `wait`
+  std::atomic<u32> signal_{};                        // wakeups of the consumer
+};
+
+}  // namespace navp::utils
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "utils/types.hpp"
+
+namespace navp::utils {
+
+// fixed number of worker threads running the indices of `parallel_for`, the caller works as well and returns
+// once every index is done
+class ThreadPool {
+ public:
+  explicit ThreadPool(u16 threads = std::thread::hardware_concurrency()) {
+    for (u16 i = 1; i < threads; ++i) workers_.emplace_back([this] { work(); });
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) worker.join();
+  }
+
+  // threads running the indices, the caller included
+  inline u16 size() const noexcept { return static_cast<u16>(workers_.size() + 1); }
+
+  // run `func(i)` for i in [0, n)
+  template <typename Func>
+  void parallel_for(size_t n, Func&& func) {
+    if (n == 0) return;
+    if (workers_.empty() || n == 1) {
+      for (size_t i = 0; i < n; ++i) func(i);
+      return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    // late workers of the previous job leave it first
+    done_.wait(lock, [this] { return active_ == 0; });
+    job_ = std::ref(func), size_ = n, pending_ = n, next_ = 0, ++generation_;
+    lock.unlock();
+    wake_.notify_all();
+    run();
+    // every index is done and the workers leave the job before it goes out of scope
+    lock.lock();
+    done_.wait(lock, [this] { return pending_ == 0 && active_ == 0; });
+    job_ = nullptr;
+  }
+
+ private:
+  void work() {
+    u64 generation = 0;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [&] { return stop_ || generation != generation_; });
+        if (stop_) return;
+        generation = generation_, ++active_;
+      }
+      run();
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (--active_ == 0 && pending_ == 0) done_.notify_one();
+    }
+  }
+
+  void run() {
+    size_t finished = 0;
+    for (size_t i = next_.fetch_add(1); i < size_; i = next_.fetch_add(1), ++finished) job_(i);
+    if (finished == 0) return;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if ((pending_ -= finished) == 0 && active_ == 0) done_.notify_one();
+  }
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable wake_, done_;
+  std::function<void(size_t)> job_;  // job of the current `parallel_for`
+  size_t size_ = 0, pending_ = 0;    // indices of the job, indices not finished yet
+  std::atomic<size_t> next_ = 0;     // next index to run
+  u64 generation_ = 0;               // number of jobs
+  u16 active_ = 0;                   // workers running the job
+  bool stop_ = false;
+};
+
+}  // namespace navp::utils
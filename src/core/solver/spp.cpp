@@ -3,7 +3,7 @@
 #include <cpptrace/from_current.hpp>
 #include <print>
 
-#include "io/custom/solution_stream.hpp"
+#include "io/custom/solution_writer.hpp"
 
 using navp::i32;
 using namespace navp::solution;
@@ -15,8 +15,9 @@ class MySpp : public SppServer {
   virtual ~MySpp() override = default;
 
   void set_output_file(std::string_view name) {
-    auto full_name = std::format("{}/{}", task_config().output().output_dir, name);
-    file_ = std::make_unique<navp::io::custom::SolutionStream>(full_name, std::ios::out);
+    auto& output = task_config().output();
+    auto full_name = std::format("{}/{}", output.output_dir, name);
+    file_ = std::make_unique<navp::io::custom::SolutionWriter>(full_name, output.file_type, output.format_options);
   }
 
  protected:
@@ -29,7 +30,7 @@ class MySpp : public SppServer {
     while (true) {
       if (load_next_epoch() && solve()) {
         auto sol = solution();
-        sol->put_record(*file_);
+        file_->push(*sol);
         navp::utils::NavVector3f64 error = sol->position.coord() - ref.coord();
 
         // std::println("{} : {} {}", (sol->time), error.norm(), sol->velocity.norm());
@@ -40,7 +41,7 @@ class MySpp : public SppServer {
   }
 
  private:
-  std::unique_ptr<navp::io::custom::SolutionStream> file_;
+  std::unique_ptr<navp::io::custom::SolutionWriter> file_;
 };
 
 i32 main(i32 argc, char* argv[]) {
@@ -1,17 +1,193 @@
 #include "algorithm/factor_graph.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 namespace navp::fgo {
 
-FactorGraph::FactorGraph() = default;
+using utils::NavMatrix33f64;
+using utils::NavMatrixDf64;
+using utils::NavVectorDf64;
+
+static inline f64 epoch_diff(const EpochUtc& lhs, const EpochUtc& rhs) noexcept {
+  auto diff = lhs - rhs;
+  return static_cast<f64>(diff.seconds()) + static_cast<f64>(diff.scale_fractional_seconds());
+}
+
+// position parameter block of ceres (double) as the f64 state
+static inline auto to_position(const std::array<double, 3>& block) noexcept -> NavVector3f64 {
+  return Eigen::Map<const Eigen::Vector3d>(block.data()).cast<f64>();
+}
+
+// the graph owns the cost functions, removing a residual block only detaches it
+static auto problem_options() -> ceres::Problem::Options {
+  ceres::Problem::Options options;
+  options.cost_function_ownership = ceres::DO_NOT_TAKE_OWNERSHIP;
+  options.enable_fast_removal = true;
+  return options;
+}
+
+FactorGraph::FactorGraph() : FactorGraph(Options{}) {}
+
+FactorGraph::FactorGraph(const Options& options) : options_(options), problem_(problem_options()) {}
 
 FactorGraph::~FactorGraph() = default;
 
-GnssFactorGraph::GnssFactorGraph() = default;
+bool FactorGraph::optimize() noexcept {
+  ceres::Solver::Options options;
+  options.num_threads = options_.threads;
+  options.linear_solver_type = options_.linear_solver;
+  options.max_num_iterations = options_.max_iterations;
+  options.logging_type = ceres::SILENT;
+  auto start = std::chrono::steady_clock::now();
+  ceres::Solve(options, &problem_, &summary_);
+  latency_ = std::chrono::steady_clock::now() - start;
+  return summary_.IsSolutionUsable();
+}
+
+GnssFactorGraph::GnssFactorGraph(u8 window_length) : GnssFactorGraph(window_length, Options{}) {}
+
+GnssFactorGraph::GnssFactorGraph(u8 window_length, const Options& options)
+    : FactorGraph(options), window_length_(std::max<u8>(window_length, 2)) {}
 
 GnssFactorGraph::~GnssFactorGraph() = default;
 
-void GnssFactorGraph::set_slide_window_length(this auto& self, u8 length) noexcept { self.window_length_ = length; }
- 
-u8 GnssFactorGraph::slide_window_length(this const auto& self) noexcept { return self.window_length_; }
+void GnssFactorGraph::set_slide_window_length(u8 length) noexcept {
+  window_length_ = std::max<u8>(length, 2);
+  while (window_.size() > window_length_) marginalize_oldest();
+}
+
+void GnssFactorGraph::add_epoch(const EpochUtc& epoch, const NavVector3f64& position,
+                                std::span<const PseudorangeObservation> observations) {
+  if (window_.size() >= window_length_) marginalize_oldest();
+  auto& state = window_.emplace_back();
+  state.time = epoch;
+  Eigen::Map<Eigen::Vector3d>(state.position.data()) = position.cast<double>();
+  problem_.AddParameterBlock(state.position.data(), 3);
+  // clock parameter blocks of the batch follow the position in order of their first observation
+  std::vector<double*> parameter_blocks{state.position.data()};
+  std::array<u8, MaxClock> block_index{};
+  for (auto& obs : observations) {
+    if (obs.clock >= MaxClock || state.clock_used[obs.clock]) continue;
+    auto clock = std::addressof(state.clock[obs.clock]);
+    *clock = static_cast<double>(obs.pseudorange - (position - obs.sv_pos).norm());
+    state.clock_used[obs.clock] = true;
+    block_index[obs.clock] = static_cast<u8>(parameter_blocks.size() - 1);
+    parameter_blocks.push_back(clock);
+  }
+  if (parameter_blocks.size() > 1) {
+    state.factor = acquire_pseudorange(static_cast<u8>(parameter_blocks.size() - 1));
+    for (auto& obs : observations) {
+      if (obs.clock >= MaxClock) continue;
+      state.factor->add(obs.sv_pos, obs.pseudorange, std::sqrt(obs.variance), block_index[obs.clock]);
+    }
+    problem_.AddResidualBlock(state.factor, nullptr, parameter_blocks);
+  }
+  if (window_.size() < 2) return;
+  auto& previous = window_[window_.size() - 2];
+  auto dt = std::max<f64>(epoch_diff(epoch, previous.time), 1e-3);
+  state.motion = acquire_random_walk(std::sqrt(position_noise_ * dt));
+  problem_.AddResidualBlock(state.motion, nullptr, previous.position.data(), state.position.data());
+}
+
+auto GnssFactorGraph::position() const noexcept -> NavVector3f64 {
+  if (window_.empty()) return NavVector3f64::Zero();
+  return to_position(window_.back().position);
+}
+
+f64 GnssFactorGraph::clock(u8 index) const noexcept {
+  if (window_.empty() || index >= MaxClock || !window_.back().clock_used[index]) return 0.0;
+  return static_cast<f64>(window_.back().clock[index]);
+}
+
+void GnssFactorGraph::clear() noexcept {
+  while (!window_.empty()) remove_oldest();
+  prior_id_ = nullptr;
+}
+
+void GnssFactorGraph::marginalize_oldest() noexcept {
+  if (window_.size() < 2) {
+    clear();
+    return;
+  }
+  auto& oldest = window_[0];
+  auto& next = window_[1];
+  // every residual of the oldest states : its pseudoranges, its prior and the random walk to the next epoch
+  ceres::Problem::EvaluateOptions evaluate_options;
+  problem_.GetResidualBlocksForParameterBlock(oldest.position.data(), &evaluate_options.residual_blocks);
+  evaluate_options.parameter_blocks.push_back(oldest.position.data());
+  for (u8 i = 0; i < MaxClock; ++i) {
+    if (oldest.clock_used[i]) evaluate_options.parameter_blocks.push_back(std::addressof(oldest.clock[i]));
+  }
+  evaluate_options.parameter_blocks.push_back(next.position.data());
+  std::vector<double> residuals;
+  ceres::CRSMatrix crs;
+  bool evaluated = problem_.Evaluate(evaluate_options, nullptr, &residuals, nullptr, &crs);
+
+  // schur complement of the removed states (m) onto the position of the next epoch
+  bool marginalized = false;
+  if (evaluated && crs.num_rows > 0) {
+    NavMatrixDf64 jacobian = NavMatrixDf64::Zero(crs.num_rows, crs.num_cols);
+    for (int row = 0; row < crs.num_rows; ++row) {
+      for (int k = crs.rows[row]; k < crs.rows[row + 1]; ++k) {
+        jacobian(row, crs.cols[k]) = static_cast<f64>(crs.values[k]);
+      }
+    }
+    NavVectorDf64 r = Eigen::Map<const Eigen::VectorXd>(residuals.data(), residuals.size()).cast<f64>();
+    NavMatrixDf64 h = jacobian.transpose() * jacobian;
+    NavVectorDf64 b = jacobian.transpose() * r;
+    auto m = crs.num_cols - 3;
+    Eigen::LLT<NavMatrixDf64> hmm(h.topLeftCorner(m, m));
+    if (hmm.info() == Eigen::Success) {
+      NavMatrixDf64 h_rm = h.bottomLeftCorner(3, m);
+      NavMatrix33f64 h_prior = h.bottomRightCorner<3, 3>() - h_rm * hmm.solve(h.topRightCorner(m, 3));
+      NavVector3f64 b_prior = b.tail<3>() - h_rm * hmm.solve(b.head(m));
+      Eigen::LLT<NavMatrix33f64> llt(h_prior);
+      if (llt.info() == Eigen::Success) {
+        prior_.sqrt_information = NavMatrix33f64(llt.matrixU()).cast<double>();
+        prior_.residual0 = NavVector3f64(llt.matrixL().solve(b_prior)).cast<double>();
+        prior_.x0 = Eigen::Map<const Eigen::Vector3d>(next.position.data());
+        marginalized = true;
+      }
+    }
+  }
+  remove_oldest();
+  if (marginalized) prior_id_ = problem_.AddResidualBlock(&prior_, nullptr, window_.front().position.data());
+}
+
+void GnssFactorGraph::remove_oldest() noexcept {
+  auto& oldest = window_.front();
+  // removing the parameter blocks removes every residual block depending on them
+  problem_.RemoveParameterBlock(oldest.position.data());
+  for (u8 i = 0; i < MaxClock; ++i) {
+    if (oldest.clock_used[i]) problem_.RemoveParameterBlock(std::addressof(oldest.clock[i]));
+  }
+  prior_id_ = nullptr;
+  if (oldest.factor) free_pseudorange_factors_.push_back(oldest.factor);
+  window_.pop_front();
+  if (window_.empty()) return;
+  if (window_.front().motion) free_random_walk_factors_.push_back(window_.front().motion);
+  window_.front().motion = nullptr;
+}
+
+PseudorangeBatchFactor* GnssFactorGraph::acquire_pseudorange(u8 clock_number) {
+  if (free_pseudorange_factors_.empty()) {
+    return pseudorange_factors_.emplace_back(std::make_unique<PseudorangeBatchFactor>(clock_number)).get();
+  }
+  auto factor = free_pseudorange_factors_.back();
+  free_pseudorange_factors_.pop_back();
+  factor->reset(clock_number);
+  return factor;
+}
+
+RandomWalkFactor* GnssFactorGraph::acquire_random_walk(f64 std) {
+  if (free_random_walk_factors_.empty()) {
+    return random_walk_factors_.emplace_back(RandomWalkFactor::Create(std)).get();
+  }
+  auto factor = free_random_walk_factors_.back();
+  free_random_walk_factors_.pop_back();
+  factor->reset(std);
+  return factor;
+}
 
-}  // namespace navp::fgo
\ No newline at end of file
+}  // namespace navp::fgo
@@ -0,0 +1,207 @@
+#include "algorithm/rts_smoother.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <format>
+
+namespace navp::algorithm {
+
+static_assert(std::is_trivially_copyable_v<EpochUtc>, "Epochs are copied into the smoother store as they are");
+
+static constexpr size_t StoreBuffer = 1 << 20;     // write buffer of the store (bytes)
+static constexpr size_t ReleaseBytes = 64 << 20;  // pages read by the backward pass are released by this size
+
+// | header | predicted state | predicted covariance | transition | filtered state | filtered covariance | bytes |
+// the predicted part is absent at the start of a segment, `bytes` is the record length to walk the store backward
+struct RecordHeader {
+  EpochUtc epoch;
+  u32 size = 0;                // states of the epoch
+  u32 previous_size = 0;       // states of the previous epoch, the columns of the transition
+  u32 predicted = 0;           // 1 if the predicted part is present
+  u32 transition_entries = 0;  // non-zero entries of the transition
+};
+
+struct TransitionEntry {
+  u32 row, col;
+  f64 value;
+};
+
+template <typename T>
+static inline void append(std::vector<char>& buffer, const T* data, size_t count) {
+  auto bytes = reinterpret_cast<const char*>(data);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T) * count);
+}
+
+// upper triangle, column by column
+static void append_upper(std::vector<char>& buffer, const Eigen::Ref<const RtsSmoother::Matrix>& matrix) {
+  for (Eigen::Index j = 0; j < matrix.cols(); ++j) append(buffer, matrix.col(j).data(), j + 1);
+}
+
+// the mapped records are copied out, so that they need no alignment
+struct RecordReader {
+  template <typename T>
+  inline void read(T* data, size_t count) noexcept {
+    std::memcpy(data, cursor, sizeof(T) * count);
+    cursor += sizeof(T) * count;
+  }
+
+  void read_upper(RtsSmoother::Matrix& matrix, Eigen::Index size) noexcept {
+    matrix.resize(size, size);
+    for (Eigen::Index j = 0; j < size; ++j) read(matrix.col(j).data(), j + 1);
+    matrix.triangularView<Eigen::StrictlyLower>() = matrix.transpose();
+  }
+
+  const char* cursor;
+};
+
+RtsSmoother::RtsSmoother(std::filesystem::path path) : path_(std::move(path)) {
+  file_ = std::fopen(path_.c_str(), "wb");
+  if (!file_) throw SmootherRuntimeError(std::format("Open smoother store {} failed", path_.string()));
+  std::setvbuf(file_, nullptr, _IOFBF, StoreBuffer);
+}
+
+RtsSmoother::~RtsSmoother() noexcept {
+  if (file_) std::fclose(file_);
+  std::error_code ec;
+  std::filesystem::remove(path_, ec);
+}
+
+void RtsSmoother::predicted(const EpochUtc& epoch, const Eigen::Ref<const Vector>& state,
+                            const Eigen::Ref<const Matrix>& covariance, const Eigen::Ref<const Matrix>& transition) {
+  record_.resize(sizeof(RecordHeader));
+  append(record_, state.data(), state.size());
+  append_upper(record_, covariance);
+  u32 entries = 0;
+  for (Eigen::Index j = 0; j < transition.cols(); ++j) {
+    for (Eigen::Index i = 0; i < transition.rows(); ++i) {
+      if (transition(i, j) == 0.0) continue;
+      TransitionEntry entry{static_cast<u32>(i), static_cast<u32>(j), transition(i, j)};
+      append(record_, &entry, 1);
+      ++entries;
+    }
+  }
+  RecordHeader header{.epoch = epoch,
+                      .size = static_cast<u32>(state.size()),
+                      .previous_size = static_cast<u32>(transition.cols()),
+                      .predicted = 1,
+                      .transition_entries = entries};
+  std::memcpy(record_.data(), &header, sizeof(header));
+  predicted_epoch_ = epoch;
+  has_predicted_ = true;
+}
+
+bool RtsSmoother::filtered(const EpochUtc& epoch, const Eigen::Ref<const Vector>& state,
+                           const Eigen::Ref<const Matrix>& covariance) noexcept {
+  RecordHeader header{};
+  if (has_predicted_) std::memcpy(&header, record_.data(), sizeof(header));
+  // without the prediction of this epoch, the epoch starts a new segment
+  if (!has_predicted_ || !(predicted_epoch_ == epoch) || header.size != static_cast<u32>(state.size())) {
+    record_.resize(sizeof(RecordHeader));
+    header = RecordHeader{.epoch = epoch, .size = static_cast<u32>(state.size())};
+    std::memcpy(record_.data(), &header, sizeof(header));
+  }
+  has_predicted_ = false;
+  append(record_, state.data(), state.size());
+  append_upper(record_, covariance);
+  u64 bytes = record_.size() + sizeof(u64);
+  append(record_, &bytes, 1);
+  if (!file_ || std::fwrite(record_.data(), 1, record_.size(), file_) != record_.size()) return false;
+  ++size_;
+  return true;
+}
+
+bool RtsSmoother::smooth(const Callback& callback) {
+  if (!file_ || std::fflush(file_) != 0) return false;
+  if (size_ == 0) return true;
+  int fd = ::open(path_.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  struct stat info;
+  if (::fstat(fd, &info) != 0 || info.st_size == 0) {
+    ::close(fd);
+    return false;
+  }
+  auto length = static_cast<size_t>(info.st_size);
+  void* map = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (map == MAP_FAILED) return false;
+  ::madvise(map, length, MADV_RANDOM);
+  auto base = static_cast<const char*>(map);
+  auto page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+
+  // smoothed state of the later epoch, and its prediction from the current one
+  Vector state, next_state;
+  Matrix covariance, next_covariance, transition;
+  std::vector<TransitionEntry> next_transition;
+  RecordHeader next_header{};
+  bool ok = true, first = true;
+  size_t end = length, released = length;
+  while (end > 0) {
+    u64 bytes;
+    std::memcpy(&bytes, base + end - sizeof(u64), sizeof(u64));
+    if (bytes < sizeof(RecordHeader) + sizeof(u64) || bytes > end) {
+      ok = false;
+      break;
+    }
+    end -= bytes;
+    RecordReader reader{base + end};
+    RecordHeader header;
+    reader.read(&header, 1);
+    Vector predicted_state;
+    Matrix predicted_covariance;
+    std::vector<TransitionEntry> entries;
+    if (header.predicted) {
+      predicted_state.resize(header.size);
+      reader.read(predicted_state.data(), header.size);
+      reader.read_upper(predicted_covariance, header.size);
+      entries.resize(header.transition_entries);
+      reader.read(entries.data(), entries.size());
+    }
+    Vector filtered_state(header.size);
+    Matrix filtered_covariance;
+    reader.read(filtered_state.data(), header.size);
+    reader.read_upper(filtered_covariance, header.size);
+
+    if (first || !next_header.predicted) {
+      state = std::move(filtered_state);
+      covariance = std::move(filtered_covariance);
+    } else {
+      if (next_header.previous_size != header.size) {
+        ok = false;
+        break;
+      }
+      // gain = P+(k) F' P-(k+1)^-1
+      transition.setZero(next_header.size, header.size);
+      for (auto& entry : next_transition) transition(entry.row, entry.col) = entry.value;
+      Eigen::LDLT<Matrix> ldlt(next_covariance);
+      if (ldlt.info() != Eigen::Success) {
+        ok = false;
+        break;
+      }
+      Matrix gain = ldlt.solve(transition * filtered_covariance).transpose();
+      state = filtered_state + gain * (state - next_state);
+      covariance = filtered_covariance + gain * (covariance - next_covariance) * gain.transpose();
+      covariance = 0.5 * (covariance + covariance.transpose());
+    }
+    callback(header.epoch, state, covariance);
+
+    first = false;
+    next_header = header;
+    next_state = std::move(predicted_state);
+    next_covariance = std::move(predicted_covariance);
+    next_transition = std::move(entries);
+    // the records behind are not read again
+    if (released - end >= ReleaseBytes) {
+      auto release = (end + page - 1) / page * page;
+      ::madvise(const_cast<char*>(base) + release, released - release, MADV_DONTNEED);
+      released = release;
+    }
+  }
+  ::munmap(map, length);
+  return ok;
+}
+
+}  // namespace navp::algorithm
@@ -1,5 +1,7 @@
 #include "sensors/gnss/atmosphere.hpp"
 
+#include <Eigen/Core>
+#include <algorithm>
 #include <numbers>
 
 #define SQR(x) ((x) * (x))
@@ -41,6 +43,12 @@ f64 mapHerring(f64 el, f64 a, f64 b, f64 c) {
   return (1 + a / (1 + b / (1 + c))) / (sinel + (a / (sinel + b / (sinel + c))));
 }
 
+// Herring model of every satellite from the sines of their elevations
+template <typename Array>
+auto mapHerringArray(const Array& sinel, f64 a, f64 b, f64 c) {
+  return (1 + a / (1 + b / (1 + c))) / (sinel + (a / (sinel + b / (sinel + c))));
+}
+
 f64 interpc(const f64 coef[], f64 lat) {
   i32 i = (i32)(lat / 15);
   if (i < 1)
@@ -50,33 +58,53 @@ f64 interpc(const f64 coef[], f64 lat) {
   return coef[i - 1] * (1 - lat / 15 + i) + coef[i] * (lat / 15 - i);
 }
 
-TropSaasResult tropSAAS(utils::GTime time, const utils::CoordinateBlh* pos, f64 el) {
+// zenith delays and niell mapping coefficients of a station, shared by its satellites
+struct TropSaasZenith {
+  f64 dry_ztd = 0;
+  f64 wet_ztd = 0;
+  f64 ah[3] = {};
+  f64 aw[3] = {};
+  bool valid = false;
+};
+
+TropSaasZenith tropSAASZenith(f64 doy, const utils::CoordinateBlh* pos) {
   f64 lat = pos->x();
   f64 hgt = pos->z();
-  if (hgt < -100 || hgt > +20000 || el < 0) {
-    return TropSaasResult{};
+  TropSaasZenith result;
+  if (hgt < -100 || hgt > +20000) {
+    return result;
   }
-  TropSaasResult result;
-  utils::UYds yds = time;
   /* year from doy 28, added half a year for southern latitudes */
-  f64 y = (yds.doy - 28) / 365.25 + (lat < 0 ? 0.5 : 0);
+  f64 y = (doy - 28) / 365.25 + (lat < 0 ? 0.5 : 0);
   f64 cosy = cos(2 * std::numbers::pi * y);
   lat = fabs(lat);
-  f64 ah[3];
-  f64 aw[3];
   for (auto i = 0; i < 3; ++i) { /* year average           +    seasonal variation  */
-    ah[i] = interpc(coefNMF[i], lat) - interpc(coefNMF[i + 3], lat) * cosy;
-    aw[i] = interpc(coefNMF[i + 6], lat);
+    result.ah[i] = interpc(coefNMF[i], lat) - interpc(coefNMF[i + 3], lat) * cosy;
+    result.aw[i] = interpc(coefNMF[i + 6], lat);
   }
-  /* height correction */
-  f64 dm = (1 / sin(el) - mapHerring(el, 2.53E-5, 5.49E-3, 1.14E-3)) * hgt / 1E3;
-  result.dry_map = mapHerring(el, ah[0], ah[1], ah[2]) + dm;
-  result.wet_map = mapHerring(el, aw[0], aw[1], aw[2]);
   f64 temp = 15 - 6.5E-3 * hgt + ZEROC;
   f64 pres = 1013.25 * pow(288.15 / temp, -5.255877);
   f64 e = 6.108 * 0.7 * exp((17.15 * temp - 4684) / (temp - 38.45));
   result.dry_ztd = 0.0022768 * pres / (1 - 0.00266 * cos(2 * pos->x()) - 0.00028 * hgt / 1E3);
   result.wet_ztd = 0.002277 * (1255 / temp + 0.05) * e;
+  result.valid = true;
+  return result;
+}
+
+TropSaasResult tropSAAS(utils::GTime time, const utils::CoordinateBlh* pos, f64 el) {
+  f64 hgt = pos->z();
+  if (hgt < -100 || hgt > +20000 || el < 0) {
+    return TropSaasResult{};
+  }
+  TropSaasResult result;
+  utils::UYds yds = time;
+  auto zenith = tropSAASZenith(yds.doy, pos);
+  /* height correction */
+  f64 dm = (1 / sin(el) - mapHerring(el, 2.53E-5, 5.49E-3, 1.14E-3)) * hgt / 1E3;
+  result.dry_map = mapHerring(el, zenith.ah[0], zenith.ah[1], zenith.ah[2]) + dm;
+  result.wet_map = mapHerring(el, zenith.aw[0], zenith.aw[1], zenith.aw[2]);
+  result.dry_ztd = zenith.dry_ztd;
+  result.wet_ztd = zenith.wet_ztd;
   result.var = SQR(ERR_SAAS / (sin(el) + 0.1));
   return result;
 }
@@ -139,6 +167,94 @@ f64 AtmosphereHandler::handle_trop(const utils::CoordinateBlh* pos) const noexce
   }
 }
 
+TropHandler& TropHandler::set_trop_model(TropModelEnum model) noexcept {
+  if (model != trop_model_) doy_ = -1, valid_ = false;
+  trop_model_ = model;
+  return *this;
+}
+
+TropHandler& TropHandler::set_grid(std::shared_ptr<const TropGrid> grid) noexcept {
+  grid_ = std::move(grid);
+  doy_ = -1, valid_ = false;
+  return *this;
+}
+
+auto TropHandler::model_grid() const noexcept -> const TropGrid* {
+  if (!grid_) return nullptr;
+  switch (trop_model_) {
+    case TropModelEnum::VMF3:
+      return grid_->kind() == TropGridKind::VMF3 ? grid_.get() : nullptr;
+    case TropModelEnum::GPT2:
+      return grid_->kind() != TropGridKind::VMF3 ? grid_.get() : nullptr;
+    default:
+      return nullptr;
+  }
+}
+
+TropHandler& TropHandler::set_station(const EpochUtc& time, const utils::CoordinateBlh& pos) noexcept {
+  utils::GTime gtime(time);
+  bool moved = std::abs(pos.x() - lat_) >= LatitudeTolerance || std::abs(pos.z() - hgt_) >= HeightTolerance;
+  if (trop_model_ == TropModelEnum::VMF3 || trop_model_ == TropModelEnum::GPT2) {
+    auto grid = model_grid();
+    if (!grid) {
+      valid_ = false;
+      return *this;
+    }
+    // the nodes are kept while the station stays, `grid_station_` caches the delays of the day or the grid epochs
+    if (doy_ < 0 || moved || std::abs(pos.y() - lon_) >= LongitudeTolerance) {
+      grid_station_.set_station(*grid, pos.x(), pos.y(), pos.z());
+      doy_ = 0, lat_ = pos.x(), lon_ = pos.y(), hgt_ = pos.z();
+    }
+    TropGridZenith zenith;
+    valid_ = grid_station_.evaluate(*grid, utils::MjDateUtc(gtime).to_double(), zenith);
+    dry_ztd_ = zenith.dry_ztd, wet_ztd_ = zenith.wet_ztd;
+    dry_coeff_ = zenith.dry_coeff, wet_coeff_ = zenith.wet_coeff;
+    return *this;
+  }
+  utils::UYds yds = gtime;
+  if (yds.doy == doy_ && !moved) {
+    return *this;
+  }
+  auto zenith = details::tropSAASZenith(yds.doy, &pos);
+  doy_ = yds.doy, lat_ = pos.x(), lon_ = pos.y(), hgt_ = pos.z();
+  dry_ztd_ = zenith.dry_ztd, wet_ztd_ = zenith.wet_ztd;
+  std::copy_n(zenith.ah, 3, dry_coeff_.begin());
+  std::copy_n(zenith.aw, 3, wet_coeff_.begin());
+  valid_ = zenith.valid;
+  return *this;
+}
+
+void TropHandler::handle(std::span<const f64> elevation, std::span<f64> trop) const noexcept {
+  auto n = static_cast<Eigen::Index>(elevation.size());
+  Eigen::Map<Eigen::Array<f64, Eigen::Dynamic, 1>> slant(trop.data(), n);
+  switch (static_cast<TropModelEnum>(trop_model_)) {
+    case TropModelEnum::STANDARD:
+    case TropModelEnum::VMF3:
+    case TropModelEnum::GPT2: {
+      if (!valid_) {
+        slant.setZero();
+        return;
+      }
+      // niell (saastamoinen), vmf3 or vmf1 (gpt2) coefficients, the same continued fraction
+      Eigen::Map<const Eigen::Array<f64, Eigen::Dynamic, 1>> el(elevation.data(), n);
+      // the sines are overwritten by the delays coefficient wise
+      slant = el.sin();
+      auto& sinel = slant;
+      // height correction of the hydrostatic mapping function
+      auto dm = (1 / sinel - details::mapHerringArray(sinel, 2.53E-5, 5.49E-3, 1.14E-3)) * hgt_ / 1E3;
+      auto dry_map = details::mapHerringArray(sinel, dry_coeff_[0], dry_coeff_[1], dry_coeff_[2]) + dm;
+      auto wet_map = details::mapHerringArray(sinel, wet_coeff_[0], wet_coeff_[1], wet_coeff_[2]);
+      slant = (el < 0).select(0.0, dry_map * dry_ztd_ + wet_map * wet_ztd_);
+      return;
+    }
+    default: {
+      for (auto& value : trop) value = 0.0;
+      nav_error("not implmentted");
+      return;
+    }
+  }
+}
+
 f64 AtmosphereHandler::handle_iono(const utils::CoordinateBlh* pos) const noexcept {
   if (!solvable()) return 0.0;
   switch (static_cast<IonoModelEnum>(iono_model_)) {
@@ -165,6 +281,16 @@ f64 AtmosphereHandler::handle_iono(const utils::CoordinateBlh* pos) const noexce
       nav_error("not implmented!");
       return 0.0;
     }
+    case IonoModelEnum::IONEX: {
+      nav_error("IONEX maps are evaluated for every satellite of an epoch by IonoHandler");
+      return 0.0;
+    }
+    case IonoModelEnum::KLOBUCHAR:
+    case IonoModelEnum::NEQUICK_APPROX:
+    case IonoModelEnum::BROADCAST: {
+      nav_error("Broadcast models are evaluated for every satellite of an epoch by IonoHandler");
+      return 0.0;
+    }
     default: {
       nav_error("Encountering an unexpected branch in IonoModelEnum");
       return 0.0;
@@ -172,4 +298,151 @@ f64 AtmosphereHandler::handle_iono(const utils::CoordinateBlh* pos) const noexce
   }
 }
 
+IonoHandler& IonoHandler::set_iono_model(IonoModelEnum model) noexcept {
+  iono_model_ = model;
+  return *this;
+}
+
+IonoHandler& IonoHandler::set_ionex(std::shared_ptr<const Ionex> ionex) noexcept {
+  ionex_ = std::move(ionex);
+  valid_ = false;
+  return *this;
+}
+
+IonoHandler& IonoHandler::set_navigation(std::vector<const Navigation*> navigation) noexcept {
+  coefficients_.set_navigation(std::move(navigation));
+  valid_ = false;
+  return *this;
+}
+
+IonoHandler& IonoHandler::set_nequick_cell(f64 cell) noexcept {
+  nequick_.set_cell_size(cell);
+  return *this;
+}
+
+IonoHandler& IonoHandler::set_station(const EpochUtc& time, const utils::CoordinateBlh& pos) noexcept {
+  lat_ = pos.x(), lon_ = pos.y();
+  utils::GTime gtime(time);
+  switch (iono_model_) {
+    case IonoModelEnum::IONEX: {
+      valid_ = ionex_ && ionex_->map_time(utils::MjDateUtc(gtime).to_double(), map_time_);
+      return *this;
+    }
+    case IonoModelEnum::KLOBUCHAR:
+    case IonoModelEnum::NEQUICK_APPROX:
+    case IonoModelEnum::BROADCAST: {
+      // the records are only searched once the epoch leaves the selected messages
+      coefficients_.select(gtime);
+      utils::GTow gps_tow = gtime;
+      utils::BTow bds_tow = gtime;
+      gps_tow_ = gps_tow, bds_tow_ = bds_tow;
+      if (auto ion = coefficients_.ion(BroadcastIonoModel::NEQUICK_G)) {
+        utils::GEpoch epoch = gtime;
+        utils::UYds yds = gtime;
+        nequick_.set_coefficients({ion->ai0, ion->ai1, ion->ai2});
+        nequick_.set_station(pos.x(), pos.y(), pos.z(), static_cast<u8>(epoch.month), yds.sod / 3600);
+      }
+      valid_ = true;
+      return *this;
+    }
+    default: {
+      valid_ = false;
+      return *this;
+    }
+  }
+}
+
+auto IonoHandler::broadcast_model(ConstellationEnum system) const noexcept -> std::optional<BroadcastIonoModel> {
+  using enum BroadcastIonoModel;
+  BroadcastIonoModel model = system == ConstellationEnum::BDS ? BDS_KLOBUCHAR : GPS_KLOBUCHAR;
+  if (iono_model_ == IonoModelEnum::NEQUICK_APPROX ||
+      (iono_model_ == IonoModelEnum::BROADCAST && system == ConstellationEnum::GAL)) {
+    model = NEQUICK_G;
+  }
+  for (auto candidate : {model, GPS_KLOBUCHAR, BDS_KLOBUCHAR, NEQUICK_G}) {
+    if (coefficients_.ion(candidate)) return candidate;
+  }
+  return std::nullopt;
+}
+
+void IonoHandler::handle(std::span<const f64> azimuth, std::span<const f64> elevation, std::span<f64> iono) noexcept {
+  handle({}, azimuth, elevation, iono);
+}
+
+void IonoHandler::handle(std::span<const ConstellationEnum> system, std::span<const f64> azimuth,
+                         std::span<const f64> elevation, std::span<f64> iono) noexcept {
+  auto n = static_cast<Eigen::Index>(elevation.size());
+  Eigen::Map<Eigen::Array<f64, Eigen::Dynamic, 1>> slant(iono.data(), n);
+  switch (iono_model_) {
+    case IonoModelEnum::NONE: {
+      slant.setZero();
+      return;
+    }
+    case IonoModelEnum::IONEX: {
+      slant.setZero();
+      if (!valid_) return;
+      constexpr f64 d2r = std::numbers::pi / 180, half_pi = std::numbers::pi / 2;
+      // delay on GPS L1 of 1 TECU (m)
+      constexpr f64 factor = 40.3E16 / (1575.42E6 * 1575.42E6);
+      Eigen::Map<const Eigen::Array<f64, Eigen::Dynamic, 1>> el(elevation.data(), n), az(azimuth.data(), n);
+      // pierce points on the single layer
+      Eigen::Array<f64, Eigen::Dynamic, 1> rp = ionex_->radius() / (ionex_->radius() + ionex_->height()) * el.cos();
+      Eigen::Array<f64, Eigen::Dynamic, 1> ap = half_pi - el - rp.asin();
+      Eigen::Array<f64, Eigen::Dynamic, 1> sinap = ap.sin(), cosaz = az.cos();
+      pierce_lat_ = (std::sin(lat_) * ap.cos() + std::cos(lat_) * sinap * cosaz).asin();
+      Eigen::Array<f64, Eigen::Dynamic, 1> dlon = (sinap * az.sin() / pierce_lat_.cos()).asin();
+      // across the poles
+      Eigen::Array<bool, Eigen::Dynamic, 1> across = Eigen::Array<bool, Eigen::Dynamic, 1>::Constant(n, false);
+      if (lat_ > 70 * d2r) {
+        across = ap.tan() * cosaz > std::tan(half_pi - lat_);
+      } else if (lat_ < -70 * d2r) {
+        across = -ap.tan() * cosaz > std::tan(half_pi + lat_);
+      }
+      pierce_lon_ = (lon_ + across.select(std::numbers::pi - dlon, dlon)) / d2r;
+      pierce_lat_ /= d2r;
+      mapping_ = 1 / (1 - rp.square()).sqrt();
+      for (Eigen::Index i = 0; i < n; ++i) {
+        if (el(i) < 0) continue;
+        f64 vtec = ionex_->vtec(map_time_, pierce_lat_(i), pierce_lon_(i));
+        if (std::isfinite(vtec)) slant(i) = factor * mapping_(i) * vtec;
+      }
+      return;
+    }
+    case IonoModelEnum::KLOBUCHAR:
+    case IonoModelEnum::NEQUICK_APPROX:
+    case IonoModelEnum::BROADCAST: {
+      slant.setZero();
+      if (!valid_) return;
+      constexpr f64 factor = 40.3E16 / (1575.42E6 * 1575.42E6);
+      // the satellites of each broadcast model at once
+      for (u8 index = 0; index < BroadcastIonoCoefficients::ModelCount; ++index) {
+        auto model = static_cast<BroadcastIonoModel>(index);
+        group_.clear(), group_azimuth_.clear(), group_elevation_.clear();
+        for (Eigen::Index i = 0; i < n; ++i) {
+          if (broadcast_model(system.empty() ? ConstellationEnum::GPS : system[i]) != model) continue;
+          group_.push_back(static_cast<u16>(i));
+          group_azimuth_.push_back(azimuth[i]);
+          group_elevation_.push_back(elevation[i]);
+        }
+        if (group_.empty()) continue;
+        group_iono_.resize(group_.size());
+        if (model == BroadcastIonoModel::NEQUICK_G) {
+          nequick_.stec(group_azimuth_, group_elevation_, group_iono_);
+          for (auto& value : group_iono_) value *= factor;
+        } else {
+          auto tow = model == BroadcastIonoModel::BDS_KLOBUCHAR ? bds_tow_ : gps_tow_;
+          klobuchar(*coefficients_.ion(model), model, tow, lat_, lon_, group_azimuth_, group_elevation_, group_iono_);
+        }
+        for (size_t k = 0; k < group_.size(); ++k) slant(group_[k]) = group_iono_[k];
+      }
+      return;
+    }
+    default: {
+      slant.setZero();
+      nav_error("not implmented!");
+      return;
+    }
+  }
+}
+
 }  // namespace navp::sensors::gnss
\ No newline at end of file
@@ -0,0 +1,312 @@
+#include "sensors/gnss/broadcast_iono.hpp"
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <numbers>
+
+#include "sensors/gnss/constants.hpp"
+
+namespace navp::sensors::gnss {
+
+static constexpr f64 pi = std::numbers::pi, d2r = pi / 180;
+
+// values of the satellites
+using ArrayXf64 = Eigen::Array<f64, Eigen::Dynamic, 1>;
+
+/*
+ * broadcast coefficients
+ */
+BroadcastIonoCoefficients& BroadcastIonoCoefficients::set_navigation(
+    std::vector<const Navigation*> navigation) noexcept {
+  navigation_ = std::move(navigation);
+  selected_ = {};
+  return *this;
+}
+
+void BroadcastIonoCoefficients::search(BroadcastIonoModel model, const utils::GTime& time,
+                                       Selection& selection) const noexcept {
+  auto system = model == BroadcastIonoModel::BDS_KLOBUCHAR ? ConstellationEnum::BDS
+                : model == BroadcastIonoModel::NEQUICK_G   ? ConstellationEnum::GAL
+                                                           : ConstellationEnum::GPS;
+  selection = Selection{};
+  selection.valid = true;
+  for (auto navigation : navigation_) {
+    auto messages_of_system = navigation->ionMap.find(system);
+    if (messages_of_system == navigation->ionMap.end()) continue;
+    for (const auto& [type, messages] : messages_of_system->second) {
+      // the BDS CNAV messages carry the BDGIM coefficients
+      if (system == ConstellationEnum::BDS && type != NavMsgTypeEnum::D1 && type != NavMsgTypeEnum::D2 &&
+          type != NavMsgTypeEnum::D1D2) {
+        continue;
+      }
+      auto next = messages.upper_bound(time);
+      if (next != messages.end() && (!selection.bounded || next->first < selection.end)) {
+        selection.end = next->first, selection.bounded = true;
+      }
+      if (next == messages.begin()) continue;
+      const auto& [ttm, ion] = *std::prev(next);
+      if (!selection.ion || selection.begin < ttm) selection.ion = &ion, selection.begin = ttm;
+    }
+  }
+}
+
+bool BroadcastIonoCoefficients::select(const utils::GTime& time) noexcept {
+  bool changed = false;
+  for (u8 index = 0; index < ModelCount; ++index) {
+    auto& selection = selected_[index];
+    if (selection.valid && !(time < selection.begin) && (!selection.bounded || time < selection.end)) continue;
+    auto previous = selection.ion;
+    search(static_cast<BroadcastIonoModel>(index), time, selection);
+    changed |= selection.ion != previous;
+  }
+  return changed;
+}
+
+/*
+ * klobuchar
+ */
+void klobuchar(const ION& ion, BroadcastIonoModel model, f64 tow, f64 lat, f64 lon, std::span<const f64> azimuth,
+               std::span<const f64> elevation, std::span<f64> iono) noexcept {
+  auto n = static_cast<Eigen::Index>(elevation.size());
+  Eigen::Map<const ArrayXf64> el(elevation.data(), n), az(azimuth.data(), n);
+  Eigen::Map<ArrayXf64> slant(iono.data(), n);
+  if (model == BroadcastIonoModel::BDS_KLOBUCHAR) {
+    constexpr f64 radius = 6378.0, height = 375.0;
+    // delay on B1I scaled to GPS L1
+    constexpr f64 scale = (1561.098E6 * 1561.098E6) / (1575.42E6 * 1575.42E6);
+    ArrayXf64 rp = radius / (radius + height) * el.cos();
+    ArrayXf64 psi = pi / 2 - el - rp.asin();
+    ArrayXf64 phi = (std::sin(lat) * psi.cos() + std::cos(lat) * psi.sin() * az.cos()).asin();
+    ArrayXf64 lam = lon + (psi.sin() * az.sin() / phi.cos()).asin();
+    // local time of the pierce points
+    ArrayXf64 t = tow + lam * 43200 / pi;
+    t -= (t / 86400).floor() * 86400;
+    ArrayXf64 x = (phi / pi).abs();
+    ArrayXf64 amp = (ion.a0 + x * (ion.a1 + x * (ion.a2 + x * ion.a3))).max(0.0);
+    ArrayXf64 per = (ion.b0 + x * (ion.b1 + x * (ion.b2 + x * ion.b3))).max(72000.0).min(172800.0);
+    ArrayXf64 vertical = ((t - 50400).abs() < per / 4).select(5E-9 + amp * (2 * pi * (t - 50400) / per).cos(), 5E-9);
+    slant = (el < 0).select(0.0, Constants::CLIGHT * scale * vertical / (1 - rp.square()).sqrt());
+    return;
+  }
+  // semicircles
+  ArrayXf64 e = el / pi;
+  ArrayXf64 psi = 0.0137 / (e + 0.11) - 0.022;
+  ArrayXf64 phi = (lat / pi + psi * az.cos()).max(-0.416).min(0.416);
+  ArrayXf64 lam = lon / pi + psi * az.sin() / (phi * pi).cos();
+  // geomagnetic latitude
+  phi += 0.064 * ((lam - 1.617) * pi).cos();
+  // local time of the pierce points
+  ArrayXf64 t = 43200 * lam + tow;
+  t -= (t / 86400).floor() * 86400;
+  ArrayXf64 f = 1 + 16 * (0.53 - e).cube();
+  ArrayXf64 amp = (ion.a0 + phi * (ion.a1 + phi * (ion.a2 + phi * ion.a3))).max(0.0);
+  ArrayXf64 per = (ion.b0 + phi * (ion.b1 + phi * (ion.b2 + phi * ion.b3))).max(72000.0);
+  ArrayXf64 x = 2 * pi * (t - 50400) / per;
+  ArrayXf64 vertical = (x.abs() < 1.57).select(5E-9 + amp * (1 + x.square() * (-0.5 + x.square() / 24)), 5E-9);
+  slant = (el < 0).select(0.0, Constants::CLIGHT * f * vertical);
+}
+
+/*
+ * nequick-approx
+ */
+
+// exponential clipped as in nequick-g
+static f64 clip_exp(f64 x) { return x > 80 ? 5.5406E34 : x < -80 ? 1.8049E-35 : std::exp(x); }
+
+// modified dip latitude (rad) of a centred dipole
+static f64 modip(f64 lat, f64 lon) {
+  constexpr f64 pole_lat = 80.65 * d2r, pole_lon = -72.68 * d2r;
+  f64 sin_mag = std::sin(lat) * std::sin(pole_lat) + std::cos(lat) * std::cos(pole_lat) * std::cos(lon - pole_lon);
+  f64 dip = std::atan(2 * std::tan(std::asin(std::clamp<f64>(sin_mag, -1.0, 1.0))));
+  return std::atan(dip / std::sqrt(std::max<f64>(std::cos(lat), 1E-6)));
+}
+
+NequickApprox& NequickApprox::set_coefficients(const std::array<f64, 3>& ai) noexcept {
+  if (ai != ai_) ai_ = ai, bin_ = -1, cells_.clear();
+  return *this;
+}
+
+NequickApprox& NequickApprox::set_cell_size(f64 cell) noexcept {
+  if (cell != cell_) cell_ = cell, cells_.clear();
+  return *this;
+}
+
+NequickApprox& NequickApprox::set_station(f64 lat, f64 lon, f64 hgt, u8 month, f64 ut) noexcept {
+  // effective ionisation level at the station
+  f64 mu = modip(lat, lon) / d2r;
+  f64 az = ai_ == std::array<f64, 3>{} ? 63.7 : std::clamp<f64>(ai_[0] + ai_[1] * mu + ai_[2] * mu * mu, 0.0, 400.0);
+  auto bin = static_cast<i64>(std::floor(ut * 3600 / ProfileLifetime));
+  // the memoized profiles are kept while the effective ionisation level barely changes
+  if (cell_ > 0 && bin == bin_ && month == month_ && std::abs(az - az_) < AzTolerance) {
+    az = az_;
+  } else {
+    cells_.clear();
+  }
+  az_ = az, r12_ = std::sqrt(167273 + (az - 63.7) * 1123.6) - 408.99;
+  lat_ = lat, lon_ = lon, hgt_ = hgt / 1E3, month_ = month, ut_ = ut, bin_ = bin;
+  return *this;
+}
+
+auto NequickApprox::profile(f64 lat, f64 lon, f64 ut) const noexcept -> Profile {
+  f64 mu = modip(lat, lon) / d2r;
+  // solar declination in the middle of the month
+  f64 t = 30.5 * month_ - 15 + (18 - ut) / 24;
+  f64 am = (0.9856 * t - 3.289) * d2r;
+  f64 al = am + (1.916 * std::sin(am) + 0.020 * std::sin(2 * am) + 282.634) * d2r;
+  f64 sin_dec = 0.39782 * std::sin(al), cos_dec = std::sqrt(1 - sin_dec * sin_dec);
+  // effective solar zenith angle (deg), kept below 90 through the night
+  f64 lt = std::fmod(std::fmod(ut + lon / d2r / 15, 24.0) + 24.0, 24.0);
+  f64 cos_chi = std::sin(lat) * sin_dec + std::cos(lat) * cos_dec * std::cos(pi / 12 * (12 - lt));
+  f64 chi = std::acos(std::clamp<f64>(cos_chi, -1.0, 1.0)) / d2r;
+  f64 blend = clip_exp(12 * (chi - 86.23292796211615));
+  f64 chi_eff = (chi + (90 - 0.24 * clip_exp(20 - 0.2 * chi)) * blend) / (1 + blend);
+  f64 day = std::max<f64>(std::cos(chi_eff * d2r), 0.0);
+
+  // E layer
+  i32 season = month_ <= 2 || month_ >= 11 ? -1 : (month_ <= 4 || month_ >= 9 ? 0 : 1);
+  f64 ee = clip_exp(0.3 * lat / d2r);
+  f64 seasp = season * (ee - 1) / (ee + 1);
+  f64 foE = std::sqrt(std::pow(1.112 - 0.019 * seasp, 2) * std::sqrt(az_) * std::pow(day, 0.6) + 0.49);
+  // F2 layer of the day and night climatology, with the equatorial crests
+  f64 r12 = std::max<f64>(r12_, 0.0);
+  f64 crest = 1 + 0.25 * std::exp(-std::pow((std::abs(mu) - 15) / 12, 2));
+  f64 foF2 = crest * (3.5 + 0.015 * r12 + (4.5 + 0.025 * r12) * std::sqrt(day));
+  f64 m3000 = 2.9 + 0.5 * std::sqrt(day);
+  // F1 layer
+  f64 foF1 = foE >= 2 ? std::min(1.4 * foE, 0.85 * foF2) : 0.0;
+  f64 NmE = 0.124 * foE * foE, NmF1 = 0.124 * foF1 * foF1, NmF2 = 0.124 * foF2 * foF2;
+
+  // peak heights
+  f64 ratio = foF2 / foE, weight = clip_exp(20 * (ratio - 1.75));
+  f64 rho = (ratio * weight + 1.75) / (weight + 1);
+  f64 dm = 0.253 / (rho - 1.215) - 0.012;
+  f64 hmF2 = 1490 * m3000 * std::sqrt((0.0196 * m3000 * m3000 + 1) / (1.2967 * m3000 * m3000 - 1)) / (m3000 + dm) - 176;
+  constexpr f64 hmE = 120;
+  f64 hmF1 = (hmF2 + hmE) / 2;
+  // thicknesses
+  f64 B2bot = 0.385 * NmF2 / (0.01 * std::exp(-3.467 + 0.857 * std::log(foF2 * foF2) + 2.02 * std::log(m3000)));
+  f64 B1top = 0.3 * (hmF2 - hmF1), B1bot = 0.5 * (hmF1 - hmE);
+  f64 BEtop = std::max<f64>(0.5 * (hmF1 - hmE), 7.0);
+  // topside thickness
+  f64 ka = month_ >= 4 && month_ <= 9 ? 6.705 - 0.014 * r12_ - 0.008 * hmF2
+                                      : -7.77 + 0.097 * std::pow(hmF2 / B2bot, 2) + 0.153 * NmF2;
+  f64 kb = (ka * clip_exp(ka - 2) + 2) / (1 + clip_exp(ka - 2));
+  f64 k = (8 * clip_exp(kb - 8) + kb) / (1 + clip_exp(kb - 8));
+  return Profile{hmE, 5, BEtop, 4 * NmE, hmF1, B1bot, B1top, 4 * NmF1, hmF2, B2bot, k * B2bot, 4 * NmF2};
+}
+
+// epstein layer of an amplitude
+static f64 epstein(f64 amplitude, f64 x) {
+  f64 e = std::exp(-std::abs(x));
+  return amplitude * e / ((1 + e) * (1 + e));
+}
+
+// topside thickness grows with the height above the F2 peak
+static constexpr f64 TopsideR = 100, TopsideG = 0.125;
+
+f64 NequickApprox::density(const Profile& p, f64 height) noexcept {
+  if (height < 100) return 0;
+  if (height > p.hmF2) {
+    f64 dh = height - p.hmF2;
+    f64 H = p.H0 * (1 + TopsideR * TopsideG * dh / (TopsideR * p.H0 + TopsideG * dh));
+    return epstein(p.AF2, dh / H);
+  }
+  return epstein(p.AF2, (height - p.hmF2) / p.B2bot) +
+         epstein(p.AF1, (height - p.hmF1) / (height < p.hmF1 ? p.B1bot : p.B1top)) +
+         epstein(p.AE, (height - p.hmE) / (height < p.hmE ? p.BEbot : p.BEtop));
+}
+
+void NequickApprox::stec(std::span<const f64> azimuth, std::span<const f64> elevation, std::span<f64> tec) noexcept {
+  // 8 gauss-legendre nodes in each height segment (km)
+  constexpr std::array<f64, 7> segments{100, 250, 400, 700, 1000, 2000, TopHeight};
+  constexpr std::array<f64, 8> x{-0.9602898564975363, -0.7966664774136267, -0.5255324099163290, -0.1834346424956498,
+                                 0.1834346424956498,  0.5255324099163290,  0.7966664774136267,  0.9602898564975363};
+  constexpr std::array<f64, 8> w{0.1012285362903763, 0.2223810344533745, 0.3137066458778873, 0.3626837833783620,
+                                 0.3626837833783620, 0.3137066458778873, 0.2223810344533745, 0.1012285362903763};
+  constexpr Eigen::Index m = (segments.size() - 1) * x.size();
+  auto n = static_cast<Eigen::Index>(elevation.size());
+  Eigen::Map<const ArrayXf64> el(elevation.data(), n), az(azimuth.data(), n);
+  Eigen::Map<ArrayXf64> slant(tec.data(), n);
+  if (n == 0) return;
+
+  // distance along the rays to a height
+  f64 r0 = EarthRadius + hgt_;
+  ArrayXf64 sin_el = el.max(0.0).sin(), cos_el = el.max(0.0).cos();
+  ArrayXf64 sin_az = az.sin(), cos_az = az.cos();
+  auto distance = [&](f64 height) -> ArrayXf64 {
+    f64 r = EarthRadius + std::max(height, hgt_);
+    return (r * r - (r0 * cos_el).square()).sqrt() - r0 * sin_el;
+  };
+  // ground location of the points of the rays at their distances
+  auto locate = [&](const auto& s, auto& lat, auto& lon) {
+    Nodes psi = (s.rowwise() * cos_el.transpose()).binaryExpr(
+        (s.rowwise() * sin_el.transpose()) + r0, [](f64 y, f64 x) { return std::atan2(y, x); });
+    lat = (std::sin(lat_) * psi.cos() + std::cos(lat_) * (psi.sin().rowwise() * cos_az.transpose())).asin();
+    lon = lon_ + (std::cos(lat_) * (psi.sin().rowwise() * sin_az.transpose()))
+                     .binaryExpr(psi.cos() - std::sin(lat_) * lat.sin(), [](f64 y, f64 x) { return std::atan2(y, x); });
+  };
+
+  // nodes of the rays
+  s_.resize(m, n), weight_.resize(m, n);
+  for (size_t k = 0; k + 1 < segments.size(); ++k) {
+    ArrayXf64 lower = distance(segments[k]), upper = distance(segments[k + 1]);
+    ArrayXf64 half = (upper - lower) / 2, middle = (upper + lower) / 2;
+    for (size_t j = 0; j < x.size(); ++j) {
+      auto row = static_cast<Eigen::Index>(k * x.size() + j);
+      s_.row(row) = (middle + half * x[j]).transpose();
+      weight_.row(row) = (half * w[j]).transpose();
+    }
+  }
+  height_ = (s_.square() + (2 * r0 * s_).rowwise() * sin_el.transpose() + r0 * r0).sqrt() - EarthRadius;
+  for (auto& parameter : parameters_) parameter.resize(m, n);
+
+  if (cell_ > 0) {
+    // one profile for each ray, memoized in the cell of its pierce point at the middle of the quarter of an hour
+    Nodes pierce = distance(PierceHeight).transpose();
+    Nodes pierce_lat, pierce_lon;
+    locate(pierce, pierce_lat, pierce_lon);
+    f64 ut = (bin_ + 0.5) * ProfileLifetime / 3600;
+    auto rows = static_cast<i64>(std::ceil(180 / cell_)), cols = static_cast<i64>(std::ceil(360 / cell_));
+    for (Eigen::Index i = 0; i < n; ++i) {
+      f64 lat = pierce_lat(0, i) / d2r, lon = std::fmod(std::fmod(pierce_lon(0, i) / d2r, 360.0) + 360.0, 360.0);
+      auto row = std::clamp<i64>(static_cast<i64>((lat + 90) / cell_), 0, rows - 1);
+      auto col = std::clamp<i64>(static_cast<i64>(lon / cell_), 0, cols - 1);
+      auto key = static_cast<u64>(row) << 32 | static_cast<u64>(col);
+      auto it = cells_.find(key);
+      if (it == cells_.end()) {
+        f64 center_lat = std::min<f64>((row + 0.5) * cell_ - 90, 90.0), center_lon = (col + 0.5) * cell_;
+        it = cells_.emplace(key, profile(center_lat * d2r, center_lon * d2r, ut)).first;
+      }
+      auto values = std::bit_cast<std::array<f64, 12>>(it->second);
+      for (size_t k = 0; k < values.size(); ++k) parameters_[k].col(i).setConstant(values[k]);
+    }
+  } else {
+    // the profile of every node
+    locate(s_, lat_node_, lon_node_);
+    for (Eigen::Index i = 0; i < n; ++i) {
+      for (Eigen::Index j = 0; j < m; ++j) {
+        auto values = std::bit_cast<std::array<f64, 12>>(profile(lat_node_(j, i), lon_node_(j, i), ut_));
+        for (size_t k = 0; k < values.size(); ++k) parameters_[k](j, i) = values[k];
+      }
+    }
+  }
+
+  // electron density of the nodes, the bottomside sums the three layers and the topside is the F2 layer
+  const auto& [hmE, BEbot, BEtop, AE, hmF1, B1bot, B1top, AF1, hmF2, B2bot, H0, AF2] = parameters_;
+  auto layer = [](const Nodes& amplitude, const Nodes& x) -> Nodes {
+    Nodes e = (-x.abs()).exp();
+    return amplitude * e / (1 + e).square();
+  };
+  Nodes dh = height_ - hmF2;
+  Nodes topside = layer(AF2, dh / (H0 * (1 + TopsideR * TopsideG * dh / (TopsideR * H0 + TopsideG * dh))));
+  Nodes bottomside = layer(AF2, dh / B2bot) +
+                     layer(AF1, (height_ - hmF1) / (height_ < hmF1).select(B1bot, B1top)) +
+                     layer(AE, (height_ - hmE) / (height_ < hmE).select(BEbot, BEtop));
+  // 1e11 m^-3 along km is 0.01 TECU
+  ArrayXf64 sum = (weight_ * (dh > 0).select(topside, bottomside)).colwise().sum().transpose() * 0.01;
+  slant = (el < 0).select(0.0, sum);
+}
+
+}  // namespace navp::sensors::gnss
@@ -0,0 +1,179 @@
+#include "sensors/gnss/cycle_slip.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "sensors/gnss/constants.hpp"
+
+namespace navp::sensors::gnss {
+
+static inline f64 epoch_diff(const EpochUtc& lhs, const EpochUtc& rhs) noexcept {
+  auto diff = lhs - rhs;
+  return static_cast<f64>(diff.seconds()) + static_cast<f64>(diff.scale_fractional_seconds());
+}
+
+CycleSlip::CycleSlip(const Options& options) noexcept : options_(options) {}
+
+void CycleSlip::reset() noexcept {
+  track_index_.clear();
+  state_.resize(0, Eigen::NoChange);
+}
+
+i32 CycleSlip::_track(Sv sv, ObsCodeEnum code1, ObsCodeEnum code2) noexcept {
+  u64 key = static_cast<u64>(sv.system().id) << 48 | static_cast<u64>(sv.prn) << 32 |
+            static_cast<u64>(code1) << 16 | static_cast<u64>(code2);
+  auto [it, inserted] = track_index_.try_emplace(key, static_cast<i32>(track_index_.size()));
+  if (inserted) {
+    if (state_.rows() <= it->second) {
+      state_.conservativeResize(std::max<Eigen::Index>(64, 2 * state_.rows()), Eigen::NoChange);
+    }
+    // a new track has no history, NaN time marks it fresh
+    state_.row(it->second).setZero();
+    state_(it->second, Time) = std::numeric_limits<f64>::quiet_NaN();
+  }
+  return it->second;
+}
+
+u32 CycleSlip::_gather(const GnssObsRecord::ObsMap& obs_map) noexcept {
+  if (input_.rows() < static_cast<Eigen::Index>(obs_map.size())) {
+    auto rows = static_cast<Eigen::Index>(obs_map.size());
+    input_.resize(rows, Eigen::NoChange);
+    prev_.resize(rows, Eigen::NoChange);
+    next_.resize(rows, Eigen::NoChange);
+    work_.resize(rows, Eigen::NoChange);
+    flag_.resize(rows, Eigen::NoChange);
+  }
+  slot_.clear(), sig1_.clear(), sig2_.clear();
+  u32 size = 0;
+  for (auto& [sv, obs] : obs_map) {
+    // the first signal with carrier phase of the two lowest frequencies
+    Sig* sig[2] = {nullptr, nullptr};
+    FreTypeEnum type[2] = {FreTypeEnum::FTYPE_NONE, FreTypeEnum::FTYPE_NONE};
+    f64 freq[2] = {0, 0};
+    for (auto& [freq_type, sigs] : obs->sigs_list) {
+      auto it = std::ranges::find_if(sigs, [&](const Sig& _sig) {
+        return _sig.carrier != 0.0 && Constants::code_to_freq(sv.system(), _sig.code) != 0.0;
+      });
+      if (it == sigs.end()) continue;
+      f64 f = Constants::code_to_freq(sv.system(), it->code);
+      if (!sig[0] || freq_type < type[0]) {
+        sig[1] = sig[0], type[1] = type[0], freq[1] = freq[0];
+        sig[0] = std::addressof(*it), type[0] = freq_type, freq[0] = f;
+      } else if (!sig[1] || freq_type < type[1]) {
+        sig[1] = std::addressof(*it), type[1] = freq_type, freq[1] = f;
+      }
+    }
+    if (!sig[0]) continue;
+    auto row = input_.row(size++);
+    row(L1) = sig[0]->carrier, row(P1) = sig[0]->pseudorange, row(D1) = sig[0]->doppler;
+    row(F1) = freq[0], row(Lli1) = sig[0]->lli;
+    if (sig[1]) {
+      row(L2) = sig[1]->carrier, row(P2) = sig[1]->pseudorange, row(D2) = sig[1]->doppler;
+      row(F2) = freq[1], row(Lli2) = sig[1]->lli;
+    } else {
+      row(L2) = row(P2) = row(D2) = row(F2) = row(Lli2) = 0;
+    }
+    slot_.push_back(_track(sv, sig[0]->code, sig[1] ? sig[1]->code : ObsCodeEnum::NONE));
+    sig1_.push_back(sig[0]);
+    sig2_.push_back(sig[1]);
+  }
+  return size;
+}
+
+f64 CycleSlip::_clock_jump(u32 size) noexcept {
+  misclosure_.clear();
+  for (u32 i = 0; i < size; ++i) {
+    if (!std::isnan(work_(i, Misclosure1))) misclosure_.push_back(work_(i, Misclosure1));
+    if (!std::isnan(work_(i, Misclosure2))) misclosure_.push_back(work_(i, Misclosure2));
+  }
+  if (misclosure_.empty()) return 0.0;
+  auto mid = misclosure_.begin() + misclosure_.size() / 2;
+  std::nth_element(misclosure_.begin(), mid, misclosure_.end());
+  return *mid;
+}
+
+u32 CycleSlip::detect(EpochUtc epoch, const GnssObsRecord::ObsMap& obs_map) noexcept {
+  if (track_index_.empty()) origin_ = epoch;
+  u32 size = _gather(obs_map);
+  if (size == 0) return 0;
+  f64 t = epoch_diff(epoch, origin_);
+  constexpr f64 nan = std::numeric_limits<f64>::quiet_NaN();
+
+  auto in = input_.topRows(size);
+  auto prev = prev_.topRows(size);
+  auto next = next_.topRows(size);
+  auto work = work_.topRows(size);
+  auto flag = flag_.topRows(size);
+  prev = state_(slot_, Eigen::all);
+
+  auto l1 = in.col(L1), l2 = in.col(L2), p1 = in.col(P1), p2 = in.col(P2);
+  auto f1 = in.col(F1), f2 = in.col(F2);
+  auto lambda1 = Constants::CLIGHT / f1;
+  auto lambda2 = Constants::CLIGHT / f2;
+  auto dual = f2 > 0.0;
+  auto code = dual && p1 != 0.0 && p2 != 0.0;
+
+  // a track is fresh after a gap, it is (re)initialized without any test
+  work.col(Dt) = t - prev.col(Time);
+  flag.col(Fresh) = !(work.col(Dt) > 0.0 && work.col(Dt) <= options_.max_gap);
+  auto fresh = flag.col(Fresh);
+  auto dt = work.col(Dt);
+
+  // geometry-free, L1 - L2 (m)
+  work.col(GfValue) = dual.select(lambda1 * l1 - lambda2 * l2, 0.0);
+  auto gf_slip = dual && !fresh && (work.col(GfValue) - prev.col(Gf)).abs() > options_.gf_threshold;
+
+  // Melbourne-Wubbena, wide-lane ambiguity (cycle)
+  work.col(MwValue) = code.select((l1 - l2) - (f1 * p1 + f2 * p2) / (f1 + f2) * (f1 - f2) / Constants::CLIGHT, 0.0);
+  auto mw_count = prev.col(MwCount);
+  auto mw_sigma = (prev.col(MwM2) / mw_count.max(1.0)).sqrt();
+  auto mw_slip = code && !fresh && mw_count > 0.0 &&
+                 (work.col(MwValue) - prev.col(MwMean)).abs() >
+                     (options_.mw_sigma_factor * mw_sigma).max(options_.mw_min_threshold);
+
+  // doppler, L(t) - L(t0) + (D(t) + D(t0)) / 2 * dt = 0 (cycle), in meter
+  auto doppler_misclosure = [&](Input l, Input d, Input f, Track l0, Track d0, Work out) {
+    auto valid = !fresh && in.col(f) > 0.0 && in.col(d) != 0.0 && prev.col(d0) != 0.0;
+    work.col(out) = valid.select(
+        (in.col(l) - prev.col(l0) + 0.5 * (in.col(d) + prev.col(d0)) * dt) * Constants::CLIGHT / in.col(f), nan);
+  };
+  doppler_misclosure(L1, D1, F1, Carrier1, Doppler1, Misclosure1);
+  doppler_misclosure(L2, D2, F2, Carrier2, Doppler2, Misclosure2);
+  f64 clock_jump = _clock_jump(size);
+  // NaN compares false, signals without doppler pass
+  auto doppler_slip1 = (work.col(Misclosure1) - clock_jump).abs() > options_.doppler_threshold;
+  auto doppler_slip2 = (work.col(Misclosure2) - clock_jump).abs() > options_.doppler_threshold;
+
+  flag.col(Slip1) = in.col(Lli1) != 0.0 || gf_slip || mw_slip || doppler_slip1;
+  flag.col(Slip2) = dual && (in.col(Lli2) != 0.0 || gf_slip || mw_slip || doppler_slip2);
+
+  // roll the state, the MW mean restarts on a slip
+  auto restart = fresh || flag.col(Slip1) || flag.col(Slip2);
+  auto count = code.select(restart.select(1.0, mw_count + 1.0), 0.0);
+  auto delta = work.col(MwValue) - prev.col(MwMean);
+  next.col(Time).setConstant(t);
+  next.col(Gf) = work.col(GfValue);
+  next.col(MwCount) = count;
+  next.col(MwMean) = code.select(restart.select(work.col(MwValue), prev.col(MwMean) + delta / count), 0.0);
+  next.col(MwM2) =
+      code.select(restart.select(0.0, prev.col(MwM2) + delta * (work.col(MwValue) - next.col(MwMean))), 0.0);
+  next.col(Carrier1) = l1, next.col(Carrier2) = l2;
+  next.col(Doppler1) = in.col(D1), next.col(Doppler2) = in.col(D2);
+  state_(slot_, Eigen::all) = next;
+
+  u32 slip_count = 0;
+  for (u32 i = 0; i < size; ++i) {
+    if (flag(i, Slip1)) {
+      sig1_[i]->valid = static_cast<Sig::ValidIndicator>(sig1_[i]->valid | Sig::CycleSlip);
+      ++slip_count;
+    }
+    if (flag(i, Slip2)) {
+      sig2_[i]->valid = static_cast<Sig::ValidIndicator>(sig2_[i]->valid | Sig::CycleSlip);
+      ++slip_count;
+    }
+  }
+  return slip_count;
+}
+
+}  // namespace navp::sensors::gnss
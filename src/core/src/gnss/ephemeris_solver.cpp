@@ -1235,7 +1235,7 @@ bool EphemerisSolver::brdc_solve_sv_status(EpochUtc tr, Sv _sv, f64 pr) noexcept
   } else if (_cons == ConstellationEnum::SBS) {
     done = launch_seph_solver(tr, _sv, pr, correct_transmission);
   } else {
-    nav_error("unsupport constellation {}", magic_enum::enum_name(_cons))
+    nav_error("unsupport constellation {}", magic_enum::enum_name(_cons));
   }
   return done;
 }
@@ -1,6 +1,7 @@
 #include "filter/filter.hpp"
 
 #include <boost/algorithm/string.hpp>
+#include <cmath>
 
 #include "utils/angle.hpp"
 #include "utils/string_utils.hpp"
@@ -146,7 +147,9 @@ auto MaskFilters::from_str(std::vector<std::string_view> str) -> Result<MaskFilt
   for (const auto& item : str) {
     filters.emplace_back(Filter::from_str(item).unwrap_throw());
   }
-  return Ok(MaskFilters{.__filter = std::move(filters)});
+  MaskFilters mask_filters{.__filter = std::move(filters)};
+  mask_filters.compile();
+  return Ok(std::move(mask_filters));
 }
 
 Result<MaskFilters, FilterParseError> MaskFilters::from_str(std::string_view str) {
@@ -160,14 +163,128 @@ Result<MaskFilters, FilterParseError> MaskFilters::from_str(std::string_view str
     if (item.empty()) continue;
     filters.emplace_back(Filter::from_str(item).unwrap_throw());
   }
-  return Ok(MaskFilters{.__filter = std::move(filters)});
+  MaskFilters mask_filters{.__filter = std::move(filters)};
+  mask_filters.compile();
+  return Ok(std::move(mask_filters));
 }
 
 auto MaskFilters::apply(const FilterItem& item) const noexcept -> bool {
-  for (const auto& filter : __filter) {
-    if (!filter.apply(item)) return false;
+  return std::visit([this](const auto& _item) { return __predicate.apply(_item); }, item);
+}
+
+MaskFilters& MaskFilters::compile() noexcept {
+  __predicate = MaskPredicate::compile(__filter);
+  return *this;
+}
+
+void MaskPredicate::Interval::bound(CompareOperatorEnum op, f64 value) noexcept {
+  constexpr f64 inf = std::numeric_limits<f64>::infinity();
+  active = true;
+  switch (op) {
+    case CompareOperatorEnum::Greater:
+      min = std::max(min, std::nextafter(value, inf));
+      break;
+    case CompareOperatorEnum::GreaterEqual:
+      min = std::max(min, value);
+      break;
+    case CompareOperatorEnum::Less:
+      max = std::min(max, std::nextafter(value, -inf));
+      break;
+    case CompareOperatorEnum::LessEqual:
+      max = std::min(max, value);
+      break;
+    case CompareOperatorEnum::Equal:
+      min = std::max(min, value), max = std::min(max, value);
+      break;
+    case CompareOperatorEnum::NotEqual:
+      excluded.push_back(value);
+      break;
   }
-  return true;
+}
+
+void MaskPredicate::Interval::apply(std::span<const f64> values, std::span<u8> mask) const noexcept {
+  if (!active) return;
+  for (size_t i = 0; i < values.size(); ++i) {
+    mask[i] &= static_cast<u8>(values[i] >= min) & static_cast<u8>(values[i] <= max);
+  }
+  for (auto value : excluded) {
+    for (size_t i = 0; i < values.size(); ++i) mask[i] &= static_cast<u8>(values[i] != value);
+  }
+}
+
+void MaskPredicate::EpochInterval::bound(CompareOperatorEnum op, const EpochItem& epoch) noexcept {
+  active = true;
+  // the tighter of two bounds, a strict one at the same epoch
+  auto lower = [&](bool strict) {
+    if (!begin || epoch > *begin) {
+      begin = epoch, begin_strict = strict;
+    } else if (epoch == *begin) {
+      begin_strict |= strict;
+    }
+  };
+  auto upper = [&](bool strict) {
+    if (!end || epoch < *end) {
+      end = epoch, end_strict = strict;
+    } else if (epoch == *end) {
+      end_strict |= strict;
+    }
+  };
+  switch (op) {
+    case CompareOperatorEnum::Greater:
+      lower(true);
+      break;
+    case CompareOperatorEnum::GreaterEqual:
+      lower(false);
+      break;
+    case CompareOperatorEnum::Less:
+      upper(true);
+      break;
+    case CompareOperatorEnum::LessEqual:
+      upper(false);
+      break;
+    case CompareOperatorEnum::Equal:
+      lower(false), upper(false);
+      break;
+    case CompareOperatorEnum::NotEqual:
+      excluded.push_back(epoch);
+      break;
+  }
+}
+
+auto MaskPredicate::compile(const std::vector<Filter>& filters) -> MaskPredicate {
+  MaskPredicate predicate;
+  auto allowed = [&](const FilterItem& item) {
+    return std::ranges::all_of(filters, [&](const Filter& filter) { return filter.apply(item); });
+  };
+  for (size_t i = 0; i < ConstellationCount; ++i) {
+    auto constellation = Constellation{.id = static_cast<sensors::gnss::ConstellationEnum>(i)};
+    predicate.constellation_[i] = allowed(constellation);
+    for (size_t prn = 0; prn < PrnCount; ++prn) {
+      predicate.sv_[i * PrnCount + prn] = allowed(Sv{.prn = static_cast<u8>(prn), .constellation = constellation});
+    }
+  }
+  for (size_t i = 0; i < CarrierCount; ++i) {
+    predicate.carrier_[i] = allowed(Carrier{.id = static_cast<sensors::gnss::CarrierEnum>(i)});
+  }
+  for (const auto& filter : filters) {
+    if (auto snr = std::get_if<SnrItem>(&filter.__item)) predicate.snr_.bound(filter.__op.op, snr->val);
+    if (auto elevation = std::get_if<ElevationItem>(&filter.__item)) {
+      predicate.elevation_.bound(filter.__op.op, elevation->val);
+    }
+    if (auto azimuth = std::get_if<AzimuthItem>(&filter.__item)) predicate.azimuth_.bound(filter.__op.op, azimuth->val);
+    if (auto epoch = std::get_if<EpochItem>(&filter.__item)) predicate.epoch_.bound(filter.__op.op, *epoch);
+  }
+  return predicate;
+}
+
+void MaskPredicate::apply_snr(std::span<const f64> snr, std::span<u8> mask) const noexcept { snr_.apply(snr, mask); }
+
+void MaskPredicate::apply_elevation(std::span<const f64> elevation, std::span<u8> mask) const noexcept {
+  elevation_.apply(elevation, mask);
+}
+
+void MaskPredicate::apply_azimuth(std::span<const f64> azimuth, std::span<u8> mask) const noexcept {
+  azimuth_.apply(azimuth, mask);
 }
 
 }  // namespace navp::filter
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include <boost/algorithm/string.hpp>
 #include <ranges>
+#include <utility>
 
 #include "filter/filter.hpp"
 #include "sensors/gnss/carrier.hpp"
@@ -30,6 +31,10 @@ const Sig* GObs::find_code(ObsCodeEnum code) const noexcept {
   return nullptr;
 }
 
+Sig* GObs::find_code(ObsCodeEnum code) noexcept {
+  return const_cast<Sig*>(std::as_const(*this).find_code(code));
+}
+
 u8 GObs::frequency_count() const noexcept { return sigs_list.size(); }
 
 u8 GObs::code_count() const noexcept {
@@ -367,7 +372,8 @@ u8 Constellation::max_prn() const noexcept {
 }
 
 bool RawSig::is_valid(const filter::MaskFilters* mask_filter) const noexcept {
-  return valid == Valid && (!mask_filter || mask_filter->apply(filter::SnrItem(snr)));
+  // a cycle slip only breaks the carrier phase continuity, the signal stays usable
+  return (valid & ~CycleSlip) == Valid && (!mask_filter || mask_filter->apply(filter::SnrItem(snr)));
 }
 
 #undef NSATGPS
@@ -8,6 +8,7 @@ namespace navp::sensors::gnss {
 using navp::sensors::gnss::GnssRandomHandler;
 
 bool GnssRecord::update() {
+  if (assembler) return assembler->load_next(*obs, nav.empty() ? nullptr : nav.back().nav.get());
   if (!obs_stream->eof()) [[likely]] {
     obs->get_record(*obs_stream);  // read next epoch observation
     return true;
@@ -19,6 +20,7 @@ void GnssRuntimeInfo::update(const GnssRecord* record) {
   auto& [_epoch, _obs] = record->obs->latest();
   epoch = _epoch;                                                     // epoch assgin
   obs_map = std::addressof(_obs);                                     // observation map
+  if (record->cycle_slip) record->cycle_slip->detect(epoch, _obs);    // flag cycle slips
   avilable_sv = record->eph_solver->solve_sv_status(epoch, obs_map);  // available satellites
   sv_map = record->eph_solver->quary_sv_status(epoch);                // satellites map
 }
@@ -53,8 +55,8 @@ NAV_NODISCARD_UNUNSED auto GnssPayload::generate_rawobs_handler(const filter::Ma
         continue;
       }
     }
-    std::vector<const Sig*> sig;
-    obs->for_each_code([&](const Sig& _sig) {
+    std::vector<Sig*> sig;
+    obs->for_each_code([&](Sig& _sig) {
       if (settings_->enabled(sv, _sig) && _sig.is_valid(mask_filter)) {  // filter unabled code and invalid signal
         sig.push_back(std::addressof(_sig));
       }
@@ -83,15 +85,7 @@ auto GnssPayload::generate_atmosphere_handler(Sv sv) const -> AtmosphereHandler
 }
 
 auto GnssPayload::generate_random_handler(Sv sv) const -> GnssRandomHandler {
-  return GnssRandomHandler{}.set_model(settings_->random).set_sv_info(&runtime_info_->sv_map->at(sv));
-}
-
-void GnssRawObsHandler::handle_signal_variance(RandomModelEnum model,
-                                               GnssRandomHandler::EvaluateRandomOptions options) const noexcept {
-  auto random_handler = GnssRandomHandler{}.set_model(model).set_options(options).set_sv_info(sv_info);
-  for (auto _sig : sig) {
-    random_handler.handle(_sig);
-  }
+  return settings_->random_handler().set_sv_info(&runtime_info_->sv_map->at(sv));
 }
 
 f64 GnssRawObsHandler::trop_corr(const utils::CoordinateBlh* station_pos, TropModelEnum model) const noexcept {
@@ -0,0 +1,182 @@
+#include "sensors/gnss/ionex.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "utils/gTime.hpp"
+#include "utils/time.hpp"
+
+namespace navp::sensors::gnss {
+
+static constexpr f64 NaN = std::numeric_limits<f64>::quiet_NaN();
+
+// label of an IONEX record, from column 61
+static auto label_of(const std::string& line) -> std::string {
+  if (line.size() <= 60) return {};
+  auto label = line.substr(60);
+  while (!label.empty() && std::isspace(static_cast<unsigned char>(label.back()))) label.pop_back();
+  return label;
+}
+
+// fixed width field of a record, 0 if empty
+static f64 field(const std::string& line, size_t begin, size_t width) {
+  if (begin >= line.size()) return 0;
+  auto text = line.substr(begin, width);
+  char* end = nullptr;
+  f64 value = std::strtod(text.c_str(), &end);
+  return end == text.c_str() ? 0 : value;
+}
+
+// 6I6 epoch of a record
+static f64 epoch_of(const std::string& line) {
+  navp::details::Date date{.year = static_cast<u16>(field(line, 0, 6)),
+                           .month = static_cast<u8>(field(line, 6, 6)),
+                           .day = static_cast<u16>(field(line, 12, 6)),
+                           .hour = static_cast<u8>(field(line, 18, 6)),
+                           .minute = static_cast<u8>(field(line, 24, 6)),
+                           .integer_second = static_cast<u8>(field(line, 30, 6))};
+  return utils::MjDateUtc(utils::GTime(EpochUtc::from_date(date))).to_double();
+}
+
+Ionex::Ionex(const std::filesystem::path& path) {
+  std::ifstream stream(path);
+  if (!stream) throw IonexRuntimeError(std::format("Open IONEX {} failed", path.string()));
+  auto error = [&](std::string_view what) {
+    return IonexRuntimeError(std::format("IONEX {}: {}", path.string(), what));
+  };
+
+  // header
+  std::string line, label;
+  u32 maps = 0;
+  f64 lat1 = 0, lat2 = 0, lon1 = 0, lon2 = 0, exponent = -1;
+  while (std::getline(stream, line)) {
+    label = label_of(line);
+    if (label == "# OF MAPS IN FILE") {
+      maps = static_cast<u32>(field(line, 0, 6));
+    } else if (label == "BASE RADIUS") {
+      radius_ = field(line, 0, 8) * 1e3;
+    } else if (label == "HGT1 / HGT2 / DHGT") {
+      if (field(line, 2, 6) != field(line, 8, 6)) throw error("only single layer maps are supported");
+      height_ = field(line, 2, 6) * 1e3;
+    } else if (label == "LAT1 / LAT2 / DLAT") {
+      lat1 = field(line, 2, 6), lat2 = field(line, 8, 6), dlat_ = field(line, 14, 6);
+    } else if (label == "LON1 / LON2 / DLON") {
+      lon1 = field(line, 2, 6), lon2 = field(line, 8, 6), dlon_ = field(line, 14, 6);
+    } else if (label == "EXPONENT") {
+      exponent = field(line, 0, 6);
+    } else if (label == "END OF HEADER") {
+      break;
+    }
+  }
+  if (label != "END OF HEADER" || maps == 0 || dlat_ == 0 || dlon_ == 0 || radius_ <= 0) {
+    throw error("incomplete header");
+  }
+  lat0_ = lat1, lon0_ = lon1;
+  rows_ = static_cast<u32>(std::lround((lat2 - lat1) / dlat_)) + 1;
+  cols_ = static_cast<u32>(std::lround((lon2 - lon1) / dlon_)) + 1;
+  if (rows_ < 2 || cols_ < 2) throw error("maps of less than 2 x 2 nodes");
+  global_ = std::abs(std::abs(lon2 - lon1) - 360.0) < 1e-6;
+  size_t size = static_cast<size_t>(maps) * rows_ * cols_;
+  tec_.assign(size, std::numeric_limits<f32>::quiet_NaN());
+  epochs_.assign(maps, NaN);
+
+  // maps, a row is "LAT/LON1/LON2/DLON/H" followed by its values in 16I5 lines
+  std::vector<f32>* values = nullptr;
+  u32 map = 0;
+  f64 scale = std::pow(10.0, exponent);
+  while (std::getline(stream, line)) {
+    label = label_of(line);
+    if (label == "START OF TEC MAP" || label == "START OF RMS MAP") {
+      map = static_cast<u32>(field(line, 0, 6)) - 1;
+      if (map >= maps) throw error(std::format("map {} out of {} maps", map + 1, maps));
+      if (label == "START OF RMS MAP" && rms_.empty()) rms_.assign(size, std::numeric_limits<f32>::quiet_NaN());
+      values = label == "START OF TEC MAP" ? &tec_ : &rms_;
+      scale = std::pow(10.0, exponent);
+    } else if (label == "END OF TEC MAP" || label == "END OF RMS MAP") {
+      values = nullptr;
+    } else if (label == "EPOCH OF CURRENT MAP" && values == &tec_) {
+      epochs_[map] = epoch_of(line);
+    } else if (label == "EXPONENT") {
+      // exponent of the current map only
+      scale = std::pow(10.0, field(line, 0, 6));
+    } else if (label == "LAT/LON1/LON2/DLON/H" && values) {
+      f64 lat = field(line, 2, 6);
+      auto row = std::lround((lat - lat0_) / dlat_);
+      if (row < 0 || row >= static_cast<i64>(rows_)) throw error(std::format("latitude {} out of the grid", lat));
+      auto begin = values->begin() + (static_cast<size_t>(map) * rows_ + row) * cols_;
+      for (u32 col = 0; col < cols_;) {
+        if (!std::getline(stream, line)) throw error("truncated map");
+        for (size_t at = 0; at + 5 <= line.size() && col < cols_; at += 5, ++col) {
+          f64 value = field(line, at, 5);
+          begin[col] = value == 9999 ? std::numeric_limits<f32>::quiet_NaN() : static_cast<f32>(value * scale);
+        }
+      }
+    } else if (label == "END OF FILE") {
+      break;
+    }
+  }
+  if (std::ranges::any_of(epochs_, [](f64 mjd) { return std::isnan(mjd); })) throw error("map without epoch");
+  if (!std::ranges::is_sorted(epochs_)) throw error("maps out of time order");
+}
+
+auto Ionex::load(const std::filesystem::path& path) -> std::shared_ptr<const Ionex> {
+  static std::mutex mutex;
+  static std::unordered_map<std::string, std::weak_ptr<const Ionex>> ionexes;
+
+  auto source = std::filesystem::absolute(path).lexically_normal();
+  std::lock_guard lock(mutex);
+  auto& cached = ionexes[source.string()];
+  if (auto ionex = cached.lock()) return ionex;
+  auto ionex = std::make_shared<const Ionex>(source);
+  cached = ionex;
+  return ionex;
+}
+
+bool Ionex::map_time(f64 mjd, MapTime& time) const noexcept {
+  if (epochs_.empty() || mjd < epochs_.front() || mjd > epochs_.back()) return false;
+  auto upper = static_cast<u32>(std::ranges::upper_bound(epochs_, mjd) - epochs_.begin());
+  u32 second = std::min(upper, static_cast<u32>(epochs_.size() - 1));
+  u32 first = second > 0 ? second - 1 : 0;
+  f64 span = epochs_[second] - epochs_[first];
+  f64 ratio = span > 0 ? (mjd - epochs_[first]) / span : 0;
+  time.map = {first, second};
+  time.weight = {1 - ratio, ratio};
+  // the maps are fixed to the sun, a point is rotated by the earth between the map and the time
+  time.rotation = {(mjd - epochs_[first]) * 360.0, (mjd - epochs_[second]) * 360.0};
+  return true;
+}
+
+f64 Ionex::interpolate(const std::vector<f32>& values, u32 map, f64 lat, f64 lon) const noexcept {
+  f64 row = (lat - lat0_) / dlat_;
+  if (global_) lon = lon0_ + std::fmod(std::fmod(lon - lon0_, 360.0) + 360.0, 360.0);
+  f64 col = (lon - lon0_) / dlon_;
+  // the first and last rows are kept towards the poles
+  row = std::clamp<f64>(row, 0.0, static_cast<f64>(rows_ - 1));
+  if (col < 0 || col > cols_ - 1) return NaN;
+  auto r = std::min(static_cast<u32>(row), rows_ - 2), c = std::min(static_cast<u32>(col), cols_ - 2);
+  f64 dr = row - r, dc = col - c;
+  auto node = values.data() + (static_cast<size_t>(map) * rows_ + r) * cols_ + c;
+  return (1 - dr) * ((1 - dc) * node[0] + dc * node[1]) + dr * ((1 - dc) * node[cols_] + dc * node[cols_ + 1]);
+}
+
+f64 Ionex::vtec(const MapTime& time, f64 lat, f64 lon, f64* rms) const noexcept {
+  f64 value = 0, deviation = 0;
+  for (size_t k = 0; k < 2; ++k) {
+    if (time.weight[k] == 0) continue;
+    f64 rotated = lon + time.rotation[k];
+    value += time.weight[k] * interpolate(tec_, time.map[k], lat, rotated);
+    if (rms) deviation += time.weight[k] * (has_rms() ? interpolate(rms_, time.map[k], lat, rotated) : NaN);
+  }
+  if (rms) *rms = deviation;
+  return value;
+}
+
+}  // namespace navp::sensors::gnss
@@ -34,7 +34,7 @@ auto PreciseEphSolver::solve_sv_pephpos(EpochUtc t, Sv sv) noexcept -> bool {
   // find target precise ephemeris map
   auto nav_it = std::ranges::find_if(nav, [&](const Navigation *_nav) { return _nav->pephMap.contains(sv); });
   if (nav_it == nav.end()) {
-    nav_warn("No precise position found at {} for {}", t, sv);
+    nav_warn_limited(std::hash<Sv>{}(sv), "No precise position found at {} for {}", t, sv);
     return false;
   }
   auto &peph_map = (*nav_it)->pephMap.at(sv);
@@ -1,32 +1,150 @@
 #include "sensors/gnss/random.hpp"
 
+#include <cmath>
+#include <format>
+#include <numbers>
+
+#include "exprtk.hpp"
 #include "sensors/gnss/constants.hpp"
+#include "sensors/gnss/ephemeris_solver.hpp"
+#include "utils/eigen.hpp"
 
 namespace navp::sensors::gnss {
 
+// values of the signals
+using ArrayXf64 = Eigen::Array<f64, Eigen::Dynamic, 1>;
+
 namespace details {
 
+// coefficients of the random models of an observation type
+struct RandomCoefficients {
+  f64 standard;   // variance of the standard model (m^2)
+  f64 elevation;  // a^2 = b^2 of the elevation model (m^2)
+  f64 snr;        // c of the snr model (m^2 Hz)
+};
+
 // stardand random model
 constexpr f32 stardand_pseudorange_var = 1.0f * 1.0f;
 constexpr f32 stardand_carrier_var = 0.02f * 0.02f;
 
-// elevation based random model
+// elevation based random model, sin(el) is bounded by the one of 5 degrees
+constexpr f64 elevation_pseudorange_var = 0.3 * 0.3;
+constexpr f64 elevation_carrier_var = 0.003 * 0.003;
+const f64 elevation_min_sin = std::sin(5.0 * std::numbers::pi / 180.0);
+
+// snr based random model, about 0.7 m and 7 mm at 45 dB-Hz
+constexpr f64 snr_pseudorange_coefficient = 1.61e4;
+constexpr f64 snr_carrier_coefficient = 1.61;
+
+constexpr RandomCoefficients pseudorange_coefficients = {stardand_pseudorange_var, elevation_pseudorange_var,
+                                                         snr_pseudorange_coefficient};
+constexpr RandomCoefficients carrier_coefficients = {stardand_carrier_var, elevation_carrier_var,
+                                                     snr_carrier_coefficient};
+
+// variances of one observation type of the signals
+static void evaluate_variance(RandomModelEnum model, const RandomExpression* expression, bool carrier,
+                              const ArrayXf64& el, const ArrayXf64& snr, ArrayXf64& var) noexcept {
+  const auto& coefficients = carrier ? carrier_coefficients : pseudorange_coefficients;
+  auto elevation_var = [&] {
+    return coefficients.elevation * (1.0 + el.sin().max(elevation_min_sin).square().inverse());
+  };
+  switch (model) {
+    case RandomModelEnum::STANDARD: {
+      var.setConstant(coefficients.standard);
+      return;
+    }
+    case RandomModelEnum::ELEVATION_DEPENDENT: {
+      var = elevation_var();
+      return;
+    }
+    case RandomModelEnum::SNR_DEPENDENT: {
+      var = (snr > 0.0).select(coefficients.snr * (snr * (-std::numbers::ln10 / 10.0)).exp(), elevation_var());
+      return;
+    }
+    case RandomModelEnum::CUSTOM: {
+      if (!expression) {
+        var.setConstant(coefficients.standard);
+        return;
+      }
+      auto size = static_cast<size_t>(var.size());
+      expression->evaluate({el.data(), size}, {snr.data(), size}, carrier, {var.data(), size});
+      return;
+    }
+    default: {
+      nav_error("Encountering an unexpected branch in RandomModelEnum");
+      var.setConstant(coefficients.standard);
+      return;
+    }
+  }
+}
 
-// snr based random model
+}  // namespace details
 
-// custom model
+// the address of a compiled copy is stable, exprtk refers to its variables
+struct RandomExpression::Compiled {
+  // throw RandomModelRuntimeError if the expression does not compile
+  explicit Compiled(const std::string& source) {
+    symbol_table.add_variable("el", el);
+    symbol_table.add_variable("snr", snr);
+    symbol_table.add_variable("carrier", carrier);
+    symbol_table.add_constants();
+    expression.register_symbol_table(symbol_table);
+    exprtk::parser<f64> parser;
+    if (!parser.compile(source, expression)) {
+      throw RandomModelRuntimeError(
+          std::format("Compile random model expression \'{}\' failed, {}", source, parser.error()));
+    }
+  }
 
-}  // namespace details
+  f64 el = 0, snr = 0, carrier = 0;        // variables of the expression
+  exprtk::symbol_table<f64> symbol_table;  // symbols bound to the variables
+  exprtk::expression<f64> expression;      // compiled expression
+};
+
+RandomExpression::RandomExpression(std::string expression) : expression_(std::move(expression)) {
+  compiled_.push_back(std::make_unique<Compiled>(expression_));
+}
+
+RandomExpression::~RandomExpression() = default;
 
-#define HANDLE_PSEUDORANGE(code)                       \
-  if (options_ & EvaluateRandomOptions::Pseudorange) { \
-    code;                                              \
+auto RandomExpression::compile(const std::string& expression) -> std::shared_ptr<const RandomExpression> {
+  return std::shared_ptr<const RandomExpression>(new RandomExpression(expression));
+}
+
+auto RandomExpression::acquire() const noexcept -> std::unique_ptr<Compiled> {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!compiled_.empty()) {
+      auto compiled = std::move(compiled_.back());
+      compiled_.pop_back();
+      return compiled;
+    }
   }
+  // the source compiled once in the constructor
+  return std::make_unique<Compiled>(expression_);
+}
+
+void RandomExpression::release(std::unique_ptr<Compiled> compiled) const noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  compiled_.push_back(std::move(compiled));
+}
+
+f64 RandomExpression::evaluate(f64 el, f64 snr, bool carrier) const noexcept {
+  f64 var = 0;
+  evaluate({&el, 1}, {&snr, 1}, carrier, {&var, 1});
+  return var;
+}
 
-#define HANDLE_CARRIER(code)                       \
-  if (options_ & EvaluateRandomOptions::Carrier) { \
-    code;                                          \
+void RandomExpression::evaluate(std::span<const f64> el, std::span<const f64> snr, bool carrier,
+                                std::span<f64> var) const noexcept {
+  auto compiled = acquire();
+  compiled->carrier = carrier ? 1.0 : 0.0;
+  for (size_t i = 0; i < el.size(); ++i) {
+    compiled->el = el[i], compiled->snr = snr[i];
+    var[i] = compiled->expression.value();
   }
+  release(std::move(compiled));
+}
 
 GnssRandomHandler& GnssRandomHandler::set_model(RandomModelEnum model) noexcept {
   model_ = model;
@@ -43,35 +161,38 @@ GnssRandomHandler& GnssRandomHandler::set_sv_info(const EphemerisResult* eph_res
   return *this;
 }
 
-const Sig* GnssRandomHandler::handle(const Sig* sig) const noexcept {
+GnssRandomHandler& GnssRandomHandler::set_expression(std::shared_ptr<const RandomExpression> expression) noexcept {
+  expression_ = std::move(expression);
+  return *this;
+}
+
+Sig* GnssRandomHandler::handle(Sig* sig) const noexcept {
   if (!sig) return nullptr;
-  auto sig_ = const_cast<Sig*>(sig);
-  if (sig_) {
-    switch (model_) {
-      case RandomModelEnum::STANDARD: {
-        HANDLE_PSEUDORANGE(sig_->code_var = details::stardand_pseudorange_var);
-        HANDLE_CARRIER(sig_->phase_var = details::stardand_carrier_var);
-        return sig_;
-      }
-      case RandomModelEnum::ELEVATION_DEPENDENT: {
-        return sig_;
-      }
-      case RandomModelEnum::SNR_DEPENDENT: {
-        return sig_;
-      }
-      case RandomModelEnum::CUSTOM: {
-        return sig_;
-      }
-      default: {
-        nav_error("Encountering an unexpected branch in RandomModelEnum");
-        return nullptr;
-      }
+  f64 elevation = sv_info_ ? sv_info_->elevation : std::numbers::pi / 2;
+  handle({&sig, 1}, {&elevation, 1});
+  return sig;
+}
+
+void GnssRandomHandler::handle(std::span<Sig* const> sigs, std::span<const f64> elevation) const noexcept {
+  auto size = static_cast<Eigen::Index>(sigs.size());
+  if (size == 0) return;
+  ArrayXf64 el = Eigen::Map<const ArrayXf64>(elevation.data(), size);
+  ArrayXf64 snr(size), var(size);
+  for (Eigen::Index i = 0; i < size; ++i) {
+    snr(i) = !sigs[i] || sigs[i]->valid & RawSig::MissingSnr ? 0.0 : sigs[i]->snr;
+  }
+  if (options_ & EvaluateRandomOptions::Pseudorange) {
+    details::evaluate_variance(model_, expression_.get(), false, el, snr, var);
+    for (Eigen::Index i = 0; i < size; ++i) {
+      if (sigs[i]) sigs[i]->code_var = var(i);
+    }
+  }
+  if (options_ & EvaluateRandomOptions::Carrier) {
+    details::evaluate_variance(model_, expression_.get(), true, el, snr, var);
+    for (Eigen::Index i = 0; i < size; ++i) {
+      if (sigs[i]) sigs[i]->phase_var = var(i);
     }
   }
-  return nullptr;
 }
 
-#undef HANDLE_PSEUDORANGE
-#undef HANDLE_CARRIER
-
-}  // namespace navp::sensors::gnss
\ No newline at end of file
+}  // namespace navp::sensors::gnss
@@ -0,0 +1,482 @@
+#include "sensors/gnss/trop_grid.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <numbers>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/gTime.hpp"
+#include "utils/time.hpp"
+
+namespace navp::sensors::gnss {
+
+namespace details {
+extern const f64 vmf3_anm[4][91][5];
+extern const f64 vmf3_bnm[4][91][5];
+}  // namespace details
+
+static constexpr char Magic[8] = "NAVTROP";
+static constexpr u32 Gpt2Fields = sizeof(TropGrid::Gpt2Node) / sizeof(f64);
+static constexpr u32 Vmf3Fields = sizeof(TropGrid::Vmf3Node) / sizeof(f64);
+static constexpr f64 D2R = std::numbers::pi / 180.0;
+
+static_assert(sizeof(TropGrid::Header) % sizeof(f64) == 0, "Grid epochs follow the header aligned");
+static_assert(Gpt2Fields == 42 && Vmf3Fields == 5, "Grid nodes are plain arrays of f64");
+
+// numbers of a text line
+static auto split_numbers(const std::string& line) -> std::vector<f64> {
+  std::vector<f64> values;
+  std::istringstream stream(line);
+  f64 value;
+  while (stream >> value) values.push_back(value);
+  return values;
+}
+
+// geometry of a cell centered global grid from its first node
+static void set_geometry(TropGrid::Header& header, f64 lat0, f64 lon0) {
+  header.lat0 = lat0, header.lon0 = lon0;
+  header.step = 2 * (90.0 - lat0);
+  if (!(header.step > 0) || std::abs(2 * lon0 - header.step) > 1e-9) {
+    throw TropGridRuntimeError(std::format("Troposphere grid starting at ({}, {}) is not cell centered", lat0, lon0));
+  }
+  header.rows = static_cast<u32>(std::lround(180.0 / header.step));
+  header.cols = static_cast<u32>(std::lround(360.0 / header.step));
+}
+
+// the node of a text line is where the grid expects it
+static void check_node(const TropGrid::Header& header, u32 index, f64 lat, f64 lon, const std::filesystem::path& path) {
+  auto row = index / header.cols, col = index % header.cols;
+  if (row >= header.rows || std::abs(lat - (header.lat0 - row * header.step)) > 1e-6 ||
+      std::abs(lon - (header.lon0 + col * header.step)) > 1e-6) {
+    throw TropGridRuntimeError(std::format("Unexpected node ({}, {}) in troposphere grid {}", lat, lon, path.string()));
+  }
+}
+
+static void write_grid(const std::filesystem::path& binary, const TropGrid::Header& header,
+                       const std::vector<f64>& epochs, const std::vector<f64>& nodes) {
+  // written aside and renamed, so that a grid being mapped is never seen half written
+  auto temporary = binary;
+  temporary += ".tmp";
+  std::FILE* file = std::fopen(temporary.c_str(), "wb");
+  if (!file) throw TropGridRuntimeError(std::format("Open troposphere grid {} failed", temporary.string()));
+  bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+            std::fwrite(epochs.data(), sizeof(f64), epochs.size(), file) == epochs.size() &&
+            std::fwrite(nodes.data(), sizeof(f64), nodes.size(), file) == nodes.size();
+  ok = std::fclose(file) == 0 && ok;
+  std::error_code ec;
+  if (ok) std::filesystem::rename(temporary, binary, ec);
+  if (!ok || ec) {
+    std::filesystem::remove(temporary, ec);
+    throw TropGridRuntimeError(std::format("Write troposphere grid {} failed", binary.string()));
+  }
+}
+
+static auto make_header(TropGridKind kind, u32 epochs, u32 fields) -> TropGrid::Header {
+  TropGrid::Header header{};
+  std::memcpy(header.magic, Magic, sizeof(Magic));
+  header.version = TropGrid::Version;
+  header.kind = kind;
+  header.epochs = epochs;
+  header.fields = fields;
+  return header;
+}
+
+static bool is_binary(const std::filesystem::path& path) {
+  char magic[sizeof(Magic)] = {};
+  std::ifstream stream(path, std::ios::binary);
+  return stream.read(magic, sizeof(magic)) && std::memcmp(magic, Magic, sizeof(Magic)) == 0;
+}
+
+TropGrid::TropGrid(const std::filesystem::path& path) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw TropGridRuntimeError(std::format("Open troposphere grid {} failed", path.string()));
+  struct stat info;
+  if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(Header)) {
+    ::close(fd);
+    throw TropGridRuntimeError(std::format("Troposphere grid {} is too short", path.string()));
+  }
+  length_ = static_cast<size_t>(info.st_size);
+  map_ = ::mmap(nullptr, length_, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (map_ == MAP_FAILED) {
+    map_ = nullptr;
+    throw TropGridRuntimeError(std::format("Map troposphere grid {} failed", path.string()));
+  }
+  header_ = static_cast<const Header*>(map_);
+  auto expected = [&] {
+    auto& h = *header_;
+    return sizeof(Header) + sizeof(f64) * (h.epochs + static_cast<size_t>(h.epochs) * h.rows * h.cols * h.fields);
+  };
+  auto fields = header_->kind == TropGridKind::VMF3 ? Vmf3Fields : Gpt2Fields;
+  if (std::memcmp(header_->magic, Magic, sizeof(Magic)) != 0 || header_->version != Version ||
+      header_->fields != fields || header_->epochs == 0 || header_->rows == 0 || header_->cols == 0 ||
+      expected() != length_) {
+    ::munmap(map_, length_);
+    map_ = nullptr;
+    throw TropGridRuntimeError(std::format("Troposphere grid {} is invalid or of another version", path.string()));
+  }
+  epochs_ = reinterpret_cast<const f64*>(header_ + 1);
+  nodes_ = epochs_ + header_->epochs;
+  ::madvise(map_, length_, MADV_RANDOM);
+}
+
+TropGrid::~TropGrid() noexcept {
+  if (map_) ::munmap(map_, length_);
+}
+
+auto TropGrid::load(const std::filesystem::path& path) -> std::shared_ptr<const TropGrid> {
+  static std::mutex mutex;
+  static std::unordered_map<std::string, std::weak_ptr<const TropGrid>> grids;
+
+  auto source = std::filesystem::absolute(path).lexically_normal();
+  std::lock_guard lock(mutex);
+  auto& cached = grids[source.string()];
+  if (auto grid = cached.lock()) return grid;
+
+  auto binary = source;
+  if (!is_binary(source)) {
+    // gpt2/gpt2w text grid, vmf3 grids of several files are converted by `convert_vmf3` beforehand
+    binary += ".bin";
+    std::error_code ec;
+    if (!std::filesystem::exists(binary) ||
+        std::filesystem::last_write_time(binary, ec) < std::filesystem::last_write_time(source, ec)) {
+      convert_gpt2(source, binary);
+    }
+  }
+  auto grid = std::make_shared<const TropGrid>(binary);
+  cached = grid;
+  return grid;
+}
+
+void TropGrid::convert_gpt2(const std::filesystem::path& text, const std::filesystem::path& binary) {
+  std::ifstream stream(text);
+  if (!stream) throw TropGridRuntimeError(std::format("Open troposphere grid {} failed", text.string()));
+  auto header = make_header(TropGridKind::GPT2, 1, Gpt2Fields);
+  std::vector<f64> nodes;
+  std::string line;
+  u32 count = 0;
+  while (std::getline(stream, line)) {
+    if (line.find('%') != std::string::npos) continue;
+    auto values = split_numbers(line);
+    if (values.empty()) continue;
+    if (values.size() != 34 && values.size() != 44) {
+      throw TropGridRuntimeError(std::format("Unexpected {} columns in gpt2 grid {}", values.size(), text.string()));
+    }
+    if (count == 0) {
+      header.kind = values.size() == 44 ? TropGridKind::GPT2W : TropGridKind::GPT2;
+      set_geometry(header, values[0], values[1]);
+      nodes.reserve(static_cast<size_t>(header.rows) * header.cols * Gpt2Fields);
+    } else if ((values.size() == 44) != (header.kind == TropGridKind::GPT2W)) {
+      throw TropGridRuntimeError(std::format("Mixed gpt2 and gpt2w nodes in grid {}", text.string()));
+    }
+    check_node(header, count, values[0], values[1], text);
+
+    // columns: lat lon p(5) T(5) Q(5) dT(5) undu Hs ah(5) aw(5) [lambda(5) Tm(5)]
+    TropGrid::Gpt2Node node{};
+    auto seasonal = [&](std::array<f64, 5>& field, size_t column, f64 scale) {
+      for (size_t i = 0; i < 5; ++i) field[i] = values[column + i] * scale;
+    };
+    seasonal(node.pressure, 2, 1.0);
+    seasonal(node.temperature, 7, 1.0);
+    seasonal(node.humidity, 12, 1e-3);
+    seasonal(node.lapse_rate, 17, 1e-3);
+    node.undulation = values[22];
+    node.height = values[23];
+    seasonal(node.ah, 24, 1e-3);
+    seasonal(node.aw, 29, 1e-3);
+    if (header.kind == TropGridKind::GPT2W) {
+      seasonal(node.lambda, 34, 1.0);
+      seasonal(node.tm, 39, 1.0);
+    }
+    auto data = reinterpret_cast<const f64*>(&node);
+    nodes.insert(nodes.end(), data, data + Gpt2Fields);
+    ++count;
+  }
+  if (count == 0 || count != header.rows * header.cols) {
+    throw TropGridRuntimeError(std::format("Gpt2 grid {} has {} of {} nodes", text.string(), count,
+                                           header.rows * header.cols));
+  }
+  write_grid(binary, header, {0.0}, nodes);
+}
+
+void TropGrid::convert_vmf3(std::span<const std::filesystem::path> grids, const std::filesystem::path& orography,
+                            const std::filesystem::path& binary) {
+  if (grids.empty()) throw TropGridRuntimeError("No vmf3 grid to convert");
+  struct EpochNodes {
+    f64 mjd;
+    std::vector<f64> nodes;  // ah aw zhd zwd of each node
+  };
+  std::vector<EpochNodes> epochs;
+  auto header = make_header(TropGridKind::VMF3, static_cast<u32>(grids.size()), Vmf3Fields);
+  for (auto& path : grids) {
+    std::ifstream stream(path);
+    if (!stream) throw TropGridRuntimeError(std::format("Open vmf3 grid {} failed", path.string()));
+    EpochNodes epoch{.mjd = -1, .nodes = {}};
+    std::string line;
+    u32 count = 0;
+    while (std::getline(stream, line)) {
+      if (line.starts_with('!')) {
+        // ! Epoch:              2021 01 01 00 00  0.0
+        auto at = line.find("Epoch:");
+        if (at == std::string::npos) continue;
+        auto values = split_numbers(line.substr(at + 6));
+        if (values.size() < 6) continue;
+        navp::details::Date date{.year = static_cast<u16>(values[0]),
+                                 .month = static_cast<u8>(values[1]),
+                                 .day = static_cast<u16>(values[2]),
+                                 .hour = static_cast<u8>(values[3]),
+                                 .minute = static_cast<u8>(values[4]),
+                                 .integer_second = static_cast<u8>(values[5])};
+        epoch.mjd = utils::MjDateUtc(utils::GTime(EpochUtc::from_date(date))).to_double();
+        continue;
+      }
+      auto values = split_numbers(line);
+      if (values.empty()) continue;
+      if (values.size() != 6) {
+        throw TropGridRuntimeError(std::format("Unexpected {} columns in vmf3 grid {}", values.size(), path.string()));
+      }
+      if (count == 0 && epochs.empty()) {
+        set_geometry(header, values[0], values[1]);
+      }
+      check_node(header, count, values[0], values[1], path);
+      epoch.nodes.insert(epoch.nodes.end(), values.begin() + 2, values.end());
+      ++count;
+    }
+    if (epoch.mjd < 0 || count != header.rows * header.cols) {
+      throw TropGridRuntimeError(std::format("Vmf3 grid {} misses its epoch or nodes", path.string()));
+    }
+    epochs.push_back(std::move(epoch));
+  }
+
+  // orography of the nodes, one height per node or "lat lon height" lines
+  std::ifstream stream(orography);
+  if (!stream) throw TropGridRuntimeError(std::format("Open vmf3 orography {} failed", orography.string()));
+  std::vector<f64> heights;
+  std::string line;
+  while (std::getline(stream, line)) {
+    if (line.starts_with('!') || line.starts_with('%')) continue;
+    auto values = split_numbers(line);
+    if (values.size() == 3) {
+      heights.push_back(values[2]);
+    } else {
+      heights.insert(heights.end(), values.begin(), values.end());
+    }
+  }
+  size_t size = static_cast<size_t>(header.rows) * header.cols;
+  if (heights.size() != size) {
+    throw TropGridRuntimeError(std::format("Vmf3 orography {} has {} of {} nodes", orography.string(), heights.size(),
+                                           size));
+  }
+
+  std::ranges::sort(epochs, {}, &EpochNodes::mjd);
+  std::vector<f64> mjd, nodes;
+  nodes.reserve(epochs.size() * size * Vmf3Fields);
+  for (auto& epoch : epochs) {
+    mjd.push_back(epoch.mjd);
+    for (size_t i = 0; i < size; ++i) {
+      nodes.insert(nodes.end(), epoch.nodes.begin() + 4 * i, epoch.nodes.begin() + 4 * i + 4);
+      nodes.push_back(heights[i]);
+    }
+  }
+  write_grid(binary, header, mjd, nodes);
+}
+
+void TropGrid::surrounding(f64 lat, f64 lon, std::array<u32, 4>& index, std::array<f64, 4>& weight) const noexcept {
+  auto& h = *header_;
+  // polar distance and longitude (deg) in units of nodes from the first one
+  f64 row = ((90.0 - lat / D2R) - (90.0 - h.lat0)) / h.step;
+  f64 col = (std::fmod(lon / D2R + 360.0, 360.0) - h.lon0) / h.step;
+  auto wrap = [&](i64 c) { return static_cast<u32>((c % h.cols + h.cols) % h.cols); };
+  i64 r0 = static_cast<i64>(std::floor(row)), c0 = static_cast<i64>(std::floor(col));
+  if (r0 < 0 || r0 + 1 >= static_cast<i64>(h.rows)) {
+    // beyond the first or last row, the nearest node
+    auto r = static_cast<u32>(std::clamp<i64>(std::lround(row), 0, h.rows - 1));
+    index.fill(node_index(r, wrap(std::lround(col))));
+    weight = {1.0, 0.0, 0.0, 0.0};
+    return;
+  }
+  f64 dr = row - r0, dc = col - c0;
+  auto r = static_cast<u32>(r0);
+  index = {node_index(r, wrap(c0)), node_index(r + 1, wrap(c0)), node_index(r, wrap(c0 + 1)),
+           node_index(r + 1, wrap(c0 + 1))};
+  weight = {(1 - dr) * (1 - dc), dr * (1 - dc), (1 - dr) * dc, dr * dc};
+}
+
+void TropGridStation::set_station(const TropGrid& grid, f64 lat, f64 lon, f64 hgt) noexcept {
+  lat_ = lat, lon_ = lon, hgt_ = hgt;
+  grid.surrounding(lat, lon, index_, weight_);
+  located_ = true;
+  day_ = -1;
+  interpolated_ = false;
+}
+
+bool TropGridStation::evaluate(const TropGrid& grid, f64 mjd, TropGridZenith& zenith) noexcept {
+  if (!located_) return false;
+  switch (grid.kind()) {
+    case TropGridKind::GPT2:
+    case TropGridKind::GPT2W:
+      return evaluate_gpt2(grid, mjd, zenith);
+    case TropGridKind::VMF3:
+      return evaluate_vmf3(grid, mjd, zenith);
+    default:
+      return false;
+  }
+}
+
+// pressure, temperature and humidity of the gpt2 nodes at the station height, the vmf1 coefficients of the day
+bool TropGridStation::evaluate_gpt2(const TropGrid& grid, f64 mjd, TropGridZenith& zenith) noexcept {
+  constexpr f64 gm = 9.80665, dMtr = 28.965e-3, Rg = 8.3143;
+  f64 day = std::floor(mjd);
+  if (day == day_) {
+    zenith = daily_;
+    return true;
+  }
+  f64 t = (day - MJD_j2000) / 365.25 * 2 * std::numbers::pi;
+  std::array<f64, 5> terms = {1.0, std::cos(t), std::sin(t), std::cos(2 * t), std::sin(2 * t)};
+  auto seasonal = [&](const std::array<f64, 5>& field) {
+    f64 value = 0;
+    for (size_t i = 0; i < 5; ++i) value += field[i] * terms[i];
+    return value;
+  };
+  f64 p = 0, te = 0, q = 0, ah = 0, aw = 0, lambda = 0, tm = 0, undu = 0;
+  for (size_t i = 0; i < 4; ++i) {
+    if (weight_[i] == 0) continue;
+    auto& node = grid.gpt2(index_[i]);
+    // station height above the node (m), reduced with the node geoid
+    f64 redh = hgt_ - node.undulation - node.height;
+    f64 t0 = seasonal(node.temperature), qi = seasonal(node.humidity);
+    f64 con = gm * dMtr / (Rg * t0 * (1 + 0.6077 * qi));
+    p += weight_[i] * seasonal(node.pressure) * std::exp(-con * redh) / 100;
+    te += weight_[i] * (t0 + seasonal(node.lapse_rate) * redh - 273.15);
+    q += weight_[i] * qi;
+    ah += weight_[i] * seasonal(node.ah);
+    aw += weight_[i] * seasonal(node.aw);
+    lambda += weight_[i] * seasonal(node.lambda);
+    tm += weight_[i] * seasonal(node.tm);
+    undu += weight_[i] * node.undulation;
+  }
+  // water vapour pressure (hPa) and the saastamoinen hydrostatic delay at the orthometric height
+  f64 e = q * p / (0.622 + 0.378 * q);
+  f64 hgt = hgt_ - undu;
+  f64 denom = 1 - 0.00266 * std::cos(2 * lat_) - 0.00028 * hgt / 1e3;
+  daily_.dry_ztd = 0.0022768 * p / denom;
+  if (grid.kind() == TropGridKind::GPT2W) {
+    // askne and nordius
+    daily_.wet_ztd = 1e-6 * (16.5203 + 377600 / tm) * (Rg / dMtr) / (gm * (lambda + 1)) * e;
+  } else {
+    daily_.wet_ztd = 0.0022768 * (1255 / (te + 273.15) + 0.05) * e / denom;
+  }
+
+  // vmf1 b and c coefficients
+  f64 doy = day - 44239 + 1 - 28;
+  f64 phh = lat_ < 0 ? std::numbers::pi : 0, c11h = lat_ < 0 ? 0.007 : 0.005, c10h = lat_ < 0 ? 0.002 : 0.001;
+  f64 ch = 0.062 + ((std::cos(doy / 365.25 * 2 * std::numbers::pi + phh) + 1) * c11h / 2 + c10h) *
+                       (1 - std::cos(lat_));
+  daily_.dry_coeff = {ah, 0.0029, ch};
+  daily_.wet_coeff = {aw, 0.00146, 0.04391};
+  if (!std::isfinite(daily_.dry_ztd) || !std::isfinite(daily_.wet_ztd) || !(p > 0)) return false;
+  day_ = day;
+  zenith = daily_;
+  return true;
+}
+
+// vmf3 b and c coefficients of the day from their spherical harmonics
+static void vmf3_coefficients(f64 lat, f64 lon, f64 doy, TropGridZenith& zenith) {
+  constexpr i32 nmax = 12;
+  f64 v[nmax + 1][nmax + 1] = {}, w[nmax + 1][nmax + 1] = {};
+  f64 x = std::cos(lat) * std::cos(lon), y = std::cos(lat) * std::sin(lon), z = std::sin(lat);
+  v[0][0] = 1;
+  v[1][0] = z;
+  for (i32 n = 2; n <= nmax; ++n) v[n][0] = ((2 * n - 1) * z * v[n - 1][0] - (n - 1) * v[n - 2][0]) / n;
+  for (i32 m = 1; m <= nmax; ++m) {
+    v[m][m] = (2 * m - 1) * (x * v[m - 1][m - 1] - y * w[m - 1][m - 1]);
+    w[m][m] = (2 * m - 1) * (x * w[m - 1][m - 1] + y * v[m - 1][m - 1]);
+    if (m < nmax) {
+      v[m + 1][m] = (2 * m + 1) * z * v[m][m];
+      w[m + 1][m] = (2 * m + 1) * z * w[m][m];
+    }
+    for (i32 n = m + 2; n <= nmax; ++n) {
+      v[n][m] = ((2 * n - 1) * z * v[n - 1][m] - (n + m - 1) * v[n - 2][m]) / (n - m);
+      w[n][m] = ((2 * n - 1) * z * w[n - 1][m] - (n + m - 1) * w[n - 2][m]) / (n - m);
+    }
+  }
+  f64 t = doy / 365.25 * 2 * std::numbers::pi;
+  std::array<f64, 5> terms = {1.0, std::cos(t), std::sin(t), std::cos(2 * t), std::sin(2 * t)};
+  // bh, bw, ch, cw
+  std::array<f64, 4> coeff{};
+  for (size_t k = 0; k < 4; ++k) {
+    for (size_t j = 0; j < 5; ++j) {
+      f64 sum = 0;
+      for (i32 n = 0, i = 0; n <= nmax; ++n) {
+        for (i32 m = 0; m <= n; ++m, ++i) {
+          sum += details::vmf3_anm[k][i][j] * v[n][m] + details::vmf3_bnm[k][i][j] * w[n][m];
+        }
+      }
+      coeff[k] += sum * terms[j];
+    }
+  }
+  zenith.dry_coeff[1] = coeff[0], zenith.wet_coeff[1] = coeff[1];
+  zenith.dry_coeff[2] = coeff[2], zenith.wet_coeff[2] = coeff[3];
+}
+
+bool TropGridStation::evaluate_vmf3(const TropGrid& grid, f64 mjd, TropGridZenith& zenith) noexcept {
+  auto epochs = grid.epochs();
+  // grid epochs around the time, the first or last one out of the grid
+  u32 last = static_cast<u32>(epochs.size() - 1);
+  if (!interpolated_ || (epoch_ > 0 && mjd < epochs[epoch_]) ||
+      (epoch_ + 1 < last && mjd >= epochs[epoch_ + 1])) {
+    auto upper = std::ranges::upper_bound(epochs, mjd) - epochs.begin();
+    epoch_ = static_cast<u32>(std::clamp<i64>(upper - 1, 0, std::max<i64>(static_cast<i64>(last) - 1, 0)));
+    // nodes reduced to the station height, then interpolated at the station
+    f64 denom_h = 1 - 0.00266 * std::cos(2 * lat_) - 0.28e-6 * hgt_;
+    for (u32 k = 0; k < 2; ++k) {
+      auto& station = vmf3_[k];
+      station = {};
+      for (size_t i = 0; i < 4; ++i) {
+        if (weight_[i] == 0) continue;
+        auto& node = grid.vmf3(std::min(epoch_ + k, last), index_[i]);
+        f64 dh = hgt_ - node.orography;
+        f64 denom_o = 1 - 0.00266 * std::cos(2 * lat_) - 0.28e-6 * node.orography;
+        station.ah += weight_[i] * node.ah;
+        station.aw += weight_[i] * node.aw;
+        station.zhd += weight_[i] * node.zhd * std::pow(1 - 2.26e-5 * dh, 5.225) * denom_o / denom_h;
+        station.zwd += weight_[i] * node.zwd * std::exp(-dh / 2000);
+      }
+    }
+    interpolated_ = true;
+  }
+  f64 span = epochs.size() > 1 ? epochs[epoch_ + 1] - epochs[epoch_] : 0;
+  f64 ratio = span > 0 ? std::clamp<f64>((mjd - epochs[epoch_]) / span, 0.0, 1.0) : 0;
+  auto interpolate = [&](f64 TropGrid::Vmf3Node::*field) {
+    return vmf3_[0].*field + (vmf3_[1].*field - vmf3_[0].*field) * ratio;
+  };
+
+  f64 day = std::floor(mjd);
+  if (day != day_) {
+    utils::MjDateUtc midnight;
+    midnight.val = day;
+    utils::UYds yds = utils::GTime(midnight);
+    vmf3_coefficients(lat_, lon_, yds.doy, daily_);
+    day_ = day;
+  }
+  zenith.dry_ztd = interpolate(&TropGrid::Vmf3Node::zhd);
+  zenith.wet_ztd = interpolate(&TropGrid::Vmf3Node::zwd);
+  zenith.dry_coeff = {interpolate(&TropGrid::Vmf3Node::ah), daily_.dry_coeff[1], daily_.dry_coeff[2]};
+  zenith.wet_coeff = {interpolate(&TropGrid::Vmf3Node::aw), daily_.wet_coeff[1], daily_.wet_coeff[2]};
+  return std::isfinite(zenith.dry_ztd) && std::isfinite(zenith.wet_ztd) && zenith.dry_ztd > 0;
+}
+
+}  // namespace navp::sensors::gnss
@@ -0,0 +1,1305 @@
+#include "utils/types.hpp"
+
+// spherical harmonics (degree and order 12) of the vmf3 b and c coefficients, each with mean, cos and sin annual,
+// cos and sin semi-annual terms, from the vmf3 reference implementation
+namespace navp::sensors::gnss::details {
+
+// bh, bw, ch, cw
+extern const f64 vmf3_anm[4][91][5] = {
+    {
+        {0.00271285863109945, -1.39197786008938E-06, 1.34955672002719E-06, 2.71686279717968E-07, 1.56659301773925E-06},
+        {9.80476624811974E-06, -5.83922611260673E-05, -2.07307023860417E-05, 1.14628726961148E-06,
+         4.93610283608719E-06},
+        {-1.03443106534268E-05, -2.05536138785961E-06, 2.09692641914244E-06, -1.55491034130965E-08,
+         -1.89706404675801E-07},
+        {-3.00353961749658E-05, 2.37284447073503E-05, 2.02236885378918E-05, 1.69276006349609E-06, 8.72156681243892E-07},
+        {-7.99121077044035E-07, -5.39048313389504E-06, -4.21234502039861E-06, -2.70944149806894E-06,
+         -6.80894455531746E-07},
+        {7.51439609883296E-07, 3.85509708865520E-07, 4.41508016098164E-08, -2.07507808307757E-08, 4.95354985050743E-08},
+        {2.21790962160087E-05, -5.56986238775212E-05, -1.81287885563308E-05, -4.41076013532589E-06,
+         4.93573223917278E-06},
+        {-4.47639989737328E-06, -2.60452893072120E-06, 2.56376320011189E-06, 4.41600992220479E-07,
+         2.93437730332869E-07},
+        {8.14992682244945E-07, 2.03945571424434E-07, 1.11832498659806E-08, 3.25756664234497E-08, 3.01029040414968E-08},
+        {-7.96927680907488E-08, -3.66953150925865E-08, -6.74742632186619E-09, -1.30315731273651E-08,
+         -2.00748924306947E-09},
+        {-2.16138375166934E-05, 1.67350317962556E-05, 1.93768260076821E-05, 1.99595120161850E-06,
+         -2.42463528222014E-06},
+        {5.34360283708044E-07, -3.64189022040600E-06, -2.99935375194279E-06, -2.06880962903922E-06,
+         -9.40815692626002E-07},
+        {6.80235884441822E-07, 1.33023436079845E-07, -1.80349593705226E-08, 2.51276252565192E-08,
+         -1.43240592002794E-09},
+        {-7.13790897253802E-08, 7.81998506267559E-09, 1.13826909570178E-09, -5.89629600214654E-09,
+         -4.20760865522804E-09},
+        {-5.80109372399116E-09, 1.13702284491976E-09, 7.29046067602764E-10, -9.10468988754012E-10,
+         -2.58814364808642E-10},
+        {1.75558618192965E-05, -2.85579168876063E-05, -1.47442190284602E-05, -6.29300414335248E-06,
+         -5.12204538913460E-07},
+        {-1.90788558291310E-06, -1.62144845155361E-06, 7.57239241641566E-07, 6.93365788711348E-07,
+         6.88855644570695E-07},
+        {2.27050351488552E-07, 1.03925791277660E-07, -3.31105076632079E-09, 2.88065761026675E-08,
+         -8.00256848229136E-09},
+        {-2.77028851807614E-08, -5.96251132206930E-09, 2.95987495527251E-10, -5.87644249625625E-09,
+         -3.28803981542337E-09},
+        {-1.89918479865558E-08, 3.54083436578857E-09, 8.10617835854935E-10, 4.99207055948336E-10,
+         -1.52691648387663E-10},
+        {1.04022499586096E-09, -2.36437143845013E-10, -2.25110813484842E-10, -7.39850069252329E-11,
+         7.95929405440911E-11},
+        {-3.11579421267630E-05, -3.43576336877494E-06, 5.81663608263384E-06, 8.31534700351802E-07,
+         4.02619520312154E-06},
+        {6.00037066879001E-07, -1.12538760056168E-07, -3.86745332115590E-07, -3.88218746020826E-07,
+         -6.83764967176388E-07},
+        {-9.79583981249316E-08, 9.14964449851003E-08, 4.77779838549237E-09, 2.44283811750703E-09,
+         -6.26361079345158E-09},
+        {-2.37742207548109E-08, -5.53336301671633E-09, -3.73625445257115E-09, -1.92304189572886E-09,
+         -7.18681390197449E-09},
+        {-6.58203463929583E-09, 9.28456148541896E-10, 2.47218904311077E-10, 1.10664919110218E-10,
+         -4.20390976974043E-11},
+        {9.45857603373426E-10, -3.29683402990254E-11, -8.15440375865127E-11, -1.21615589356628E-12,
+         -9.70713008848085E-12},
+        {1.61377382316176E-10, 6.84326027598147E-12, -4.66898885683671E-12, 2.31211355085535E-12, 2.39195112937346E-12},
+        {2.99634365075821E-07, 8.14391615472128E-06, 6.70458490942443E-06, -9.92542646762000E-07,
+         -3.04078064992750E-06},
+        {-6.52697933801393E-07, 2.87255329776428E-07, -1.78227609772085E-08, 2.65525429849935E-07,
+         8.60650570551813E-08},
+        {-1.62727164011710E-07, 1.09102479325892E-07, 4.97827431850001E-09, 7.86649963082937E-11,
+         -6.67193813407656E-09},
+        {-2.96370000987760E-09, 1.20008401576557E-09, 1.75885448022883E-09, -1.74756709684384E-09,
+         3.21963061454248E-09},
+        {-9.91101697778560E-10, 7.54541713140752E-10, -2.95880967800875E-10, 1.81009160501278E-10,
+         8.31547411640954E-11},
+        {1.21268051949609E-10, -5.93572774509587E-11, -5.03295034994351E-11, 3.05383430975252E-11,
+         3.56280438509939E-11},
+        {6.92012970333794E-11, -9.02885345797597E-12, -3.44151832744880E-12, 2.03164894681921E-12,
+         -5.44852265137606E-12},
+        {5.56731263672800E-12, 3.57272150106101E-12, 2.25885622368678E-12, -2.44508240047675E-13,
+         -6.83314378535235E-13},
+        {3.96883487797254E-06, -4.57100506169608E-06, -3.30208117813256E-06, 3.32599719134845E-06,
+         4.26539325549339E-06},
+        {1.10123151770973E-06, 4.58046760144882E-07, 1.86831972581926E-07, -1.60092770735081E-07,
+         -5.58956114867062E-07},
+        {-3.40344900506653E-08, 2.87649741373047E-08, -1.83929753066251E-08, -9.74179203885847E-09,
+         -2.42064137485043E-09},
+        {-6.49731596932566E-09, -3.07048108404447E-09, -2.84380614669848E-09, 1.55123146524283E-09,
+         4.53694984588346E-10},
+        {5.45175793803325E-10, -3.73287624700125E-10, -1.16293122618336E-10, 7.25845618602690E-11,
+         -4.34112440021627E-11},
+        {1.89481447552805E-10, 3.67431482211078E-12, -1.72180065021194E-11, 1.47046319023226E-11, 1.31920481414062E-11},
+        {2.10125915737167E-12, -3.08420783495975E-12, -4.87748712363020E-12, 1.16363599902490E-14,
+         1.26698255558605E-13},
+        {-8.07894928696254E-12, 9.19344620512607E-13, 3.26929173307443E-13, 2.00438149416495E-13,
+         -9.57035765212079E-15},
+        {1.38737151773284E-12, 1.09340178371420E-13, 5.15714202449053E-14, -5.92156438588931E-14,
+         -3.29586752336143E-14},
+        {6.38137197198254E-06, 4.62426300749908E-06, 4.42334454191034E-06, 1.15374736092349E-06, -2.61859702227253E-06},
+        {-2.25320619636149E-07, 3.21907705479353E-07, -3.34834530764823E-07, -4.82132753601810E-07,
+         -3.22410936343355E-07},
+        {3.48894515496995E-09, 3.49951261408458E-08, -6.01128959281142E-09, 4.78213900943443E-09, 1.46012816168576E-08},
+        {-9.66682871952083E-11, 3.75806627535317E-09, 2.38984004956705E-09, 2.07545049877203E-09, 1.58573595632766E-09},
+        {1.06834370693917E-09, -4.07975055112153E-10, -2.37598937943957E-10, 5.89327007480137E-11,
+         1.18891820437634E-10},
+        {5.22433722695807E-11, 6.02011995016293E-12, -7.80605402956048E-12, 1.50873145627341E-11,
+         -1.40550093106311E-12},
+        {2.13396242187279E-13, -1.71939313965536E-12, -3.57625378660975E-14, -5.01675184988446E-14,
+         -1.07805487368797E-12},
+        {-1.24352330043311E-12, 8.26105883301606E-13, 4.63606970128517E-13, 6.39517888984486E-14,
+         -7.35135439920086E-14},
+        {-5.39023859065631E-13, 2.54188315588243E-14, 1.30933833278664E-14, 6.06153473304781E-15,
+         -4.24722717533726E-14},
+        {3.12767756884813E-14, -2.29517847871632E-15, 2.53117304424948E-16, 7.07504914138118E-16,
+         -1.20089065310688E-15},
+        {2.08311178819214E-06, -1.22179185044174E-06, -2.98842190131044E-06, 3.07310218974299E-06,
+         2.27100346036619E-06},
+        {-3.94601643855452E-07, -5.44014825116083E-07, -6.16955333162507E-08, -2.31954821580670E-07,
+         1.14010813005310E-07},
+        {6.11067575043044E-08, -3.93240193194272E-08, -1.62979132528933E-08, 1.01339204652581E-08,
+         1.97319601566071E-08},
+        {2.57770508710055E-09, 1.87799543582899E-09, 1.95407654714372E-09, 1.15276419281270E-09, 2.25397005402120E-09},
+        {7.16926338026236E-10, -3.65857693313858E-10, -1.54864067050915E-11, 6.50770211276549E-11,
+         -7.85160007413546E-12},
+        {4.90007693914221E-12, 3.31649396536340E-12, 4.81664871165640E-13, 7.26080745617085E-12, 2.30960953372164E-12},
+        {9.75489202240545E-13, -1.68967954531421E-13, 7.38383391334110E-13, -3.58435515913239E-13,
+         -3.01564710027450E-13},
+        {-3.79533601922805E-13, 2.76681830946617E-13, 1.21480375553803E-13, -1.57729077644850E-14,
+         -8.87664977818700E-14},
+        {-3.96462845480288E-14, 2.94155690934610E-14, 6.78413205760717E-15, -4.12135802787361E-15,
+         -1.46373307795619E-14},
+        {-8.64941937408121E-15, -1.91822620970386E-15, -8.01725413560744E-16, 5.02941051180784E-16,
+         -1.07572628474344E-15},
+        {-4.13816294742758E-15, -7.43602019785880E-17, -5.54248556346072E-17, -4.83999456005158E-17,
+         -1.19622559730466E-16},
+        {-8.34852132750364E-07, -7.45794677612056E-06, -6.58132648865533E-06, -1.38608110346732E-06,
+         5.32326534882584E-07},
+        {-2.75513802414150E-07, 3.64713745106279E-08, -7.12385417940442E-08, -7.86206067228882E-08,
+         2.28048393207161E-08},
+        {-4.26696415431918E-08, -4.65599668635087E-09, 7.35037936327566E-09, 1.17098354115804E-08,
+         1.44594777658035E-08},
+        {1.12407689274199E-09, 7.62142529563709E-10, -6.72563708415472E-10, -1.18094592485992E-10,
+         -1.17043815733292E-09},
+        {1.76612225246125E-10, -1.01188552503192E-10, 7.32546072616968E-11, 1.79542821801610E-11,
+         -2.23264859965402E-11},
+        {-9.35960722512375E-12, 1.90894283812231E-12, -6.34792824525760E-13, 3.98597963877826E-12,
+         -4.47591409078971E-12},
+        {-3.34623858556099E-12, 4.56384903915853E-14, 2.72561108521416E-13, -3.57942733300468E-15,
+         1.99794810657713E-13},
+        {-6.16775522568954E-14, 8.25316968328823E-14, 7.19845814260518E-14, -2.92415710855106E-14,
+         -5.49570017444031E-15},
+        {-8.50728802453217E-15, 8.38161600916267E-15, 3.43651657459983E-15, -8.19429434115910E-16,
+         -4.08905746461100E-15},
+        {4.39042894275548E-15, -3.69440485320477E-16, 1.22249256876779E-16, -2.09359444520984E-16,
+         -3.34211740264257E-16},
+        {-5.36054548134225E-16, 3.29794204041989E-17, 2.13564354374585E-17, -1.37838993720865E-18,
+         -1.29188342867753E-17},
+        {-3.26421841529845E-17, 7.38235405234126E-18, 2.49291659676210E-18, 8.18252735459593E-19, 1.73824952279230E-20},
+        {4.67237509268208E-06, 1.93611283787239E-06, 9.39035455627622E-07, -5.84565118072823E-07,
+         -1.76198705802101E-07},
+        {-3.33739157421993E-07, 4.12139555299163E-07, 1.58754695700856E-07, 1.37448753329669E-07, 1.04722936936873E-07},
+        {6.64200603076386E-09, 1.45412222625734E-08, 1.82498796118030E-08, 2.86633517581614E-09, 1.06066984548100E-09},
+        {5.25549696746655E-09, -1.33677183394083E-09, 7.60804375937931E-11, -1.07918624219037E-10,
+         8.09178898247941E-10},
+        {1.89318454110039E-10, 9.23092164791765E-11, 5.51434573131180E-11, 3.86696392289240E-11, -1.15208165047149E-11},
+        {-1.02252706006226E-12, -7.25921015411136E-13, -1.98110126887620E-12, -2.18964868282672E-13,
+         -7.18834476685625E-13},
+        {-2.69770025318548E-12, -2.17850340796321E-14, 4.73040820865871E-13, 1.57947421572149E-13,
+         1.86925164972766E-13},
+        {1.07831718354771E-13, 2.26681841611017E-14, 2.56046087047783E-14, -1.14995851659554E-14,
+         -2.27056907624485E-14},
+        {6.29825154734712E-15, 8.04458225889001E-16, 9.53173540411138E-16, 1.16892301877735E-15, -1.04324684545047E-15},
+        {-5.57345639727027E-16, -2.93949227634932E-16, 7.47621406284534E-18, -5.36416885470756E-17,
+         -2.87213280230513E-16},
+        {1.73219775047208E-16, 2.05017387523061E-17, 9.08873886345587E-18, -2.86881547225742E-18,
+         -1.25303645304992E-17},
+        {-7.30829109684568E-18, 2.03711261415353E-18, 7.62162636124024E-19, -7.54847922012517E-19,
+         -8.85105098195030E-19},
+        {5.62039968280587E-18, -1.38144206573507E-19, 1.68028711767211E-20, 1.81223858251981E-19, -8.50245194985878E-20}
+    },
+    {
+        {0.00136127467401223, -6.83476317823061E-07, -1.37211986707674E-06, 7.02561866200582E-07,
+         -2.16342338010651E-07},
+        {-9.53197486400299E-06, 6.58703762338336E-06, 2.42000663952044E-06, -6.04283463108935E-07,
+         2.02144424676990E-07},
+        {-6.76728911259359E-06, 6.03830755085583E-07, -8.72568628835897E-08, 2.21750344140938E-06,
+         1.05146032931020E-06},
+        {-3.21102832397338E-05, -7.88685357568093E-06, -2.55495673641049E-06, -1.99601934456719E-06,
+         -4.62005252198027E-07},
+        {-7.84639263523250E-07, 3.11624739733849E-06, 9.02170019697389E-07, 6.37066632506008E-07,
+         -9.44485038780872E-09},
+        {2.19476873575507E-06, -2.20580510638233E-07, 6.94761415598378E-07, 4.80770865279717E-07,
+         -1.34357837196401E-07},
+        {2.18469215148328E-05, -1.80674174262038E-06, -1.52754285605060E-06, -3.51212288219241E-07,
+         2.73741237656351E-06},
+        {2.85579058479116E-06, 1.57201369332361E-07, -2.80599072875081E-07, -4.91267304946072E-07,
+         -2.11648188821805E-07},
+        {2.81729255594770E-06, 3.02487362536122E-07, -1.64836481475431E-07, -2.11607615408593E-07,
+         -6.47817762225366E-08},
+        {1.31809947620223E-07, -1.58289524114549E-07, -7.05580919885505E-08, 5.56781440550867E-08,
+         1.23403290710365E-08},
+        {-1.29252282695869E-05, -1.07247072037590E-05, -3.31109519638196E-06, 2.13776673779736E-06,
+         -1.49519398373391E-07},
+        {1.81685152305722E-06, -1.17362204417861E-06, -3.19205277136370E-08, 4.09166457255416E-07,
+         1.53286667406152E-07},
+        {1.63477723125362E-06, -2.68584775517243E-08, 4.94662064805191E-09, -7.09027987928288E-08,
+         4.44353430574937E-08},
+        {-2.13090618917978E-07, 4.05836983493219E-08, 2.94495876336549E-08, -1.75005469063176E-08,
+         -3.03015988647002E-09},
+        {-2.16074435298006E-09, 9.37631708987675E-09, -2.05996036369828E-08, 6.97068002894092E-09,
+         -8.90988987979604E-09},
+        {1.38047798906967E-05, 2.05528261553901E-05, 1.59072148872708E-05, 7.34088731264443E-07, 1.28226710383580E-06},
+        {7.08175753966264E-07, -9.27988276636505E-07, 1.60535820026081E-07, -3.27296675122065E-07,
+         -2.20518321170684E-07},
+        {1.90932483086199E-07, -7.44215272759193E-08, 1.81330673333187E-08, 4.37149649043616E-08, 4.18884335594172E-08},
+        {-5.37009063880924E-08, 2.22870057779431E-08, 1.73740123037651E-08, -4.45137302235032E-09,
+         9.44721910524571E-09},
+        {-6.83406949047909E-08, -1.95046676795923E-10, 2.57535903049686E-09, 4.82643164083020E-09,
+         3.37657333705158E-09},
+        {3.96128688448981E-09, -6.63809403270686E-10, 2.44781464212534E-10, 5.92280853590699E-11,
+         -4.78502591970721E-10},
+        {1.75859399041414E-05, -2.81238050668481E-06, -2.43670534594848E-06, 3.58244562699714E-06,
+         -1.76547446732691E-06},
+        {-1.06451311473304E-07, 1.54336689617184E-06, -2.00690000442673E-07, 1.38790047911880E-09,
+         -1.62490619890017E-07},
+        {-2.72757421686155E-07, 1.71139266205398E-07, -2.55080309401917E-08, -8.40793079489831E-09,
+         -1.01129447760167E-08},
+        {2.92966025844079E-08, -2.07556718857313E-08, 5.45985315647905E-09, 8.76857690274150E-09, 1.06785510440474E-08},
+        {-1.22059608941331E-08, 6.52491630264276E-09, -1.79332492326928E-10, 3.75921793745396E-10,
+         -7.06416506254786E-10},
+        {1.63224355776652E-09, 4.95586028736232E-10, -3.07879011759040E-10, -7.78354087544277E-11,
+         1.43959047067250E-10},
+        {3.86319414653663E-10, -2.06467134617933E-10, 4.37330971382694E-11, -5.00421056263711E-11,
+         -9.40237773015723E-12},
+        {-1.23856142706451E-05, 7.61047394008415E-06, -1.99104114578138E-07, 6.86177748886858E-07,
+         -1.09466747592827E-07},
+        {2.99866062403128E-07, 1.87525561397390E-07, 4.99374806994715E-08, 4.86229763781404E-07, 4.46570575517658E-07},
+        {-5.05748332368430E-07, 1.95523624722285E-08, -9.17535435911345E-08, -2.56671607433547E-08,
+         -7.11896201616653E-08},
+        {-2.66062200406494E-08, -5.40470019739274E-09, -2.29718660244954E-09, -3.73328592264404E-09,
+         3.38748313712376E-09},
+        {5.30855327954894E-10, 5.28851845648032E-10, -2.22278913745418E-10, -5.52628653064771E-11,
+         -9.24825145219684E-10},
+        {6.03737227573716E-10, -3.52190673510919E-12, -1.30371720641414E-10, -9.12787239944822E-12,
+         6.42187285537238E-12},
+        {1.78081862458539E-10, 2.93772078656037E-12, -1.04698379945322E-11, -2.82260024833024E-11,
+         -5.61810459067525E-12},
+        {9.35003092299580E-12, -8.23133834521577E-13, 5.54878414224198E-13, -3.62943215777181E-13,
+         2.38858933771653E-12},
+        {-1.31216096107331E-05, -5.70451670731759E-06, -5.11598683573971E-06, -4.99990779887599E-06,
+         1.27389320221511E-07},
+        {-1.23108260369048E-06, 5.53093245213587E-07, 8.60093183929302E-07, 2.65569700925696E-07, 1.95485134805575E-07},
+        {-2.29647072638049E-07, -5.45266515081825E-08, 2.85298129762263E-08, 1.98167939680185E-08,
+         5.52227340898335E-09},
+        {-2.73844745019857E-08, -4.48345173291362E-10, -1.93967347049382E-09, -1.41508853776629E-09,
+         -1.75456962391145E-09},
+        {-2.68863184376108E-11, -2.20546981683293E-09, 6.56116990576877E-10, 1.27129855674922E-10,
+         -2.32334506413213E-10},
+        {1.98303136881156E-10, 6.04782006047075E-11, 2.91291115431570E-11, 6.18098615782757E-11, -3.82682292530379E-11},
+        {9.48294455071158E-12, -3.05873596453015E-13, 5.31539408055057E-13, -7.31016438665600E-12,
+         -1.19921002209198E-11},
+        {-2.25188050845725E-11, -3.91627574966393E-13, -6.80217235976769E-13, 5.91033607278405E-13,
+         5.02991534452191E-13},
+        {1.29532063896247E-12, 1.66337285851564E-13, 3.25543028344555E-13, 1.89143357962363E-13, 3.32288378169726E-13},
+        {-2.45864358781728E-06, 4.49460524898260E-06, 1.03890496648813E-06, -2.73783420376785E-06,
+         7.12695730642593E-07},
+        {-9.27805078535168E-07, -4.97733876686731E-07, 9.18680298906510E-08, -2.47200617423980E-07,
+         6.16163630140379E-08},
+        {-1.39623661883136E-08, -1.12580495666505E-07, 2.61821435950379E-08, -2.31875562002885E-08,
+         5.72679835033659E-08},
+        {-9.52538983318497E-09, -5.40909215302433E-09, 1.88698793952475E-09, -4.08127746406372E-09,
+         1.09534895853812E-10},
+        {3.79767457525741E-09, 1.11549801373366E-10, -6.45504957274111E-10, 3.05477141010356E-10, 1.26261210565856E-10},
+        {5.08813577945300E-11, 1.43250547678637E-11, 8.81616572082448E-12, 2.58968878880804E-11, 3.83421818249954E-11},
+        {8.95094368142044E-12, -3.26220304555971E-12, -1.28047847191896E-12, 2.67562170258942E-12,
+         2.72195031576670E-12},
+        {-6.47181697409757E-12, 1.13776457455685E-12, 2.84856274334969E-13, -7.63667272085395E-14,
+         -1.34451657758826E-13},
+        {-1.25291265888343E-12, 8.63500441050317E-14, -1.21307856635548E-13, 5.12570529540511E-14,
+         3.32389276976573E-14},
+        {3.73573418085813E-14, -5.37808783042784E-16, -4.23430408270850E-16, -4.75110565740493E-15,
+         6.02553212780166E-15},
+        {8.95483987262751E-06, -3.90778212666235E-06, -1.12115019808259E-06, 1.78678942093383E-06,
+         1.46806344157962E-06},
+        {-4.59185232678613E-07, 1.09497995905419E-07, 1.31663977640045E-07, 4.20525791073626E-08,
+         -9.71470741607431E-08},
+        {1.63399802579572E-07, 1.50909360648645E-08, -1.11480472593347E-08, -1.84000857674573E-08,
+         7.82124614794256E-09},
+        {1.22887452385094E-08, -4.06647399822746E-10, -6.49120327585597E-10, 8.63651225791194E-10,
+         -2.73440085913102E-09},
+        {2.51748630889583E-09, 4.79895880425564E-10, -2.44908073860844E-10, 2.56735882664876E-10,
+         -1.64815306286912E-10},
+        {4.85671381736718E-11, -2.51742732115131E-11, -2.60819437993179E-11, 6.12728324086123E-12,
+         2.16833310896138E-11},
+        {4.11389702320298E-12, -8.09433180989935E-13, -1.19812498226024E-12, 1.46885737888520E-12,
+         3.15807685137836E-12},
+        {-1.47614580597013E-12, 4.66726413909320E-13, 1.72089709006255E-13, 1.13854935381418E-13, 2.77741161317003E-13},
+        {-1.02257724967727E-13, 1.10394382923502E-13, -3.14153505370805E-15, 2.41103099110106E-14,
+         2.13853053149771E-14},
+        {-3.19080885842786E-14, -9.53904307973447E-15, 2.74542788156379E-15, 2.33797859107844E-15,
+         -2.53192474907304E-15},
+        {-5.87702222126367E-15, -1.80133850930249E-15, -3.09793125614454E-16, -1.04197538975295E-16,
+         3.72781664701327E-16},
+        {1.86187054729085E-06, 8.33098045333428E-06, 3.18277735484232E-06, -7.68273797022231E-07,
+         -1.52337222261696E-06},
+        {-5.07076646593648E-07, -8.61959553442156E-07, -3.51690005432816E-07, -4.20797082902431E-07,
+         -3.07652993252673E-07},
+        {-7.38992472164147E-08, -8.39473083080280E-08, -2.51587083298935E-08, 7.30691259725451E-09,
+         -3.19457155958983E-08},
+        {-1.99777182012924E-09, -3.21265085916022E-09, -4.84477421865675E-10, -1.82924814205799E-09,
+         -3.46664344655997E-10},
+        {-7.05788559634927E-11, 1.21840735569025E-10, 7.97347726425926E-11, 1.08275679614409E-10,
+         -1.17891254809785E-10},
+        {1.10299718947774E-11, -3.22958261390263E-11, -1.43535798209229E-11, 6.87096504209595E-12,
+         -6.64963212272352E-12},
+        {-6.47393639740084E-12, 1.03156978325120E-12, -9.20099775082358E-14, -2.40150316641949E-13,
+         1.14008812047857E-12},
+        {-1.23957846397250E-13, 2.85996703969692E-13, 1.91579874982553E-13, 5.20597174693064E-14,
+         -4.06741434883370E-14},
+        {-2.35479068911236E-14, 1.97847338186993E-14, 1.58935977518516E-15, -2.32217195254742E-15,
+         -8.48611789490575E-15},
+        {1.03992320391626E-14, 1.54017082092642E-15, 1.05950035082788E-16, -1.17870898461353E-15,
+         -1.10937420707372E-15},
+        {-1.09011948374520E-15, -6.04168007633584E-16, -9.10901998157436E-17, 1.98379116989461E-16,
+         -1.03715496658498E-16},
+        {-1.38171942108278E-16, -6.33037999097522E-17, -1.38777695011470E-17, 1.94191397045401E-17,
+         5.70055906754485E-18},
+        {1.92989406002085E-06, -3.82662130483128E-06, -4.60189561036048E-07, 2.24290587856309E-06,
+         1.40544379451550E-06},
+        {6.49033717633394E-08, 2.41396114435326E-07, 2.73948898223321E-07, 1.10633664439332E-07, -3.19555270171075E-08},
+        {-2.91988966963297E-08, -6.03828192816571E-09, 1.18462386444840E-08, 1.32095545004128E-08,
+         -5.06572721528914E-09},
+        {7.31079058474148E-09, -8.42775299751834E-10, 1.10190810090667E-09, 1.96592273424306E-09,
+         -2.13135932785688E-09},
+        {7.06656405314388E-11, 1.43441125783756E-10, 1.46962246686924E-10, 7.44592776425197E-11, -3.64331892799173E-11},
+        {-2.52393942119372E-11, 1.07520964869263E-11, 5.84669886072094E-12, 6.52029744217103E-12, 1.82947123132059E-12},
+        {-4.15669940115121E-12, -1.95963254053648E-13, 2.16977822834301E-13, -2.84701408462031E-13,
+         4.27194601040231E-13},
+        {3.07891105454129E-13, 1.91523190672955E-13, 1.05367297580989E-13, -5.28136363920236E-14,
+         -3.53364110005917E-14},
+        {7.02156663274738E-15, 9.52230536780849E-15, -3.41019408682733E-15, -3.59825303352899E-15,
+         -2.62576411636150E-15},
+        {-1.75110277413804E-15, 5.29265220719483E-16, 4.45015980897919E-16, -3.80179856341347E-16,
+         -4.32917763829695E-16},
+        {1.16038609651443E-16, -6.69643574373352E-17, 2.65667154817303E-17, -9.76010333683956E-17,
+         4.07312981076655E-17},
+        {5.72659246346386E-18, 1.30357528108671E-18, 2.49193258417535E-18, 1.76247014075584E-18, 7.59614374197688E-19},
+        {1.03352170833303E-17, -2.30633516638829E-18, 2.84777940620193E-18, -7.72161347944693E-19, 6.07028034506380E-19}
+    },
+    {
+        {0.0571481238161787, 3.35402081801137E-05, 3.15988141788728E-05, -1.34477341887086E-05, -2.61831023577773E-07},
+        {5.77367395845715E-05, -0.000669057185209558, -6.51057691648904E-05, -1.61830149147091E-06,
+         8.96771209464758E-05},
+        {-8.50773002452907E-05, -4.87106614880272E-05, 4.03431160775277E-05, 2.54090162741464E-06,
+         -5.59109319864264E-06},
+        {0.00150536423187709, 0.000611682258892697, 0.000369730024614855, -1.95658439780282E-05, -3.46246726553700E-05},
+        {-2.32168718433966E-05, -0.000127478686553809, -9.00292451740728E-05, -6.07834315901830E-05,
+         -1.04628419422714E-05},
+        {-1.38607250922551E-06, -3.97271603842309E-06, -8.16155320152118E-07, 5.73266706046665E-07,
+         2.00366060212696E-07},
+        {6.52491559188663E-05, -0.00112224323460183, -0.000344967958304075, -7.67282640947300E-05,
+         0.000107907110551939},
+        {-0.000138870461448036, -7.29995695401936E-05, 5.35986591445824E-05, 9.03804869703890E-06,
+         8.61370129482732E-06},
+        {-9.98524443968768E-07, -6.84966792665998E-08, 1.47478021860771E-07, 1.94857794008064E-06,
+         7.17176852732910E-07},
+        {1.27066367911720E-06, 1.12113289164288E-06, 2.71525688515375E-07, -2.76125723009239E-07,
+         -1.05429690305013E-07},
+        {-0.000377264999981652, 0.000262691217024294, 0.000183639785837590, 3.93177048515576E-06,
+         -6.66187081899168E-06},
+        {-4.93720951871921E-05, -0.000102820030405771, -5.69904376301748E-05, -3.79603438055116E-05,
+         -3.96726017834930E-06},
+        {-2.21881958961135E-06, -1.40207117987894E-06, 1.60956630798516E-07, 2.06121145135022E-06,
+         6.50944708093149E-07},
+        {2.21876332411271E-07, 1.92272880430386E-07, -6.44016558013941E-09, -1.40954921332410E-07,
+         -4.26742169137667E-07},
+        {-3.51738525149881E-08, 2.89616194332516E-08, -3.40343352397886E-08, -2.89763392721812E-08,
+         -6.40980581663785E-10},
+        {3.51240856823468E-05, -0.000725895015345786, -0.000322514037108045, -0.000106143759981636,
+         4.08153152459337E-05},
+        {-2.36269716929413E-05, -4.20691836557932E-05, 1.43926743222922E-05, 2.61811210631784E-05,
+         2.09610762194903E-05},
+        {-7.91765756673890E-07, 1.64556789159745E-06, -9.43930166276555E-07, 6.46641738736139E-07,
+         -5.91509547299176E-07},
+        {3.92768838766879E-07, -1.98027731703690E-07, -5.41303590057253E-08, -4.21705797874207E-07,
+         -6.06042329660681E-08},
+        {-1.56650141024305E-08, 7.61808165752027E-08, -1.81900460250934E-08, 1.30196216971675E-08,
+         1.08616031342379E-08},
+        {-2.80964779829242E-08, -7.25951488826103E-09, -2.59789823306225E-09, -2.79271942407154E-09,
+         4.10558774868586E-09},
+        {-0.000638227857648286, -0.000154814045363391, 7.78518327501759E-05, -2.95961469342381E-05,
+         1.15965225055757E-06},
+        {4.47833146915112E-06, 1.33712284237555E-05, 3.61048816552123E-06, -2.50717844073547E-06,
+         -1.28100822021734E-05},
+        {-2.26958070007455E-06, 2.57779960912242E-06, 1.08395653197976E-06, 1.29403393862805E-07,
+         -1.04854652812567E-06},
+        {-3.98954043463392E-07, -2.26931182815454E-07, -1.09169545045028E-07, -1.49509536031939E-07,
+         -3.98376793949903E-07},
+        {2.30418911071110E-08, 1.23098508481555E-08, -1.71161401463708E-08, 2.35829696577657E-09, 1.31136164162040E-08},
+        {3.69423793101582E-09, 3.49231027561927E-10, -1.18581468768647E-09, 5.43180735828820E-10, 5.43192337651588E-10},
+        {-1.38608847117992E-09, -1.86719145546559E-10, -8.13477384765498E-10, 2.01919878240491E-10,
+         1.00067892622287E-10},
+        {-4.35499078415956E-05, 0.000450727967957804, 0.000328978494268850, -3.05249478582848E-05,
+         -3.21914834544310E-05},
+        {1.24887940973241E-05, 1.34275239548403E-05, 1.11275518344713E-06, 7.46733554562851E-06, -2.12458664760353E-06},
+        {9.50250784948476E-07, 2.34367372695203E-06, -5.43099244798980E-07, -4.35196904508734E-07,
+         -8.31852234345897E-07},
+        {5.91775478636535E-09, -1.48970922508592E-07, 2.99840061173840E-08, -1.30595933407792E-07,
+         1.27136765045597E-07},
+        {-1.78491083554475E-08, 1.76864919393085E-08, -1.96740493482011E-08, 1.21096708004261E-08,
+         2.95518703155064E-10},
+        {1.75053510088658E-09, -1.31414287871615E-09, -1.44689439791928E-09, 1.14682483668460E-09,
+         1.74488616540169E-09},
+        {1.08152964586251E-09, -3.85678162063266E-10, -2.77851016629979E-10, 3.89890578625590E-11,
+         -2.54627365853495E-10},
+        {-1.88340955578221E-10, 5.19645384002867E-11, 2.14131326027631E-11, 1.24027770392728E-11,
+         -9.42818962431967E-12},
+        {0.000359777729843898, -0.000111692619996219, -6.87103418744904E-05, 0.000115128973879551,
+         7.59796247722486E-05},
+        {5.23717968000879E-05, 1.32279078116467E-05, -5.72277317139479E-07, -7.56326558610214E-06,
+         -1.95749622214651E-05},
+        {1.00109213210139E-06, -2.75515216592735E-07, -1.13393194050846E-06, -4.75049734870663E-07,
+         -3.21499480530932E-07},
+        {-2.07013716598890E-07, -7.31392258077707E-08, -3.96445714084160E-08, 3.21390452929387E-08,
+         -1.43738764991525E-08},
+        {2.03081434931767E-09, -1.35423687136122E-08, -4.47637454261816E-09, 2.18409121726643E-09,
+         -3.74845286805217E-09},
+        {3.17469255318367E-09, 2.44221027314129E-10, -2.46820614760019E-10, 7.55851003884434E-10, 6.98980592550891E-10},
+        {9.89541493531067E-11, -2.78762878057315E-11, -2.10947962916771E-10, 3.77882267360636E-11,
+         -1.20009542671532E-12},
+        {5.01720575730940E-11, 1.66470417102135E-11, -7.50624817938091E-12, 9.97880221482238E-12, 4.87141864438892E-12},
+        {2.53137945301589E-11, 1.93030083090772E-12, -1.44708804231290E-12, -1.77837100743423E-12,
+         -8.10068935490951E-13},
+        {0.000115735341520738, 0.000116910591048350, 8.36315620479475E-05, 1.61095702669207E-05, -7.53084853489862E-05},
+        {-9.76879433427199E-06, 9.16968438003335E-06, -8.72755127288830E-06, -1.30077933880053E-05,
+         -9.78841937993320E-06},
+        {1.04902782517565E-07, 2.14036988364936E-07, -7.19358686652888E-07, 1.12529592946332E-07, 7.07316352860448E-07},
+        {7.63177265285080E-08, 1.22781974434290E-07, 8.99971272969286E-08, 5.63482239352990E-08, 4.31054352285547E-08},
+        {3.29855763107355E-09, -6.95004336734441E-09, -6.52491370576354E-09, 1.97749180391742E-09,
+         3.51941791940498E-09},
+        {3.85373745846559E-10, 1.65754130924183E-10, -3.31326088103057E-10, 5.93256024580436E-10, 1.27725220636915E-10},
+        {-1.08840956376565E-10, -4.56042860268189E-11, -4.77254322645633E-12, -2.94405398621875E-12,
+         -3.07199979999475E-11},
+        {2.07389879095010E-11, 1.51186798732451E-11, 9.28139802941848E-12, 5.92738269687687E-12, 9.70337402306505E-13},
+        {-2.85879708060306E-12, 1.92164314717053E-13, 4.02664678967890E-14, 5.18246319204277E-13,
+         -7.91438726419423E-13},
+        {6.91890667590734E-13, -8.49442290988352E-14, -5.54404947212402E-15, 9.71093377538790E-15,
+         -5.33714333415971E-14},
+        {-5.06132972789792E-05, -4.28348772058883E-05, -6.90746551020305E-05, 8.48380415176836E-05,
+         7.04135614675053E-05},
+        {-1.27945598849788E-05, -1.92362865537803E-05, -2.30971771867138E-06, -8.98515975724166E-06,
+         5.25675205004752E-06},
+        {-8.71907027470177E-07, -1.02091512861164E-06, -1.69548051683864E-07, 4.87239045855761E-07,
+         9.13163249899837E-07},
+        {-6.23651943425918E-08, 6.98993315829649E-08, 5.91597766733390E-08, 4.36227124230661E-08, 6.45321798431575E-08},
+        {-1.46315079552637E-10, -7.85142670184337E-09, 1.48788168857903E-09, 2.16870499912160E-09,
+         -1.16723047065545E-09},
+        {3.31888494450352E-10, 1.90931898336457E-10, -3.13671901557599E-11, 2.60711798190524E-10, 8.45240112207997E-11},
+        {1.36645682588537E-11, -5.68830303783976E-12, 1.57518923848140E-11, -1.61935794656758E-11,
+         -4.16568077748351E-12},
+        {9.44684950971905E-13, 7.30313977131995E-12, 3.14451447892684E-12, 6.49029875639842E-13, -9.66911019905919E-13},
+        {-8.13097374090024E-13, 5.23351897822186E-13, 8.94349188113951E-14, -1.33327759673270E-13,
+         -4.04549450989029E-13},
+        {-3.76176467005839E-14, -6.19953702289713E-14, -3.74537190139726E-14, 1.71275486301958E-14,
+         -3.81946773167132E-14},
+        {-4.81393385544160E-14, 3.66084990006325E-15, 3.10432030972253E-15, -4.10964475657416E-15,
+         -6.58644244242900E-15},
+        {-7.81077363746945E-05, -0.000254773632197303, -0.000214538508009518, -3.80780934346726E-05,
+         1.83495359193990E-05},
+        {5.89140224113144E-06, -3.17312632433258E-06, -3.81872516710791E-06, -2.27592226861647E-06,
+         1.57044619888023E-06},
+        {-1.44272505088690E-06, -1.10236588903758E-07, 2.64336813084693E-07, 4.76074163332460E-07,
+         4.28623587694570E-07},
+        {3.98889120733904E-08, -1.29638005554027E-08, -4.13668481273828E-08, 1.27686793719542E-09,
+         -3.54202962042383E-08},
+        {1.60726837551750E-09, -2.70750776726156E-09, 2.79387092681070E-09, -3.01419734793998E-10,
+         -1.29101669438296E-10},
+        {-2.55708290234943E-10, 2.27878015173471E-11, -6.43063443462716E-12, 1.26531554846856E-10,
+         -1.65822147437220E-10},
+        {-3.35886470557484E-11, -3.51895009091595E-12, 5.80698399963198E-12, -2.84881487149207E-12,
+         8.91708061745902E-12},
+        {-3.12788523950588E-12, 3.35366912964637E-12, 2.52236848033838E-12, -8.12801050709184E-13,
+         -2.63510394773892E-13},
+        {6.83791881183142E-14, 2.41583263270381E-13, 8.58807794189356E-14, -5.12528492761045E-14,
+         -1.40961725631276E-13},
+        {-1.28585349115321E-14, -2.11049721804969E-14, 5.26409596614749E-15, -4.31736582588616E-15,
+         -1.60991602619068E-14},
+        {-9.35623261461309E-15, -3.94384886372442E-16, 5.04633016896942E-16, -5.40268998456055E-16,
+         -1.07857944298104E-15},
+        {8.79756791888023E-16, 4.52529935675330E-16, 1.36886341163227E-16, -1.12984402980452E-16, 6.30354561057224E-18},
+        {0.000117829256884757, 2.67013591698442E-05, 2.57913446775250E-05, -4.40766244878807E-05,
+         -1.60651761172523E-06},
+        {-1.87058092029105E-05, 1.34371169060024E-05, 5.59131416451555E-06, 4.50960364635647E-06, 2.87612873904633E-06},
+        {2.79835536517287E-07, 8.93092708148293E-07, 8.37294601021795E-07, -1.99029785860896E-08,
+         -8.87240405168977E-08},
+        {4.95854313394905E-08, -1.44694570735912E-08, 2.51662229339375E-08, -3.87086600452258E-09,
+         2.29741919071270E-08},
+        {4.71497840986162E-09, 2.47509999454076E-09, 1.67323845102824E-09, 8.14196768283530E-10, -3.71467396944165E-10},
+        {-1.07340743907054E-10, -8.07691657949326E-11, -5.99381660248133E-11, 2.33173929639378E-12,
+         -2.26994195544563E-11},
+        {-3.83130441984224E-11, -5.82499946138714E-12, 1.43286311435124E-11, 3.15150503353387E-12,
+         5.97891025146774E-12},
+        {-5.64389191072230E-13, 9.57258316335954E-13, 1.12055192185939E-12, -4.42417706775420E-13,
+         -9.93190361616481E-13},
+        {1.78188860269677E-13, 7.82582024904950E-14, 5.18061650118009E-14, 2.13456507353387E-14, -5.26202113779510E-14},
+        {-8.18481324740893E-15, -3.71256746886786E-15, 4.23508855164371E-16, -2.91292502923102E-15,
+         -1.15454205389350E-14},
+        {6.16578691696810E-15, 6.74087154080877E-16, 5.71628946437034E-16, -2.05251213979975E-16,
+         -7.25999138903781E-16},
+        {9.35481959699383E-17, 6.23535830498083E-17, 3.18076728802060E-18, -2.92353209354587E-17, 7.65216088665263E-19},
+        {2.34173078531701E-17, -8.30342420281772E-18, -4.33602329912952E-18, 1.90226281379981E-18,
+         -7.85507922718903E-19}
+    },
+    {
+        {0.0395329695826997, -0.000131114380761895, -0.000116331009006233, 6.23548420410646E-05, 5.72641113425116E-05},
+        {-0.000441837640880650, 0.000701288648654908, 0.000338489802858270, 3.76700309908602E-05,
+         -8.70889013574699E-06},
+        {1.30418530496887E-05, -0.000185046547597376, 4.31032103066723E-05, 0.000105583334124319, 3.23045436993589E-05},
+        {3.68918433448519E-05, -0.000219433014681503, 3.46768613485000E-06, -9.17185187163528E-05,
+         -3.69243242456081E-05},
+        {-6.50227201116778E-06, 2.07614874282187E-05, -5.09131314798362E-05, -3.08053225174359E-05,
+         -4.18483655873918E-05},
+        {2.67879176459056E-05, -6.89303730743691E-05, 2.11046783217168E-06, 1.93163912538178E-05,
+         -1.97877143887704E-06},
+        {0.000393937595007422, -0.000452948381236406, -0.000136517846073846, 0.000138239247989489,
+         0.000133175232977863},
+        {5.00214539435002E-05, 3.57229726719727E-05, -9.38010547535432E-07, -3.52586798317563E-05,
+         -7.01218677681254E-06},
+        {3.91965314099929E-05, 1.02236686806489E-05, -1.95710695226022E-05, -5.93904795230695E-06,
+         3.24339769876093E-06},
+        {6.68158778290653E-06, -8.10468752307024E-06, -9.91192994096109E-06, -1.89755520007723E-07,
+         -3.26799467595579E-06},
+        {0.000314196817753895, -0.000296548447162009, -0.000218410153263575, -1.57318389871000E-05,
+         4.69789570185785E-05},
+        {0.000104597721123977, -3.31000119089319E-05, 5.60326793626348E-05, 4.71895007710715E-05, 3.57432326236664E-05},
+        {8.95483021572039E-06, 1.44019305383365E-05, 4.87912790492931E-06, -3.45826387853503E-06, 3.23960320438157E-06},
+        {-1.35249651009930E-05, -2.49349762695977E-06, -2.51509483521132E-06, -9.14254874104858E-07,
+         -8.57897406100890E-07},
+        {-1.68143325235195E-06, 1.72073417594235E-06, 1.38765993969565E-06, 4.09770982137530E-07,
+         -6.60908742097123E-07},
+        {-0.000639889366487161, 0.00120194042474696, 0.000753258598887703, 3.87356377414663E-05, 1.31231811175345E-05},
+        {2.77062763606783E-05, -9.51425270178477E-06, -6.61068056107547E-06, -1.38713669012109E-05,
+         9.84662092961671E-06},
+        {-2.69398078539471E-06, 6.50860676783123E-06, 3.80855926988090E-06, -1.98076068364785E-06,
+         1.17187335666772E-06},
+        {-2.63719028151905E-06, 5.03149473656743E-07, 7.38964893399716E-07, -8.38892485369078E-07,
+         1.30943917775613E-06},
+        {-1.56634992245479E-06, -2.97026487417045E-08, 5.06602801102463E-08, -4.60436007958792E-08,
+         -1.62536449440997E-07},
+        {-2.37493912770935E-07, 1.69781593069938E-08, 8.35178275224265E-08, -4.83564044549811E-08,
+         -4.96448864199318E-08},
+        {0.00134012259587597, -0.000250989369253194, -2.97647945512547E-05, -6.47889968094926E-05,
+         8.41302130716859E-05},
+        {-0.000113287184900929, 4.78918993866293E-05, -3.14572113583139E-05, -2.10518256626847E-05,
+         -2.03933633847417E-05},
+        {-4.97413321312139E-07, 3.72599822034753E-06, -3.53221588399266E-06, -1.05232048036416E-06,
+         -2.74821498198519E-06},
+        {4.81988542428155E-06, 4.21400219782474E-07, 1.02814808667637E-06, 4.40299068486188E-09, 3.37103399036634E-09},
+        {1.10140301678818E-08, 1.90257670180182E-07, -1.00831353341885E-08, 1.44860642389714E-08,
+         -5.29882089987747E-08},
+        {6.12420414245775E-08, -4.48953461152996E-09, -1.38837603709003E-08, -2.05533675904779E-08,
+         1.49517908802329E-09},
+        {9.17090243673643E-10, -9.24878857867367E-09, -2.30856560363943E-09, -4.36348789716735E-09,
+         -4.45808881183025E-10},
+        {-0.000424912699609112, -0.000114365438471564, -0.000403200981827193, 4.19949560550194E-05,
+         -3.02068483713739E-05},
+        {3.85435472851225E-05, -5.70726887668306E-05, 4.96313706308613E-07, 1.02395703617082E-05, 5.85550000567006E-06},
+        {-7.38204470183331E-06, -4.56638770109511E-06, -3.94007992121367E-06, -2.16666812189101E-06,
+         -4.55694264113194E-06},
+        {5.89841165408527E-07, 1.40862905173449E-08, 1.08149086563211E-07, -2.18592601537944E-07,
+         -3.78927431428119E-07},
+        {4.85164687450468E-08, 8.34273921293655E-08, 1.47489605513673E-08, 6.01494125001291E-08, 6.43812884159484E-09},
+        {1.13055580655363E-08, 3.50568765400469E-09, -5.09396162501750E-09, -1.83362063152411E-09,
+         -4.11227251553035E-09},
+        {3.16454132867156E-09, -1.39634794131087E-09, -7.34085003895929E-10, -7.55541371271796E-10,
+         -1.57568747643705E-10},
+        {1.27572900992112E-09, -3.51625955080441E-10, -4.84132020565098E-10, 1.52427274930711E-10,
+         1.27466120431317E-10},
+        {-0.000481655666236529, -0.000245423313903835, -0.000239499902816719, -0.000157132947351028,
+         5.54583099258017E-05},
+        {-1.52987254785589E-05, 2.78383892116245E-05, 4.32299123991860E-05, 1.70981319744327E-05,
+         -1.35090841769225E-06},
+        {-8.65400907717798E-06, -6.51882656990376E-06, -2.43810171017369E-07, 8.54348785752623E-07,
+         2.98371863248143E-07},
+        {-1.68155571776752E-06, -3.53602587563318E-07, -1.00404435881759E-07, -2.14162249012859E-08,
+         -2.42131535531526E-07},
+        {-1.08048603277187E-08, -9.78850785763030E-08, -2.32906554437417E-08, 2.22003630858805E-08,
+         -2.27230368089683E-09},
+        {-5.98864391551041E-09, 7.38970926486848E-09, 3.61322835311957E-09, 3.70037329172919E-09,
+         -3.41121137081362E-09},
+        {-7.33113754909726E-10, -9.08374249335220E-11, -1.78204392133739E-10, 8.28618491929026E-11,
+         -1.32966817912373E-10},
+        {-5.23340481314676E-10, 1.36403528233346E-10, -7.04478837151279E-11, -6.83175201536443E-12,
+         -2.86040864071134E-12},
+        {3.75347503578356E-11, -1.08518134138781E-11, -2.53583751744508E-12, 1.00168232812303E-11,
+         1.74929602713312E-11},
+        {-0.000686805336370570, 0.000591849814585706, 0.000475117378328026, -2.59339398048415E-05,
+         3.74825110514968E-05},
+        {3.35231363034093E-05, 2.38331521146909E-05, 7.43545963794093E-06, -3.41430817541849E-06, 7.20180957675353E-06},
+        {3.60564374432978E-07, -3.13300039589662E-06, -6.38974746108020E-07, -8.63985524672024E-07,
+         2.43367665208655E-06},
+        {-4.09605238516094E-07, -2.51158699554904E-07, -1.29359217235188E-07, -2.27744642483133E-07,
+         7.04065989970205E-08},
+        {6.74886341820129E-08, -1.02009407061935E-08, -3.30790296448812E-08, 1.64959795655031E-08,
+         1.40641779998855E-08},
+        {1.31706886235108E-09, -1.06243701278671E-09, -2.85573799673944E-09, 3.72566568681289E-09,
+         2.48402582003925E-09},
+        {-3.68427463251097E-11, -1.90028122983781E-10, -3.98586561768697E-11, 1.14458831693287E-11,
+         -2.27722300377854E-12},
+        {-7.90029729611056E-11, 3.81213646526419E-11, 4.63303426711788E-11, 1.52294835905903E-11,
+         -2.99094751490726E-12},
+        {-2.36146602045017E-11, 1.03852674709985E-11, -4.47242126307100E-12, 5.30884113537806E-12,
+         1.68499023262969E-12},
+        {-3.30107358134527E-13, -4.73989085379655E-13, 5.17199549822684E-13, 2.34951744478255E-13,
+         2.05931351608192E-13},
+        {0.000430215687511780, -0.000132831373000014, -3.41830835017045E-05, 4.70312161436033E-06,
+         -3.84807179340006E-05},
+        {1.66861163032403E-05, -8.10092908523550E-06, 8.20658107437905E-06, 6.12399025026683E-06,
+         -1.85536495631911E-06},
+        {1.53552093641337E-06, 2.19486495660361E-06, -1.07253805120137E-06, -4.72141767909137E-07,
+         4.00744581573216E-07},
+        {2.56647305130757E-07, -8.07492046592274E-08, -2.05858469296168E-07, 1.09784168930599E-07,
+         -7.76823030181225E-08},
+        {1.77744008115031E-08, 1.64134677817420E-08, 4.86163044879020E-09, 1.13334251800856E-08, -7.17260621115426E-09},
+        {1.61133063219326E-09, -1.85414677057024E-09, -2.13798537812651E-09, 1.15255123229679E-09,
+         2.24504700129464E-09},
+        {1.23344223096739E-10, -1.20385012169848E-10, -2.18038256346433E-12, 3.23033120628279E-11,
+         8.01179568213400E-11},
+        {-6.55745274387847E-12, 1.22127104697198E-11, 5.83805016355883E-12, -8.31201582509817E-12,
+         1.90985373872656E-12},
+        {-2.89199983667265E-12, 5.05962500506667E-12, 1.28092925110279E-12, 5.60353813743813E-13, 1.76753731968770E-12},
+        {-1.61678729774956E-13, -3.92206170988615E-13, -9.04941327579237E-14, 1.89847694200763E-13,
+         4.10008676756463E-14},
+        {-1.16808369005656E-13, -9.97464591430510E-14, 7.46366550245722E-15, 2.53398578153179E-14,
+         1.06510689748906E-14},
+        {-0.000113716921384790, -0.000131902722651488, -0.000162844886485788, 7.90171538739454E-06,
+         -0.000178768066961413},
+        {-2.13146535366500E-06, -3.57818705543597E-05, -1.50825855069298E-05, -2.17909259570022E-05,
+         -8.19332236308581E-06},
+        {-2.88001138617357E-06, -2.09957465440793E-06, 6.81466526687552E-08, 3.58308906974448E-07,
+         -4.18502067223724E-07},
+        {-1.10761444317605E-07, 6.91773860777929E-08, 8.17125372450372E-08, -2.16476237959181E-08,
+         7.59221970502074E-08},
+        {-9.56994224818941E-09, 6.64104921728432E-09, 6.33077902928348E-09, 2.85721181743727E-09,
+         -6.39666681678123E-09},
+        {4.62558627839842E-10, -1.69014863754621E-09, -2.80260429599733E-10, 4.27558937623863E-11,
+         -1.66926133269027E-10},
+        {-7.23385132663753E-11, 5.51961193545280E-11, 3.04070791942335E-11, 3.23227055919062E-12, 8.47312431934829E-11},
+        {-1.61189613765486E-11, 1.66868155925172E-11, 1.05370341694715E-11, -4.41495859079592E-12,
+         -2.24939051401750E-12},
+        {-8.72229568056267E-13, 1.88613726203286E-12, 1.21711137534390E-14, -1.13342372297867E-12,
+         -6.87151975256052E-13},
+        {7.99311988544090E-15, 4.46150979586709E-14, 7.50406779454998E-14, -3.20385428942275E-14,
+         -1.26543636054393E-14},
+        {4.80503817699514E-14, -3.35545623603729E-14, -1.18546423610485E-14, 4.19419209985980E-15,
+         -1.73525614436880E-14},
+        {-1.20464898830163E-15, -8.80752065000456E-16, -1.22214298993313E-15, 1.69928513019657E-15,
+         1.93593051311405E-16},
+        {1.68528879784841E-05, 3.57144412031081E-05, -1.65999910125077E-05, 5.40370336805755E-05, 0.000118138122851376},
+        {-3.28151779115881E-05, 1.04231790790798E-05, -2.80761862890640E-06, 2.98996152515593E-06,
+         -2.67641158709985E-06},
+        {-2.08664816151978E-06, -1.64463884697475E-06, 6.79099429284834E-08, 7.23955842946495E-07,
+         -6.86378427465657E-07},
+        {-2.88205823027255E-09, 2.38319699493291E-09, 1.14169347509045E-07, 8.12981074994402E-08,
+         -1.56957943666988E-07},
+        {-7.09711403570189E-09, 6.29470515502988E-09, 3.50833306577579E-09, 8.31289199649054E-09,
+         -2.14221463168338E-09},
+        {-8.11910123910038E-10, 3.34047829618955E-10, 3.70619377446490E-10, 3.30426088213373E-10, 4.86297305597865E-11},
+        {1.98628160424161E-11, -4.98557831380098E-12, -5.90523187802174E-12, -1.27027116925122E-12,
+         1.49982368570355E-11},
+        {2.62289263262748E-12, 3.91242360693861E-12, 6.56035499387192E-12, -1.17412941089401E-12,
+         -9.40878197853394E-13},
+        {-3.37805010124487E-13, 5.39454874299593E-13, -2.41569839991525E-13, -2.41572016820792E-13,
+         -3.01983673057198E-13},
+        {-1.85034053857964E-13, 4.31132161871815E-14, 4.13497222026824E-15, -4.60075514595980E-14,
+         -1.92454846400146E-14},
+        {2.96113888929854E-15, -1.11688534391626E-14, 3.76275373238932E-15, -3.72593295948136E-15,
+         1.98205490249604E-16},
+        {1.40074667864629E-15, -5.15564234798333E-16, 3.56287382196512E-16, 5.07242777691587E-16,
+         -2.30405782826134E-17},
+        {2.96822530176851E-16, -4.77029898301223E-17, 1.12782285532775E-16, 1.58443229778573E-18, 8.22141904662969E-17}
+    }
+};
+
+// bh, bw, ch, cw
+extern const f64 vmf3_bnm[4][91][5] = {
+    {
+        {0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0},
+        {-2.29210587053658E-06, -2.33805004374529E-06, -7.49312880102168E-07, -5.12022747852006E-07,
+         5.88926055066172E-07},
+        {0, 0, 0, 0, 0},
+        {-4.63382754843690E-06, -2.23853015662938E-06, 8.14830531656518E-07, 1.15453269407116E-06,
+         -4.53555450927571E-07},
+        {-6.92432096320778E-07, -2.98734455136141E-07, 1.48085153955641E-08, 1.37881746148773E-07,
+         -6.92492118460215E-09},
+        {0, 0, 0, 0, 0},
+        {-1.91507979850310E-06, -1.83614825459598E-06, -7.46807436870647E-07, -1.28329122348007E-06,
+         5.04937180063059E-07},
+        {-8.07527103916713E-07, 2.83997840574570E-08, -6.01890498063025E-08, -2.48339507554546E-08,
+         2.46284627824308E-08},
+        {-2.82995069303093E-07, 1.38818274596408E-09, 3.22731214161408E-09, 2.87731153972404E-10, 1.53895537278496E-08},
+        {0, 0, 0, 0, 0},
+        {-6.68210270956800E-07, -2.19104833297845E-06, 1.30116691657253E-07, 4.78445730433450E-07,
+         -4.40344300914051E-07},
+        {-2.36946755740436E-07, -1.32730991878204E-07, 1.83669593693860E-08, 7.90218931983569E-08,
+         -4.70161979232584E-08},
+        {1.07746083292179E-07, -4.17088637760330E-09, -1.83296035841109E-09, -5.80243971371211E-09,
+         -2.11682361167439E-09},
+        {-5.44712355496109E-08, 1.89717032256923E-09, 2.27327316287804E-10, 7.78400728280038E-10, 8.82380487618991E-12},
+        {0, 0, 0, 0, 0},
+        {-5.61707049615673E-08, -1.09066447089585E-06, -2.25742250174119E-07, -8.64367795924377E-07,
+         1.06411275240680E-08},
+        {2.41782935157918E-08, -3.65762298303819E-08, -6.93420659586875E-08, -3.97316214341991E-08,
+         -2.08767816486390E-08},
+        {6.38293030383436E-08, 1.11377936334470E-08, 6.91424941454782E-09, 1.39887159955004E-09, 5.25428749022906E-09},
+        {1.09291268489958E-08, 1.23935926756516E-10, 3.92917259954515E-10, -1.79144682483562E-10,
+         -9.11802874917597E-10},
+        {-4.40957607823325E-09, 1.45751390560667E-10, 1.24641258165301E-10, -6.45810339804674E-11,
+         -8.92894658893326E-12},
+        {0, 0, 0, 0, 0},
+        {1.54754294162102E-08, -1.60154742388847E-06, -4.08425188394881E-07, 6.18170290113531E-09,
+         -2.58919765162122E-07},
+        {1.37130642286873E-08, -6.67813955828458E-08, -7.01410996605609E-09, 3.82732572660461E-08,
+         -2.73381870915135E-08},
+        {2.19113155379218E-08, 4.11027496396868E-09, 6.33816020485226E-09, -1.49242411327524E-09,
+         -6.14224941851705E-10},
+        {6.26573021218961E-09, 5.17137416480052E-10, -3.49784328298676E-10, 1.13578756343208E-10, 2.80414613398411E-10},
+        {1.65048133258794E-11, 1.00047239417239E-10, 1.05124654878499E-10, -3.03826002621926E-11, 4.57155388334682E-11},
+        {6.20221691418381E-11, 9.75852610098156E-12, -5.46716005756984E-12, 1.31643349569537E-11, 3.61618775715470E-12},
+        {0, 0, 0, 0, 0},
+        {-1.03938913012708E-06, -1.78417431315664E-07, 2.86040141364439E-07, 1.83508599345952E-08,
+         -1.34452220464346E-07},
+        {-4.36557481393662E-08, 7.49780206868834E-09, -8.62829428674082E-09, 5.50577793039009E-09,
+         -9.46897502333254E-09},
+        {3.43193738406672E-10, 1.13545447306468E-08, 1.25242388852214E-09, 6.03221501959620E-10, 1.57172070361180E-09},
+        {-4.73307591021391E-10, 1.70855824051391E-10, -2.62470421477037E-11, 2.04525835988874E-10,
+         -1.17859695928164E-10},
+        {-3.36185995299839E-10, 3.19243054562183E-11, 1.17589412418126E-10, -1.35478747434514E-12,
+         5.11192214558542E-11},
+        {3.19640547592136E-11, 2.94297823804643E-12, -1.00651526276990E-11, -1.67028733953153E-12,
+         3.03938833625503E-12},
+        {1.68928641118173E-11, -7.90032886682002E-13, -1.40899773539137E-12, 7.76937592393354E-13,
+         7.32539820298651E-13},
+        {0, 0, 0, 0, 0},
+        {2.32949756055277E-07, 1.46237594908093E-07, -1.07770884952484E-07, 1.26824870644476E-07,
+         -2.36345735961108E-08},
+        {8.89572676497766E-08, 7.24810004121931E-08, 2.67583556180119E-08, 2.48434796111361E-08, -3.55004782858686E-09},
+        {-1.00823909773603E-08, 8.84433929029076E-10, -2.55502517594511E-10, -5.48034274059119E-10,
+         -8.50241938494079E-10},
+        {1.13259819566467E-09, 5.55186945221216E-10, 7.63679807785295E-11, -1.70067998092043E-11, 1.57081965572493E-10},
+        {-2.37748192185353E-10, 2.45463764948000E-11, 3.23208414802860E-11, -2.72624834520723E-12,
+         8.14449183666500E-12},
+        {-1.54977633126025E-11, 4.58754903157884E-12, -1.25864665839074E-12, 2.44139868157872E-12,
+         -1.82827441958193E-12},
+        {3.28285563794513E-12, -1.10072329225465E-12, -7.23470501810935E-13, 5.85309745620389E-13,
+         4.11317589687125E-13},
+        {4.57596974384170E-13, 9.84198128213558E-14, 3.34503817702830E-14, 7.08431086558307E-15, 2.79891177268807E-14},
+        {0, 0, 0, 0, 0},
+        {-3.67820719155580E-07, 6.98497901205902E-07, 1.83397388750300E-07, 2.39730262495372E-07,
+         -2.58441984368194E-07},
+        {5.17793954077994E-08, 5.54614175977835E-08, 1.75026214305232E-09, -2.55518450411346E-09,
+         -6.12272723006537E-09},
+        {-7.94292648157198E-09, -1.01709107852895E-09, -1.49251241812310E-09, 9.32827213605682E-10,
+         -8.24490722043118E-10},
+        {1.36410408475679E-11, 2.16390220454971E-10, 1.24934806872235E-10, -6.82507825145903E-11,
+         -4.01575177719668E-11},
+        {-1.41619917600555E-11, -1.54733230409082E-11, 1.36792829351538E-11, 1.11157862104733E-12,
+         2.08548465892268E-11},
+        {-3.56521723755846E-12, 4.47877185884557E-12, -6.34096209274637E-16, -1.13010624512348E-12,
+         -2.82018136861041E-13},
+        {2.22758955943441E-12, -4.63876465559380E-13, -5.80688019272507E-13, 2.45878690598655E-13,
+         1.49997666808106E-13},
+        {-6.26833903786958E-14, 2.73416335780807E-14, 1.91842340758425E-14, 1.67405061129010E-14,
+         -2.45268543953704E-17},
+        {1.81972870222228E-14, 5.43036245069085E-15, 1.92476637107321E-15, 8.78498602508626E-17, -1.42581647227657E-15},
+        {0, 0, 0, 0, 0},
+        {9.74322164613392E-07, -5.23101820582724E-07, -2.81997898176227E-07, 4.54762451707384E-08,
+         -3.34645078118827E-08},
+        {-6.75813194549663E-09, 3.49744702199583E-08, -5.09170419895883E-09, 5.24359476874755E-09,
+         4.96664262534662E-09},
+        {4.53858847892396E-10, -1.49347392165963E-09, -2.00939511362154E-09, 9.30987163387955E-10,
+         9.74450200826854E-11},
+        {-4.92900885858693E-10, 5.34223033225688E-12, 1.08501839729368E-10, -6.43526142089173E-11,
+         -3.11063319142619E-11},
+        {1.38469246386690E-11, -7.91180584906922E-12, 2.26641656746936E-13, 4.55251515177956E-12, 6.05270575117769E-12},
+        {4.02247935664225E-12, 1.82776657951829E-12, -1.28348801405445E-13, -2.16257301300350E-13,
+         -5.54363979435025E-14},
+        {4.15005914461687E-13, -2.00647573581168E-13, -1.67278251942946E-13, 1.30332398257985E-13,
+         1.52742363652434E-13},
+        {6.36376500056974E-14, 1.65794532815776E-14, -3.80832559052662E-15, -6.40262894005341E-16,
+         2.42577181848072E-15},
+        {-5.55273521249151E-15, 3.69725182221479E-15, 2.02114207545759E-15, -4.50870833392161E-16,
+         9.62950493696677E-17},
+        {1.00935904205024E-17, 6.54751873609395E-17, -1.09138810997186E-16, -8.62396750098759E-17,
+         -3.82788257844306E-17},
+        {0, 0, 0, 0, 0},
+        {4.21958510903678E-07, -8.30678271007705E-08, -3.47006439555247E-07, -3.36442823712421E-08,
+         9.90739768222027E-08},
+        {2.64389033612742E-08, 2.65825090066479E-09, -1.28895513428522E-08, -7.07182694980098E-10,
+         7.10907165301180E-09},
+        {6.31203524153492E-09, -1.67038260990134E-09, 1.33104703539822E-09, 8.34376495185149E-10,
+         -2.52478613522612E-10},
+        {1.18414896299279E-10, -2.57745052288455E-11, 2.88295935685818E-11, -3.27782977418354E-11,
+         -1.05705000036156E-11},
+        {-4.20826459055091E-12, -6.97430607432268E-12, -3.90660545970607E-12, -3.90449239948755E-13,
+         -4.60384797517466E-13},
+        {-9.47668356558200E-13, 6.53305025354881E-13, 2.63240185434960E-13, 1.40129115015734E-13, 3.85788887132074E-14},
+        {2.23947810407291E-13, 7.35262771548253E-15, -3.83348211931292E-14, 4.20376514344176E-14, 4.26445836468461E-14},
+        {-3.88008154470596E-16, 2.28561424667750E-15, -8.73599966653373E-16, 2.14321147947665E-15,
+         6.38631825071920E-16},
+        {-8.62165565535721E-15, 1.79742912149810E-15, 1.01541125038661E-15, -7.91027655831866E-17,
+         -4.06505132825230E-16},
+        {-2.35355054392189E-16, -6.13997759731013E-17, -2.73490528665965E-17, 2.63895177155121E-17,
+         -4.47531057245187E-18},
+        {6.01909706823530E-17, 5.35520010856833E-18, -2.15530106132531E-18, -2.46778496746231E-18,
+         -7.09947296442799E-19},
+        {0, 0, 0, 0, 0},
+        {-3.75005956318736E-07, -5.39872297906819E-07, -1.19929654883034E-07, 4.52771083775007E-08,
+         1.82790552943564E-07},
+        {7.82606642505646E-09, -1.68890832383153E-08, -8.45995188378997E-09, 1.42958730598502E-09,
+         3.21075754133531E-09},
+        {4.28818421913782E-09, -1.07501469928219E-09, 8.84086350297418E-10, 9.74171228764155E-10, 8.59877149602304E-12},
+        {1.28983712172521E-10, -6.96375160373676E-11, -2.13481436408896E-11, 1.33516375568179E-11,
+         -1.65864626508258E-11},
+        {-4.48914384622368E-12, 9.68953616831263E-13, -1.61372463422897E-12, -2.09683563440448E-12,
+         -1.90096826314068E-12},
+        {-1.12626619779175E-13, 3.34903159106509E-14, -1.21721528343657E-13, 7.46246339290354E-14,
+         3.68424909859186E-13},
+        {5.08294274367790E-14, 2.83036159977090E-14, 1.48074873486387E-14, -9.59633528834945E-15,
+         -1.26231060951100E-14},
+        {-4.01464098583541E-16, 1.97047929526674E-15, -5.29967950447497E-16, -3.59120406619931E-16,
+         1.69690933982683E-16},
+        {-1.73919209873841E-15, 7.52792462841274E-16, 3.65589287101147E-16, -7.79247612043812E-17,
+         -8.24599670368999E-17},
+        {-4.61555616150128E-17, 4.94529746019753E-19, -1.09858157212270E-17, 3.95550811124928E-18,
+         3.23972399884100E-18},
+        {-2.27040686655766E-17, -3.27855689001215E-18, -3.30649011116861E-19, 9.08748546536849E-19,
+         8.92197599890994E-19},
+        {5.67241944733762E-18, 3.84449400209976E-19, 1.77668058015537E-19, 2.00432838283455E-20, -2.00801461564767E-19}
+    },
+    {
+        {0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0},
+        {-9.56715196386889E-06, -3.68040633020420E-08, 1.27846786489883E-07, 1.32525487755973E-06,
+         1.53075361125066E-06},
+        {0, 0, 0, 0, 0},
+        {-7.17682617983607E-06, 2.89994188119445E-06, -2.97763578173405E-07, 8.95742089134942E-07,
+         3.44416325304006E-07},
+        {-8.02661132285210E-07, 3.66738692077244E-07, -3.02880965723280E-07, 3.54144282036103E-07,
+         -1.68873066391463E-07},
+        {0, 0, 0, 0, 0},
+        {-2.89640569283461E-06, -7.83566373343614E-07, -8.36667214682577E-07, -7.41891843549121E-07,
+         -9.23922655636489E-08},
+        {-1.06144662284862E-06, 1.57709930505924E-07, 1.04203025714319E-07, 1.20783300488461E-07,
+         -1.38726055821134E-07},
+        {-4.16549018672265E-07, -1.35220897698872E-07, -6.40269964829901E-08, 1.63258283210837E-08,
+         -2.57958025095959E-08},
+        {0, 0, 0, 0, 0},
+        {3.52324885892419E-06, -2.26705543513814E-07, 1.53835589488292E-06, -3.75263061267433E-07,
+         3.69384057396017E-07},
+        {-2.06569149157664E-07, -9.36260183227175E-08, -3.55985284353048E-08, -9.13671163891094E-08,
+         6.93156256562600E-09},
+        {1.32437594740782E-07, 4.44349887272663E-08, -3.38192451721674E-08, -3.97263855781102E-08,
+         -1.93087822995800E-09},
+        {-1.29595244818942E-07, -1.40852985547683E-08, 1.42587592939760E-09, 7.05779876554001E-09,
+         -1.00996269264535E-08},
+        {0, 0, 0, 0, 0},
+        {4.06960756215938E-06, -1.97898540226986E-06, 7.21905857553588E-08, -1.19908881538755E-06,
+         -5.67561861536903E-08},
+        {6.53369660286999E-08, -2.42818687866392E-07, -1.66203004559493E-08, -2.41512414151897E-08,
+         4.45426333411018E-08},
+        {1.44650670663281E-07, 8.50666367433859E-09, -4.61165612004307E-09, 4.88527987491045E-09, 1.06277326713172E-08},
+        {1.86770937103513E-08, -6.44197940288930E-10, -7.60456736846174E-09, -9.97186468682689E-10,
+         8.73229752697716E-10},
+        {-1.00206566229113E-08, 1.33934372663121E-09, 1.41691503439220E-09, 8.72352590578753E-10,
+         -8.04561626629829E-10},
+        {0, 0, 0, 0, 0},
+        {3.07161843116618E-06, 1.82962085656470E-06, 1.87728623016069E-07, 7.10611617623261E-07, 2.26499092250481E-07},
+        {4.50766403064905E-08, -1.67752393078256E-07, 2.47844723639070E-08, -3.56484348424869E-09,
+         -1.56634836636584E-08},
+        {3.77011651881090E-08, -7.23045828480496E-09, 5.22995988863761E-09, -1.03740320341306E-09,
+         4.57839777217789E-09},
+        {8.09495635883121E-09, -3.01977244420529E-10, -2.30104544933093E-09, 3.63658580939428E-10,
+         4.39320811714867E-10},
+        {9.37087629961269E-11, 1.00780920426635E-09, 1.28140539913350E-10, -6.65795285522138E-12, 4.71732796198631E-11},
+        {-8.88504487069155E-11, -1.63253810435461E-10, 7.22669710644299E-11, 5.64715132584527E-11,
+         -1.08949308197617E-12},
+        {0, 0, 0, 0, 0},
+        {-2.64054293284174E-07, -2.37611606117256E-06, -1.83671059706264E-06, -3.12199354841993E-07,
+         -1.05598289276114E-07},
+        {7.41706968747147E-08, -1.64359098062646E-08, -3.09750224040234E-08, -9.68640079410317E-09,
+         -7.90399057863403E-08},
+        {-1.00254376564271E-08, 1.12528248631191E-08, -2.67841549174100E-09, -2.69481819323647E-09,
+         1.56550607475331E-09},
+        {-2.18568129350729E-09, 6.26422056977450E-10, 1.95007291427316E-09, 3.14226463591125E-10,
+         -3.62000388344482E-10},
+        {-9.30451291747549E-10, 5.62175549482704E-11, 1.01022849902012E-10, 5.18675856498499E-11, 5.37561696283235E-11},
+        {5.33151334468794E-11, 1.07571307336725E-10, -1.31714567944652E-11, -4.17524405900018E-11,
+         -2.16737797893502E-12},
+        {4.69916869001309E-11, -4.34516364859583E-12, -6.61054225868897E-12, -5.75845818545368E-12,
+         -2.32180293529175E-12},
+        {0, 0, 0, 0, 0},
+        {-3.50305843086926E-06, 1.76085131953403E-06, 8.16661224478572E-07, 4.09111042640801E-07,
+         -9.85414469804995E-08},
+        {1.44670876127274E-07, -1.41331228923029E-08, -3.06530152369269E-08, -1.46732098927996E-08,
+         -2.30660839364244E-08},
+        {-2.00043052422933E-08, 1.72145861031776E-09, 2.13714615094209E-09, 1.02982676689194E-09,
+         -1.64945224692217E-10},
+        {1.23552540016991E-09, 1.42028470911613E-09, 8.79622616627508E-10, -7.44465600265154E-10,
+         -7.17124672589442E-11},
+        {-6.67749524914644E-10, -5.77722874934050E-11, 3.40077806879472E-11, 4.26176076541840E-11,
+         8.23189659748212E-11},
+        {-4.62771648935992E-11, -7.24005305716782E-13, 1.18233730497485E-12, 5.18156973532267E-12,
+         -1.53329687155297E-12},
+        {4.75581699468619E-12, -3.79782291469732E-12, 1.33077109836853E-12, -1.02426020107120E-12,
+         3.10385019249130E-13},
+        {1.66486090578792E-12, 1.08573672403649E-12, 1.26268044166279E-13, -1.23509297742757E-13,
+         -1.81842007284038E-13},
+        {0, 0, 0, 0, 0},
+        {9.93870680202303E-08, -1.85264736035628E-06, -5.58942734710854E-07, -5.54183448316270E-07,
+         -3.95581289689398E-08},
+        {7.88329069002365E-08, 2.04810091451078E-08, 3.74588851000076E-09, 3.42429296613803E-08, -2.00840228416712E-08},
+        {-5.93700447329696E-10, -6.57499436973459E-10, -6.90560448220751E-09, 3.56586371051089E-09,
+         7.33310245621566E-11},
+        {-6.38101662363634E-11, 4.23668020216529E-10, -2.43764895979202E-10, -9.31466610703172E-11,
+         -3.17491457845975E-10},
+        {1.50943725382470E-11, -6.11641188685078E-11, -4.37018785685645E-11, -2.32871158949602E-11,
+         4.19757251950526E-11},
+        {-1.18165328825853E-11, -9.91299557532438E-13, 6.40908678055865E-14, 2.41049422936434E-12,
+         -8.20746054454953E-14},
+        {6.01892101914838E-12, -8.78487122873450E-13, -1.58887481332294E-12, -3.13556902469604E-13,
+         5.14523727801645E-14},
+        {-1.50791729401891E-13, -1.45234807159695E-13, 1.65302377570887E-13, -5.77094211651483E-15,
+         9.22218953528393E-14},
+        {-1.85618902787381E-14, 5.64333811864051E-14, -9.94311377945570E-15, -2.40992156199999E-15,
+         -2.19196760659665E-14},
+        {0, 0, 0, 0, 0},
+        {-8.16252352075899E-08, 1.61725487723444E-06, 9.55522506715921E-07, 4.02436267433511E-07,
+         -2.80682052597712E-07},
+        {7.68684790328630E-09, -5.00940723761353E-09, -2.43640127974386E-08, -2.59119930503129E-08,
+         3.35015169182094E-08},
+        {7.97903115186673E-09, 3.73803883416618E-09, 3.27888334636662E-09, 1.37481300578804E-09, -1.10677168734482E-10},
+        {-1.67853012769912E-09, -1.61405252173139E-10, -1.98841576520056E-10, -1.46591506832192E-11,
+         9.35710487804660E-11},
+        {4.08807084343221E-11, -3.74514169689568E-11, -3.03638493323910E-11, -5.02332555734577E-12,
+         -8.03417498408344E-12},
+        {6.48922619024579E-12, 1.96166891023817E-12, -1.96968755122868E-12, -5.20970156382361E-12,
+         -1.62656885103402E-12},
+        {1.28603518902875E-12, -4.88146958435109E-13, -3.37034886991840E-13, 1.37393696103000E-14,
+         4.41398325716943E-14},
+        {1.48670014793021E-13, 4.41636026364555E-14, 2.06210477976005E-14, -3.43717583585390E-14,
+         -1.21693704024213E-14},
+        {-1.67624180330244E-14, 6.59317111144238E-15, 2.57238525440646E-15, -3.21568425020512E-17,
+         5.29659568026553E-15},
+        {7.85453466393227E-16, 6.91252183915939E-16, -1.20540764178454E-15, -3.85803892583301E-16,
+         3.46606994632006E-16},
+        {0, 0, 0, 0, 0},
+        {2.86710087625579E-06, -1.68179842305865E-06, -8.48306772016870E-07, -7.08798062479598E-07,
+         -1.27469453733635E-07},
+        {2.11824305734993E-09, 2.02274279084379E-08, 1.61862253091554E-08, 3.25597167111807E-08, 3.40868964045822E-09},
+        {1.21757111431438E-08, 1.68405530472906E-09, 1.55379338018638E-09, -3.81467795805531E-10, 2.53316405545058E-09},
+        {-9.98413758659768E-11, 5.38382145421318E-10, 3.92629628330704E-10, -1.43067134097778E-10,
+         3.74959329667113E-12},
+        {-1.57270407028909E-11, -9.02797202317592E-12, 8.45997059887690E-12, 4.71474382524218E-12,
+         5.41880986596427E-12},
+        {-1.20658618702054E-12, 7.12940685593433E-13, 1.02148613026937E-12, 1.63063852348169E-13, 1.74048793197708E-13},
+        {3.80559390991789E-13, 1.19678271353485E-13, 9.72859455604188E-14, 5.42642400031729E-14, 8.18796710714586E-14},
+        {-4.69629218656902E-14, 5.59889038686206E-15, 2.05363292795059E-15, 5.38599403288686E-15,
+         -2.68929559474202E-15},
+        {-1.88759348081742E-14, 5.20975954705924E-15, -4.43585653096395E-16, 5.57436617793556E-16,
+         -3.95922805817677E-16},
+        {-9.80871456373282E-16, 2.50857658461759E-17, -1.24253000050963E-16, 6.00857065211394E-17,
+         3.53799635311500E-18},
+        {2.49370713054872E-16, -1.49119714269816E-17, -3.12276052640583E-17, -2.42001662334001E-17,
+         -1.69766504318143E-17},
+        {0, 0, 0, 0, 0},
+        {-1.69222102455713E-06, 1.64277906173064E-06, 5.28855114364096E-07, 4.28159853268650E-07,
+         -1.57362445882665E-07},
+        {1.67656782413678E-08, -3.77746114074055E-08, -2.21564555842165E-08, -3.37071806992217E-08,
+         1.47454008739800E-08},
+        {1.06080499491408E-08, 3.21990403709678E-09, 3.87301757435359E-09, 2.92241827834347E-10, -1.86619473655742E-11},
+        {1.62399669665839E-10, 3.51322865845172E-10, 2.67086377702958E-11, -1.31596563625491E-10, 3.14164569507034E-11},
+        {-2.02180016657259E-11, 2.03305178342732E-11, 6.34969032565839E-12, 5.99522296668787E-12,
+         -4.46275273451008E-12},
+        {-9.88409290158885E-13, -1.47692750858224E-13, 3.14655550730530E-13, -2.41857189187879E-13,
+         4.47727504501486E-13},
+        {1.71430777754854E-13, 1.73950835042486E-13, 5.92323956541558E-14, 8.06625710171825E-15, 2.33252485755634E-14},
+        {-1.74184545690134E-15, -8.18003353124179E-16, -6.62369006497819E-16, 4.16303374396147E-15,
+         7.06513748014024E-15},
+        {-6.02936238677014E-15, 1.89241084885229E-15, 1.99097881944270E-17, -6.99974290696640E-16,
+         -2.69504942597709E-17},
+        {-4.65632962602379E-16, 3.70281995445114E-18, -9.04232973763345E-17, 2.20847370761932E-17,
+         7.62909453726566E-17},
+        {-6.25921477907943E-17, -2.10532795609842E-17, -1.03808073867183E-17, 1.15091380049019E-18,
+         4.66794445408388E-19},
+        {9.39427013576903E-18, 9.17044662931859E-19, 2.04132745117549E-18, -1.72364063154625E-19, -1.18098896532163E-18}
+    },
+    {
+        {0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0},
+        {3.44092035729033E-05, -1.21876825440561E-05, -1.87490665238967E-05, -2.60980336247863E-05,
+         4.31639313264615E-06},
+        {0, 0, 0, 0, 0},
+        {-2.60125613000133E-05, 1.70570295762269E-05, 3.08331896996832E-05, 1.66256596588688E-05,
+         -1.07841055501996E-05},
+        {8.74011641844073E-06, -2.25874169896607E-06, 6.50985196673747E-07, 1.30424765493752E-06,
+         -1.85081244549542E-07},
+        {0, 0, 0, 0, 0},
+        {3.77496505484964E-05, -1.08198973553337E-05, -1.67717574544937E-05, -3.22476096673598E-05,
+         1.12281888201134E-05},
+        {-7.68623378647958E-07, -4.01400837153063E-06, -2.16390246700835E-06, -1.76912959937924E-06,
+         -1.12740084951955E-06},
+        {-2.37092815818895E-06, -9.52317223759653E-07, -2.22722065579131E-07, -6.25157619772530E-08,
+         1.86582003894639E-08},
+        {0, 0, 0, 0, 0},
+        {-6.10254317785872E-05, -2.51815503068494E-05, 2.01046207874667E-05, 7.21107723367308E-06,
+         -1.30692058660457E-05},
+        {-9.60655417241537E-06, -7.31381721742373E-06, -2.52767927589636E-06, 9.09039973214621E-07,
+         -6.76454911344246E-07},
+        {-2.25743206384908E-08, 2.33058746737575E-07, 2.24746779293445E-07, 6.78551351968876E-08, 1.25076011387284E-07},
+        {-2.25744112770133E-07, -1.44429560891636E-07, -2.96810417448652E-08, -5.93858519742856E-08,
+         -2.43210229455420E-08},
+        {0, 0, 0, 0, 0},
+        {7.45721015256308E-06, -3.81396821676410E-05, -1.41086198468687E-05, -2.28514517574713E-05,
+         7.28638705683277E-06},
+        {-5.77517778169692E-06, -3.93061211403839E-06, -2.17369763310752E-06, -1.48060935583664E-07,
+         -2.74200485662814E-07},
+        {4.52962035878238E-07, 9.80990375495214E-07, 4.67492045269286E-07, -8.31032252212116E-09, 1.69426023427740E-07},
+        {7.20536791795515E-10, 2.75612253452141E-09, 2.47772119382536E-09, 4.30621825021233E-09, -2.86498479499428E-08},
+        {-2.46253956492716E-08, -3.10300833499669E-09, 8.06559148724445E-09, 2.98197408430123E-10,
+         6.32503656532846E-09},
+        {0, 0, 0, 0, 0},
+        {-6.01147094179306E-05, -3.16631758509869E-05, 4.10038115100010E-06, 3.55215057231403E-07,
+         -2.23606515237408E-06},
+        {-2.85937516921923E-06, -3.67775706610630E-06, -5.06445540401637E-07, 8.21776759711184E-07,
+         -5.98690271725558E-07},
+        {7.77122595418965E-07, 3.60896376754085E-07, 3.88610487893381E-07, -4.39533892679537E-08,
+         -6.26882227849174E-08},
+        {1.05759993661891E-07, 2.58009912408833E-08, -1.51356049060972E-08, -1.13335813107412E-09,
+         5.37470857850370E-10},
+        {7.99831506181984E-09, 1.67423735327465E-09, 2.94736760548677E-09, -1.56727133704788E-09, 8.46186800849124E-10},
+        {3.07727104043851E-09, 3.93584215798484E-10, 3.86721562770643E-11, 1.72181091277391E-10, -2.16915737920145E-10},
+        {0, 0, 0, 0, 0},
+        {-1.16335389078126E-05, -1.39864676661484E-05, 2.52546278407717E-06, -8.79152625440188E-06,
+         -8.97665132187974E-06},
+        {-3.95874550504316E-06, -1.17976262528730E-07, 7.03189926369300E-07, 3.38907065351535E-07,
+         -3.67714052493558E-07},
+        {2.29082449370440E-07, 5.72961531093329E-07, 4.21969662578894E-08, 1.24112958141431E-08, 9.56404486571888E-08},
+        {1.44631865298671E-09, 6.19368473895584E-09, 1.67110424041236E-09, 2.57979463602951E-09, -6.90806907510366E-09},
+        {1.77235802019153E-09, -8.14388846228970E-10, 4.50421956523579E-09, 5.67452314909707E-10, 2.47610443675560E-09},
+        {4.85932343880617E-10, 2.24864117422804E-10, -2.22534534468511E-10, -7.96395824973477E-11,
+         3.12587399902493E-12},
+        {-3.20173937255409E-11, -1.29872402028088E-11, -4.24092901203818E-11, 2.66570185704416E-11,
+         -5.25164954403909E-12},
+        {0, 0, 0, 0, 0},
+        {-1.36010179191872E-05, 1.77873053642413E-05, 4.80988546657119E-06, 3.46859608161212E-06,
+         -1.73247520896541E-06},
+        {2.00020483116258E-06, 2.43393064079673E-06, 1.21478843695862E-06, 1.95582820041644E-07, -3.11847995109088E-07},
+        {-8.13287218979310E-09, 1.05206830238665E-08, 6.54040136224164E-09, -1.96402660575990E-08,
+         -1.40379796070732E-08},
+        {4.01291020310740E-08, 2.92634301047947E-08, 6.04179709273169E-09, 8.61849065020545E-10, 5.98065429697245E-09},
+        {-1.06149335032911E-09, -4.39748495862323E-10, 8.83040310269353E-10, 3.49392227277679E-10,
+         8.57722299002622E-10},
+        {-1.25049888909390E-11, 2.05203288281631E-10, 1.37817670505319E-11, 6.82057794430145E-11,
+         -9.41515631694254E-11},
+        {7.47196022644130E-12, -2.51369898528782E-11, -2.12196687809200E-11, 1.55282119505201E-11,
+         9.99224438231805E-12},
+        {-7.90534019004874E-13, 3.55824506982589E-12, 8.00835777767281E-13, 8.73460019069655E-13, 1.34176126600106E-12},
+        {0, 0, 0, 0, 0},
+        {3.12855262465316E-05, 1.31629386003608E-05, 2.65598119437581E-06, 8.68923340949135E-06, -7.51164082949678E-06},
+        {1.56870792650533E-06, 1.89227301685370E-06, 4.15620385341985E-07, -2.74253787880603E-07,
+         -4.28826210119200E-07},
+        {-9.99176994565587E-08, -1.10785129426286E-07, -1.10318125091182E-07, 6.22726507350764E-09,
+         -3.39214566386250E-08},
+        {1.24872975018433E-08, 1.10663206077249E-08, 5.40658975901469E-09, -2.79119137105115E-09,
+         -2.47500096192502E-09},
+        {1.11518917154060E-10, -4.21965763244849E-10, 3.26786005211229E-10, 1.93488254914545E-10, 7.00774679999972E-10},
+        {1.50889220040757E-10, 1.03130002661366E-10, -3.09481760816903E-11, -4.47656630703759E-11,
+         -7.36245021803800E-12},
+        {-1.91144562110285E-12, -1.11355583995978E-11, -1.76207323352556E-11, 8.15289793192265E-12,
+         3.45078925412654E-12},
+        {-2.73248710476019E-12, -1.65089342283056E-13, -2.20125355220819E-13, 5.32589191504356E-13,
+         5.70008982140874E-13},
+        {8.06636928368811E-13, 1.30893069976672E-13, 9.72079137767479E-14, 3.87410156264322E-14, -5.56410013263563E-14},
+        {0, 0, 0, 0, 0},
+        {2.02454485403216E-05, -9.77720471118669E-06, -4.35467548126223E-06, 2.19599868869063E-06,
+         -3.26670819043690E-06},
+        {-3.21839256310540E-08, 8.38760368015005E-07, -5.08058835724060E-07, 4.16177282491396E-08,
+         1.53842592762120E-07},
+        {-1.57377633165313E-07, -7.86803586842404E-08, -7.40444711426898E-08, 3.15259864117954E-08,
+         5.60536231567172E-09},
+        {-3.26080428920229E-10, -3.14576780695439E-09, 8.46796096612981E-10, -2.59329379174262E-09,
+         -8.01054756588382E-10},
+        {-4.58725236153576E-11, -6.87847958546571E-11, 8.18226480126754E-12, 1.81082075625897E-10,
+         1.74510532938256E-10},
+        {7.60233505328792E-11, 4.76463939581321E-11, -2.47198455442033E-11, -8.83439688929965E-12,
+         5.93967446277316E-13},
+        {-8.92919292558887E-12, -4.38524572312029E-12, -4.02709146060896E-12, 4.84344426425295E-12,
+         5.12869042781520E-12},
+        {1.91518361809952E-12, 3.06846255371817E-13, -2.44830265306345E-13, 7.86297493099244E-14, 2.72347805801980E-13},
+        {9.09936624159538E-14, 7.20650818861447E-15, 2.45383991578283E-14, -4.79580974186462E-15, 3.64604724046944E-14},
+        {-4.63611142770709E-14, 1.73908246420636E-15, -4.41651410674801E-15, -6.61409045306922E-16,
+         -1.60016049099639E-15},
+        {0, 0, 0, 0, 0},
+        {6.17105245892845E-06, -1.04342983738457E-05, -1.72711741097994E-05, -8.16815967888426E-07,
+         3.42789959967593E-06},
+        {-2.44014060833825E-07, 2.06991837444652E-07, -3.85805819475679E-07, 1.67162359832166E-08,
+         4.15139610402483E-07},
+        {8.18199006804020E-08, -3.20013409049159E-08, 5.94000906771151E-08, 2.24122167188946E-08,
+         -1.33796186160409E-08},
+        {7.66269294674338E-11, -6.07862178874828E-10, 4.95795757186248E-10, -3.07589245481422E-10,
+         3.44456287710689E-10},
+        {-1.84076250254929E-10, -1.30985312312781E-10, -1.52547325533276E-10, -2.51000125929512E-11,
+         -1.93924012590455E-11},
+        {-2.93307452197665E-11, 2.88627386757582E-11, 5.58812021182217E-12, -1.68692874069187E-13,
+         1.80464313900575E-12},
+        {-9.59053874473003E-13, 6.04803122874761E-13, -9.80015608958536E-13, 1.70530372034214E-12,
+         1.70458664160775E-12},
+        {2.80169588226043E-13, 9.09573148053551E-14, 2.16449186617004E-14, 1.15550091496353E-13, 4.97772796761321E-14},
+        {-3.04524400761371E-14, 3.42845631349694E-14, 2.44230630602064E-14, 5.76017546103056E-16,
+         -9.74409465961093E-15},
+        {5.98765340844291E-15, -2.63942474859535E-15, -1.80204805804437E-15, -1.84981819321183E-16,
+         -5.85073392163660E-16},
+        {-2.37069441910133E-15, 2.87429226086856E-16, -1.67055963193389E-16, 2.72110684914090E-18,
+         8.46646962667892E-17},
+        {0, 0, 0, 0, 0},
+        {-2.71386164105722E-05, -1.41834938338454E-05, -2.00777928859929E-07, 5.94329804681196E-07,
+         8.61856994375586E-06},
+        {-3.93656495458664E-08, -6.36432821807576E-07, -2.47887475106438E-07, -2.64906446204966E-08,
+         1.10689794197004E-07},
+        {5.25319489188562E-08, 9.00866357158695E-09, 5.00693379572512E-08, 2.47269011056404E-08, -7.27648556194598E-09},
+        {1.87207107149043E-09, -1.46428282396138E-09, -2.71812237167257E-10, 8.44902265891466E-10,
+         -5.62683870906027E-10},
+        {-1.08295119666184E-10, 4.75553388543793E-11, -5.49429386495686E-11, -6.60907871731611E-11,
+         -5.97347322824822E-11},
+        {-4.95118306815571E-12, 5.31083735234970E-13, -1.93679746327378E-12, -1.61770521840510E-12,
+         1.23276727202510E-11},
+        {6.68582682909900E-13, 7.38288575160449E-13, 5.47630483499201E-13, -1.00770258118914E-13,
+         -1.65564928475981E-13},
+        {5.80963409268471E-14, 6.93474288078737E-14, 6.60728092794315E-15, -5.21029056725202E-15,
+         -1.11283532854883E-16},
+        {-4.10567742688903E-15, 1.62252646805882E-14, 1.00774699865989E-14, -2.44793214897877E-16,
+         -1.59283906414563E-15},
+        {1.84669506619904E-17, 8.28473337813919E-17, -1.53400662078899E-16, -5.01060672199689E-17,
+         -2.20727935766132E-16},
+        {2.65355116203636E-16, -3.70233146147684E-17, 3.52689394451586E-18, -8.62215942516328E-18,
+         9.26909361974526E-18},
+        {9.94266950643135E-17, 4.17028699663441E-18, -7.65153491125819E-21, -5.62131270981041E-18,
+         -3.03732817297438E-18}
+    },
+    {
+        {0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0},
+        {-0.000209104872912563, -1.41530274973540E-05, 3.00318745764815E-05, -1.82864291318284E-05,
+         -7.62965409959238E-06},
+        {0, 0, 0, 0, 0},
+        {-0.000186336519900275, 0.000191256553935638, 7.28356195304996E-05, 3.59637869639906E-05,
+         -2.53927226167388E-05},
+        {0.000108195343799485, -6.97050977217619E-05, -6.68037133871099E-05, 2.30387653190503E-05,
+         -1.22735483925784E-05},
+        {0, 0, 0, 0, 0},
+        {0.000119941091277039, -7.70547844186875E-05, -8.15376297964528E-05, 1.06005789545203E-05,
+         2.31177232268720E-05},
+        {-1.77494760217164E-05, -1.37061385686605E-05, -1.74805936475816E-05, -6.91745900867532E-07,
+         -7.10231790947787E-06},
+        {-1.47564103733219E-05, 2.08890785485260E-06, 3.19876879447867E-06, 9.43984664503715E-07,
+         -4.90480527577521E-06},
+        {0, 0, 0, 0, 0},
+        {4.93300138389457E-05, -6.77641298460617E-05, -3.25043347246397E-05, 8.33226714911921E-06,
+         8.11499972792905E-06},
+        {-2.80449863471272E-05, -1.04367606414606E-05, 1.64473584641163E-07, -3.57420965807816E-06,
+         2.95887156564038E-06},
+        {1.88835280111533E-06, 5.69125761193702E-07, -2.22757382799409E-06, -1.96699131032252E-07,
+         -2.91861219283659E-07},
+        {-4.69918971436680E-06, -7.00778948636735E-07, 2.97544157334673E-09, 3.86100512544410E-07,
+         2.30939653701027E-07},
+        {0, 0, 0, 0, 0},
+        {1.77050610394149E-05, -3.18353071311574E-05, 3.04232260950316E-05, -6.26821316488169E-05,
+         -1.75094810002378E-06},
+        {9.25605901565775E-06, -8.25179123302247E-06, 6.74032752408358E-06, 3.22192289084524E-06, 6.09414500075259E-06},
+        {4.28233825242200E-06, 2.10470570087927E-07, -4.75050074985668E-07, -4.89382663470592E-07,
+         8.75232347469207E-07},
+        {8.50393520366934E-07, 1.58764911467186E-07, -2.16267638321210E-07, -7.43341300487416E-10,
+         1.75131729813230E-07},
+        {-2.87064111623119E-07, 4.50393893102830E-08, 6.63315044416690E-08, 7.61199387418853E-08,
+         -6.05694385243652E-09},
+        {0, 0, 0, 0, 0},
+        {-1.95692079507947E-05, 5.15486098887851E-05, 3.00852761598173E-05, 1.21485028343416E-05,
+         -6.72450521493428E-06},
+        {5.34496867088158E-06, 3.90973451680699E-06, 3.70148924718425E-06, 5.73731499938212E-08, 5.52258220288780E-07},
+        {3.39950838185315E-07, -5.63443976772634E-07, 4.52082211980595E-07, -2.57094645806243E-07,
+         -6.84885762924729E-08},
+        {2.15793276880684E-07, 2.05911354090873E-07, 1.33747872341142E-08, -2.07997626478952E-08,
+         -3.69812938736019E-08},
+        {2.11952749403224E-09, 4.04317822544732E-08, 2.40972024883650E-09, 8.56289126938059E-09, 2.31035283490200E-08},
+        {-2.08402298813248E-09, -8.50243600879112E-09, 2.60895410117768E-09, -6.69156841738591E-10,
+         -5.16280278087006E-09},
+        {0, 0, 0, 0, 0},
+        {0.000124901291436683, -5.70770326719086E-05, -8.44887248105015E-05, -3.11442665354698E-05,
+         -1.12982893252046E-05},
+        {-8.38934444233944E-06, 1.56860091415414E-06, -1.77704563531825E-06, -5.70219068898717E-08,
+         -4.30377735031244E-06},
+        {3.72965318017681E-07, 6.98175439446187E-07, 1.75760544807919E-08, 1.59731284857151E-07, 3.62363848767891E-07},
+        {-2.32148850787091E-07, -4.21888751852973E-08, 8.35926113952108E-08, -2.24572480575674E-08,
+         -6.92114100904503E-08},
+        {-2.92635642210745E-09, 3.38086229163415E-09, 4.72186694662901E-09, -8.32354437305758E-11,
+         4.19673890995627E-09},
+        {-1.26452887692900E-09, 1.91309690886864E-09, 1.54755631983655E-09, -1.09865169400249E-09,
+         1.83645326319994E-10},
+        {9.92539437011905E-10, -2.96318203488300E-10, 1.17466020823486E-10, -5.00185957995526E-10,
+         -8.54777591408537E-11},
+        {0, 0, 0, 0, 0},
+        {-0.000182885335404854, 7.27424724520089E-05, 3.05286278023427E-05, 2.55324463432562E-05,
+         -6.39859510763234E-06},
+        {-5.21449265232557E-06, -6.70572386081398E-06, -3.95473351292738E-06, -6.41023334372861E-07,
+         -3.11616331059009E-06},
+        {2.37090789071727E-07, 3.58427517014705E-07, 2.55709192777007E-07, 8.44593804408541E-08, 9.27243162355359E-09},
+        {7.24370898432057E-08, -7.43945120337710E-09, 8.61751911975683E-10, -2.34651212610623E-08,
+         2.94052921681456E-09},
+        {-1.22127317934425E-08, -3.89758984276768E-09, 4.12890383904924E-11, 2.06528068002723E-09,
+         1.73488696972270E-09},
+        {-5.44137406907620E-10, -4.81034553189921E-10, -2.56101759039694E-11, 3.21880564410154E-10,
+         -2.70195343165250E-11},
+        {1.08394225300546E-10, -7.99525492688661E-11, 1.73850287030654E-10, -8.06390014426271E-11,
+         -7.63143364291160E-13},
+        {-3.41446959267441E-11, 2.72675729042792E-11, 5.69674704865345E-12, -3.38402998344892E-12,
+         -2.96732381931007E-12},
+        {0, 0, 0, 0, 0},
+        {2.91161315987250E-05, -7.24641166590735E-05, -8.58323519857884E-06, -1.14037444255820E-05,
+         1.32244819451517E-05},
+        {1.24266748259826E-06, -4.13127038469802E-06, -8.47496394492885E-07, 5.48722958754267E-07,
+         -1.98288551821205E-06},
+        {-1.70671245196917E-08, 1.36891127083540E-08, -2.80901972249870E-07, -5.45369793946222E-09,
+         -9.58796303763498E-08},
+        {1.14115335901746E-08, 2.79308166429178E-08, -1.71144803132413E-08, 4.86116243565380E-09,
+         -8.13061459952280E-09},
+        {-1.19144311035824E-09, -1.28197815211763E-09, -1.22313592972373E-09, 6.23116336753674E-10,
+         2.11527825898689E-09},
+        {4.94618645030426E-10, -1.01554483531252E-10, -3.58808808952276E-10, 1.23499783028794E-10,
+         -1.21017599361833E-10},
+        {1.33959569836451E-10, -1.87140898812283E-11, -3.04265350158941E-11, -1.42907553051431E-11,
+         -1.09873858099638E-11},
+        {1.30277419203512E-11, -4.95312627777245E-12, 2.23070215544358E-12, 1.66450226016423E-12, 6.26222944728474E-12},
+        {-4.40721204874728E-12, 2.99575133064885E-12, -1.54917262009097E-12, 8.90015664527060E-14,
+         -1.59135267012937E-12},
+        {0, 0, 0, 0, 0},
+        {-4.17667211323160E-05, 1.39005215116294E-05, 1.46521361817829E-05, 3.23485458024416E-05,
+         -8.57936261085263E-06},
+        {9.48491026524450E-07, 1.67749735481991E-06, 6.80159475477603E-07, -1.34558044496631E-06, 1.62108231492249E-06},
+        {-2.67545753355631E-07, -3.31848493018159E-08, 1.05837219557465E-07, 1.55587655479400E-07,
+         -2.84996014386667E-08},
+        {-5.15113778734878E-08, 8.83630725241303E-09, 3.36579455982772E-09, -6.22350102096402E-09,
+         5.03959133095369E-09},
+        {2.04635880823035E-11, -1.07923589059151E-09, -6.96482137669712E-10, -4.70238500452793E-10,
+         -6.60277903598297E-10},
+        {-2.41897168749189E-11, 1.33547763615216E-10, -5.13534673658908E-11, -8.32767177662817E-11,
+         5.72614717082428E-11},
+        {7.55170562359940E-12, -1.57123461699055E-11, -1.48874069619124E-11, -7.10529462981252E-13,
+         -7.99006335025107E-12},
+        {2.41883156738960E-12, 2.97346980183361E-12, 1.28719977731450E-12, -2.49240876894143E-12, 6.71155595793198E-13},
+        {4.16995565336914E-13, -1.71584521275288E-13, -7.23064067359978E-14, 2.45405880599037E-13,
+         4.43532934905830E-13},
+        {3.56937508828997E-14, 2.43012511260300E-14, -7.96090778289326E-14, -1.59548529636358E-14,
+         8.99103763000507E-15},
+        {0, 0, 0, 0, 0},
+        {0.000117579258399489, -4.52648448635772E-05, -2.69130037097862E-05, -3.82266335794366E-05,
+         -4.36549257701084E-06},
+        {-1.43270371215502E-06, 1.21565440183855E-06, 8.53701136074284E-07, 1.52709810023665E-06, 1.22382663462904E-06},
+        {3.06089147519664E-07, 9.79084123751975E-08, 7.96524661441178E-08, 4.54770947973458E-08, 2.22842369458882E-07},
+        {-9.94254707745127E-09, 1.43251376378012E-08, 1.93911753685160E-08, -6.52214645690987E-09,
+         -1.97114016452408E-09},
+        {-9.20751919828404E-10, -9.44312829629076E-10, 7.24196738163952E-11, -6.71801072324561E-11,
+         2.33146774065873E-10},
+        {-1.43544298956410E-11, 1.78464235318769E-10, 7.69950023012326E-11, -4.22390057304453E-12,
+         3.05176324574816E-11},
+        {-7.88053753973990E-12, -3.20207793051003E-12, 1.01527407317625E-12, 6.02788185858449E-12,
+         1.14919530900453E-11},
+        {-1.21558899266069E-12, 5.31300597882986E-13, 3.44023865079264E-13, -6.22598216726224E-14,
+         -5.47031650765402E-14},
+        {-4.15627948750943E-13, 2.77620907292721E-13, -8.99784134364011E-14, 1.07254247320864E-13,
+         6.85990080564196E-14},
+        {-3.91837863922901E-14, 9.74714976816180E-15, 6.79982450963903E-15, -2.41420876658572E-15,
+         -2.20889384455344E-15},
+        {9.25912068402776E-15, -4.02621719248224E-15, -2.43952036351187E-15, -1.97006876049866E-15,
+         1.03065621527869E-16},
+        {0, 0, 0, 0, 0},
+        {-0.000103762036940193, 4.38145356960292E-05, 2.43406920349913E-05, 7.89103527673736E-06,
+         -1.66841465339160E-05},
+        {-1.18428449371744E-06, -1.30188721737259E-06, -1.88013557116650E-06, -1.01342046295303E-06,
+         9.21813037802502E-07},
+        {1.51836068712460E-07, 1.11362553803933E-07, 1.55375052233052E-07, 1.94450910788747E-09, -1.73093755828342E-08},
+        {-3.77758211813121E-09, 1.23323969583610E-08, 1.72510045250302E-09, -1.88609789458597E-09,
+         1.28937597985937E-09},
+        {-1.07947760393523E-09, 5.26051570105365E-10, -3.67657536332496E-11, 3.16110123523840E-10,
+         -3.24273198242170E-10},
+        {-2.00385649209820E-12, 2.54703869682390E-11, 4.08563622440851E-12, -4.83350348928636E-11,
+         -3.98153443845079E-13},
+        {2.73094467727215E-12, 5.08900664114903E-12, -7.66669089075134E-13, 2.50015592643012E-12, 4.29763262853853E-12},
+        {6.53946487537890E-13, -2.24958413781008E-13, 6.74638861781238E-15, 3.28537647613903E-14, 2.54199700290116E-13},
+        {-1.09122051193505E-13, 8.36362392931501E-14, -3.90750153912300E-14, -5.44915910741950E-14,
+         2.43816947219217E-14},
+        {-1.41882561550134E-14, 1.00455397812713E-14, 2.63347255121581E-15, 1.53043256823601E-15, 2.49081021428095E-15},
+        {-1.17256193152654E-15, 1.05648985031971E-16, 1.31778372453016E-16, 1.44815198666577E-16,
+         -3.72532768618480E-16},
+        {2.66203457773766E-16, -7.67224608659658E-17, 3.51487351031864E-18, 4.10287131339291E-17, -6.72171711728514E-17}
+    }
+};
+
+}  // namespace navp::sensors::gnss::details
@@ -0,0 +1,152 @@
+#include "io/rtcm/epoch_assembler.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "utils/logger.hpp"
+
+using navp::sensors::gnss::GnssObsRecord;
+using navp::sensors::gnss::Navigation;
+
+namespace navp::io::rtcm {
+
+namespace {
+
+// move the staged ephemerides into `to`, a later broadcast of the same toe replaces the former
+template <typename EphMap>
+void hand_over(EphMap& from, EphMap& to) noexcept {
+  for (auto& [sv, types] : from) {
+    for (auto& [type, ephs] : types) {
+      auto& target = to[sv][type];
+      for (auto& [toe, eph] : ephs) target.insert_or_assign(toe, std::move(eph));
+    }
+  }
+  from.clear();
+}
+
+}  // namespace
+
+EpochAssembler::EpochAssembler(const EpochAssemblerOptions& options) : options_(options), staging_(nullptr) {
+  std::memset(staging_.glo_fcn_, 0, sizeof(staging_.glo_fcn_));
+  decoder_.set_observation(&staging_).set_navigation(&staged_nav_).set_callback([this](const Rtcm3Message& message) {
+    on_message(message);
+  });
+}
+
+EpochAssembler::~EpochAssembler() = default;
+
+size_t EpochAssembler::decode(std::span<const u8> frames, Clock::time_point now) noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (closed_) return 0;
+  now_ = now;
+  return decoder_.decode(frames);  // the messages come back through `on_message`
+}
+
+void EpochAssembler::on_message(const Rtcm3Message& message) noexcept {
+  if (!message.is_msm()) return;
+  EpochUtc epoch(message.time);
+  // late data, the epoch was released or the stream went on to a later one
+  if ((last_released_ && epoch <= *last_released_) || (partial_ && epoch < partial_->epoch)) {
+    staging_.obs_map_.erase(epoch);
+    ++statistics_.late;
+    nav_warn_limited(message.station, "Station {} msm {} of {} arrived after its epoch was released, dropped",
+                     message.station, message.type, epoch);
+    return;
+  }
+  // the first msm of the next epoch, the partial one will not be completed anymore
+  if (partial_ && partial_->epoch < epoch) release(false, now_);
+  if (!partial_) partial_ = PartialEpoch{.epoch = epoch, .first = now_};
+  ++partial_->messages;
+  if (message.is_epoch_end()) release(true, now_);
+}
+
+void EpochAssembler::release(bool complete, Clock::time_point now) noexcept {
+  auto node = staging_.obs_map_.extract(partial_->epoch);
+  auto latency = std::chrono::duration<f64>(now - partial_->first).count();
+  AssembledEpoch epoch{.epoch = partial_->epoch,
+                       .obs_map = node ? std::move(node.mapped()) : GnssObsRecord::ObsMap{},
+                       .messages = partial_->messages,
+                       .complete = complete,
+                       .latency = latency};
+  if (!complete) {
+    nav_debug("Epoch {} released incomplete after {} msm and {:.3f} s", epoch.epoch, epoch.messages, latency);
+  }
+  // counters
+  ++(complete ? statistics_.complete : statistics_.incomplete);
+  total_latency_ += latency;
+  statistics_.last_latency = latency;
+  statistics_.max_latency = std::max(statistics_.max_latency, latency);
+  statistics_.mean_latency = total_latency_ / static_cast<f64>(statistics_.complete + statistics_.incomplete);
+  // hand over, the oldest epoch is dropped if the solution falls behind
+  last_released_ = partial_->epoch;
+  partial_.reset();
+  released_.push_back(std::move(epoch));
+  if (released_.size() > options_.capacity) released_.pop_front(), ++statistics_.overflows;
+  released_cv_.notify_all();
+}
+
+bool EpochAssembler::poll(Clock::time_point now) noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!partial_ || now - partial_->first < options_.deadline) return false;
+  release(false, now);
+  return true;
+}
+
+auto EpochAssembler::next() noexcept -> std::optional<AssembledEpoch> {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (released_.empty()) return std::nullopt;
+  auto epoch = std::move(released_.front());
+  released_.pop_front();
+  return epoch;
+}
+
+bool EpochAssembler::load_next(GnssObsRecord& record, Navigation* nav) noexcept {
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto until = options_.max_wait.count() > 0 ? Clock::now() + options_.max_wait : Clock::time_point::max();
+  while (released_.empty()) {
+    // the deadline of the partial epoch is kept here, the stream may be silent
+    auto now = Clock::now();
+    if (partial_ && now - partial_->first >= options_.deadline) {
+      release(false, now);
+      break;
+    }
+    if (closed_ || now >= until) return false;
+    auto wake = partial_ ? std::min(until, partial_->first + options_.deadline) : until;
+    if (wake == Clock::time_point::max()) {
+      released_cv_.wait(lock);
+    } else {
+      released_cv_.wait_until(lock, wake);
+    }
+  }
+  auto& epoch = released_.front();
+  record.obs_map_.insert_or_assign(epoch.epoch, std::move(epoch.obs_map));
+  record.trim_storage();
+  released_.pop_front();
+  // codes and glonass channels met so far, ephemerides decoded since the last load
+  for (auto& [system, codes] : staging_.code_map_) record.code_map_[system].insert(codes.begin(), codes.end());
+  for (size_t i = 0; i < sizeof(record.glo_fcn_); ++i) {
+    if (staging_.glo_fcn_[i] != 0) record.glo_fcn_[i] = staging_.glo_fcn_[i];
+  }
+  if (nav) hand_over(staged_nav_.ephMap, nav->ephMap), hand_over(staged_nav_.gephMap, nav->gephMap);
+  return true;
+}
+
+void EpochAssembler::close() noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (closed_) return;
+  closed_ = true;
+  if (partial_) release(false, Clock::now());
+  released_cv_.notify_all();
+}
+
+bool EpochAssembler::closed() const noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return closed_;
+}
+
+auto EpochAssembler::statistics() const noexcept -> AssemblyStatistics {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return statistics_;
+}
+
+}  // namespace navp::io::rtcm
@@ -0,0 +1,587 @@
+#include "io/ntrip/ntrip.hpp"
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <queue>
+
+#include "io/rtcm/rtcm3.hpp"
+#include "utils/logger.hpp"
+
+using navp::io::rtcm::crc24q;
+using navp::io::rtcm::Rtcm3Decoder;
+
+namespace navp::io::ntrip {
+
+namespace {
+
+constexpr i32 MaxEvents = 256;
+constexpr size_t MaxResponse = 4096;  // bytes of a caster response before the data
+
+auto base64(std::string_view text) -> std::string {
+  constexpr char Table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string result;
+  result.reserve((text.size() + 2) / 3 * 4);
+  for (size_t i = 0; i < text.size(); i += 3) {
+    u32 bits = static_cast<u8>(text[i]) << 16;
+    if (i + 1 < text.size()) bits |= static_cast<u8>(text[i + 1]) << 8;
+    if (i + 2 < text.size()) bits |= static_cast<u8>(text[i + 2]);
+    result.push_back(Table[bits >> 18 & 0x3F]);
+    result.push_back(Table[bits >> 12 & 0x3F]);
+    result.push_back(i + 1 < text.size() ? Table[bits >> 6 & 0x3F] : '=');
+    result.push_back(i + 2 < text.size() ? Table[bits & 0x3F] : '=');
+  }
+  return result;
+}
+
+// ntrip 1.0 request, answered by "ICY 200 OK" and the data
+auto ntrip_request(const StreamEndpoint& endpoint, std::string_view user_agent) -> std::string {
+  auto request = std::format("GET /{} HTTP/1.0\r\nUser-Agent: {}\r\nAccept: */*\r\n", endpoint.mountpoint, user_agent);
+  if (!endpoint.user.empty()) {
+    std::format_to(std::back_inserter(request), "Authorization: Basic {}\r\n",
+                   base64(std::format("{}:{}", endpoint.user, endpoint.password)));
+  }
+  request += "Connection: close\r\n\r\n";
+  return request;
+}
+
+void close_fd(i32& fd) noexcept {
+  if (fd >= 0) ::close(fd);
+  fd = -1;
+}
+
+void wake(i32 event_fd) noexcept {
+  u64 one = 1;
+  [[maybe_unused]] auto written = ::write(event_fd, &one, sizeof(one));
+}
+
+// ipv4 address of a host name or a numeric address, network byte order
+auto resolve(const StreamEndpoint& endpoint) -> u32 {
+  addrinfo hints{.ai_flags = AI_NUMERICSERV, .ai_family = AF_INET, .ai_socktype = SOCK_STREAM};
+  addrinfo* address = nullptr;
+  auto port = std::to_string(endpoint.port);
+  if (auto status = ::getaddrinfo(endpoint.host.c_str(), port.c_str(), &hints, &address); status != 0) {
+    throw NtripRuntimeError(std::format("Can't resolve the host \"{}\", {}", endpoint.host, ::gai_strerror(status)));
+  }
+  auto result = reinterpret_cast<const sockaddr_in*>(address->ai_addr)->sin_addr.s_addr;
+  ::freeaddrinfo(address);
+  return result;
+}
+
+i64 nanoseconds(SteadyClock::duration duration) noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+
+}  // namespace
+
+auto StreamEndpoint::from_str(std::string_view url) -> StreamEndpoint {
+  StreamEndpoint endpoint;
+  if (auto at = url.rfind('@'); at != std::string_view::npos) {
+    auto credentials = url.substr(0, at);
+    auto colon = credentials.find(':');
+    endpoint.user = credentials.substr(0, colon);
+    if (colon != std::string_view::npos) endpoint.password = credentials.substr(colon + 1);
+    url.remove_prefix(at + 1);
+  }
+  if (auto slash = url.find('/'); slash != std::string_view::npos) {
+    endpoint.mountpoint = url.substr(slash + 1);
+    url = url.substr(0, slash);
+  }
+  if (auto colon = url.find(':'); colon != std::string_view::npos) {
+    auto port = url.substr(colon + 1);
+    auto [end, ec] = std::from_chars(port.data(), port.data() + port.size(), endpoint.port);
+    if (ec != std::errc() || end != port.data() + port.size() || endpoint.port == 0) {
+      throw NtripRuntimeError(std::format("Invalid port \"{}\" of the stream \"{}\"", port, url));
+    }
+    url = url.substr(0, colon);
+  }
+  if (!url.empty()) endpoint.host = url;
+  return endpoint;
+}
+
+/*
+ * ingestion loop
+ */
+
+struct IngestionLoop::Worker {
+  i32 epoll_fd = -1, event_fd = -1;
+  std::thread thread;
+  std::vector<Stream*> streams;  // streams of the loop
+  std::mutex mutex;              // guards `pending`
+  std::vector<Stream*> pending;  // streams added and not connected yet
+
+  // reconnections, the earliest first
+  using Reconnect = std::pair<SteadyClock::time_point, Stream*>;
+  std::priority_queue<Reconnect, std::vector<Reconnect>, std::greater<>> reconnects;
+
+  ~Worker() {
+    close_fd(epoll_fd);
+    close_fd(event_fd);
+  }
+};
+
+IngestionLoop::IngestionLoop(const IngestionOptions& options) : options_(options) {
+  for (u32 i = 0; i < std::max(options_.threads, 1u); ++i) {
+    auto worker = std::make_unique<Worker>();
+    worker->epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+    worker->event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    epoll_event event{.events = EPOLLIN, .data = {.ptr = nullptr}};
+    if (worker->epoll_fd < 0 || worker->event_fd < 0 ||
+        ::epoll_ctl(worker->epoll_fd, EPOLL_CTL_ADD, worker->event_fd, &event) < 0) {
+      throw NtripRuntimeError(std::format("Can't create the event loop, {}", std::strerror(errno)));
+    }
+    workers_.emplace_back(std::move(worker));
+  }
+}
+
+IngestionLoop::~IngestionLoop() { stop(); }
+
+auto IngestionLoop::add_stream(const StreamEndpoint& endpoint, FrameHandler handler) -> StreamId {
+  auto stream = std::make_unique<Stream>();
+  stream->endpoint = endpoint;
+  stream->handler = std::move(handler);
+  if (!endpoint.mountpoint.empty()) stream->request = ntrip_request(endpoint, options_.user_agent);
+  stream->address = resolve(endpoint);
+  stream->buffer = std::make_unique<u8[]>(BufferSize);
+  stream->backoff = options_.min_backoff;
+
+  Stream* added;
+  {
+    std::lock_guard lock(mutex_);
+    stream->id = static_cast<StreamId>(streams_.size());
+    added = streams_.emplace_back(std::move(stream)).get();
+  }
+  auto& worker = *workers_[added->id % workers_.size()];
+  {
+    std::lock_guard lock(worker.mutex);
+    worker.pending.push_back(added);
+  }
+  wake(worker.event_fd);
+  return added->id;
+}
+
+void IngestionLoop::start() {
+  if (running_.exchange(true)) return;
+  for (auto& worker : workers_) {
+    worker->thread = std::thread([this, &worker = *worker] { run(worker); });
+  }
+}
+
+void IngestionLoop::stop() noexcept {
+  if (!running_.exchange(false)) return;
+  for (auto& worker : workers_) {
+    wake(worker->event_fd);
+    if (worker->thread.joinable()) worker->thread.join();
+  }
+}
+
+auto IngestionLoop::statistics(StreamId id) const -> StreamStatistics {
+  std::lock_guard lock(mutex_);
+  if (id >= streams_.size()) throw NtripRuntimeError(std::format("No stream of id {}", id));
+  const auto& stream = *streams_[id];
+  auto reads = stream.reads.load(std::memory_order_relaxed);
+  return StreamStatistics{
+      .state = stream.state.load(std::memory_order_relaxed),
+      .bytes = stream.bytes.load(std::memory_order_relaxed),
+      .frames = stream.frames.load(std::memory_order_relaxed),
+      .dropped_bytes = stream.dropped_bytes.load(std::memory_order_relaxed),
+      .connects = stream.connects.load(std::memory_order_relaxed),
+      .failures = stream.failures.load(std::memory_order_relaxed),
+      .last_latency = stream.last_latency.load(std::memory_order_relaxed) * 1e-9,
+      .max_latency = stream.max_latency.load(std::memory_order_relaxed) * 1e-9,
+      .mean_latency = reads ? stream.total_latency.load(std::memory_order_relaxed) * 1e-9 / reads : 0.0,
+  };
+}
+
+size_t IngestionLoop::streams() const noexcept {
+  std::lock_guard lock(mutex_);
+  return streams_.size();
+}
+
+void IngestionLoop::run(Worker& worker) noexcept {
+  epoll_event events[MaxEvents];
+  auto next_check = SteadyClock::now();
+  while (running_.load(std::memory_order_acquire)) {
+    // streams added since the last wake
+    {
+      std::lock_guard lock(worker.mutex);
+      for (auto stream : worker.pending) {
+        worker.streams.push_back(stream);
+        connect(worker, *stream);
+      }
+      worker.pending.clear();
+    }
+
+    // sleep until the next reconnection or silence check
+    auto now = SteadyClock::now();
+    auto deadline = next_check;
+    if (!worker.reconnects.empty()) deadline = std::min(deadline, worker.reconnects.top().first);
+    auto timeout = std::max<i64>(std::chrono::ceil<std::chrono::milliseconds>(deadline - now).count(), 0);
+    auto count = ::epoll_wait(worker.epoll_fd, events, MaxEvents, static_cast<i32>(timeout));
+    if (count < 0 && errno != EINTR) {
+      nav_error("Ingestion loop stops, {}", std::strerror(errno));
+      break;
+    }
+
+    auto ready = SteadyClock::now();
+    for (i32 i = 0; i < count; ++i) {
+      auto stream = static_cast<Stream*>(events[i].data.ptr);
+      if (!stream) {
+        u64 value;
+        [[maybe_unused]] auto read = ::read(worker.event_fd, &value, sizeof(value));
+        continue;
+      }
+      if (stream->state.load(std::memory_order_relaxed) == StreamStateEnum::CONNECTING) {
+        on_connected(worker, *stream);
+      } else if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+        on_readable(worker, *stream, ready);
+      }
+    }
+
+    // reconnections due
+    now = SteadyClock::now();
+    while (!worker.reconnects.empty() && worker.reconnects.top().first <= now) {
+      auto stream = worker.reconnects.top().second;
+      worker.reconnects.pop();
+      connect(worker, *stream);
+    }
+
+    // silent connections
+    if (now >= next_check) {
+      for (auto stream : worker.streams) {
+        if (stream->fd >= 0 && now - stream->last_activity > options_.timeout) {
+          fail(worker, *stream, "no data received");
+        }
+      }
+      next_check = now + std::min<SteadyClock::duration>(options_.timeout, std::chrono::seconds(1));
+    }
+  }
+
+  for (auto stream : worker.streams) {
+    close_fd(stream->fd);
+    stream->state.store(StreamStateEnum::WAITING, std::memory_order_relaxed);
+  }
+}
+
+// the address resolved by `add_stream`, the connection does not block
+void IngestionLoop::connect(Worker& worker, Stream& stream) noexcept {
+  stream.size = 0;
+  stream.last_activity = SteadyClock::now();
+  stream.state.store(StreamStateEnum::CONNECTING, std::memory_order_relaxed);
+
+  sockaddr_in address{
+      .sin_family = AF_INET, .sin_port = htons(stream.endpoint.port), .sin_addr = {.s_addr = stream.address}};
+  stream.fd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  i32 status = stream.fd < 0 ? -1 : ::connect(stream.fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+  if (status < 0 && errno != EINPROGRESS) {
+    fail(worker, stream, std::strerror(errno));
+    return;
+  }
+  i32 no_delay = 1;
+  ::setsockopt(stream.fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+  epoll_event event{.events = EPOLLOUT | EPOLLIN, .data = {.ptr = &stream}};
+  if (::epoll_ctl(worker.epoll_fd, EPOLL_CTL_ADD, stream.fd, &event) < 0) {
+    fail(worker, stream, std::strerror(errno));
+  }
+}
+
+void IngestionLoop::fail(Worker& worker, Stream& stream, std::string_view reason) noexcept {
+  nav_warn_limited(stream.id, "Stream {}:{}/{} fails, {}, reconnect in {} ms", stream.endpoint.host,
+                   stream.endpoint.port, stream.endpoint.mountpoint, reason, stream.backoff.count());
+  close_fd(stream.fd);  // removed from the epoll by closing
+  stream.failures.fetch_add(1, std::memory_order_relaxed);
+  stream.state.store(StreamStateEnum::WAITING, std::memory_order_relaxed);
+  worker.reconnects.emplace(SteadyClock::now() + stream.backoff, &stream);
+  stream.backoff = std::min(stream.backoff * 2, options_.max_backoff);
+}
+
+void IngestionLoop::on_connected(Worker& worker, Stream& stream) noexcept {
+  i32 error = 0;
+  socklen_t length = sizeof(error);
+  if (::getsockopt(stream.fd, SOL_SOCKET, SO_ERROR, &error, &length) < 0 || error != 0) {
+    fail(worker, stream, std::strerror(error ? error : errno));
+    return;
+  }
+  epoll_event event{.events = EPOLLIN, .data = {.ptr = &stream}};
+  ::epoll_ctl(worker.epoll_fd, EPOLL_CTL_MOD, stream.fd, &event);
+  stream.last_activity = SteadyClock::now();
+  if (stream.request.empty()) {
+    stream.connects.fetch_add(1, std::memory_order_relaxed);
+    stream.state.store(StreamStateEnum::STREAMING, std::memory_order_relaxed);
+    return;
+  }
+  // a request of a few hundred bytes fits the empty send buffer of a new connection
+  auto sent = ::send(stream.fd, stream.request.data(), stream.request.size(), MSG_NOSIGNAL);
+  if (sent != static_cast<ssize_t>(stream.request.size())) {
+    fail(worker, stream, "the request can't be sent");
+    return;
+  }
+  stream.state.store(StreamStateEnum::REQUESTING, std::memory_order_relaxed);
+}
+
+void IngestionLoop::on_readable(Worker& worker, Stream& stream, SteadyClock::time_point ready) noexcept {
+  auto received = ::recv(stream.fd, stream.buffer.get() + stream.size, BufferSize - stream.size, 0);
+  if (received < 0 && (errno == EAGAIN || errno == EINTR)) return;
+  if (received <= 0) {
+    fail(worker, stream, received == 0 ? "connection closed" : std::strerror(errno));
+    return;
+  }
+  stream.size += static_cast<size_t>(received);
+  stream.last_activity = SteadyClock::now();
+  stream.bytes.fetch_add(static_cast<u64>(received), std::memory_order_relaxed);
+  if (stream.state.load(std::memory_order_relaxed) == StreamStateEnum::REQUESTING && !accept_response(worker, stream)) {
+    return;
+  }
+
+  deliver(stream);
+  auto latency = nanoseconds(SteadyClock::now() - ready);
+  stream.reads.fetch_add(1, std::memory_order_relaxed);
+  stream.last_latency.store(latency, std::memory_order_relaxed);
+  stream.total_latency.fetch_add(latency, std::memory_order_relaxed);
+  if (latency > stream.max_latency.load(std::memory_order_relaxed)) {
+    stream.max_latency.store(latency, std::memory_order_relaxed);
+  }
+}
+
+bool IngestionLoop::accept_response(Worker& worker, Stream& stream) noexcept {
+  std::string_view response(reinterpret_cast<const char*>(stream.buffer.get()), stream.size);
+  auto line_end = response.find("\r\n");
+  if (line_end == std::string_view::npos) {
+    if (stream.size > MaxResponse) fail(worker, stream, "invalid response");
+    return false;
+  }
+
+  // "ICY 200 OK" of ntrip 1.0, or the headers of a http response
+  size_t data = 0;
+  if (response.starts_with("ICY 200 OK")) {
+    data = line_end + 2;
+  } else if (response.starts_with("HTTP/1.") && response.substr(8, 5) == " 200 ") {
+    auto headers_end = response.find("\r\n\r\n");
+    if (headers_end == std::string_view::npos) {
+      if (stream.size > MaxResponse) fail(worker, stream, "invalid response");
+      return false;
+    }
+    data = headers_end + 4;
+  } else {
+    fail(worker, stream, std::format("refused by \"{}\"", response.substr(0, line_end)));
+    return false;
+  }
+
+  stream.size -= data;
+  std::memmove(stream.buffer.get(), stream.buffer.get() + data, stream.size);
+  stream.connects.fetch_add(1, std::memory_order_relaxed);
+  stream.state.store(StreamStateEnum::STREAMING, std::memory_order_relaxed);
+  return true;
+}
+
+void IngestionLoop::deliver(Stream& stream) noexcept {
+  auto buffer = stream.buffer.get();
+  size_t pos = 0, begin = 0, frames = 0, dropped = 0;
+  auto hand_over = [&] {
+    if (pos > begin) stream.handler(std::span<const u8>(buffer + begin, pos - begin));
+  };
+  while (pos < stream.size) {
+    // the frames of a run are contiguous
+    auto size = stream.size - pos < Rtcm3Decoder::HeaderSize ? 0 : Rtcm3Decoder::frame_size(buffer + pos);
+    if (size != 0 && stream.size - pos < size) break;  // a frame split across reads
+    if (size != 0) {
+      auto end = pos + size - Rtcm3Decoder::CrcSize;
+      auto crc = static_cast<u32>(buffer[end]) << 16 | static_cast<u32>(buffer[end + 1]) << 8 | buffer[end + 2];
+      if (crc24q(std::span<const u8>(buffer + pos, end - pos)) == crc) {
+        pos += size, ++frames;
+        continue;
+      }
+    } else if (stream.size - pos < Rtcm3Decoder::HeaderSize && buffer[pos] == Rtcm3Decoder::Preamble) {
+      break;  // a header split across reads
+    }
+    // bytes out of frames, up to the next preamble
+    hand_over();
+    auto next = static_cast<const u8*>(std::memchr(buffer + pos + 1, Rtcm3Decoder::Preamble, stream.size - pos - 1));
+    auto skip = next ? static_cast<size_t>(next - buffer) : stream.size;
+    dropped += skip - pos;
+    pos = begin = skip;
+  }
+  hand_over();
+
+  stream.frames.fetch_add(frames, std::memory_order_relaxed);
+  if (dropped) stream.dropped_bytes.fetch_add(dropped, std::memory_order_relaxed);
+  if (frames) stream.backoff = options_.min_backoff;
+  stream.size -= pos;
+  std::memmove(buffer, buffer + pos, stream.size);
+}
+
+/*
+ * local caster
+ */
+
+LocalCaster::LocalCaster() {
+  listen_fd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  sockaddr_in address{.sin_family = AF_INET, .sin_port = 0, .sin_addr = {.s_addr = htonl(INADDR_LOOPBACK)}};
+  socklen_t length = sizeof(address);
+  epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+  event_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  epoll_event listen_event{.events = EPOLLIN, .data = {.ptr = &listen_fd_}};
+  epoll_event wake_event{.events = EPOLLIN, .data = {.ptr = &event_fd_}};
+  if (listen_fd_ < 0 || epoll_fd_ < 0 || event_fd_ < 0 ||
+      ::bind(listen_fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 ||
+      ::listen(listen_fd_, SOMAXCONN) < 0 ||
+      ::getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&address), &length) < 0 ||
+      ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, listen_fd_, &listen_event) < 0 ||
+      ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, event_fd_, &wake_event) < 0) {
+    auto error = std::strerror(errno);
+    close_fd(listen_fd_), close_fd(epoll_fd_), close_fd(event_fd_);
+    throw NtripRuntimeError(std::format("Can't listen on the loopback, {}", error));
+  }
+  port_ = ntohs(address.sin_port);
+}
+
+LocalCaster::~LocalCaster() {
+  stop();
+  close_fd(listen_fd_), close_fd(epoll_fd_), close_fd(event_fd_);
+}
+
+LocalCaster& LocalCaster::add_mountpoint(std::string_view name, std::string_view filename, size_t chunk,
+                                         std::chrono::milliseconds interval, bool repeat) {
+  std::ifstream file(std::string(filename), std::ios::binary);
+  if (!file.is_open()) {
+    throw NtripRuntimeError(std::format("Can't open the file \"{}\" of the mountpoint \"{}\"", filename, name));
+  }
+  mountpoints_.push_back(Mountpoint{.name = std::string(name),
+                                    .data = std::vector<u8>(std::istreambuf_iterator<char>(file), {}),
+                                    .chunk = std::max<size_t>(chunk, 1),
+                                    .interval = interval,
+                                    .repeat = repeat});
+  return *this;
+}
+
+void LocalCaster::start() {
+  if (running_.exchange(true)) return;
+  thread_ = std::thread([this] { run(); });
+}
+
+void LocalCaster::stop() noexcept {
+  if (!running_.exchange(false)) return;
+  wake(event_fd_);
+  if (thread_.joinable()) thread_.join();
+}
+
+void LocalCaster::disconnect_all() noexcept {
+  disconnect_.store(true, std::memory_order_release);
+  wake(event_fd_);
+}
+
+void LocalCaster::run() noexcept {
+  std::vector<std::unique_ptr<Client>> clients;
+  epoll_event events[MaxEvents];
+  auto drop = [&](Client& client) { close_fd(client.fd); };
+
+  while (running_.load(std::memory_order_acquire)) {
+    // sleep until a chunk is due
+    auto now = SteadyClock::now();
+    i64 timeout = -1;
+    for (const auto& client : clients) {
+      if (client->fd < 0 || !client->mountpoint) continue;
+      auto wait = std::chrono::ceil<std::chrono::milliseconds>(client->next - now).count();
+      timeout = timeout < 0 ? std::max<i64>(wait, 0) : std::clamp<i64>(wait, 0, timeout);
+    }
+    auto count = ::epoll_wait(epoll_fd_, events, MaxEvents, static_cast<i32>(timeout));
+    for (i32 i = 0; i < count; ++i) {
+      if (events[i].data.ptr == &event_fd_) {
+        u64 value;
+        [[maybe_unused]] auto read = ::read(event_fd_, &value, sizeof(value));
+      } else if (events[i].data.ptr == &listen_fd_) {
+        while (true) {
+          auto fd = ::accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+          if (fd < 0) break;
+          auto& client = clients.emplace_back(std::make_unique<Client>(Client{.fd = fd}));
+          epoll_event event{.events = EPOLLIN, .data = {.ptr = client.get()}};
+          ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event);
+        }
+      } else {
+        on_request(*static_cast<Client*>(events[i].data.ptr));
+      }
+    }
+    if (disconnect_.exchange(false, std::memory_order_acquire)) {
+      std::ranges::for_each(clients, [&](auto& client) { drop(*client); });
+    }
+
+    // chunks due, a full socket buffer is retried with the next chunk
+    now = SteadyClock::now();
+    for (auto& client : clients) {
+      if (client->fd < 0 || !client->mountpoint || client->next > now) continue;
+      const auto& mountpoint = *client->mountpoint;
+      auto size = std::min(mountpoint.chunk, mountpoint.data.size() - client->offset);
+      auto sent = ::send(client->fd, mountpoint.data.data() + client->offset, size, MSG_NOSIGNAL);
+      if (sent < 0 && errno != EAGAIN) {
+        drop(*client);
+        continue;
+      }
+      client->offset += static_cast<size_t>(std::max<ssize_t>(sent, 0));
+      client->next = now + (sent < 0 ? std::chrono::milliseconds(1) : mountpoint.interval);
+      if (client->offset == mountpoint.data.size()) {
+        if (mountpoint.repeat) {
+          client->offset = 0;
+        } else {
+          drop(*client);
+        }
+      }
+    }
+    std::erase_if(clients, [](const auto& client) { return client->fd < 0; });
+  }
+
+  std::ranges::for_each(clients, [&](auto& client) { drop(*client); });
+}
+
+void LocalCaster::on_request(Client& client) noexcept {
+  char buffer[1024];
+  auto received = ::recv(client.fd, buffer, sizeof(buffer), 0);
+  if (received <= 0 || client.mountpoint) {
+    // closed by the client, bytes after the request are ignored
+    if (received == 0 || (received < 0 && errno != EAGAIN)) close_fd(client.fd);
+    return;
+  }
+  client.request.append(buffer, static_cast<size_t>(received));
+  auto end = client.request.find("\r\n\r\n");
+  if (end == std::string::npos) {
+    if (client.request.size() > MaxResponse) close_fd(client.fd);
+    return;
+  }
+
+  // "GET /mountpoint HTTP/1.x"
+  std::string_view request(client.request);
+  std::string_view name;
+  if (request.starts_with("GET /")) {
+    auto path = request.substr(5);
+    name = path.substr(0, path.find(' '));
+  }
+  auto mountpoint = std::ranges::find(mountpoints_, name, &Mountpoint::name);
+  if (mountpoint == mountpoints_.end()) {
+    constexpr std::string_view NotFound = "HTTP/1.0 404 Not Found\r\n\r\n";
+    [[maybe_unused]] auto sent = ::send(client.fd, NotFound.data(), NotFound.size(), MSG_NOSIGNAL);
+    close_fd(client.fd);
+    return;
+  }
+  constexpr std::string_view Ok = "ICY 200 OK\r\n";
+  if (::send(client.fd, Ok.data(), Ok.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(Ok.size())) {
+    close_fd(client.fd);
+    return;
+  }
+  client.mountpoint = &*mountpoint;
+  client.next = SteadyClock::now();
+  clients_.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace navp::io::ntrip
@@ -0,0 +1,799 @@
+#include "io/rtcm/rtcm3.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "sensors/gnss/constants.hpp"
+#include "sensors/gnss/navigation.hpp"
+#include "sensors/gnss/observation.hpp"
+#include "utils/logger.hpp"
+
+using navp::sensors::gnss::Constants;
+using navp::sensors::gnss::Eph;
+using navp::sensors::gnss::FreTypeEnum;
+using navp::sensors::gnss::Geph;
+using navp::sensors::gnss::GnssObsRecord;
+using navp::sensors::gnss::GObs;
+using navp::sensors::gnss::NavMsgTypeEnum;
+using navp::sensors::gnss::Navigation;
+using navp::sensors::gnss::ObsCodeEnum;
+using navp::sensors::gnss::Sig;
+using navp::sensors::gnss::Sv;
+using navp::sensors::gnss::SvhEnum;
+using navp::utils::BTow;
+using navp::utils::BWeek;
+using navp::utils::GTime;
+using navp::utils::GTow;
+using navp::utils::GWeek;
+using navp::utils::RTod;
+
+namespace navp::io::rtcm {
+
+namespace {
+
+// 2^-n
+constexpr f64 p2(i32 n) noexcept {
+  f64 value = 1.0;
+  for (i32 i = 0; i < n; ++i) value *= 0.5;
+  return value;
+}
+
+constexpr f64 SC2RAD = 3.1415926535898;  // semi-circle to radian of the gps icd
+constexpr f64 RangeMs = Constants::CLIGHT * 1e-3;
+constexpr f64 GloG1Step = 0.5625e6, GloG2Step = 0.4375e6;  // glonass fdma frequency steps (Hz)
+constexpr i8 UnknownChannel = -128;
+
+constexpr auto crc24q_table = [] {
+  std::array<u32, 256> table{};
+  for (u32 i = 0; i < 256; ++i) {
+    u32 crc = i << 16;
+    for (i32 j = 0; j < 8; ++j) {
+      crc <<= 1;
+      if (crc & 0x1000000) crc ^= 0x1864CFB;
+    }
+    table[i] = crc & 0xFFFFFF;
+  }
+  return table;
+}();
+
+// big endian bits of a payload, at most 32 bits a field
+struct BitReader {
+  const u8* data;
+  u32 pos = 0;
+
+  u32 u(u32 len) noexcept {
+    u64 bits = 0;
+    for (u32 i = pos >> 3, last = (pos + len - 1) >> 3; i <= last; ++i) bits = (bits << 8) | data[i];
+    bits >>= 7 - ((pos + len - 1) & 7);
+    pos += len;
+    return static_cast<u32>(bits & ((1ull << len) - 1));
+  }
+
+  // two's complement
+  i32 s(u32 len) noexcept { return static_cast<i32>(u(len) << (32 - len)) >> (32 - len); }
+
+  // sign and magnitude, glonass
+  f64 g(u32 len) noexcept {
+    auto value = u(len);
+    auto magnitude = static_cast<f64>(value & ((1u << (len - 1)) - 1));
+    return (value >> (len - 1)) ? -magnitude : magnitude;
+  }
+
+  // 38 bits two's complement, station coordinates
+  f64 s38() noexcept {
+    auto high = s(32);
+    return static_cast<f64>(high) * 64.0 + u(6);
+  }
+
+  void skip(u32 len) noexcept { pos += len; }
+};
+
+// observation codes of the msm signal ids 1-32, rtcm 10403.3 tables 3.5-91/96/99/105/108
+using SignalTable = std::array<ObsCodeEnum, 32>;
+
+constexpr SignalTable signal_table(std::initializer_list<std::pair<u8, ObsCodeEnum>> signals) {
+  SignalTable table{};
+  for (auto [id, code] : signals) table[id - 1] = code;
+  return table;
+}
+
+using enum ObsCodeEnum;
+constexpr SignalTable GpsSignals = signal_table({{2, L1C},  {3, L1P},  {4, L1W},  {8, L2C},  {9, L2P},  {10, L2W},
+                                                 {15, L2S}, {16, L2L}, {17, L2X}, {22, L5I}, {23, L5Q}, {24, L5X},
+                                                 {30, L1S}, {31, L1L}, {32, L1X}});
+constexpr SignalTable GloSignals = signal_table({{2, L1C}, {3, L1P}, {8, L2C}, {9, L2P}});
+constexpr SignalTable GalSignals =
+    signal_table({{2, L1C},  {3, L1A},  {4, L1B},  {5, L1X},  {6, L1Z},  {8, L6C},  {9, L6A},
+                  {10, L6B}, {11, L6X}, {12, L6Z}, {14, L7I}, {15, L7Q}, {16, L7X}, {18, L8I},
+                  {19, L8Q}, {20, L8X}, {22, L5I}, {23, L5Q}, {24, L5X}});
+constexpr SignalTable QzsSignals = signal_table({{2, L1C},  {9, L6S},  {10, L6L}, {11, L6X}, {15, L2S},
+                                                 {16, L2L}, {17, L2X}, {22, L5I}, {23, L5Q}, {24, L5X},
+                                                 {30, L1S}, {31, L1L}, {32, L1X}});
+constexpr SignalTable BdsSignals = signal_table({{2, L2I},  {3, L2Q},  {4, L2X},  {8, L6I},  {9, L6Q},  {10, L6X},
+                                                 {14, L7I}, {15, L7Q}, {16, L7X}, {22, L5D}, {23, L5P}, {24, L5X},
+                                                 {25, L7D}, {30, L1D}, {31, L1P}, {32, L1X}});
+
+FreTypeEnum code_frequency(ConstellationEnum system, ObsCodeEnum code) noexcept {
+  if (system == ConstellationEnum::GLO) return sensors::gnss::details::Code2Freq::glo_code_freq(code);
+  return Constants::code_to_freq_enum({.id = system}, code);
+}
+
+// lock time (ms) of the msm4/5 lock time indicator
+u32 lock_time(u32 indicator) noexcept { return indicator ? 1u << (indicator + 4) : 0; }
+
+// lock time (ms) of the msm6/7 extended lock time indicator
+u32 extended_lock_time(u32 indicator) noexcept {
+  if (indicator < 64) return indicator;
+  indicator = std::min(indicator, 704u);
+  u32 start = 64, value = 64, scale = 2;
+  while (indicator >= start + 32) value += scale * 32, start += 32, scale *= 2;
+  return value + scale * (indicator - start);
+}
+
+}  // namespace
+
+u32 crc24q(std::span<const u8> data) noexcept {
+  u32 crc = 0;
+  for (auto byte : data) crc = ((crc << 8) & 0xFFFFFF) ^ crc24q_table[(crc >> 16) ^ byte];
+  return crc;
+}
+
+Rtcm3Decoder::Rtcm3Decoder() noexcept : reference_(EpochUtc::now()) {
+  std::fill_n(glo_fcn_, MaxSatellites, UnknownChannel);
+}
+
+Rtcm3Decoder& Rtcm3Decoder::set_observation(GnssObsRecord* obs) noexcept {
+  obs_ = obs;
+  return *this;
+}
+
+Rtcm3Decoder& Rtcm3Decoder::set_navigation(Navigation* nav) noexcept {
+  nav_ = nav;
+  return *this;
+}
+
+Rtcm3Decoder& Rtcm3Decoder::set_reference_time(const GTime& time) noexcept {
+  reference_ = time;
+  return *this;
+}
+
+Rtcm3Decoder& Rtcm3Decoder::set_callback(Callback callback) noexcept {
+  callback_ = std::move(callback);
+  return *this;
+}
+
+size_t Rtcm3Decoder::frame_size(const u8* header) noexcept {
+  if (header[0] != Preamble || (header[1] & 0xFC)) return 0;
+  return HeaderSize + (static_cast<size_t>(header[1] & 0x03) << 8 | header[2]) + CrcSize;
+}
+
+size_t Rtcm3Decoder::decode(std::span<const u8> data) noexcept {
+  size_t decoded = 0;
+
+  // complete the frame kept from the last call
+  if (frame_size_ > 0) {
+    if (frame_size_ < HeaderSize) {
+      auto count = std::min(HeaderSize - frame_size_, data.size());
+      std::copy_n(data.begin(), count, frame_.begin() + frame_size_);
+      frame_size_ += count, data = data.subspan(count);
+      if (frame_size_ < HeaderSize) return 0;
+      if (frame_size(frame_.data()) == 0) {
+        // not a header, search the bytes after the preamble again
+        std::array<u8, HeaderSize> kept;
+        std::copy_n(frame_.begin(), HeaderSize, kept.begin());
+        frame_size_ = 0;
+        decoded += decode(std::span<const u8>(kept).subspan(1));
+        return decoded + decode(data);
+      }
+    }
+    auto size = frame_size(frame_.data());
+    auto count = std::min(size - frame_size_, data.size());
+    std::copy_n(data.begin(), count, frame_.begin() + frame_size_);
+    frame_size_ += count, data = data.subspan(count);
+    if (frame_size_ < size) return 0;
+    frame_size_ = 0;
+    decoded += decode_frame(std::span<const u8>(frame_.data(), size));
+  }
+
+  // frames decoded in place
+  size_t pos = 0;
+  while (pos < data.size()) {
+    auto preamble = static_cast<const u8*>(std::memchr(data.data() + pos, Preamble, data.size() - pos));
+    if (!preamble) return decoded;
+    pos = static_cast<size_t>(preamble - data.data());
+    if (data.size() - pos < HeaderSize) break;
+    auto size = frame_size(preamble);
+    if (size == 0) {
+      ++pos;
+      continue;
+    }
+    if (data.size() - pos < size) break;
+    auto crc_errors = crc_errors_;
+    if (decode_frame(data.subspan(pos, size))) {
+      ++decoded, pos += size;
+    } else {
+      pos += crc_errors == crc_errors_ ? size : 1;  // resynchronize after a bad crc
+    }
+  }
+
+  // keep the beginning of a frame
+  frame_size_ = data.size() - pos;
+  std::copy_n(data.begin() + pos, frame_size_, frame_.begin());
+  return decoded;
+}
+
+bool Rtcm3Decoder::decode_frame(std::span<const u8> frame) noexcept {
+  if (frame.size() < HeaderSize + CrcSize || frame_size(frame.data()) != frame.size()) return false;
+  auto size = frame.size() - CrcSize;
+  auto crc = static_cast<u32>(frame[size]) << 16 | static_cast<u32>(frame[size + 1]) << 8 | frame[size + 2];
+  if (crc24q(frame.first(size)) != crc) {
+    ++crc_errors_;
+    nav_warn_limited(0, "Rtcm3 frame of {} bytes fails the crc check", frame.size());
+    return false;
+  }
+
+  auto payload = frame.data() + HeaderSize;
+  auto length = size - HeaderSize;
+  if (length < 2) return false;
+  message_ = Rtcm3Message{.type = static_cast<u16>(BitReader{payload}.u(12))};
+  bool decoded = false;
+  switch (message_.type) {
+    case 1005:
+      [[fallthrough]];
+    case 1006: {
+      decoded = decode_station(payload, length);
+      break;
+    }
+    case 1019: {
+      decoded = decode_gps_ephemeris(payload, length);
+      break;
+    }
+    case 1020: {
+      decoded = decode_glo_ephemeris(payload, length);
+      break;
+    }
+    case 1042: {
+      decoded = decode_bds_ephemeris(payload, length);
+      break;
+    }
+    case 1044: {
+      decoded = decode_qzs_ephemeris(payload, length);
+      break;
+    }
+    case 1045:
+      [[fallthrough]];
+    case 1046: {
+      decoded = decode_gal_ephemeris(payload, length);
+      break;
+    }
+    default: {
+      decoded = message_.is_msm() && decode_msm(payload, length);
+    }
+  }
+  if (!decoded) return false;
+
+  ++messages_;
+  if (callback_) callback_(message_);
+  return true;
+}
+
+auto Rtcm3Decoder::msm_time(ConstellationEnum system, u32 epoch) const noexcept -> GTime {
+  // integer milliseconds, the msm of all constellations of an epoch meet at the same time
+  constexpr i64 WeekMs = 604800000, DayMs = 86400000;
+  auto reference = static_cast<i64>(GWeek(reference_).val) * WeekMs + std::llround(GTow(reference_).val * 1e3);
+  auto nearest = [reference](i64 time, i64 period) {
+    if (time - reference > period / 2) return time - period;
+    if (time - reference < -period / 2) return time + period;
+    return time;
+  };
+  i64 time = 0;
+  switch (system) {
+    case ConstellationEnum::GLO: {
+      // moscow time of day -> utc -> gpst
+      auto tod = static_cast<i64>(epoch & 0x7FFFFFF) - 10800000 + std::llround(utils::leapSeconds(reference_)) * 1000;
+      time = nearest(reference - reference % DayMs + tod, DayMs);
+      break;
+    }
+    case ConstellationEnum::BDS: {
+      time = nearest(reference - reference % WeekMs + epoch + 14000, WeekMs);
+      break;
+    }
+    default: {
+      time = nearest(reference - reference % WeekMs + epoch, WeekMs);
+    }
+  }
+  return GTime(GWeek(static_cast<i32>(time / WeekMs)), GTow(static_cast<f64>(time % WeekMs) * 1e-3));
+}
+
+bool Rtcm3Decoder::decode_msm(const u8* payload, size_t size) noexcept {
+  BitReader bits{payload};
+  auto type = bits.u(12);
+  auto msm = type % 10;
+  ConstellationEnum system;
+  u8 system_index;
+  const SignalTable* signals;
+  switch (type / 10) {
+    case 107: system = ConstellationEnum::GPS, system_index = 0, signals = &GpsSignals; break;
+    case 108: system = ConstellationEnum::GLO, system_index = 1, signals = &GloSignals; break;
+    case 109: system = ConstellationEnum::GAL, system_index = 2, signals = &GalSignals; break;
+    case 111: system = ConstellationEnum::QZS, system_index = 3, signals = &QzsSignals; break;
+    case 112: system = ConstellationEnum::BDS, system_index = 4, signals = &BdsSignals; break;
+    default: return false;
+  }
+
+  // header
+  constexpr u32 HeaderBits = 169;  // up to the signal mask
+  if (size * 8 < HeaderBits) return false;
+  message_.station = static_cast<u16>(bits.u(12));
+  auto epoch = bits.u(30);
+  message_.multiple = bits.u(1);
+  bits.skip(3 + 7 + 2 + 2 + 1 + 3);  // iods, reserved, clock steering, external clock, smoothing
+  u8 satellites[MaxSatellites], signal_ids[MaxSignals], nsat = 0, nsig = 0;
+  for (u8 i = 0; i < MaxSatellites; ++i) {
+    if (bits.u(1)) satellites[nsat++] = i + 1;
+  }
+  for (u8 i = 0; i < MaxSignals; ++i) {
+    if (bits.u(1)) signal_ids[nsig++] = i + 1;
+  }
+  if (nsat * nsig > 64 || HeaderBits + nsat * nsig > size * 8) {
+    nav_warn_limited(type, "Rtcm3 {} of {} satellites and {} signals is invalid", type, nsat, nsig);
+    return false;
+  }
+  bool cells[64];
+  u8 ncell = 0;
+  for (u8 i = 0; i < nsat * nsig; ++i) ncell += cells[i] = bits.u(1);
+
+  // msm4: 18/48, msm5: 36/63, msm6: 18/65, msm7: 36/80 bits a satellite/cell
+  bool extended = msm == 5 || msm == 7, high_resolution = msm >= 6;
+  u32 satellite_bits = extended ? 36 : 18;
+  u32 cell_bits = (high_resolution ? 65 : 48) + (extended ? 15 : 0);
+  if (bits.pos + nsat * satellite_bits + ncell * cell_bits > size * 8) {
+    nav_warn_limited(type, "Rtcm3 {} of {} bytes is too short", type, size);
+    return false;
+  }
+
+  // satellite data, rough ranges (ms) and rates (m/s)
+  f64 ranges[MaxSatellites], rates[MaxSatellites];
+  u8 infos[MaxSatellites];
+  for (u8 i = 0; i < nsat; ++i) {
+    auto range = bits.u(8);
+    ranges[i] = range == 255 ? 0.0 : range;
+  }
+  for (u8 i = 0; i < nsat; ++i) infos[i] = extended ? static_cast<u8>(bits.u(4)) : 15;
+  for (u8 i = 0; i < nsat; ++i) {
+    auto range = bits.u(10);
+    if (ranges[i] != 0.0) ranges[i] += range * p2(10);
+  }
+  for (u8 i = 0; i < nsat; ++i) {
+    auto rate = extended ? bits.s(14) : -8192;
+    rates[i] = rate == -8192 ? std::nan("") : rate;
+  }
+
+  // signal data, fine ranges (ms), rates (m/s), lock times (ms) and cnr (dB-Hz)
+  f64 pseudoranges[64], phases[64], phase_rates[64];
+  f32 cnrs[64];
+  u32 locks[64];
+  u32 range_bits = high_resolution ? 20 : 15, phase_bits = high_resolution ? 24 : 22;
+  f64 range_scale = high_resolution ? p2(29) : p2(24), phase_scale = high_resolution ? p2(31) : p2(29);
+  for (u8 k = 0; k < ncell; ++k) {
+    auto range = bits.s(range_bits);
+    pseudoranges[k] = range == -(1 << (range_bits - 1)) ? std::nan("") : range * range_scale;
+  }
+  for (u8 k = 0; k < ncell; ++k) {
+    auto phase = bits.s(phase_bits);
+    phases[k] = phase == -(1 << (phase_bits - 1)) ? std::nan("") : phase * phase_scale;
+  }
+  for (u8 k = 0; k < ncell; ++k) {
+    locks[k] = high_resolution ? extended_lock_time(bits.u(10)) : lock_time(bits.u(4));
+  }
+  bits.skip(ncell);  // half-cycle ambiguity indicators
+  for (u8 k = 0; k < ncell; ++k) {
+    cnrs[k] = high_resolution ? static_cast<f32>(bits.u(10) * 0.0625) : static_cast<f32>(bits.u(6));
+  }
+  for (u8 k = 0; k < ncell; ++k) {
+    auto rate = extended ? bits.s(15) : -16384;
+    phase_rates[k] = rate == -16384 ? std::nan("") : rate * 1e-4;
+  }
+
+  auto time = msm_time(system, epoch);
+  message_.system = system;
+  message_.satellites = nsat;
+  message_.time = time;
+  reference_ = time;
+  if (!obs_) return true;
+
+  // observations, decoded into the epoch slot
+  auto& slot = obs_->obs_map_[EpochUtc(time)];
+  auto& codes = obs_->code_map_[system];
+  for (u8 i = 0, k = 0; i < nsat; ++i) {
+    auto prn = satellites[i];
+    Sv sv{.prn = prn, .constellation = {.id = system}};
+    if (system == ConstellationEnum::GLO) {
+      if (infos[i] <= 13) glo_fcn_[prn - 1] = static_cast<i8>(infos[i] - 7);
+      if (glo_fcn_[prn - 1] != UnknownChannel && prn <= 27) {
+        obs_->glo_fcn_[prn - 1] = static_cast<char>(glo_fcn_[prn - 1] + 8);
+      }
+    }
+    auto& obs = slot[sv];
+    if (!obs) {
+      obs = std::make_shared<GObs>();
+      obs->sv = sv;
+      obs->time = time;
+    }
+    for (u8 j = 0; j < nsig; ++j) {
+      if (!cells[i * nsig + j]) continue;
+      auto cell = k++;
+      auto signal = signal_ids[j];
+      auto code = (*signals)[signal - 1];
+      auto freq_type = code_frequency(system, code);
+      if (freq_type == FreTypeEnum::FTYPE_NONE) continue;
+
+      // carrier frequency, the glonass fdma one needs the frequency channel
+      auto frequency = Constants::frequency(freq_type);
+      if (freq_type == FreTypeEnum::G1 || freq_type == FreTypeEnum::G2) {
+        auto fcn = glo_fcn_[prn - 1];
+        auto step = freq_type == FreTypeEnum::G1 ? GloG1Step : GloG2Step;
+        frequency = fcn == UnknownChannel ? 0.0 : frequency + fcn * step;
+      }
+
+      Sig sig;
+      sig.code = code;
+      sig.freq = freq_type;
+      u8 valid = Sig::Valid;
+      if (ranges[i] != 0.0 && !std::isnan(pseudoranges[cell])) {
+        sig.pseudorange = (ranges[i] + pseudoranges[cell]) * RangeMs;
+      } else {
+        valid |= Sig::MissingPseudorange;
+      }
+      if (ranges[i] != 0.0 && !std::isnan(phases[cell]) && frequency != 0.0) {
+        sig.carrier = (ranges[i] + phases[cell]) * frequency * 1e-3;  // ms -> cycles
+      } else {
+        valid |= Sig::MissingCarrierPhase;
+      }
+      if (!std::isnan(rates[i]) && !std::isnan(phase_rates[cell]) && frequency != 0.0) {
+        sig.doppler = static_cast<f32>(-(rates[i] + phase_rates[cell]) * frequency / Constants::CLIGHT);
+      } else {
+        valid |= Sig::MissingDoppler;
+      }
+      sig.snr = cnrs[cell];
+      if (sig.snr == 0.0f) valid |= Sig::MissingSnr;
+      sig.valid = static_cast<Sig::ValidIndicator>(valid);
+
+      // loss of lock when the lock time decreases
+      auto& last_lock = lock_[system_index][prn - 1][signal - 1];
+      sig.lli = (locks[cell] == 0 && last_lock == 0) || locks[cell] < last_lock;
+      last_lock = locks[cell];
+
+      auto& sigs = obs->sigs_list[freq_type];
+      if (auto it = std::ranges::find(sigs, code, &Sig::code); it != sigs.end()) {
+        *it = sig;
+      } else {
+        sigs.push_back(sig);
+        codes.insert(code);
+      }
+    }
+  }
+  obs_->trim_storage();
+  return true;
+}
+
+bool Rtcm3Decoder::decode_station(const u8* payload, size_t size) noexcept {
+  if (size * 8 < (message_.type == 1005 ? 152u : 168u)) return false;
+  BitReader bits{payload, 12};
+  message_.station = static_cast<u16>(bits.u(12));
+  bits.skip(6 + 4);  // itrf realization year, gps/glonass/galileo/reference station indicators
+  station_position_.x() = bits.s38() * 1e-4;
+  bits.skip(2);  // single receiver oscillator, reserved
+  station_position_.y() = bits.s38() * 1e-4;
+  bits.skip(2);  // quarter cycle indicator
+  station_position_.z() = bits.s38() * 1e-4;
+  if (message_.type == 1006) antenna_height_ = bits.u(16) * 1e-4;
+  return true;
+}
+
+bool Rtcm3Decoder::decode_gps_ephemeris(const u8* payload, size_t size) noexcept {
+  if (size * 8 < 488) return false;
+  BitReader bits{payload, 12};
+  Eph eph;
+  auto prn = bits.u(6);
+  eph.weekRollOver = static_cast<i32>(bits.u(10));
+  eph.sva = static_cast<i32>(bits.u(4));
+  eph.code = static_cast<i32>(bits.u(2));
+  eph.idot = bits.s(14) * p2(43) * SC2RAD;
+  eph.iode = static_cast<i32>(bits.u(8));
+  eph.tocs = bits.u(16) * 16.0;
+  eph.f2 = bits.s(8) * p2(55);
+  eph.f1 = bits.s(16) * p2(43);
+  eph.f0 = bits.s(22) * p2(31);
+  eph.iodc = static_cast<i32>(bits.u(10));
+  eph.crs = bits.s(16) * p2(5);
+  eph.deln = bits.s(16) * p2(43) * SC2RAD;
+  eph.M0 = bits.s(32) * p2(31) * SC2RAD;
+  eph.cuc = bits.s(16) * p2(29);
+  eph.e = bits.u(32) * p2(33);
+  eph.cus = bits.s(16) * p2(29);
+  eph.sqrtA = bits.u(32) * p2(19);
+  eph.toes = bits.u(16) * 16.0;
+  eph.cic = bits.s(16) * p2(29);
+  eph.OMG0 = bits.s(32) * p2(31) * SC2RAD;
+  eph.cis = bits.s(16) * p2(29);
+  eph.i0 = bits.s(32) * p2(31) * SC2RAD;
+  eph.crc = bits.s(16) * p2(5);
+  eph.omg = bits.s(32) * p2(31) * SC2RAD;
+  eph.OMGd = bits.s(24) * p2(43) * SC2RAD;
+  eph.tgd[0] = bits.s(8) * p2(31);
+  eph.svh = static_cast<SvhEnum>(bits.u(6));
+  eph.flag = static_cast<i32>(bits.u(1));
+  eph.fitFlag = static_cast<i32>(bits.u(1));
+  eph.fit = eph.fitFlag ? 0.0 : 4.0;
+  if (prn == 0 || prn > 32) return false;  // sbas of the prn 40-
+
+  eph.type = NavMsgTypeEnum::LNAV;
+  eph.sv = Sv{.prn = static_cast<u8>(prn), .constellation = {.id = ConstellationEnum::GPS}};
+  eph.A = eph.sqrtA * eph.sqrtA;
+  eph.toe = GTime(GTow(eph.toes), reference_);
+  eph.toc = GTime(GTow(eph.tocs), reference_);
+  eph.ttm = reference_;
+  eph.ttms = GTow(reference_);
+  eph.week = GWeek(eph.toe).val;
+  message_.system = ConstellationEnum::GPS;
+  if (nav_) nav_->ephMap[eph.sv][eph.type][eph.toe] = eph;
+  return true;
+}
+
+bool Rtcm3Decoder::decode_glo_ephemeris(const u8* payload, size_t size) noexcept {
+  if (size * 8 < 360) return false;
+  BitReader bits{payload, 12};
+  Geph geph;
+  auto prn = bits.u(6);
+  geph.frq = static_cast<i32>(bits.u(5)) - 7;
+  bits.skip(1 + 1 + 2);  // almanac health, health availability, P1
+  geph.tk_hour = static_cast<i32>(bits.u(5));
+  geph.tk_min = static_cast<i32>(bits.u(6));
+  geph.tk_sec = bits.u(1) * 30.0;
+  geph.svh = static_cast<SvhEnum>(bits.u(1));  // msb of Bn
+  bits.skip(1);                                 // P2
+  geph.tb = static_cast<i32>(bits.u(7));
+  for (i32 i = 0; i < 3; ++i) {
+    geph.vel[i] = bits.g(24) * p2(20) * 1e3;
+    geph.pos[i] = bits.g(27) * p2(11) * 1e3;
+    geph.acc[i] = bits.g(5) * p2(30) * 1e3;
+  }
+  bits.skip(1);  // P3
+  geph.gammaN = bits.g(11) * p2(40);
+  bits.skip(2 + 1);  // P, ln
+  geph.taun = bits.g(22) * p2(30);
+  geph.dtaun = bits.g(5) * p2(30);
+  geph.age = static_cast<i32>(bits.u(5));
+  bits.skip(1 + 4);  // P4, FT
+  geph.NT = static_cast<i32>(bits.u(11));
+  geph.glonassM = static_cast<i32>(bits.u(2));
+  geph.moreData = bits.u(1);
+  bits.skip(11 + 32);  // NA, tauc
+  geph.N4 = static_cast<i32>(bits.u(5));
+  if (prn == 0 || prn > 27) return false;
+
+  geph.type = NavMsgTypeEnum::FDMA;
+  geph.sv = Sv{.prn = static_cast<u8>(prn), .constellation = {.id = ConstellationEnum::GLO}};
+  geph.iode = geph.tb;
+  geph.tofs = geph.tk_hour * 3600.0 + geph.tk_min * 60.0 + geph.tk_sec;
+  geph.toe = GTime(RTod(geph.tb * 900.0), reference_);
+  geph.tof = GTime(RTod(geph.tofs), reference_);
+  glo_fcn_[prn - 1] = static_cast<i8>(geph.frq);
+  if (obs_) obs_->glo_fcn_[prn - 1] = static_cast<char>(geph.frq + 8);
+  message_.system = ConstellationEnum::GLO;
+  if (nav_) nav_->gephMap[geph.sv][geph.type][geph.toe] = geph;
+  return true;
+}
+
+bool Rtcm3Decoder::decode_bds_ephemeris(const u8* payload, size_t size) noexcept {
+  if (size * 8 < 511) return false;
+  BitReader bits{payload, 12};
+  Eph eph;
+  auto prn = bits.u(6);
+  eph.weekRollOver = static_cast<i32>(bits.u(13));
+  eph.sva = static_cast<i32>(bits.u(4));
+  eph.idot = bits.s(14) * p2(43) * SC2RAD;
+  eph.aode = static_cast<i32>(bits.u(5));
+  eph.tocs = bits.u(17) * 8.0;
+  eph.f2 = bits.s(11) * p2(66);
+  eph.f1 = bits.s(22) * p2(50);
+  eph.f0 = bits.s(24) * p2(33);
+  eph.aodc = static_cast<i32>(bits.u(5));
+  eph.crs = bits.s(18) * p2(6);
+  eph.deln = bits.s(16) * p2(43) * SC2RAD;
+  eph.M0 = bits.s(32) * p2(31) * SC2RAD;
+  eph.cuc = bits.s(18) * p2(31);
+  eph.e = bits.u(32) * p2(33);
+  eph.cus = bits.s(18) * p2(31);
+  eph.sqrtA = bits.u(32) * p2(19);
+  eph.toes = bits.u(17) * 8.0;
+  eph.cic = bits.s(18) * p2(31);
+  eph.OMG0 = bits.s(32) * p2(31) * SC2RAD;
+  eph.cis = bits.s(18) * p2(31);
+  eph.i0 = bits.s(32) * p2(31) * SC2RAD;
+  eph.crc = bits.s(18) * p2(6);
+  eph.omg = bits.s(32) * p2(31) * SC2RAD;
+  eph.OMGd = bits.s(24) * p2(43) * SC2RAD;
+  eph.tgd[0] = bits.s(10) * 1e-10;
+  eph.tgd[1] = bits.s(10) * 1e-10;
+  eph.svh = static_cast<SvhEnum>(bits.u(1));
+  if (prn == 0) return false;
+
+  // types and issues of data as the rinex reader
+  eph.type = prn > 5 && prn < 59 ? NavMsgTypeEnum::D1 : NavMsgTypeEnum::D2;
+  eph.sv = Sv{.prn = static_cast<u8>(prn), .constellation = {.id = ConstellationEnum::BDS}};
+  eph.iode = static_cast<i32>(eph.tocs / 720) % 240;
+  eph.iodc = eph.iode + 256 * static_cast<i32>(eph.tocs / 172800) % 4;
+  eph.A = eph.sqrtA * eph.sqrtA;
+  eph.toe = GTime(BTow(eph.toes), reference_);
+  eph.toc = GTime(BTow(eph.tocs), reference_);
+  eph.ttm = reference_;
+  eph.ttms = BTow(reference_);
+  eph.week = BWeek(eph.toe).val;
+  message_.system = ConstellationEnum::BDS;
+  if (nav_) nav_->ephMap[eph.sv][eph.type][eph.toe] = eph;
+  return true;
+}
+
+bool Rtcm3Decoder::decode_qzs_ephemeris(const u8* payload, size_t size) noexcept {
+  if (size * 8 < 485) return false;
+  BitReader bits{payload, 12};
+  Eph eph;
+  auto prn = bits.u(4);
+  eph.tocs = bits.u(16) * 16.0;
+  eph.f2 = bits.s(8) * p2(55);
+  eph.f1 = bits.s(16) * p2(43);
+  eph.f0 = bits.s(22) * p2(31);
+  eph.iode = static_cast<i32>(bits.u(8));
+  eph.crs = bits.s(16) * p2(5);
+  eph.deln = bits.s(16) * p2(43) * SC2RAD;
+  eph.M0 = bits.s(32) * p2(31) * SC2RAD;
+  eph.cuc = bits.s(16) * p2(29);
+  eph.e = bits.u(32) * p2(33);
+  eph.cus = bits.s(16) * p2(29);
+  eph.sqrtA = bits.u(32) * p2(19);
+  eph.toes = bits.u(16) * 16.0;
+  eph.cic = bits.s(16) * p2(29);
+  eph.OMG0 = bits.s(32) * p2(31) * SC2RAD;
+  eph.cis = bits.s(16) * p2(29);
+  eph.i0 = bits.s(32) * p2(31) * SC2RAD;
+  eph.crc = bits.s(16) * p2(5);
+  eph.omg = bits.s(32) * p2(31) * SC2RAD;
+  eph.OMGd = bits.s(24) * p2(43) * SC2RAD;
+  eph.idot = bits.s(14) * p2(43) * SC2RAD;
+  eph.code = static_cast<i32>(bits.u(2));
+  eph.weekRollOver = static_cast<i32>(bits.u(10));
+  eph.sva = static_cast<i32>(bits.u(4));
+  eph.svh = static_cast<SvhEnum>(bits.u(6));
+  eph.tgd[0] = bits.s(8) * p2(31);
+  eph.iodc = static_cast<i32>(bits.u(10));
+  eph.fitFlag = static_cast<i32>(bits.u(1));
+  eph.fit = eph.fitFlag ? 0.0 : 2.0;
+  if (prn == 0) return false;
+
+  eph.type = NavMsgTypeEnum::LNAV;
+  eph.sv = Sv{.prn = static_cast<u8>(prn), .constellation = {.id = ConstellationEnum::QZS}};
+  eph.A = eph.sqrtA * eph.sqrtA;
+  eph.toe = GTime(GTow(eph.toes), reference_);
+  eph.toc = GTime(GTow(eph.tocs), reference_);
+  eph.ttm = reference_;
+  eph.ttms = GTow(reference_);
+  eph.week = GWeek(eph.toe).val;
+  message_.system = ConstellationEnum::QZS;
+  if (nav_) nav_->ephMap[eph.sv][eph.type][eph.toe] = eph;
+  return true;
+}
+
+bool Rtcm3Decoder::decode_gal_ephemeris(const u8* payload, size_t size) noexcept {
+  bool fnav = message_.type == 1045;
+  if (size * 8 < (fnav ? 496u : 504u)) return false;
+  BitReader bits{payload, 12};
+  Eph eph;
+  auto prn = bits.u(6);
+  eph.weekRollOver = static_cast<i32>(bits.u(12));
+  eph.iode = eph.iodc = static_cast<i32>(bits.u(10));  // IODnav
+  eph.sva = static_cast<i32>(bits.u(8));               // SISA
+  eph.idot = bits.s(14) * p2(43) * SC2RAD;
+  eph.tocs = bits.u(14) * 60.0;
+  eph.f2 = bits.s(6) * p2(59);
+  eph.f1 = bits.s(21) * p2(46);
+  eph.f0 = bits.s(31) * p2(34);
+  eph.crs = bits.s(16) * p2(5);
+  eph.deln = bits.s(16) * p2(43) * SC2RAD;
+  eph.M0 = bits.s(32) * p2(31) * SC2RAD;
+  eph.cuc = bits.s(16) * p2(29);
+  eph.e = bits.u(32) * p2(33);
+  eph.cus = bits.s(16) * p2(29);
+  eph.sqrtA = bits.u(32) * p2(19);
+  eph.toes = bits.u(14) * 60.0;
+  eph.cic = bits.s(16) * p2(29);
+  eph.OMG0 = bits.s(32) * p2(31) * SC2RAD;
+  eph.cis = bits.s(16) * p2(29);
+  eph.i0 = bits.s(32) * p2(31) * SC2RAD;
+  eph.crc = bits.s(16) * p2(5);
+  eph.omg = bits.s(32) * p2(31) * SC2RAD;
+  eph.OMGd = bits.s(24) * p2(43) * SC2RAD;
+  eph.tgd[0] = bits.s(10) * p2(32);  // BGD E5a/E1
+  if (fnav) {
+    eph.e5a_hs = static_cast<i32>(bits.u(2));
+    eph.e5a_dvs = static_cast<i32>(bits.u(1));
+    eph.svh = static_cast<SvhEnum>((eph.e5a_hs << 4) + (eph.e5a_dvs << 3));
+    eph.code = (1 << 1) + (1 << 8);  // F/NAV E5a-I, clock of E5a,E1
+  } else {
+    eph.tgd[1] = bits.s(10) * p2(32);  // BGD E5b/E1
+    eph.e5b_hs = static_cast<i32>(bits.u(2));
+    eph.e5b_dvs = static_cast<i32>(bits.u(1));
+    eph.e1_hs = static_cast<i32>(bits.u(2));
+    eph.e1_dvs = static_cast<i32>(bits.u(1));
+    eph.svh = static_cast<SvhEnum>((eph.e5b_hs << 7) + (eph.e5b_dvs << 6) + (eph.e1_hs << 1) + eph.e1_dvs);
+    eph.code = (1 << 0) + (1 << 2) + (1 << 9);  // I/NAV E1-B and E5b-I, clock of E5b,E1
+  }
+  if (prn == 0) return false;
+
+  eph.type = fnav ? NavMsgTypeEnum::FNAV : NavMsgTypeEnum::INAV;
+  eph.sv = Sv{.prn = static_cast<u8>(prn), .constellation = {.id = ConstellationEnum::GAL}};
+  eph.A = eph.sqrtA * eph.sqrtA;
+  eph.toe = GTime(GTow(eph.toes), reference_);
+  eph.toc = GTime(GTow(eph.tocs), reference_);
+  eph.ttm = reference_;
+  eph.ttms = GTow(reference_);
+  eph.week = GWeek(eph.toe).val;  // galileo week + 1024
+  message_.system = ConstellationEnum::GAL;
+  if (nav_) nav_->ephMap[eph.sv][eph.type][eph.toe] = eph;
+  return true;
+}
+
+Rtcm3Stream::~Rtcm3Stream() = default;
+
+bool Rtcm3Stream::is_rtcm3_file(std::string_view filename) noexcept {
+  // a frame of a good crc in the first bytes, a recording may begin within a frame
+  std::ifstream file(std::string(filename), std::ios::binary);
+  std::array<u8, 4096> buffer;
+  file.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
+  auto size = static_cast<size_t>(file.gcount());
+  for (size_t pos = 0; pos + Rtcm3Decoder::HeaderSize <= size; ++pos) {
+    auto frame = Rtcm3Decoder::frame_size(&buffer[pos]);
+    if (frame == 0 || pos + frame > size) continue;
+    auto end = pos + frame - Rtcm3Decoder::CrcSize;
+    auto crc = static_cast<u32>(buffer[end]) << 16 | static_cast<u32>(buffer[end + 1]) << 8 | buffer[end + 2];
+    if (crc24q(std::span<const u8>(&buffer[pos], end - pos)) == crc) return true;
+  }
+  return false;
+}
+
+void Rtcm3Stream::decode_record(Record& record) {
+  auto gnss_obs = dynamic_cast<GnssObsRecord*>(&record);
+  if (!gnss_obs) {
+    nav_warn("Rtcm3Stream decode unmatched record, rtcm3 stream should receive GnssObsRecord");
+    return;
+  }
+  decoder_.set_observation(gnss_obs);
+
+  // frames until the last msm of an epoch
+  auto data = reinterpret_cast<char*>(frame_.data());
+  while (read(data, 1)) {
+    if (frame_[0] != Rtcm3Decoder::Preamble) continue;
+    if (!read(data + 1, Rtcm3Decoder::HeaderSize - 1)) break;
+    auto size = Rtcm3Decoder::frame_size(frame_.data());
+    if (size == 0) {
+      seekg(1 - static_cast<i64>(Rtcm3Decoder::HeaderSize), std::ios::cur);
+      continue;
+    }
+    if (!read(data + Rtcm3Decoder::HeaderSize, static_cast<std::streamsize>(size - Rtcm3Decoder::HeaderSize))) break;
+    auto crc_errors = decoder_.crc_errors();
+    if (decoder_.decode_frame(std::span<const u8>(frame_.data(), size))) {
+      if (decoder_.message().is_epoch_end()) {
+        record_number++;
+        return;
+      }
+    } else if (decoder_.crc_errors() != crc_errors) {
+      seekg(1 - static_cast<i64>(size), std::ios::cur);  // resynchronize after the preamble
+    }
+  }
+}
+
+void Rtcm3Stream::encode_record(const Record& record) { nav_error("Not implemented"); }
+
+}  // namespace navp::io::rtcm
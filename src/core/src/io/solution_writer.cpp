@@ -0,0 +1,272 @@
+#include "io/custom/solution_writer.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <vector>
+
+#include "solution/solution.hpp"
+#include "utils/angle.hpp"
+#include "utils/logger.hpp"
+
+namespace navp::io::custom {
+
+namespace {
+
+// append `value` with `precision` decimals right aligned to `width`, as "{:>width.precisionf}"
+void append_fixed(std::string& buffer, f64 value, i32 precision, size_t width) noexcept {
+  char chars[512];  // the largest f64 has 309 digits
+  auto end = std::to_chars(chars, chars + sizeof(chars), value, std::chars_format::fixed, precision).ptr;
+  auto size = static_cast<size_t>(end - chars);
+  if (size < width) buffer.append(width - size, ' ');
+  buffer.append(chars, size);
+}
+
+// append `value` right aligned to `width`, padded by `fill`
+void append_integer(std::string& buffer, u32 value, size_t width, char fill) noexcept {
+  char chars[16];
+  auto end = std::to_chars(chars, chars + sizeof(chars), value).ptr;
+  auto size = static_cast<size_t>(end - chars);
+  if (size < width) buffer.append(width - size, fill);
+  buffer.append(chars, size);
+}
+
+void format_time(std::string& buffer, const SolutionBinaryRecord& record, TimeTypeEnum time_type) noexcept {
+  EpochUtc time{.__dur = details::Duration{._m_seconds = Seconds<i64>(record.seconds),
+                                           ._m_attos = Attoseconds<i64>(record.attoseconds)}};
+  switch (time_type) {
+    case TimeTypeEnum::UTC: {
+      std::format_to(std::back_inserter(buffer), "{}", time);
+      break;
+    }
+    case TimeTypeEnum::GPS: {
+      std::format_to(std::back_inserter(buffer), "{}", time.gps_time<GpsClock>());
+      break;
+    }
+    case TimeTypeEnum::BDT: {
+      std::format_to(std::back_inserter(buffer), "{}", time.gps_time<BdsClock>());
+      break;
+    }
+    default: {
+      nav_error("Unsupported time type, the TimeTypeEnum should be 0(UTC), 1(GPST), 2(BDST), {} is invalid",
+                (u8)time_type);
+    }
+  }
+}
+
+void format_angle(std::string& buffer, f64 angle, AngleTypeEnum angle_type) noexcept {
+  switch (angle_type) {
+    case AngleTypeEnum::DMS: {
+      auto dms = DDmmss<f64>::from_radians(angle);
+      buffer.push_back(dms.negative ? '-' : ' ');
+      append_integer(buffer, dms.hh, 3, ' ');
+      buffer.push_back(':');
+      append_integer(buffer, dms.mm, 2, ' ');
+      buffer.push_back(':');
+      append_fixed(buffer, dms.ss, 6, 2);
+      break;
+    }
+    case AngleTypeEnum::DEG: {
+      append_fixed(buffer, to_degress(angle), 8, 5);
+      break;
+    }
+    case AngleTypeEnum::RAD: {
+      append_fixed(buffer, angle, 15, 3);
+      break;
+    }
+    default: {
+      nav_error("Unsupported angle type, the AngleTypeEnum should be 0(DMS), 1(DEG), 2(RAD), {} is invalid",
+                (u8)angle_type);
+    }
+  }
+}
+
+void format_vector(std::string& buffer, const f64* values, size_t width, char separator) noexcept {
+  for (size_t i = 0; i < 3; ++i) {
+    if (i) buffer.push_back(separator);
+    append_fixed(buffer, values[i], 4, width);
+  }
+}
+
+void write_or_throw(std::ofstream& file, std::string_view filename, const char* data, size_t size) {
+  if (!file.write(data, static_cast<std::streamsize>(size))) {
+    throw SolutionWriterRuntimeError(std::format("Can't write the solution file \"{}\"", filename));
+  }
+}
+
+}  // namespace
+
+auto SolutionBinaryRecord::from(const solution::PvtSolutionRecord& record) noexcept -> SolutionBinaryRecord {
+  SolutionBinaryRecord binary{
+      .seconds = record.time.seconds(),
+      .attoseconds = record.time.fractional_attoseconds(),
+      .position = {record.position.x(), record.position.y(), record.position.z()},
+      .velocity = {record.velocity.x(), record.velocity.y(), record.velocity.z()},
+      .blh = {record.blh.x(), record.blh.y(), record.blh.z()},
+      .sigma_r = record.sigma_r,
+      .sigma_v = record.sigma_v,
+      .dtr = {},
+      .qr = {},
+      .qv = {},
+      .mode = static_cast<u8>(record.mode),
+      .type = record.type,
+      .syss = record.syss,
+      .ns = record.ns,
+      .iter = record.iter,
+      .nex = record.nex,
+      .reserved = {},
+  };
+  std::copy_n(record.dtr, 6, binary.dtr);
+  std::copy_n(record.qr, 6, binary.qr);
+  std::copy_n(record.qv, 6, binary.qv);
+  return binary;
+}
+
+void SolutionBinaryRecord::to(solution::PvtSolutionRecord& record) const noexcept {
+  record.time = EpochUtc{.__dur = details::Duration{._m_seconds = Seconds<i64>(seconds),
+                                                    ._m_attos = Attoseconds<i64>(attoseconds)}};
+  record.position = utils::CoordinateXyz(utils::NavVector3f64(position[0], position[1], position[2]));
+  record.velocity = utils::CoordinateXyz(utils::NavVector3f64(velocity[0], velocity[1], velocity[2]));
+  record.blh = utils::CoordinateBlh(utils::NavVector3f64(blh[0], blh[1], blh[2]));
+  record.sigma_r = sigma_r, record.sigma_v = sigma_v;
+  std::copy_n(dtr, 6, record.dtr);
+  std::copy_n(qr, 6, record.qr);
+  std::copy_n(qv, 6, record.qv);
+  record.mode = static_cast<solution::SolutionModeEnum>(mode);
+  record.type = type, record.syss = syss, record.ns = ns, record.iter = iter, record.nex = nex;
+}
+
+// the position and velocity are written for every coordinate type, enu positions as xyz
+void format_solution(const SolutionBinaryRecord& record, const FormatOptions& options, std::string& buffer) {
+  auto separator = options.separator;
+
+  format_time(buffer, record, options.time_type);  // epoch
+  buffer.push_back(separator);
+
+  // position
+  if (options.coordinate_type == CoordinateTypeEnum::BLH) {
+    format_angle(buffer, record.blh[0], options.angle_type);
+    buffer.push_back(separator);
+    format_angle(buffer, record.blh[1], options.angle_type);
+    buffer.push_back(separator);
+    append_fixed(buffer, record.blh[2], 4, 7);
+  } else {
+    format_vector(buffer, record.position, 14, separator);
+  }
+  buffer.push_back(separator);
+
+  // velocity
+  format_vector(buffer, record.velocity, 10, separator);
+  buffer.push_back(separator);
+
+  // solution information
+  append_integer(buffer, record.mode, 1, ' ');
+  buffer.push_back(separator);
+  append_integer(buffer, record.ns, 2, '0');
+  buffer.push_back('\n');
+}
+
+size_t convert_solution_binary(std::string_view binary_file, std::string_view text_file,
+                               const FormatOptions& options) {
+  std::ifstream in(std::string(binary_file), std::ios::binary);
+  if (!in.is_open()) {
+    throw SolutionWriterRuntimeError(std::format("Can't open the binary solution file \"{}\"", binary_file));
+  }
+  char magic[sizeof(SolutionBinaryRecord::Magic)];
+  if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, SolutionBinaryRecord::Magic, sizeof(magic)) != 0) {
+    throw SolutionWriterRuntimeError(std::format("\"{}\" is not a binary solution file", binary_file));
+  }
+  std::ofstream out(std::string(text_file), std::ios::binary);
+  if (!out.is_open()) {
+    throw SolutionWriterRuntimeError(std::format("Can't open the solution file \"{}\"", text_file));
+  }
+
+  constexpr size_t Chunk = 4096;
+  std::vector<SolutionBinaryRecord> records(Chunk);
+  std::string buffer;
+  buffer.reserve(SolutionWriter::BufferSize + 1024);
+  size_t count = 0;
+  while (in) {
+    in.read(reinterpret_cast<char*>(records.data()), Chunk * sizeof(SolutionBinaryRecord));
+    auto size = static_cast<size_t>(in.gcount()) / sizeof(SolutionBinaryRecord);
+    for (size_t i = 0; i < size; ++i) {
+      format_solution(records[i], options, buffer);
+      if (buffer.size() >= SolutionWriter::BufferSize) {
+        write_or_throw(out, text_file, buffer.data(), buffer.size());
+        buffer.clear();
+      }
+    }
+    count += size;
+  }
+  write_or_throw(out, text_file, buffer.data(), buffer.size());
+  return count;
+}
+
+SolutionWriter::SolutionWriter(std::string_view filename, SolutionFileEnum file_type, const FormatOptions& options,
+                               size_t capacity)
+    : file_type_(file_type),
+      options_(options),
+      file_(std::string(filename), std::ios::binary | std::ios::trunc),
+      queue_(capacity) {
+  if (!file_.is_open()) {
+    throw SolutionWriterRuntimeError(std::format("Can't open the solution file \"{}\"", filename));
+  }
+  buffer_.reserve(BufferSize + 1024);
+  if (file_type_ == SolutionFileEnum::BINARY) {
+    buffer_.append(SolutionBinaryRecord::Magic, sizeof(SolutionBinaryRecord::Magic));
+  }
+  thread_ = std::thread([this] { consume(); });
+}
+
+SolutionWriter::~SolutionWriter() { close(); }
+
+void SolutionWriter::push(const solution::PvtSolutionRecord& record) noexcept {
+  if (stop_.load(std::memory_order_relaxed)) {
+    nav_error("Push a solution to a closed writer");
+    return;
+  }
+  auto binary = SolutionBinaryRecord::from(record);
+  while (!queue_.push(binary)) std::this_thread::yield();
+}
+
+void SolutionWriter::close() noexcept {
+  if (stop_.exchange(true, std::memory_order_release)) return;
+  queue_.wake();
+  if (thread_.joinable()) thread_.join();
+  file_.close();
+}
+
+void SolutionWriter::consume() noexcept {
+  while (true) {
+    // records pushed before `close` are seen once the stop is
+    bool stop = stop_.load(std::memory_order_acquire);
+    while (auto record = queue_.pop()) {
+      encode(*record);
+      if (buffer_.size() >= BufferSize) write_buffer();
+    }
+    if (stop) break;
+    queue_.wait();
+  }
+  write_buffer();
+  file_.flush();
+}
+
+void SolutionWriter::encode(const SolutionBinaryRecord& record) noexcept {
+  if (file_type_ == SolutionFileEnum::BINARY) {
+    buffer_.append(reinterpret_cast<const char*>(&record), sizeof(record));
+  } else {
+    format_solution(record, options_, buffer_);
+  }
+  records_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SolutionWriter::write_buffer() noexcept {
+  if (!file_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()))) {
+    nav_error("Can't write {} bytes of solutions", buffer_.size());
+  }
+  buffer_.clear();
+}
+
+}  // namespace navp::io::custom
@@ -0,0 +1,129 @@
+#include "solution/ambiguity_state.hpp"
+
+namespace navp::solution {
+
+static inline f64 epoch_diff(const EpochUtc& lhs, const EpochUtc& rhs) noexcept {
+  auto diff = lhs - rhs;
+  return static_cast<f64>(diff.seconds()) + static_cast<f64>(diff.scale_fractional_seconds());
+}
+
+void AmbiguityState::reset() noexcept {
+  keys_.clear();
+  held_.clear();
+  index_.clear();
+  ref_.clear();
+}
+
+void AmbiguityState::reset(sensors::gnss::Sv sv, sensors::gnss::ObsCodeEnum code) noexcept {
+  std::vector<u16> keep;
+  keep.reserve(keys_.size());
+  for (u16 i = 0; i < keys_.size(); ++i) {
+    auto& key = keys_[i];
+    if (key.code != code || (key.sv != sv && key.ref != sv)) keep.push_back(i);
+  }
+  if (keep.size() == keys_.size()) return;
+  // compact in place, keep[i] >= i so every source is read before it is overwritten
+  auto size = static_cast<u16>(keep.size());
+  for (u16 j = 0; j < size; ++j) {
+    for (u16 i = 0; i < size; ++i) covariance_(i, j) = covariance_(keep[i], keep[j]);
+    value_(j) = value_(keep[j]);
+    keys_[j] = keys_[keep[j]];
+    held_[j] = held_[keep[j]];
+  }
+  keys_.resize(size);
+  held_.resize(size);
+  _rebuild_index();
+}
+
+void AmbiguityState::_rebuild_index() noexcept {
+  index_.clear();
+  ref_.clear();
+  for (u16 i = 0; i < keys_.size(); ++i) {
+    auto& key = keys_[i];
+    index_.emplace(key, i);
+    ref_.emplace(std::make_pair(key.sv.system().id, key.code), key.ref);
+  }
+}
+
+bool AmbiguityState::_combine(const AmbiguityKey& key, Combination& combination) const noexcept {
+  // N(s, r') = N(s, r) - N(r', r), N(r, r) = 0
+  auto ref = ref_.find(std::make_pair(key.sv.system().id, key.code));
+  if (ref == ref_.end()) return false;
+  auto add = [&](sensors::gnss::Sv sv, f64 coeff) {
+    if (sv == ref->second) return true;
+    auto it = index_.find(AmbiguityKey{.sv = sv, .code = key.code, .ref = ref->second});
+    if (it == index_.end()) return false;
+    combination.index[combination.size] = it->second;
+    combination.coeff[combination.size++] = coeff;
+    return true;
+  };
+  return add(key.sv, 1.0) && add(key.ref, -1.0) && combination.size > 0;
+}
+
+u16 AmbiguityState::predict(EpochUtc epoch, std::span<const AmbiguityKey> keys) noexcept {
+  if (!keys_.empty()) {
+    auto dt = epoch_diff(epoch, epoch_);
+    if (dt <= 0 || dt > MaxGap) reset();
+  }
+  current_epoch_ = epoch;
+  current_keys_.assign(keys.begin(), keys.end());
+  prior_index_.assign(keys.size(), -1);
+  combination_.clear();
+  prior_held_.clear();
+  for (u16 i = 0; i < keys.size(); ++i) {
+    Combination combination;
+    if (!_combine(keys[i], combination)) continue;
+    bool held = true;
+    for (u8 k = 0; k < combination.size; ++k) held = held && held_[combination.index[k]];
+    prior_index_[i] = static_cast<i32>(combination_.size());
+    combination_.push_back(combination);
+    prior_held_.push_back(held);
+  }
+  prior_size_ = static_cast<u16>(combination_.size());
+  if (prior_value_.size() < prior_size_) {
+    prior_value_.resize(keys.size());
+    prior_covariance_.resize(keys.size(), keys.size());
+  }
+  // x' = Tx, P' = TPT', T has at most two terms in each row
+  for (u16 i = 0; i < prior_size_; ++i) {
+    auto& ci = combination_[i];
+    prior_value_(i) = 0;
+    for (u8 a = 0; a < ci.size; ++a) prior_value_(i) += ci.coeff[a] * value_(ci.index[a]);
+    for (u16 j = 0; j <= i; ++j) {
+      auto& cj = combination_[j];
+      f64 covariance = 0;
+      for (u8 a = 0; a < ci.size; ++a) {
+        for (u8 b = 0; b < cj.size; ++b) {
+          covariance += ci.coeff[a] * cj.coeff[b] * covariance_(ci.index[a], cj.index[b]);
+        }
+      }
+      prior_covariance_(i, j) = prior_covariance_(j, i) = covariance;
+    }
+  }
+  return prior_size_;
+}
+
+void AmbiguityState::update(const Eigen::Ref<const utils::NavVectorDf64>& value,
+                            const Eigen::Ref<const utils::NavMatrixDf64>& covariance) noexcept {
+  if (static_cast<size_t>(value.size()) != current_keys_.size()) return;
+  epoch_ = current_epoch_;
+  keys_ = current_keys_;
+  value_ = value;
+  covariance_ = covariance;
+  // the float estimate of a held ambiguity stays at the integer within its prior variance
+  held_.assign(keys_.size(), 0);
+  for (u16 i = 0; i < keys_.size(); ++i) {
+    if (prior_index_[i] >= 0) held_[i] = prior_held_[prior_index_[i]];
+  }
+  _rebuild_index();
+}
+
+void AmbiguityState::hold(const Eigen::Ref<const utils::NavVectorDf64>& integer) noexcept {
+  if (static_cast<size_t>(integer.size()) != keys_.size()) return;
+  value_ = integer;
+  covariance_.setZero();
+  covariance_.diagonal().setConstant(HoldVariance);
+  held_.assign(keys_.size(), 1);
+}
+
+}  // namespace navp::solution
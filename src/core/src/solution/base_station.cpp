@@ -0,0 +1,204 @@
+#include "solution/base_station.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "sensors/gnss/constants.hpp"
+
+namespace navp::solution {
+
+using sensors::gnss::Constants;
+using sensors::gnss::GnssRandomHandler;
+
+static inline f64 epoch_diff(const EpochUtc& lhs, const EpochUtc& rhs) noexcept {
+  auto diff = lhs - rhs;
+  return static_cast<f64>(diff.seconds()) + static_cast<f64>(diff.scale_fractional_seconds());
+}
+
+auto BaseSatellite::find_code(sensors::gnss::ObsCodeEnum code) const noexcept -> const BaseSignal* {
+  auto it = std::ranges::find(sigs, code, &BaseSignal::code);
+  return it == sigs.end() ? nullptr : std::addressof(*it);
+}
+
+auto BaseEpoch::find(Sv sv) const noexcept -> const BaseSatellite* {
+  auto it = std::ranges::lower_bound(satellites, sv, {}, [](const BaseSatellite& sat) { return sat.eph.sv; });
+  return it == satellites.end() || it->eph.sv != sv ? nullptr : std::addressof(*it);
+}
+
+BaseStation::BaseStation(const TaskConfig& task_config, bool enabled_mt, u16 history)
+    : BaseStation(task_config, task_config.base_station(enabled_mt), history) {}
+
+BaseStation::BaseStation(const TaskConfig& task_config, std::shared_ptr<sensors::gnss::GnssHandler> station,
+                         u16 history)
+    : base_(std::make_unique<Spp>(task_config, std::move(station))), history_(history) {
+  fixed_ = base_->station()->station_info()->fixed;
+  if (!fixed_) {
+    task_config.logger()->warn("Base station \'{}\' is not fixed, using Base station spp result as reference",
+                               base_->station()->station_info()->name);
+  }
+}
+
+BaseStation::BaseStation(u16 history) noexcept : history_(history) {}
+
+bool BaseStation::load_next_epoch() noexcept {
+  if (!base_ || !base_->load_next_epoch()) return false;
+  // the spp solution of a moveable base is its reference, a fixed base only needs the satellite status
+  if (!fixed_ && !base_->solve()) return true;
+  auto info = fixed_ ? base_->rover_->update_runtime_info() : base_->station()->runtime_info();
+  auto& position = fixed_ ? *base_->station()->station_info()->ref_pos : base_->solution()->position;
+  publish(
+      preprocess(info->epoch, position, *info->obs_map, *info->sv_map, base_->station()->settings()->random_handler()));
+  return true;
+}
+
+bool BaseStation::is_realtime() const noexcept {
+  if (!base_) return false;
+  auto& assembler = base_->station()->record()->assembler;
+  return assembler && !assembler->closed();
+}
+
+auto BaseStation::preprocess(EpochUtc epoch, const utils::CoordinateXyz& position,
+                             const sensors::gnss::GnssObsRecord::ObsMap& obs_map,
+                             const sensors::gnss::EphemerisSolver::SvMap& sv_map,
+                             const GnssRandomHandler& random) noexcept -> std::shared_ptr<BaseEpoch> {
+  auto base_epoch = std::make_shared<BaseEpoch>();
+  base_epoch->epoch = epoch;
+  base_epoch->position = position;
+  base_epoch->satellites.reserve(obs_map.size());
+  for (auto& [sv, obs] : obs_map) {
+    auto eph = sv_map.find(sv);
+    if (eph == sv_map.end()) continue;  // satellite without ephemeris
+    auto& sat = base_epoch->satellites.emplace_back(BaseSatellite{.eph = eph->second});
+    sat.eph.update_ea_from(position);
+    sat.distance = (position - sat.eph.pos).norm();
+    sat.sigs.reserve(obs->code_count());
+    obs->for_each_code([&](const sensors::gnss::Sig& _sig) {
+      auto& sig = sat.sigs.emplace_back(BaseSignal{_sig});
+      f64 lambda = Constants::code_to_wave_length(sv.system(), sig.code);
+      sig.pseudorange_residual = sig.pseudorange != 0.0 ? sig.pseudorange - sat.distance : 0.0;
+      sig.carrier_residual = sig.carrier != 0.0 && std::isfinite(lambda) ? sig.carrier * lambda - sat.distance : 0.0;
+    });
+  }
+  // variances of all the signals at once
+  std::vector<sensors::gnss::Sig*> sigs;
+  std::vector<f64> elevation;
+  for (auto& sat : base_epoch->satellites) {
+    for (auto& sig : sat.sigs) sigs.push_back(std::addressof(sig)), elevation.push_back(sat.eph.elevation);
+  }
+  random.handle(sigs, elevation);
+  std::ranges::sort(base_epoch->satellites, {}, [](const BaseSatellite& sat) { return sat.eph.sv; });
+  return base_epoch;
+}
+
+void BaseStation::publish(std::shared_ptr<BaseEpoch> base_epoch) noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!published_.empty()) estimate_rates(*published_.back(), *base_epoch);
+  predicted_.reset(), ++generation_;
+  published_.emplace_back(std::move(base_epoch));
+  while (published_.size() > history_) published_.pop_front();
+}
+
+auto BaseStation::latest() const noexcept -> std::shared_ptr<const BaseEpoch> {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return published_.empty() ? nullptr : published_.back();
+}
+
+auto BaseStation::at(EpochUtc epoch) const noexcept -> std::shared_ptr<const BaseEpoch> {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = std::ranges::find(published_, epoch, [](const auto& base_epoch) { return base_epoch->epoch; });
+  return it == published_.end() ? nullptr : *it;
+}
+
+auto BaseStation::predict(EpochUtc epoch, f64 max_age) const noexcept -> std::shared_ptr<const BaseEpoch> {
+  std::shared_ptr<const BaseEpoch> before, after;
+  u64 generation;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (predicted_ && predicted_->epoch == epoch && predicted_->age <= max_age) return predicted_;
+    generation = generation_;
+    auto it = std::ranges::upper_bound(published_, epoch, {}, [](const auto& base_epoch) { return base_epoch->epoch; });
+    if (it != published_.begin()) before = *std::prev(it);
+    if (it != published_.end()) after = *it;
+  }
+  if (before && before->epoch == epoch) return before;
+  if (!before || max_age <= 0.0) return nullptr;
+  f64 age = epoch_diff(epoch, before->epoch);
+  std::shared_ptr<BaseEpoch> predicted;
+  if (after && after->rate_interval > 0.0) {
+    // interpolate between the bracketing epochs, the rates of `after` are estimated from `before`
+    age = std::min(age, epoch_diff(after->epoch, epoch));
+    if (age > max_age) return nullptr;
+    predicted = predict_from(*before, *after, epoch);
+  } else {
+    // extrapolate the latest epoch before `epoch` with its own rates
+    if (age > max_age || before->rate_interval <= 0.0) return nullptr;
+    predicted = predict_from(*before, *before, epoch);
+  }
+  predicted->age = age;
+  // cache the prediction unless an epoch was published meanwhile
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (generation == generation_) predicted_ = predicted;
+  return predicted;
+}
+
+void BaseStation::estimate_rates(const BaseEpoch& previous, BaseEpoch& current) noexcept {
+  f64 dt = epoch_diff(current.epoch, previous.epoch);
+  if (dt <= 0.0 || dt > MaxRateInterval) return;
+  // carrier residual rate of the continuous signals, the clock drift is their median without the satellite clock
+  std::vector<f64> drifts;
+  for (auto& sat : current.satellites) {
+    auto previous_sat = previous.find(sat.eph.sv);
+    if (!previous_sat) continue;
+    for (auto& sig : sat.sigs) {
+      auto previous_sig = previous_sat->find_code(sig.code);
+      if (!previous_sig || sig.carrier_residual == 0.0 || previous_sig->carrier_residual == 0.0) continue;
+      if (sig.lli || sig.is_cycle_slip()) continue;
+      sig.carrier_rate = (sig.carrier_residual - previous_sig->carrier_residual) / dt;
+      drifts.push_back(sig.carrier_rate + Constants::CLIGHT * sat.eph.fd_dtsv);
+    }
+  }
+  if (drifts.empty()) return;
+  auto middle = drifts.begin() + drifts.size() / 2;
+  std::ranges::nth_element(drifts, middle);
+  current.clock_drift = *middle;
+  current.rate_interval = dt;
+  // the code follows the carrier, signals without a continuous carrier follow the clock drift
+  for (auto& sat : current.satellites) {
+    f64 sat_rate = current.clock_drift - Constants::CLIGHT * sat.eph.fd_dtsv;
+    for (auto& sig : sat.sigs) {
+      if (sig.carrier_rate == 0.0) sig.carrier_rate = sat_rate;
+      sig.pseudorange_rate = sig.carrier_rate;
+    }
+  }
+}
+
+auto BaseStation::predict_from(const BaseEpoch& anchor, const BaseEpoch& rates, EpochUtc epoch) noexcept
+    -> std::shared_ptr<BaseEpoch> {
+  f64 dt = epoch_diff(epoch, anchor.epoch);
+  auto predicted = std::make_shared<BaseEpoch>(anchor);
+  predicted->epoch = epoch;
+  predicted->clock_drift = rates.clock_drift;
+  predicted->rate_interval = rates.rate_interval;
+  for (auto& sat : predicted->satellites) {
+    // cached satellite geometry moved to the epoch
+    sat.eph.pos = utils::CoordinateXyz(utils::NavVector3f64(sat.eph.pos + sat.eph.vel * dt));
+    sat.eph.update_ea_from(predicted->position);
+    sat.distance = (predicted->position - sat.eph.pos).norm();
+    auto rates_sat = std::addressof(rates) == std::addressof(anchor) ? std::addressof(sat) : rates.find(sat.eph.sv);
+    f64 sat_rate = rates.clock_drift - Constants::CLIGHT * sat.eph.fd_dtsv;
+    for (auto& sig : sat.sigs) {
+      auto rates_sig = rates_sat ? rates_sat->find_code(sig.code) : nullptr;
+      f64 pseudorange_rate = rates_sig ? rates_sig->pseudorange_rate : sat_rate;
+      f64 carrier_rate = rates_sig ? rates_sig->carrier_rate : sat_rate;
+      sig.pseudorange_residual += pseudorange_rate * dt;
+      sig.carrier_residual += carrier_rate * dt;
+      f64 lambda = Constants::code_to_wave_length(sat.eph.sv.system(), sig.code);
+      if (sig.pseudorange != 0.0) sig.pseudorange = sat.distance + sig.pseudorange_residual;
+      if (sig.carrier != 0.0 && std::isfinite(lambda)) sig.carrier = (sat.distance + sig.carrier_residual) / lambda;
+      sig.pseudorange_rate = pseudorange_rate, sig.carrier_rate = carrier_rate;
+    }
+  }
+  return predicted;
+}
+
+}  // namespace navp::solution
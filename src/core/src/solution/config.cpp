@@ -1,10 +1,14 @@
 #include "solution/config.hpp"
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/daily_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+#include "io/ntrip/ntrip.hpp"
 #include "io/rinex/rinex_stream.hpp"
+#include "io/rtcm/epoch_assembler.hpp"
+#include "io/rtcm/rtcm3.hpp"
 #include "sensors/gnss/gnss.hpp"
 #include "solution/config.hpp"
 
@@ -23,15 +27,28 @@ REGISTER_CONFIG_ITEM(ExecutorCfg, "executor");    // std::string
 
 // solution config
 REGISTER_CONFIG_ITEM(SolutionCfg, "solution");
-REGISTER_CONFIG_ITEM(SolutionModeCfg, "mode");      // integer
-REGISTER_CONFIG_ITEM(SolutionBaseCfg, "base");      // std::string
-REGISTER_CONFIG_ITEM(SolutionRoverCfg, "rover");    // std::string
-REGISTER_CONFIG_ITEM(SolutionCapacity, "capacity")  // integer
-REGISTER_CONFIG_ITEM(SolutionRatio, "ratio")        // float
+REGISTER_CONFIG_ITEM(SolutionModeCfg, "mode");               // integer
+REGISTER_CONFIG_ITEM(SolutionAlgorithmCfg, "algorithm")      // integer
+REGISTER_CONFIG_ITEM(SolutionBaseCfg, "base");               // std::string
+REGISTER_CONFIG_ITEM(SolutionRoverCfg, "rover");             // std::string
+REGISTER_CONFIG_ITEM(SolutionBasesCfg, "bases");             // table
+REGISTER_CONFIG_ITEM(SolutionCapacity, "capacity")           // integer
+REGISTER_CONFIG_ITEM(SolutionRatio, "ratio")                 // float
+REGISTER_CONFIG_ITEM(SolutionRaim, "raim")                   // bool
+REGISTER_CONFIG_ITEM(SolutionWarmStart, "warm_start")        // bool
+REGISTER_CONFIG_ITEM(SolutionBaseMaxAge, "base_max_age")     // float
+REGISTER_CONFIG_ITEM(SolutionNetworkMode, "network_mode")    // integer
+REGISTER_CONFIG_ITEM(SolutionWindow, "window")               // integer
+REGISTER_CONFIG_ITEM(SolutionGraphThreads, "graph_threads")  // integer
+REGISTER_CONFIG_ITEM(SolutionSmoother, "smoother")           // std::string
 
 // output config
 REGISTER_CONFIG_ITEM(OutputCfg, "output");
-REGISTER_CONFIG_ITEM(OutputDirCfg, "dir");  // std::string
+REGISTER_CONFIG_ITEM(OutputDirCfg, "dir");                // std::string
+REGISTER_CONFIG_ITEM(OutputFormatCfg, "format");          // integer
+REGISTER_CONFIG_ITEM(OutputCoordinateCfg, "coordinate");  // integer
+REGISTER_CONFIG_ITEM(OutputTimeCfg, "time");              // integer
+REGISTER_CONFIG_ITEM(OutputAngleCfg, "angle");            // integer
 
 // filter config
 REGISTER_CONFIG_ITEM(FilterCfg, "filter")       // std::string
@@ -48,11 +65,18 @@ REGISTER_CONFIG_ITEM(StationRefPosStyleCfg, "reference_position_style")  // std:
 REGISTER_CONFIG_ITEM(StationRefPosCfg, "reference_position");            // std::string
 REGISTER_CONFIG_ITEM(StationFrequencyCfg, "frequency");                  // integer
 REGISTER_CONFIG_ITEM(StationTropCfg, "trop");                            // integer
+REGISTER_CONFIG_ITEM(StationTropGridCfg, "trop_grid");                   // std::string
 REGISTER_CONFIG_ITEM(StationIonoCfg, "iono");                            // integer
+REGISTER_CONFIG_ITEM(StationIonexCfg, "ionex");                          // std::string
+REGISTER_CONFIG_ITEM(StationNequickCellCfg, "nequick_cell");             // float
 REGISTER_CONFIG_ITEM(StationRandomCfg, "random");                        // integer
+REGISTER_CONFIG_ITEM(StationRandomExpressionCfg, "random_expression");   // std::string
 REGISTER_CONFIG_ITEM(StationCodesCfg, "enabled_codes");                  // table
 REGISTER_CONFIG_ITEM(StationLoggerCfg, "logger_name");                   // std::string
 REGISTER_CONFIG_ITEM(StationCapacityCfg, "capacity")                     // integer
+REGISTER_CONFIG_ITEM(StationRtcmTimeCfg, "rtcm_time");                   // std::string
+REGISTER_CONFIG_ITEM(StationAssemblyDeadlineCfg, "assembly_deadline");   // integer
+REGISTER_CONFIG_ITEM(StationMaxWaitCfg, "max_wait");                     // integer
 
 // logger config
 REGISTER_CONFIG_ITEM(GlobalLoggerCfg, "logger");                     // std::string
@@ -66,10 +90,19 @@ REGISTER_CONFIG_ITEM(LoggerFileEnableMutCfg, "enable_multithread");  // bool
 REGISTER_CONFIG_ITEM(LoggerFilePatternCfg, "pattern");               // std::string
 REGISTER_CONFIG_ITEM(LoggerFilePathCfg, "path");                     // std::string
 REGISTER_CONFIG_ITEM(LoggerFileTypeCfg, "type");                     // integer
+REGISTER_CONFIG_ITEM(LoggerFlushOnCfg, "flush_on");                  // integer
+REGISTER_CONFIG_ITEM(LoggerAsyncCfg, "async");                       // bool
+REGISTER_CONFIG_ITEM(LoggerAsyncQueueCfg, "async_queue_size");       // integer
+REGISTER_CONFIG_ITEM(LoggerAsyncOverflowCfg, "async_overflow");      // integer
 
 #undef REGISTER_CONFIG_ITEM
 
+using navp::io::ntrip::IngestionLoop;
+using navp::io::ntrip::StreamEndpoint;
 using navp::io::rinex::RinexStream;
+using navp::io::rtcm::EpochAssembler;
+using navp::io::rtcm::EpochAssemblerOptions;
+using navp::io::rtcm::Rtcm3Stream;
 using CodeMap = navp::sensors::gnss::CodeMap;
 using spdlog::level::level_enum;
 
@@ -183,6 +216,15 @@ auto get_integer_as(const toml::node* node) noexcept -> ConfigResult<T> {
   return static_cast<T>(node->as_integer()->get());
 }
 
+// integer of an enum with `count` values
+template <typename T>
+auto get_enum_as(const toml::node* node, i64 count) noexcept -> ConfigResult<T> {
+  if (!node->is_integer() || node->as_integer()->get() < 0 || node->as_integer()->get() >= count) {
+    return ConfigParseError(std::format("Parsing error at {}, should be a integer in [0, {})", node->source(), count));
+  }
+  return static_cast<T>(node->as_integer()->get());
+}
+
 template <typename T>
 auto get_as(const toml::node* node) noexcept -> ConfigResult<T> {
   if (!node->is<T>()) {
@@ -295,25 +337,47 @@ struct FileLoggerConfig {
 
 struct LoggerConfig {
   bool enable_console;
-  spdlog::level::level_enum console_level, flush_on_level;
+  spdlog::level::level_enum console_level, flush_on_level = spdlog::level::err;
   std::string name;
   std::string console_pattern;
   std::vector<FileLoggerConfig> file_loggers;
+  bool async = false;              // sinks written by the spdlog thread pool
+  size_t async_queue_size = 8192;  // messages queued in the thread pool
+  spdlog::async_overflow_policy async_overflow = spdlog::async_overflow_policy::block;  // when the queue is full
 
   std::shared_ptr<spdlog::logger> create_logger() const noexcept {
-    Logger logger(name);
+    if (auto ptr = spdlog::get(name); ptr) {
+      return ptr;
+    }
+    std::vector<spdlog::sink_ptr> sinks;
     // depoy console
     if (enable_console) {
       auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
       console_sink->set_level(console_level);
       console_sink->set_pattern(std::move(console_pattern));
-      logger.depoy_sink(std::move(console_sink));
+      sinks.emplace_back(std::move(console_sink));
     }
     // depoy files
     for (auto& file_cfg : file_loggers) {
-      logger.depoy_sink(file_cfg.create_file_sink());
+      if (auto sink = file_cfg.create_file_sink()) sinks.emplace_back(std::move(sink));
     }
-    return logger.set_level(spdlog::level::trace).flush_on(flush_on_level).register_self();
+    // the logger level is the lowest one of its sinks, messages no sink writes are not formatted
+    auto level = spdlog::level::off;
+    for (const auto& sink : sinks) level = std::min(level, sink->level());
+
+    if (!async) {
+      Logger logger(name);
+      for (auto& sink : sinks) logger.depoy_sink(std::move(sink));
+      return logger.set_level(level).flush_on(flush_on_level).register_self();
+    }
+    // the thread pool is shared by the asynchronous loggers, the first one sets its queue size
+    if (!spdlog::thread_pool()) spdlog::init_thread_pool(async_queue_size, 1);
+    auto logger = std::make_shared<spdlog::async_logger>(name, sinks.begin(), sinks.end(), spdlog::thread_pool(),
+                                                         async_overflow);
+    logger->set_level(level);
+    logger->flush_on(flush_on_level);
+    spdlog::register_logger(logger);
+    return logger;
   }
 };
 
@@ -347,6 +411,20 @@ auto get_logger(const toml::node* node) noexcept -> ConfigResult<std::shared_ptr
         }
       }
     }
+    if (auto flush_node = get_child_node(_log, LoggerFlushOnCfg); flush_node.is_ok()) {
+      log_cfg.flush_on_level = get_integer_as<level_enum>(flush_node.unwrap_unchecked()).unwrap_throw();
+    }
+    // asynchronous sinks, optional
+    if (auto async_node = get_child_node(_log, LoggerAsyncCfg); async_node.is_ok()) {
+      log_cfg.async = get_as<bool>(async_node.unwrap_unchecked()).unwrap_throw();
+    }
+    if (auto queue_node = get_child_node(_log, LoggerAsyncQueueCfg); queue_node.is_ok()) {
+      log_cfg.async_queue_size = get_integer_as<size_t>(queue_node.unwrap_unchecked()).unwrap_throw();
+    }
+    if (auto overflow_node = get_child_node(_log, LoggerAsyncOverflowCfg); overflow_node.is_ok()) {
+      log_cfg.async_overflow =
+          get_integer_as<spdlog::async_overflow_policy>(overflow_node.unwrap_unchecked()).unwrap_throw();
+    }
   } else {
     return ConfigParseError(std::format("Parsing error at {}, should be a table", node->source()));
   }
@@ -363,7 +441,7 @@ auto NavConfigManger::solution_mode() const noexcept -> SolutionModeEnum {
 }
 
 auto NavConfigManger::algorithm() const noexcept -> algorithm::AlgorithmEnum {
-  auto node = get_node(this, SolutionCfg, SolutionModeCfg).unwrap_throw();
+  auto node = get_node(this, SolutionCfg, SolutionAlgorithmCfg).unwrap_throw();
   return get_integer_as<algorithm::AlgorithmEnum>(node).unwrap_throw();
 }
 
@@ -398,6 +476,18 @@ auto NavConfigManger::base_station(bool enabled_mt) const noexcept -> std::share
   }
 }
 
+auto NavConfigManger::network_stations(bool enabled_mt) const noexcept
+    -> std::vector<std::shared_ptr<sensors::gnss::GnssHandler>> {
+  std::vector<std::shared_ptr<sensors::gnss::GnssHandler>> stations;
+  auto node = get_node(this, SolutionCfg, SolutionBasesCfg);
+  if (node.is_err()) return stations;
+  for (auto station_name : get_table_as<std::string_view>(node.unwrap_unchecked()).unwrap_throw()) {
+    stations.emplace_back(enabled_mt ? navp::GlobalConfig::get_station_mt(station_name)
+                                     : navp::GlobalConfig::get_station_st(station_name));
+  }
+  return stations;
+}
+
 auto NavConfigManger::rover_station(bool enabled_mt) const noexcept -> std::shared_ptr<sensors::gnss::GnssHandler> {
   auto node = get_node(this, SolutionCfg, SolutionRoverCfg).unwrap_throw();
   auto station_name = solution::get_as<std::string>(node).unwrap_throw();
@@ -429,11 +519,73 @@ auto NavConfigManger::ratio() const noexcept -> f32 {
   return static_cast<f32>(solution::get_as<double>(node).unwrap_throw());
 }
 
+auto NavConfigManger::raim() const noexcept -> bool {
+  auto node = get_node(this, SolutionCfg, SolutionRaim);
+  if (node.is_err()) return false;
+  return solution::get_as<bool>(node.unwrap_unchecked()).unwrap_throw();
+}
+
+auto NavConfigManger::warm_start() const noexcept -> bool {
+  auto node = get_node(this, SolutionCfg, SolutionWarmStart);
+  if (node.is_err()) return false;
+  return solution::get_as<bool>(node.unwrap_unchecked()).unwrap_throw();
+}
+
+auto NavConfigManger::base_max_age() const noexcept -> f64 {
+  auto node = get_node(this, SolutionCfg, SolutionBaseMaxAge);
+  if (node.is_err()) return 0.0;
+  return solution::get_as<double>(node.unwrap_unchecked()).unwrap_throw();
+}
+
+auto NavConfigManger::network_mode() const noexcept -> u8 {
+  auto node = get_node(this, SolutionCfg, SolutionNetworkMode);
+  if (node.is_err()) return 0;
+  return get_integer_as<u8>(node.unwrap_unchecked()).unwrap_throw();
+}
+
+auto NavConfigManger::window() const noexcept -> u8 {
+  auto node = get_node(this, SolutionCfg, SolutionWindow);
+  if (node.is_err()) return 10;
+  return get_integer_as<u8>(node.unwrap_unchecked()).unwrap_throw();
+}
+
+auto NavConfigManger::graph_threads() const noexcept -> u16 {
+  auto node = get_node(this, SolutionCfg, SolutionGraphThreads);
+  if (node.is_err()) return 1;
+  return get_integer_as<u16>(node.unwrap_unchecked()).unwrap_throw();
+}
+
+auto NavConfigManger::smoother() const noexcept -> std::string {
+  auto node = get_node(this, SolutionCfg, SolutionSmoother);
+  if (node.is_err()) return {};
+  return solution::get_as<std::string>(node.unwrap_unchecked()).unwrap_throw();
+}
+
 auto NavConfigManger::output_dir() const noexcept -> std::string {
   auto node = get_node(this, OutputCfg, OutputDirCfg).unwrap_throw();
   return solution::get_as<std::string>(node).unwrap_throw();
 }
 
+auto NavConfigManger::output_format() const noexcept -> u8 {
+  auto node = get_node(this, OutputCfg, OutputFormatCfg);
+  if (node.is_err()) return 0;
+  return get_enum_as<u8>(node.unwrap_unchecked(), 2).unwrap_throw();
+}
+
+auto NavConfigManger::output_options() const noexcept -> io::FormatOptions {
+  io::FormatOptions options;
+  if (auto node = get_node(this, OutputCfg, OutputCoordinateCfg); node.is_ok()) {
+    options.coordinate_type = get_enum_as<io::CoordinateTypeEnum>(node.unwrap_unchecked(), 2).unwrap_throw();
+  }
+  if (auto node = get_node(this, OutputCfg, OutputTimeCfg); node.is_ok()) {
+    options.time_type = get_enum_as<io::TimeTypeEnum>(node.unwrap_unchecked(), 3).unwrap_throw();
+  }
+  if (auto node = get_node(this, OutputCfg, OutputAngleCfg); node.is_ok()) {
+    options.angle_type = get_enum_as<io::AngleTypeEnum>(node.unwrap_unchecked(), 3).unwrap_throw();
+  }
+  return options;
+}
+
 }  // namespace navp::solution
 
 namespace navp {
@@ -480,12 +632,39 @@ std::unique_ptr<GnssPayload> GlobalConfig::_get_station_handler(std::string_view
     // trop model
     auto trop_node = get_child_node(station_node, StationTropCfg).unwrap_throw();
     settings.trop = get_integer_as<TropModelEnum>(trop_node).unwrap_throw();
+    // trop grid, a text grid is converted once to a binary one beside it
+    auto trop_grid_node = get_child_node(station_node, StationTropGridCfg);
+    if (trop_grid_node.is_ok()) {
+      settings.trop_grid = TropGrid::load(get_as<std::string>(trop_grid_node.unwrap_unchecked()).unwrap_throw());
+    } else if (settings.trop == TropModelEnum::VMF3 || settings.trop == TropModelEnum::GPT2) {
+      logger->error("Station \'{}\' trop model needs a \'trop_grid\'", station_name);
+    }
     // iono model
     auto iono_node = get_child_node(station_node, StationIonoCfg).unwrap_throw();
     settings.iono = get_integer_as<IonoModelEnum>(iono_node).unwrap_throw();
+    // ionosphere maps
+    auto ionex_node = get_child_node(station_node, StationIonexCfg);
+    if (ionex_node.is_ok()) {
+      settings.ionex = Ionex::load(get_as<std::string>(ionex_node.unwrap_unchecked()).unwrap_throw());
+    } else if (settings.iono == IonoModelEnum::IONEX) {
+      logger->error("Station \'{}\' iono model needs an \'ionex\'", station_name);
+    }
+    // memoized nequick-approx profiles
+    auto nequick_cell_node = get_child_node(station_node, StationNequickCellCfg);
+    if (nequick_cell_node.is_ok()) {
+      settings.nequick_cell = get_as<double>(nequick_cell_node.unwrap_unchecked()).unwrap_throw();
+    }
     // random model
     auto random_node = get_child_node(station_node, StationRandomCfg).unwrap_throw();
     settings.random = get_integer_as<RandomModelEnum>(random_node).unwrap_throw();
+    // custom random model, compiled once here
+    auto random_expression_node = get_child_node(station_node, StationRandomExpressionCfg);
+    if (random_expression_node.is_ok()) {
+      settings.random_expression =
+          RandomExpression::compile(get_as<std::string>(random_expression_node.unwrap_unchecked()).unwrap_throw());
+    } else if (settings.random == RandomModelEnum::CUSTOM) {
+      logger->error("Station \'{}\' random model needs a \'random_expression\'", station_name);
+    }
     // capacity
     auto capacity_node = get_child_node(station_node, StationCapacityCfg).unwrap_throw();
     settings.capacity = get_integer_as<i32>(capacity_node).unwrap_throw();
@@ -530,6 +709,16 @@ std::unique_ptr<GnssPayload> GlobalConfig::_get_station_handler(std::string_view
    */
   {
     station->record_ = std::make_unique<GnssRecord>();
+    // solvers of the observation
+    auto init_solvers = [&](GnssRecord& storage) {
+      // cycle slip detector
+      storage.cycle_slip = std::make_unique<CycleSlip>();
+      // ephemeris solver
+      storage.eph_solver = std::make_unique<EphemerisSolver>(logger);
+      std::ranges::for_each(storage.nav,
+                            [&](const GnssNavRecord& record) { storage.eph_solver->add_ephemeris(record.nav.get()); });
+      storage.eph_solver->set_storage(station->settings_->capacity);
+    };
     // storage from file source
     auto init_file_source = [&](GnssRecord& storage) {
       // navigation
@@ -537,20 +726,62 @@ std::unique_ptr<GnssPayload> GlobalConfig::_get_station_handler(std::string_view
       storage.nav = get_nav_record(nav_node, logger).unwrap_throw();
       // observation stream
       auto obs_node = get_child_node(station_node, StationObsPathCfg).unwrap_throw();
-      // todo
-      // detection observation file type here
-      storage.obs_stream = get_stream<RinexStream>(obs_node, logger).unwrap_throw();
+      if (obs_node->is_string() && Rtcm3Stream::is_rtcm3_file(obs_node->as_string()->get())) {
+        storage.obs_stream = get_stream<Rtcm3Stream>(obs_node, logger).unwrap_throw();
+      } else {
+        storage.obs_stream = get_stream<RinexStream>(obs_node, logger).unwrap_throw();
+      }
       // obs
       storage.obs = std::make_unique<GnssObsRecord>(logger);
       storage.obs->set_storage(station->settings_->capacity);
       if (auto rinex_stream = dynamic_cast<RinexStream*>(storage.obs_stream.get())) {
         rinex_stream->decode_header(*storage.obs);  // read observation header
+      } else if (auto rtcm_stream = dynamic_cast<Rtcm3Stream*>(storage.obs_stream.get())) {
+        // ephemerides of the stream, the gps weeks resolved near the recording time
+        auto& decoder = rtcm_stream->decoder();
+        decoder.set_navigation(storage.nav.emplace_back().nav.get());
+        auto rtcm_time_node = get_child_node(station_node, StationRtcmTimeCfg);
+        if (rtcm_time_node.is_ok()) {
+          auto time_str = get_as<std::string>(rtcm_time_node.unwrap_unchecked()).unwrap_throw();
+          decoder.set_reference_time(
+              utils::GTime(EpochUtc::from_str("%Y-%m-%d %H:%M:%S", time_str.c_str()).unwrap_throw()));
+        }
       }
-      // ephemeris solver
-      storage.eph_solver = std::make_unique<EphemerisSolver>(logger);
-      std::ranges::for_each(storage.nav,
-                            [&](const GnssNavRecord& record) { storage.eph_solver->add_ephemeris(record.nav.get()); });
-      storage.eph_solver->set_storage(station->settings_->capacity);
+      init_solvers(storage);
+    };
+    // storage from network source, a rtcm3 stream of a ntrip caster or tcp server assembled into epochs
+    auto init_network_source = [&](GnssRecord& storage) {
+      // navigation files are optional, the ephemerides of the stream go to the last navigation
+      auto nav_node = get_child_node(station_node, StationNavPathCfg);
+      if (nav_node.is_ok()) storage.nav = get_nav_record(nav_node.unwrap_unchecked(), logger).unwrap_throw();
+      storage.nav.emplace_back();
+      // epoch assembly, a base waits for its next epoch at most the deadline by default so the rover goes on
+      EpochAssemblerOptions options;
+      auto deadline_node = get_child_node(station_node, StationAssemblyDeadlineCfg);
+      if (deadline_node.is_ok()) {
+        auto deadline = get_integer_as<u32>(deadline_node.unwrap_unchecked()).unwrap_throw();
+        options.deadline = std::chrono::milliseconds(deadline);
+      }
+      auto max_wait_node = get_child_node(station_node, StationMaxWaitCfg);
+      if (max_wait_node.is_ok()) {
+        auto max_wait = get_integer_as<u32>(max_wait_node.unwrap_unchecked()).unwrap_throw();
+        options.max_wait = std::chrono::milliseconds(max_wait);
+      } else if (station->station_info_->type == 1) {
+        options.max_wait = options.deadline;
+      }
+      storage.assembler = std::make_shared<EpochAssembler>(options);
+      // obs
+      storage.obs = std::make_unique<GnssObsRecord>(logger);
+      storage.obs->set_storage(station->settings_->capacity);
+      init_solvers(storage);
+      // the stream is received from now on, the epochs wait in the assembler until loaded
+      auto obs_node = get_child_node(station_node, StationObsPathCfg).unwrap_throw();
+      auto endpoint = StreamEndpoint::from_str(get_as<std::string>(obs_node).unwrap_throw());
+      storage.ingestion = std::make_unique<IngestionLoop>();
+      storage.ingestion->add_stream(endpoint, [assembler = storage.assembler](std::span<const u8> frames) {
+        assembler->decode(frames);
+      });
+      storage.ingestion->start();
     };
     auto& storage = *station->record_;
     switch (station->station_info_->source) {
@@ -561,11 +792,12 @@ std::unique_ptr<GnssPayload> GlobalConfig::_get_station_handler(std::string_view
       }
       // network
       case 1: {
-        nav_error("not implemented!")
+        init_network_source(storage);
+        break;
       }
       // serial port
       case 2: {
-        nav_error("not implemented!")
+        nav_error("not implemented!");
       }
     }
   }
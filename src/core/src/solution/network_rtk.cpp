@@ -0,0 +1,212 @@
+#include "solution/network_rtk.hpp"
+
+#include <algorithm>
+#include <ranges>
+
+namespace navp::solution {
+
+using sensors::gnss::GnssRandomHandler;
+using sensors::gnss::Sig;
+
+static auto make_bases(const TaskConfig& task_config, bool enabled_mt) -> std::vector<std::shared_ptr<BaseStation>> {
+  return std::views::transform(task_config.network_stations(enabled_mt),
+                               [&](auto station) { return std::make_shared<BaseStation>(task_config, station); }) |
+         std::ranges::to<std::vector>();
+}
+
+NetworkRtk::Baseline::Baseline(const TaskConfig& task_config, std::shared_ptr<BaseStation> base) noexcept
+    : base_station_(std::move(base)) {
+  __RtkPayload::_set_maskfilters(task_config);
+}
+
+bool NetworkRtk::Baseline::prepare(const Spp* rover, f64 base_max_age) noexcept {
+  auto start = std::chrono::steady_clock::now();
+  solution_ = *rover->solution();
+  base_epoch_ = base_station_->predict(rover->station()->runtime_info()->epoch, base_max_age);
+  available_ = base_epoch_ && __RtkPayload::_reset(rover, base_epoch_.get(), false);
+  timing_.prepare = std::chrono::steady_clock::now() - start;
+  timing_.solve = std::chrono::nanoseconds(0);
+  return available_;
+}
+
+bool NetworkRtk::Baseline::solve(f32 ratio_threshold, const std::shared_ptr<spdlog::logger>& logger) noexcept {
+  auto start = std::chrono::steady_clock::now();
+  available_ = __RtkPayload::_solve(solution_, ratio_threshold, logger);
+  timing_.solve = std::chrono::steady_clock::now() - start;
+  return available_;
+}
+
+void NetworkRtk::Baseline::build_joint_model(algorithm::WeightedLeastSquare<f64>* wls, u16 dd_ambiguity_index,
+                                             const utils::CoordinateXyz& rover_pos) noexcept {
+  auto start = std::chrono::steady_clock::now();
+  __RtkPayload::_build_dd_model(wls, dd_ambiguity_index, rover_pos);
+  timing_.solve += std::chrono::steady_clock::now() - start;
+}
+
+void NetworkRtk::Baseline::update_joint_geometry(algorithm::WeightedLeastSquare<f64>* wls, u16 dd_ambiguity_index,
+                                                 const utils::CoordinateXyz& rover_pos) noexcept {
+  auto start = std::chrono::steady_clock::now();
+  __RtkPayload::_update_dd_geometry(wls, dd_ambiguity_index, rover_pos);
+  timing_.solve += std::chrono::steady_clock::now() - start;
+}
+
+NetworkRtk::NetworkRtk(const TaskConfig& task_config, bool enabled_mt)
+    : NetworkRtk(task_config, make_bases(task_config, enabled_mt), enabled_mt) {
+  own_bases_ = true;
+}
+
+NetworkRtk::NetworkRtk(const TaskConfig& task_config, std::vector<std::shared_ptr<BaseStation>> bases, bool enabled_mt)
+    : ratio_threshold_(task_config.config().ratio()),
+      base_max_age_(task_config.solution().base_max_age),
+      mode_(static_cast<SolveMode>(task_config.solution().network_mode)),
+      own_bases_(false),
+      enabled_mt_(enabled_mt),
+      logger_(task_config.logger()),
+      rover_(std::make_unique<Spp>(task_config, enabled_mt)),
+      pool_(std::clamp<u16>(bases.size(), 1, std::max(1u, std::thread::hardware_concurrency()))),
+      solution_(task_config.solution().capacity) {
+  for (auto& base : bases) baselines_.emplace_back(std::make_unique<Baseline>(task_config, std::move(base)));
+  ambiguity_fixer_.options().ratio_threshold = ratio_threshold_;
+  if (baselines_.empty()) logger_->warn("Network rtk without base station");
+  if (mode_ > Joint) {
+    logger_->error("Network rtk mode {} is not supported, 0 independent or 1 joint", static_cast<u8>(mode_));
+  }
+}
+
+bool NetworkRtk::load_next_epoch() noexcept {
+  solution_.push();
+  if (!rover_->load_next_epoch()) return false;
+  if (!own_bases_) return true;
+  auto epoch = rover_->station()->record()->obs->latest().first;
+  auto load_base = [&](size_t index) {
+    auto& base = baselines_[index]->base();
+    for (auto latest = base->latest(); !latest || latest->epoch < epoch; latest = base->latest()) {
+      if (!base->load_next_epoch()) break;
+    }
+  };
+  // the stations of a multi-thread task can be read concurrently
+  if (enabled_mt_) {
+    pool_.parallel_for(baselines_.size(), load_base);
+  } else {
+    for (size_t i = 0; i < baselines_.size(); ++i) load_base(i);
+  }
+  return true;
+}
+
+void NetworkRtk::handle_rover_variance() noexcept {
+  auto info = rover_->station()->runtime_info();
+  std::vector<Sig*> sigs;
+  std::vector<f64> elevation;
+  for (auto& [sv, obs] : *info->obs_map) {
+    auto eph = info->sv_map->find(sv);
+    if (eph == info->sv_map->end()) continue;
+    obs->for_each_code([&](Sig& sig) { sigs.push_back(&sig), elevation.push_back(eph->second.elevation); });
+  }
+  rover_->station()->settings()->random_handler().set_options(GnssRandomHandler::Both).handle(sigs, elevation);
+}
+
+bool NetworkRtk::solve() noexcept {
+  auto& sol = solution_.last();
+  if (!rover_->solve()) return false;
+  sol = *rover_->solution();
+  handle_rover_variance();
+  pool_.parallel_for(baselines_.size(), [&](size_t i) { baselines_[i]->prepare(rover_.get(), base_max_age_); });
+  if (std::ranges::none_of(baselines_, &Baseline::available)) {
+    logger_->debug("Network rtk without available baseline at {}", sol.time);
+    return false;
+  }
+  switch (mode_) {
+    case Independent:
+      return solve_independent();
+    case Joint:
+      return solve_joint();
+    default:
+      return false;
+  }
+}
+
+bool NetworkRtk::solve_independent() noexcept {
+  pool_.parallel_for(baselines_.size(), [&](size_t i) {
+    if (baselines_[i]->available()) baselines_[i]->solve(ratio_threshold_, logger_);
+  });
+  std::vector<const PvtSolutionRecord*> solutions;
+  for (auto& baseline : baselines_) {
+    if (baseline->available()) solutions.push_back(std::addressof(baseline->solution()));
+  }
+  return combine(solutions, solution_.last());
+}
+
+bool NetworkRtk::combine(std::span<const PvtSolutionRecord* const> solutions, PvtSolutionRecord& sol) noexcept {
+  auto is_fixed = [](const PvtSolutionRecord* solution) { return solution->mode == SolutionModeEnum::FIXED; };
+  bool fixed = std::ranges::any_of(solutions, is_fixed);
+  utils::NavMatrix33f64 information = utils::NavMatrix33f64::Zero();
+  utils::NavVector3f64 weighted_position = utils::NavVector3f64::Zero();
+  for (auto solution : solutions) {
+    if (fixed && !is_fixed(solution)) continue;
+    auto& qr = solution->qr;
+    utils::NavMatrix33f64 covariance;
+    covariance << qr[0], qr[1], qr[2], qr[1], qr[3], qr[4], qr[2], qr[4], qr[5];
+    utils::NavMatrix33f64 solution_information = covariance.inverse();
+    information += solution_information;
+    weighted_position += solution_information * solution->position;
+  }
+  if (information.isZero()) return false;
+  utils::NavMatrix33f64 covariance = information.inverse();
+  sol.position = utils::CoordinateXyz(utils::NavVector3f64(covariance * weighted_position));
+  sol.blh = sol.position.to_blh();
+  sol.qr[0] = static_cast<f32>(covariance(0, 0)), sol.qr[1] = static_cast<f32>(covariance(0, 1)),
+  sol.qr[2] = static_cast<f32>(covariance(0, 2)), sol.qr[3] = static_cast<f32>(covariance(1, 1)),
+  sol.qr[4] = static_cast<f32>(covariance(1, 2)), sol.qr[5] = static_cast<f32>(covariance(2, 2));
+  sol.mode = fixed ? SolutionModeEnum::FIXED : SolutionModeEnum::FLOAT;
+  return true;
+}
+
+bool NetworkRtk::solve_joint() noexcept {
+  auto& sol = solution_.last();
+  auto spp_position = sol.position;
+  // ambiguities of each baseline follow the previous baseline
+  std::vector<Baseline*> baselines;
+  std::vector<u16> dd_ambiguity_index;
+  u16 dd_ambiguity_size = 0;
+  for (auto& baseline : baselines_) {
+    if (!baseline->available()) continue;
+    baselines.push_back(baseline.get());
+    dd_ambiguity_index.push_back(dd_ambiguity_size);
+    dd_ambiguity_size += baseline->_dd_ambiguity_size();
+  }
+  wls_ = std::make_unique<algorithm::WeightedLeastSquare<f64>>(3 + dd_ambiguity_size, 2 * dd_ambiguity_size, logger_);
+  wls_->parameter().block(0, 0, 3, 1) = sol.position;
+  // the whole model is built once, the following iterations only refresh the geometry
+  pool_.parallel_for(baselines.size(), [&](size_t i) {
+    baselines[i]->build_joint_model(wls_.get(), dd_ambiguity_index[i], sol.position);
+  });
+  sol.iter = 0;
+  while (true) {
+    wls_->correct();
+    auto position_correction = wls_->parameter_correction().block(0, 0, 3, 1).norm();
+    ++sol.iter;
+    sol.position = wls_->parameter().block(0, 0, 3, 1);
+    if (position_correction < __RtkPayload::ConvergeLimit) break;
+    // not converged, keep the spp solution
+    if (sol.iter >= __RtkPayload::MaxIteration) {
+      sol.position = spp_position;
+      logger_->warn("Network rtk joint solution not converged after {} iterations at {}", sol.iter, sol.time);
+      return false;
+    }
+    pool_.parallel_for(baselines.size(), [&](size_t i) {
+      baselines[i]->update_joint_geometry(wls_.get(), dd_ambiguity_index[i], sol.position);
+    });
+  }
+  utils::NavMatrixDf64 covariance = wls_->cofactor().inverse();
+  wls_->evaluate();
+  __RtkPayload::evaluate_float(sol, *wls_, covariance);
+  // the ambiguities of every baseline at once, the fixed baseline starts from the first base station
+  auto& base_pos = baselines[0]->base_epoch_->position;
+  utils::NavVector3f64 float_baseline = sol.position - base_pos;
+  if (ambiguity_fixer_.fix(float_baseline, wls_->parameter().segment(3, dd_ambiguity_size), covariance)) {
+    __RtkPayload::evaluate_fixed(sol, ambiguity_fixer_, base_pos);
+  }
+  return true;
+}
+
+}  // namespace navp::solution
@@ -3,7 +3,7 @@
 #include <algorithm>
 #include <ranges>
 
-#include "algorithm/ambiguity_fixer.hpp"
+#include "algorithm/dd_weight.hpp"
 #include "sensors/gnss/constants.hpp"
 
 namespace navp::solution {
@@ -13,65 +13,66 @@ using sensors::gnss::GnssRandomHandler;
 using sensors::gnss::Sig;
 
 Rtk::Rtk(const TaskConfig& task_config, bool enabled_mt)
+    : Rtk(task_config, std::make_shared<BaseStation>(task_config, enabled_mt), enabled_mt) {
+  own_base_ = true;
+}
+
+Rtk::Rtk(const TaskConfig& task_config, std::shared_ptr<BaseStation> base, bool enabled_mt)
     : ratio_threshold_(task_config.config().ratio()),
+      base_max_age_(task_config.solution().base_max_age),
       logger_(task_config.logger()),
       rover_(std::make_unique<Spp>(task_config, enabled_mt)),
-      base_(std::make_unique<Spp>(task_config, enabled_mt)),
+      base_(std::move(base)),
+      own_base_(false),
       solution_(task_config.solution().capacity) {
-  indicator_.base_fixed = base_->station()->station_info()->fixed;
-  if (!indicator_.base_fixed) {
-    logger_->warn("Base station \'{}\' is not fixed, using Base station spp result as reference",
-                  base_->station()->station_info()->name);
-  }
   __RtkPayload::_set_maskfilters(task_config);
 }
 
 bool Rtk::load_next_epoch() noexcept {
   solution_.push();
-  return align_time();
+  return rover_->load_next_epoch() && align_time();
 }
 
 bool Rtk::load_rtk_payload() noexcept {
-  if (rover_->solve() && (indicator_.base_fixed || base_->solve())) {
+  if (base_epoch_ && rover_->solve()) {
     solution_.last() = *rover_->solution();  // set solution
-    return __RtkPayload::_reset(rover_.get(), base_.get());
+    return __RtkPayload::_reset(rover_.get(), base_epoch_.get());
   }
   return false;
 }
 
 bool Rtk::align_time() noexcept {
-  // pass the first epoch
-  if (rover_->epoch() == base_->epoch() && rover_->epoch() == EpochUtc()) {
-    rover_->load_next_epoch();
-    base_->load_next_epoch();
-    return align_time();
-  }
-  while (rover_->epoch() != base_->epoch()) {
-    if (rover_->epoch() < base_->epoch()) {
-      rover_->load_next_epoch();
-      continue;
-    } else {
-      base_->load_next_epoch();
-      continue;
+  while (true) {
+    auto epoch = rover_->station()->record()->obs->latest().first;
+    // an owned base is read up to the rover epoch, so the base epoch can be interpolated
+    if (own_base_) {
+      for (auto latest = base_->latest(); !latest || latest->epoch < epoch; latest = base_->latest()) {
+        if (!base_->load_next_epoch()) break;
+      }
     }
+    // base epoch at the rover epoch, or predicted from the base epochs within the max age
+    if ((base_epoch_ = base_->predict(epoch, base_max_age_))) return true;
+    // the base has not reached the rover epoch yet : a shared base is read by its owner, an owned one has ended,
+    // unless it is a real-time base which missed the rover epoch by the wait of its stream
+    if (auto latest = base_->latest(); (!latest || latest->epoch < epoch) && !(own_base_ && base_->is_realtime())) {
+      return false;
+    }
+    // no base epoch close enough to the rover epoch, skip it
+    logger_->debug("Rtk skips rover epoch {} without base epoch", epoch);
+    if (!rover_->load_next_epoch()) return false;
   }
-  return rover_->epoch() == base_->epoch();
 }
 
-bool __RtkPayload::_reset(const Spp* rover, const Spp* base) noexcept {
+bool __RtkPayload::_reset(const Spp* rover, const BaseEpoch* base, bool handle_rover_variance) noexcept {
   // claer old data
   system_payload_map_.clear();
   wls_.reset();
   // check if rover and base is valid
   if (!rover || !base) return false;
   // reset
-  rover_ = rover->station(), base_ = base->station();
+  rover_ = rover->station(), base_ = base;
   rover_pos_ = std::addressof(rover->solution()->position);
-  if (!indicator_.base_fixed) {
-    base_pos_ = std::addressof(base->solution()->position);
-  } else {
-    base_pos_ = base->station()->station_info()->ref_pos.get();
-  }
+  base_pos_ = std::addressof(base->position);
   // The order of the following operations cannot be changed
   if (!_get_public_view_satellites()) return false;
   _select_reference_satellite();
@@ -79,7 +80,7 @@ bool __RtkPayload::_reset(const Spp* rover, const Spp* base) noexcept {
   _get_base_information();
   _select_available_sigs();
   if (_solvable()) {
-    _handle_variance();
+    if (handle_rover_variance) _handle_variance();
     return true;
   }
   return false;
@@ -89,9 +90,9 @@ auto __RtkPayload::epoch() const noexcept -> EpochUtc { return rover_->runtime_i
 
 bool __RtkPayload::_get_public_view_satellites() noexcept {
   if (mask_filter_ && !mask_filter_->apply(epoch())) return false;  // filter time
-  auto base_obs_map = base_->runtime_info()->obs_map;
   auto rover_obs_map = rover_->runtime_info()->obs_map;
-  for (const auto& [sv, _] : *base_obs_map) {
+  for (const auto& base_sat : base_->satellites) {
+    auto sv = base_sat.eph.sv;
     if (mask_filter_ && (!mask_filter_->apply(sv.system()) || !mask_filter_->apply(sv)))
       continue;  // filter sv and system
     if (rover_obs_map->contains(sv)) {
@@ -130,18 +131,18 @@ void __RtkPayload::_get_rover_information() noexcept {
 }
 
 void __RtkPayload::_get_base_information() noexcept {
-  std::ranges::for_each(system_payload_map_ | std::views::values, [base_pos = base_pos_](SystemPayload& payload) {
+  std::ranges::for_each(system_payload_map_ | std::views::values, [base = base_](SystemPayload& payload) {
     payload.bt_base_satellites_distance.reserve(payload.public_view_satellites.size());
-    for (auto eph : payload.rover_eph) {
-      payload.bt_base_satellites_distance.emplace_back((*base_pos - eph->pos).norm());
+    for (auto sv : payload.public_view_satellites) {
+      payload.bt_base_satellites_distance.emplace_back(base->find(sv)->distance);
     }
   });
 }
 
 void __RtkPayload::_handle_variance() noexcept {
-  std::ranges::for_each(system_payload_map_ | std::views::values, [&](SystemPayload& payload) {
-    payload.handle_variance(rover_->settings()->random, base_->settings()->random);
-  });
+  auto rover_random = rover_->settings()->random_handler().set_options(GnssRandomHandler::Both);
+  std::ranges::for_each(system_payload_map_ | std::views::values,
+                        [&](SystemPayload& payload) { payload.handle_variance(rover_random); });
 }
 
 void __RtkPayload::_select_available_sigs() noexcept {
@@ -149,19 +150,17 @@ void __RtkPayload::_select_available_sigs() noexcept {
                         [&](SystemPayload& payload) { payload.select_available_sigs(rover_, base_, mask_filter_); });
 }
 
-void __RtkPayload::SystemPayload::select_available_sigs(const GnssHandler* rover, const GnssHandler* base,
+void __RtkPayload::SystemPayload::select_available_sigs(const GnssHandler* rover, const BaseEpoch* base,
                                                         const filter::MaskFilters* mask_filter) noexcept {
   if (public_view_satellites.size() < 2) return;  // if public view satellites less than 2, return
   auto& rover_obs_map = rover->runtime_info()->obs_map;
-  auto& base_obs_map = base->runtime_info()->obs_map;
 
   // get observation vector
   auto rover_obs_vec =
       std::views::transform(public_view_satellites, [&](const Sv sv) { return rover_obs_map->at(sv).get(); }) |
       std::ranges::to<std::vector>();
-  auto base_obs_vec =
-      std::views::transform(public_view_satellites, [&](const Sv sv) { return base_obs_map->at(sv).get(); }) |
-      std::ranges::to<std::vector>();
+  auto base_sat_vec = std::views::transform(public_view_satellites, [&](const Sv sv) { return base->find(sv); }) |
+                      std::ranges::to<std::vector>();
 
   // initialize available code set
   rover_obs_vec[0]->for_each_code([&](const Sig& sig) {
@@ -173,19 +172,17 @@ void __RtkPayload::SystemPayload::select_available_sigs(const GnssHandler* rover
   // delete code that is not available in the rest of the satellites
   for (u8 i = 1; i < public_view_satellites.size(); ++i) {
     auto obs_i = rover_obs_vec[i];
-    for (auto code : available_code_set) {
-      if (auto sig = obs_i->find_code(code); !sig || !sig->is_valid(mask_filter)) {
-        available_code_set.erase(code);
-      }
-    }
+    std::erase_if(available_code_set, [&](sensors::gnss::ObsCodeEnum code) {
+      auto sig = obs_i->find_code(code);
+      return !sig || !sig->is_valid(mask_filter);
+    });
   }
   for (u8 i = 0; i < public_view_satellites.size(); ++i) {
-    auto obs_i = base_obs_vec[i];
-    for (auto code : available_code_set) {
-      if (auto sig = obs_i->find_code(code); !sig || !sig->is_valid(mask_filter)) {
-        available_code_set.erase(code);
-      }
-    }
+    auto sat_i = base_sat_vec[i];
+    std::erase_if(available_code_set, [&](sensors::gnss::ObsCodeEnum code) {
+      auto sig = sat_i->find_code(code);
+      return !sig || !sig->is_valid(mask_filter);
+    });
   }
 
   if (available_code_set.empty()) return;
@@ -195,10 +192,10 @@ void __RtkPayload::SystemPayload::select_available_sigs(const GnssHandler* rover
 
   for (u8 i = 0; i < public_view_satellites.size(); ++i) {
     auto& rover_obs_i = rover_obs_map->at(public_view_satellites[i]);
-    auto& base_obs_i = base_obs_map->at(public_view_satellites[i]);
+    auto base_sat_i = base_sat_vec[i];
     for (auto [index, code] : std::views::zip(std::views::iota(0), available_code_set)) {
       rover_sigs[i + index * public_view_satellites.size()] = rover_obs_i->find_code(code);
-      base_sigs[i + index * public_view_satellites.size()] = base_obs_i->find_code(code);
+      base_sigs[i + index * public_view_satellites.size()] = base_sat_i->find_code(code);
     }
   }
 }
@@ -235,8 +232,8 @@ u16 __RtkPayload::_bt_satellite_ambiguity_size() const noexcept {
   return size;
 }
 
-u8 __RtkPayload::_dd_ambiguity_size() const noexcept {
-  u8 size = 0;
+u16 __RtkPayload::_dd_ambiguity_size() const noexcept {
+  u16 size = 0;
   std::ranges::for_each(system_payload_map_ | std::views::values,
                         [&size](const SystemPayload& payload) { size += payload.dd_ambiguity_size(); });
   return size;
@@ -248,12 +245,11 @@ bool __RtkPayload::SystemPayload::is_view_vector_cached() const noexcept {
 
 void __RtkPayload::SystemPayload::reset_view_vector_cache() const noexcept { view_vector_cache.reset(); }
 
-void __RtkPayload::SystemPayload::update_view_vector_cache() const noexcept {
-  reset_view_vector_cache();
-  view_vector_cache = std::make_unique<ViewVectorCache>();
-  view_vector_cache->reserve(public_view_satellites.size());
+void __RtkPayload::SystemPayload::update_view_vector_cache(const utils::CoordinateXyz& rover_pos) const noexcept {
+  // refresh in place when the satellites are unchanged
+  if (!is_view_vector_cached()) view_vector_cache = std::make_unique<ViewVectorCache>(public_view_satellites.size());
   for (u8 i = 0; i < public_view_satellites.size(); ++i) {
-    view_vector_cache->emplace_back(rover_eph[i]->view_vector_to(rover_spp_sol_->position));
+    (*view_vector_cache)[i] = rover_eph[i]->view_vector_to(rover_pos);
   }
 }
 
@@ -329,14 +325,15 @@ void __RtkPayload::SystemPayload::update_dd_obs_cache() const noexcept {
   if (!is_bt_sta_sd_obs_cached()) update_bt_sta_sd_obs_cache();
   dd_obs_cache = std::make_unique<ObservationCacheVector>();
   dd_obs_cache->resize(dd_ambiguity_size());
+  auto dd_sats = public_view_satellites.size() - 1;
   for (auto code_index : std::views::iota(0, (i32)available_code_set.size())) {
     auto ref_sv_index = code_index * public_view_satellites.size();
     auto& ref_sd_obs = btsta_sd_obs_cache->at(ref_sv_index);
-    for (auto i = 1; i < btsta_sd_obs_cache->size(); ++i) {
-      auto& rover_sd_obs = btsta_sd_obs_cache->at(ref_sv_index + i);
-      (*dd_obs_cache)[ref_sv_index + i - 1] = (ObservationCache{
-          .pseudorange = rover_sd_obs.pseudorange - ref_sd_obs.pseudorange,
-          .carrier = rover_sd_obs.carrier - ref_sd_obs.carrier,
+    for (u8 i = 1; i < public_view_satellites.size(); ++i) {
+      auto& mov_sd_obs = btsta_sd_obs_cache->at(ref_sv_index + i);
+      (*dd_obs_cache)[code_index * dd_sats + i - 1] = (ObservationCache{
+          .pseudorange = mov_sd_obs.pseudorange - ref_sd_obs.pseudorange,
+          .carrier = mov_sd_obs.carrier - ref_sd_obs.carrier,
       });
     }
   }
@@ -405,126 +402,121 @@ void __RtkPayload::SystemPayload::reset_bt_sat_sd_random_cache() const noexcept
   base_btsat_sd_random_cache.reset();
 }
 
-bool __RtkPayload::SystemPayload::is_dd_weight_cached() const noexcept {
-  return dd_weight_cache && dd_weight_cache->rows() == dd_weight_cache->cols() &&
-         dd_weight_cache->rows() == 2 * dd_ambiguity_size();
-}
-
-void __RtkPayload::SystemPayload::update_dd_weight_cache() const noexcept {
-  reset_dd_weight_cache();
-  // between station single difference random cache exists
-  if (!is_bt_sta_sd_random_cached()) update_bt_sta_sd_random_cache();
-  auto observation_size = 2 * dd_ambiguity_size();
-  dd_weight_cache = std::make_unique<utils::NavMatrixDf64>(observation_size, observation_size);
-  dd_weight_cache->setZero();
-  std::size_t index = 0;
-  std::size_t dd_sats = public_view_satellites.size() - 1;
-  for (auto code_index : std::views::iota(0, (i32)available_code_set.size())) {
-    auto ref_sv_index = code_index * dd_sats;
-    auto& ref_sv_random = btsta_sd_random_cache->at(ref_sv_index);
-    Eigen::Block<utils::NavMatrixDf64> pseudorange_variance =
-        dd_weight_cache->block(ref_sv_index, ref_sv_index, dd_sats, dd_sats);
-    Eigen::Block<utils::NavMatrixDf64> carrier_variance =
-        dd_weight_cache->block(ref_sv_index + dd_sats, ref_sv_index + dd_sats, dd_sats, dd_sats);
-    pseudorange_variance.array() = ref_sv_random.pseudorange;
-    carrier_variance.array() = ref_sv_random.carrier;
-    for (u8 i = 0; i < dd_sats; ++i) {
-      auto mov_sv_index = ref_sv_index + i;
-      auto mov_sv_random = btsta_sd_random_cache->at(ref_sv_index + i);
-      pseudorange_variance(i, i) += mov_sv_random.pseudorange;
-      carrier_variance(i, i) += mov_sv_random.carrier;
-    }
-  }
-  dd_weight_cache->noalias() = dd_weight_cache->inverse();
-}
-
-void __RtkPayload::SystemPayload::reset_dd_weight_cache() const noexcept { dd_weight_cache.reset(); }
-
-void __RtkPayload::SystemPayload::handle_variance(sensors::gnss::RandomModelEnum rover_model,
-                                                  sensors::gnss::RandomModelEnum base_model) const noexcept {
-  auto code_size = available_code_set.size();
-  for (u16 i = 0; i < rover_sigs.size(); ++i) {
-    auto random_handler =
-        GnssRandomHandler{}.set_options(GnssRandomHandler::Both).set_sv_info(rover_eph[i / code_size]);
-    random_handler.set_model(rover_model).handle(rover_sigs[i]);
-    random_handler.set_model(base_model).handle(base_sigs[i]);
-  }
+void __RtkPayload::SystemPayload::handle_variance(const GnssRandomHandler& rover_random) const noexcept {
+  auto sat_size = public_view_satellites.size();
+  std::vector<f64> elevation(rover_sigs.size());
+  for (u16 i = 0; i < rover_sigs.size(); ++i) elevation[i] = rover_eph[i % sat_size]->elevation;
+  rover_random.handle(rover_sigs, elevation);
 }
 
 void __RtkPayload::SystemPayload::build_dd_jacobian(Eigen::Block<utils::NavMatrixDf64> jacobian) const noexcept {
-  if (!is_view_vector_cached()) update_view_vector_cache();
   auto& ref_vector = view_vector_cache->at(0);
   auto dd_sats = public_view_satellites.size() - 1;
-  std::vector<f64> code_lambda(available_code_set.size());
-  for (auto [code_index, code] : std::views::enumerate(available_code_set)) {
-    code_lambda[code_index] = Constants::code_to_wave_length(public_view_satellites[0].system(), code);
-  }
+  // d(dd rho)/d(rover position) = e_mov - e_ref, the same for pseudorange and carrier of every code
   for (u8 i = 0; i < dd_sats; ++i) {
-    auto& rover_vector = view_vector_cache->at(i + 1);
-    jacobian(i, 0) = ref_vector.x - rover_vector.x;
-    jacobian(i, 1) = ref_vector.y - rover_vector.y;
-    jacobian(i, 2) = ref_vector.z - rover_vector.z;
-    jacobian(i + dd_sats, 0) = jacobian(i, 0);
-    jacobian(i + dd_sats, 1) = jacobian(i, 1);
-    jacobian(i + dd_sats, 2) = jacobian(i, 2);
-    jacobian(i + dd_sats, 3 + i) = code_lambda[0];
+    auto& mov_vector = view_vector_cache->at(i + 1);
+    jacobian(i, 0) = mov_vector.x - ref_vector.x;
+    jacobian(i, 1) = mov_vector.y - ref_vector.y;
+    jacobian(i, 2) = mov_vector.z - ref_vector.z;
   }
-
+  jacobian.block(dd_sats, 0, dd_sats, 3) = jacobian.block(0, 0, dd_sats, 3);
   for (u8 i = 1; i < available_code_set.size(); ++i) {
-    auto row_index = 2 * i * dd_sats;
-    for (u8 j = 0; j < dd_sats; ++j) {
-      auto& rover_vector = view_vector_cache->at(j);
-      jacobian(row_index + j, 0) = jacobian(j, 0);
-      jacobian(row_index + j, 1) = jacobian(j, 1);
-      jacobian(row_index + j, 2) = jacobian(j, 2);
-      jacobian(row_index + j + dd_sats, 0) = jacobian(j + dd_sats, 0);
-      jacobian(row_index + j + dd_sats, 1) = jacobian(j + dd_sats, 1);
-      jacobian(row_index + j + dd_sats, 2) = jacobian(j + dd_sats, 2);
-      jacobian(row_index + j + dd_sats, 3 + j) = code_lambda[i];
+    jacobian.block(2 * i * dd_sats, 0, 2 * dd_sats, 3) = jacobian.block(0, 0, 2 * dd_sats, 3);
+  }
+}
+
+void __RtkPayload::SystemPayload::build_dd_ambiguity_jacobian(
+    Eigen::Block<utils::NavMatrixDf64> jacobian) const noexcept {
+  auto dd_sats = public_view_satellites.size() - 1;
+  jacobian.setZero();
+  for (auto [code_index, code] : std::views::enumerate(available_code_set)) {
+    f64 lambda = Constants::code_to_wave_length(public_view_satellites[0].system(), code);
+    for (u8 i = 0; i < dd_sats; ++i) {
+      jacobian(2 * code_index * dd_sats + dd_sats + i, code_index * dd_sats + i) = lambda;
     }
   }
 }
 
-void __RtkPayload::SystemPayload::build_dd_observation(Eigen::Block<utils::NavVectorDf64> observation) const noexcept {
-  if (!is_view_vector_cached()) update_view_vector_cache();
+void __RtkPayload::SystemPayload::build_dd_observation(Eigen::Block<utils::NavVectorDf64> observation,
+                                                       const f64* ambiguity) const noexcept {
   if (!is_dd_obs_cached()) update_dd_obs_cache();
   f64 rover_ref_rho = view_vector_cache->at(0).distance;
   f64 base_ref_rho = bt_base_satellites_distance[0];
   auto dd_sats = public_view_satellites.size() - 1;
-  for (auto code_index = 0; code_index < available_code_set.size(); ++code_index) {
-    auto code_begin_index = code_index * (public_view_satellites.size() - 1);
+  for (auto [code_index, code] : std::views::enumerate(available_code_set)) {
+    f64 lambda = Constants::code_to_wave_length(public_view_satellites[0].system(), code);
+    auto row_index = 2 * code_index * dd_sats;
     for (u8 i = 0; i < dd_sats; ++i) {
       auto mov_index = i + 1;
-      f64 rover_btsta_rho = view_vector_cache->at(mov_index).distance - rover_ref_rho;
-      f64 base_btsta_rho = bt_base_satellites_distance[mov_index] - base_ref_rho;
-      f64 dd_rho = base_btsta_rho - rover_btsta_rho;
-      observation(code_begin_index + i, 0) = dd_obs_cache->at(i).pseudorange - dd_rho;
-      observation(code_index + i + dd_sats, 0) = dd_obs_cache->at(i).carrier - dd_rho;
+      f64 rover_btsat_rho = view_vector_cache->at(mov_index).distance - rover_ref_rho;
+      f64 base_btsat_rho = bt_base_satellites_distance[mov_index] - base_ref_rho;
+      f64 dd_rho = rover_btsat_rho - base_btsat_rho;
+      auto& dd_obs = dd_obs_cache->at(code_index * dd_sats + i);
+      observation(row_index + i, 0) = dd_obs.pseudorange - dd_rho;
+      observation(row_index + dd_sats + i, 0) = dd_obs.carrier - dd_rho - lambda * ambiguity[code_index * dd_sats + i];
     }
   }
 }
 
 void __RtkPayload::SystemPayload::build_dd_weight(Eigen::Block<utils::NavMatrixDf64> weight) const noexcept {
-  if (!is_dd_weight_cached()) update_dd_weight_cache();
-  weight = dd_weight_cache->inverse();
+  // between station single difference random cache exists
+  if (!is_bt_sta_sd_random_cached()) update_bt_sta_sd_random_cache();
+  using VarianceMap = Eigen::Map<const utils::NavVectorDf64, Eigen::Unaligned, Eigen::InnerStride<2>>;
+  static_assert(sizeof(ObservationCache) == 2 * sizeof(f64));
+  Eigen::Index dd_sats = public_view_satellites.size() - 1;
+  // codes are uncorrelated, each code has a pseudorange block and a carrier block sharing the reference satellite
+  weight.setZero();
+  for (auto code_index : std::views::iota(0, (i32)available_code_set.size())) {
+    auto ref_sv_index = code_index * public_view_satellites.size();
+    auto row_index = 2 * code_index * dd_sats;
+    auto& ref_sv_random = btsta_sd_random_cache->at(ref_sv_index);
+    auto& mov_sv_random = btsta_sd_random_cache->at(ref_sv_index + 1);
+    algorithm::dd_weight(weight.block(row_index, row_index, dd_sats, dd_sats), ref_sv_random.pseudorange,
+                         VarianceMap(&mov_sv_random.pseudorange, dd_sats));
+    algorithm::dd_weight(weight.block(row_index + dd_sats, row_index + dd_sats, dd_sats, dd_sats),
+                         ref_sv_random.carrier, VarianceMap(&mov_sv_random.carrier, dd_sats));
+  }
 }
 
-void __RtkPayload::SystemPayload::build_dd_model(algorithm::WeightedLeastSquare<f64>* wls,
-                                                 u16 dd_ambiguity_index) const noexcept {
+void __RtkPayload::SystemPayload::build_dd_model(algorithm::WeightedLeastSquare<f64>* wls, u16 dd_ambiguity_index,
+                                                 const utils::CoordinateXyz& rover_pos) const noexcept {
   auto ambiguous_size = dd_ambiguity_size();
-  // build H
-  build_dd_jacobian(wls->jacobian().block(2 * dd_ambiguity_index, 0, 2 * ambiguous_size, 3 + ambiguous_size));
-  // build L
-  build_dd_observation(wls->observation().block(2 * dd_ambiguity_index, 0, 2 * ambiguous_size, 1));
+  auto row_index = 2 * dd_ambiguity_index, row_size = 2 * ambiguous_size;
+  // build H (ambiguity part)
+  build_dd_ambiguity_jacobian(wls->jacobian().block(row_index, 3 + dd_ambiguity_index, row_size, ambiguous_size));
   // build R
-  build_dd_weight(
-      wls->weight().block(2 * dd_ambiguity_index, 2 * dd_ambiguity_index, 2 * ambiguous_size, 2 * ambiguous_size));
+  build_dd_weight(wls->weight().block(row_index, row_index, row_size, row_size));
+  // build H (geometry part) and L
+  update_dd_geometry(wls, dd_ambiguity_index, rover_pos);
+}
+
+void __RtkPayload::SystemPayload::update_dd_geometry(algorithm::WeightedLeastSquare<f64>* wls,
+                                                     u16 dd_ambiguity_index,
+                                                     const utils::CoordinateXyz& rover_pos) const noexcept {
+  auto ambiguous_size = dd_ambiguity_size();
+  auto row_index = 2 * dd_ambiguity_index, row_size = 2 * ambiguous_size;
+  update_view_vector_cache(rover_pos);
+  build_dd_jacobian(wls->jacobian().block(row_index, 0, row_size, 3));
+  build_dd_observation(wls->observation().block(row_index, 0, row_size, 1),
+                       wls->parameter().data() + 3 + dd_ambiguity_index);
 }
 
-void __RtkPayload::_build_dd_model() noexcept {
-  u16 dd_ambiguity_index = 0;
+void __RtkPayload::_build_dd_model() noexcept { _build_dd_model(wls_.get(), 0, *rover_pos_); }
+
+void __RtkPayload::_update_dd_geometry() noexcept { _update_dd_geometry(wls_.get(), 0, *rover_pos_); }
+
+void __RtkPayload::_build_dd_model(algorithm::WeightedLeastSquare<f64>* wls, u16 dd_ambiguity_index,
+                                   const utils::CoordinateXyz& rover_pos) noexcept {
+  for (auto& [sys, payload] : system_payload_map_) {
+    payload.build_dd_model(wls, dd_ambiguity_index, rover_pos);
+    dd_ambiguity_index += payload.dd_ambiguity_size();
+  }
+}
+
+void __RtkPayload::_update_dd_geometry(algorithm::WeightedLeastSquare<f64>* wls, u16 dd_ambiguity_index,
+                                       const utils::CoordinateXyz& rover_pos) noexcept {
   for (auto& [sys, payload] : system_payload_map_) {
-    payload.build_dd_model(wls_.get(), dd_ambiguity_index);
+    payload.update_dd_geometry(wls, dd_ambiguity_index, rover_pos);
     dd_ambiguity_index += payload.dd_ambiguity_size();
   }
 }
@@ -534,52 +526,134 @@ f64 __RtkPayload::_iter_once() noexcept {
   return wls_->parameter_correction().block(0, 0, 3, 1).norm();
 }
 
-void __RtkPayload::_update_rover_position(const utils::CoordinateXyz* pos) noexcept {
-  rover_pos_ = pos;
-  // reset rover view vector cache
-  std::ranges::for_each(__RtkPayload::system_payload_map_ | std::views::values,
-                        [](const __RtkPayload::SystemPayload& payload) { payload.reset_view_vector_cache(); });
-}
+void __RtkPayload::_update_rover_position(const utils::CoordinateXyz* pos) noexcept { rover_pos_ = pos; }
 
-void __RtkPayload::_fix_ambiguity(f32 ratio_threshold) noexcept {
-  auto float_baseline = (*rover_pos_ - *base_pos_);
-  auto am_fixer = algorithm::AmbiguityFixer(float_baseline, wls_->parameter().data() + 3, wls_->cofactor());
-  if (am_fixer.fix()) {
-    if (am_fixer.ratio() >= ratio_threshold) {
-      // todo
+void __RtkPayload::_predict_ambiguity() noexcept {
+  ambiguity_keys_.clear();
+  for (auto& [sys, payload] : system_payload_map_) {
+    auto sat_size = payload.public_view_satellites.size();
+    auto& ref_sv = payload.public_view_satellites[0];
+    for (auto [code_index, code] : std::views::enumerate(payload.available_code_set)) {
+      for (u8 i = 0; i < sat_size; ++i) {
+        auto sig_index = code_index * sat_size + i;
+        auto rover_sig = payload.rover_sigs[sig_index], base_sig = payload.base_sigs[sig_index];
+        if (rover_sig->lli || rover_sig->is_cycle_slip() || base_sig->lli || base_sig->is_cycle_slip()) {
+          ambiguity_state_.reset(payload.public_view_satellites[i], code);
+        }
+        if (i > 0) ambiguity_keys_.push_back({.sv = payload.public_view_satellites[i], .code = code, .ref = ref_sv});
+      }
     }
   }
+  ambiguity_state_.predict(epoch(), ambiguity_keys_);
 }
 
-void Rtk::update_position_after_iter() noexcept {
-  auto& sol = solution_.last();
-  sol.position += __RtkPayload::wls_->parameter().block(0, 0, 1, 3);
-  _update_rover_position(std::addressof(sol.position));
-}
-
-void Rtk::model(RtkModel model) noexcept {
-  switch (model) {
-    case DdBasic:
-      model_dd_basic();
-    default:
-      return;
+void __RtkPayload::_build_ambiguity_prior() noexcept {
+  auto prior_size = ambiguity_state_.prior_size();
+  if (prior_size == 0) return;
+  auto row_index = 2 * _dd_ambiguity_size();
+  auto& prior_index = ambiguity_state_.prior_index();
+  for (u16 i = 0; i < prior_index.size(); ++i) {
+    if (prior_index[i] >= 0) wls_->jacobian()(row_index + prior_index[i], 3 + i) = 1.0;
+  }
+  wls_->weight().block(row_index, row_index, prior_size, prior_size) =
+      ambiguity_state_.prior_covariance().llt().solve(utils::NavMatrixDf64::Identity(prior_size, prior_size));
+  _update_ambiguity_prior();
+}
+
+void __RtkPayload::_update_ambiguity_prior() noexcept {
+  auto row_index = 2 * _dd_ambiguity_size();
+  auto& prior_index = ambiguity_state_.prior_index();
+  auto prior_value = ambiguity_state_.prior_value();
+  for (u16 i = 0; i < prior_index.size(); ++i) {
+    if (prior_index[i] < 0) continue;
+    wls_->observation()(row_index + prior_index[i]) = prior_value(prior_index[i]) - wls_->parameter()(3 + i);
   }
 }
 
-void Rtk::evaluate() noexcept {}
+void __RtkPayload::_update_ambiguity_state(const utils::NavMatrixDf64& float_qxx) noexcept {
+  auto ambiguity_size = _dd_ambiguity_size();
+  ambiguity_state_.update(wls_->parameter().segment(3, ambiguity_size),
+                          float_qxx.bottomRightCorner(ambiguity_size, ambiguity_size));
+}
 
-void Rtk::model_dd_basic() noexcept { __RtkPayload::_build_dd_model(); }
+bool __RtkPayload::_fix_ambiguity(const utils::NavMatrixDf64& float_qxx, f32 ratio_threshold) noexcept {
+  auto ambiguity_size = _dd_ambiguity_size();
+  utils::NavVector3f64 float_baseline = *rover_pos_ - *base_pos_;
+  ambiguity_fixer_.options().ratio_threshold = ratio_threshold;
+  if (!ambiguity_fixer_.fix(float_baseline, wls_->parameter().segment(3, ambiguity_size), float_qxx)) return false;
+  if (ambiguity_fixer_.fixed_size() == ambiguity_size) ambiguity_state_.hold(ambiguity_fixer_.fixed_ambiguity());
+  return true;
+}
 
-bool Rtk::solve(RtkModel model) noexcept {
-  // set wls
-  size_t dd_ambiguity_size = __RtkPayload::_dd_ambiguity_size();
-  __RtkPayload::_set_wls(3 + dd_ambiguity_size, 2 * dd_ambiguity_size, logger_);
+void __RtkPayload::evaluate_float(PvtSolutionRecord& sol, const algorithm::WeightedLeastSquare<f64>& wls,
+                                  const utils::NavMatrixDf64& covariance) noexcept {
+  sol.position = wls.parameter().block(0, 0, 3, 1);
+  sol.blh = sol.position.to_blh();
+  sol.qr[0] = static_cast<f32>(covariance(0, 0)), sol.qr[1] = static_cast<f32>(covariance(0, 1)),
+  sol.qr[2] = static_cast<f32>(covariance(0, 2)), sol.qr[3] = static_cast<f32>(covariance(1, 1)),
+  sol.qr[4] = static_cast<f32>(covariance(1, 2)), sol.qr[5] = static_cast<f32>(covariance(2, 2));
+  sol.sigma_r = wls.sigma();
+  sol.mode = SolutionModeEnum::FLOAT;
+}
+
+void __RtkPayload::evaluate_fixed(PvtSolutionRecord& sol, const algorithm::AmbiguityFixer& fixer,
+                                  const utils::CoordinateXyz& base_pos) noexcept {
+  auto& qbb = fixer.fixed_qbb();
+  sol.position = utils::CoordinateXyz(utils::NavVector3f64(base_pos + fixer.fixed_baseline()));
+  sol.blh = sol.position.to_blh();
+  sol.qr[0] = static_cast<f32>(qbb(0, 0)), sol.qr[1] = static_cast<f32>(qbb(0, 1)),
+  sol.qr[2] = static_cast<f32>(qbb(0, 2)), sol.qr[3] = static_cast<f32>(qbb(1, 1)),
+  sol.qr[4] = static_cast<f32>(qbb(1, 2)), sol.qr[5] = static_cast<f32>(qbb(2, 2));
+  sol.mode = SolutionModeEnum::FIXED;
+}
+
+bool __RtkPayload::_solve(PvtSolutionRecord& sol, f32 ratio_threshold,
+                          const std::shared_ptr<spdlog::logger>& logger) noexcept {
+  auto spp_position = sol.position;
+  // carried ambiguities of the previous epochs
+  _predict_ambiguity();
+  // set wls, linearized at the rover spp position and the carried ambiguities
+  size_t dd_ambiguity_size = _dd_ambiguity_size();
+  size_t prior_size = ambiguity_state_.prior_size();
+  _set_wls(3 + dd_ambiguity_size, 2 * dd_ambiguity_size + prior_size, logger);
+  wls_->parameter().block(0, 0, 3, 1) = sol.position;
+  auto& prior_index = ambiguity_state_.prior_index();
+  for (u16 i = 0; i < dd_ambiguity_size; ++i) {
+    if (prior_index[i] >= 0) wls_->parameter()(3 + i) = ambiguity_state_.prior_value()(prior_index[i]);
+  }
+  _update_rover_position(std::addressof(sol.position));
+  // the whole model is built once, the following iterations only refresh the geometry
+  _build_dd_model();
+  _build_ambiguity_prior();
+  sol.iter = 0;
   while (true) {
-    Rtk::model(model);
-    auto position_correction = __RtkPayload::_iter_once();
-    update_position_after_iter();
-    if (position_correction < 1e-6) {
+    auto position_correction = _iter_once();
+    ++sol.iter;
+    sol.position = wls_->parameter().block(0, 0, 3, 1);
+    if (position_correction < ConvergeLimit) break;
+    // not converged, keep the spp solution
+    if (sol.iter >= MaxIteration) {
+      sol.position = spp_position;
+      logger->warn("Rtk float solution not converged after {} iterations at {}", sol.iter, epoch());
+      return false;
     }
+    _update_dd_geometry();
+    _update_ambiguity_prior();
+  }
+  utils::NavMatrixDf64 covariance = wls_->cofactor().inverse();
+  wls_->evaluate();
+  evaluate_float(sol, *wls_, covariance);
+  _update_ambiguity_state(covariance);
+  if (_fix_ambiguity(covariance, ratio_threshold)) evaluate_fixed(sol, ambiguity_fixer_, *base_pos_);
+  return true;
+}
+
+bool Rtk::solve(RtkModel model) noexcept {
+  switch (model) {
+    case DdBasic:
+      return __RtkPayload::_solve(solution_.last(), ratio_threshold_, logger_);
+    default:
+      return false;
   }
 }
 
@@ -9,6 +9,24 @@ using namespace navp::sensors::gnss;
 
 namespace navp::solution {
 
+// warm start settings
+static constexpr f64 WarmStartMaxGap = 30.0;               // max gap to predict from the previous epoch (s)
+static constexpr f64 AtmosphereReuseElevation = 1.745e-3;  // max elevation change to reuse atmosphere error (rad)
+static constexpr f64 AtmosphereReuseMaxAge = 60.0;         // max age to reuse atmosphere error (s)
+
+// kalman filter settings
+static constexpr f64 FilterMaxGap = 30.0;            // max gap to predict, otherwise reinitialize (s)
+static constexpr f64 AccelerationVariance = 1.0;     // velocity random walk (m^2/s^3)
+static constexpr f64 ClockDriftVariance = 0.1;       // clock drift random walk (m^2/s^3)
+static constexpr f64 ClockVariance = 100.0 * 100.0;  // receiver clock, white noise (m^2)
+static constexpr f64 DopplerVariance = 0.1 * 0.1;    // doppler measurement (m^2/s^2)
+
+// epoch difference (s)
+static inline f64 epoch_diff(const EpochUtc& lhs, const EpochUtc& rhs) noexcept {
+  auto diff = lhs - rhs;
+  return static_cast<f64>(diff.seconds()) + static_cast<f64>(diff.scale_fractional_seconds());
+}
+
 // this function is used to handle the position model
 // - jacobian    (modeled)
 // - observation (modeled)
@@ -47,10 +65,11 @@ void handle_spp_velocity_model(algorithm::WeightedLeastSquare<_Float_t>& wls,
   sv_info->view_vector_to(station_position, jacobian(doppler_index, 0), jacobian(doppler_index, 1),
                           jacobian(doppler_index, 2), distance);
   jacobian(doppler_index, 3) = 1;
-  f64 rate_row0 = (jacobian(doppler_index, 0) * sv_info->vel.x() + jacobian(doppler_index, 1) * sv_info->vel.y() +
-                   jacobian(doppler_index, 2) * sv_info->vel.z()) /
-                  distance;
-  observation(doppler_index) = doppler - rate_row0 + Constants::CLIGHT * sv_info->fd_dtsv;
+  // range rate projected from the satellite velocity, the view vector points from satellite to station
+  f64 rate_row0 = jacobian(doppler_index, 0) * sv_info->vel.x() + jacobian(doppler_index, 1) * sv_info->vel.y() +
+                  jacobian(doppler_index, 2) * sv_info->vel.z();
+  // doppler is positive for approaching satellites, range rate = -lambda * doppler
+  observation(doppler_index) = -doppler + rate_row0 + Constants::CLIGHT * sv_info->fd_dtsv;
 }
 
 void Spp::load_spp_payload() noexcept {
@@ -58,9 +77,10 @@ void Spp::load_spp_payload() noexcept {
       ._set_information(rover_)                                                         // first set information
       ._set_obs_handler(rover_)                                                         // set observation handler
       ._set_solution(const_cast<PvtSolutionRecord*>(std::addressof(solution_.last())))  // set solution to output
+      ._predict_solution(warm_start_ ? std::addressof(solution_.previous()) : nullptr)  // predict position
       ._set_atmosphere_error(satellite_number())                                        // set atmosphere error
       ._set_wls(3 + clock_parameter_number(), signal_number(), rover_->logger())        // set wls
-      ._handle_variance(rover_->settings()->random);                                    // handle variance
+      ._handle_variance(rover_->settings()->random_handler().set_options(GnssRandomHandler::Pseudorange));
 }
 
 __SppPayload& __SppPayload::_set_maskfilters(const TaskConfig& task_config) noexcept {
@@ -85,6 +105,24 @@ __SppPayload& __SppPayload::_set_clock_map(const std::shared_ptr<GnssHandler>& h
   return *this;
 }
 
+__SppPayload& __SppPayload::_set_trop_grid(const std::shared_ptr<GnssHandler>& handler) noexcept {
+  trop_handler_.set_grid(handler->settings()->trop_grid);
+  return *this;
+}
+
+__SppPayload& __SppPayload::_set_ionex(const std::shared_ptr<GnssHandler>& handler) noexcept {
+  iono_handler_.set_ionex(handler->settings()->ionex);
+  return *this;
+}
+
+__SppPayload& __SppPayload::_set_broadcast_iono(const std::shared_ptr<GnssHandler>& handler) noexcept {
+  std::vector<const Navigation*> navigation;
+  std::ranges::for_each(handler->record()->nav,
+                        [&](const GnssNavRecord& record) { navigation.push_back(record.nav.get()); });
+  iono_handler_.set_navigation(std::move(navigation)).set_nequick_cell(handler->settings()->nequick_cell);
+  return *this;
+}
+
 EpochUtc __SppPayload::epoch() const noexcept { return info_->epoch; }
 
 bool __SppPayload::_position_solvable() const noexcept {
@@ -101,9 +139,14 @@ u16 __SppPayload::signal_number() const noexcept {
   return sig_num;
 }
 
-void __SppPayload::_handle_variance(sensors::gnss::RandomModelEnum model) const noexcept {
-  std::ranges::for_each(*obs_handler_,
-                        [model](const GnssRawObsHandler& handler) { handler.handle_signal_variance(model); });
+void __SppPayload::_handle_variance(const GnssRandomHandler& random_handler) const noexcept {
+  std::vector<Sig*> sigs;
+  std::vector<f64> elevation;
+  sigs.reserve(signal_number()), elevation.reserve(signal_number());
+  for (const auto& handler : *obs_handler_) {
+    for (auto sig : handler.sig) sigs.push_back(sig), elevation.push_back(handler.sv_info->elevation);
+  }
+  random_handler.handle(sigs, elevation);
 }
 
 __SppPayload& __SppPayload::_set_atmosphere_error(u16 number) noexcept {
@@ -122,6 +165,20 @@ __SppPayload& __SppPayload::_set_wls(u32 parameter_size, u32 observation_size,
 __SppPayload& __SppPayload::_set_solution(PvtSolutionRecord* sol) noexcept {
   sol_ = sol;
   sol_->time = info_->epoch;  // set solution time
+  sol_->nex = 0;              // reset excluded satellites
+  sol_->iter = 0;             // reset iteration number
+  return *this;
+}
+
+__SppPayload& __SppPayload::_predict_solution(const PvtSolutionRecord* previous) noexcept {
+  warm_started_ = false;
+  if (!previous || previous->mode == SolutionModeEnum::NONE) return *this;
+  auto dt = epoch_diff(sol_->time, previous->time);
+  if (dt <= 0 || dt > WarmStartMaxGap) return *this;
+  sol_->position = previous->position;
+  if (previous->velocity.allFinite()) sol_->position += previous->velocity * dt;  // constant velocity
+  sol_->blh = sol_->position.to_blh();
+  warm_started_ = true;
   return *this;
 }
 
@@ -137,17 +194,54 @@ u8 __SppPayload::clock_parameter_number() const noexcept { return clock_map_.siz
 
 u8 __SppPayload::clock_parameter_index(sensors::gnss::Sv sv) const noexcept { return clock_map_.at(sv.system()); }
 
+i32 __SppPayload::clock_parameter_index(ConstellationEnum sys) const noexcept {
+  auto it = clock_map_.find(sys);
+  return it == clock_map_.end() ? -1 : it->second;
+}
+
 void __SppPayload::_calculate_atmosphere_error(TropModelEnum trop, IonoModelEnum iono) noexcept {
+  batch_index_.clear();
+  batch_system_.clear();
+  batch_azimuth_.clear();
+  batch_elevation_.clear();
   for (u16 sat_index = 0; sat_index < obs_handler_->size(); ++sat_index) {
     auto& obs = obs_handler_->at(sat_index);
-    obs.sv_info->update_ea_from(sol_->position);                  // update satellite elevation and azimuth
-    (*trop_error_)[sat_index] = obs.trop_corr(&sol_->blh, trop);  // calculate trop error
-    (*iono_error_)[sat_index] = obs.iono_corr(&sol_->blh, iono);  // calculate iono error
+    obs.sv_info->update_ea_from(sol_->position);  // update satellite elevation and azimuth
+    // reuse the atmosphere error while the elevation barely changes
+    auto it = atmosphere_cache_.find(obs.sv_info->sv);
+    if (it != atmosphere_cache_.end() &&
+        std::abs(it->second.elevation - obs.sv_info->elevation) < AtmosphereReuseElevation &&
+        std::abs(epoch_diff(info_->epoch, it->second.epoch)) < AtmosphereReuseMaxAge) {
+      (*trop_error_)[sat_index] = it->second.trop;
+      (*iono_error_)[sat_index] = it->second.iono;
+      continue;
+    }
+    batch_index_.push_back(sat_index);
+    batch_system_.push_back(obs.sv_info->sv.system());
+    batch_azimuth_.push_back(obs.sv_info->azimuth);
+    batch_elevation_.push_back(obs.sv_info->elevation);
+  }
+  if (batch_index_.empty()) return;
+  // atmosphere error of the remaining satellites, the zenith delays and the maps are shared by the station
+  trop_slant_.resize(batch_index_.size());
+  iono_slant_.resize(batch_index_.size());
+  trop_handler_.set_trop_model(trop).set_station(info_->epoch, sol_->blh).handle(batch_elevation_, trop_slant_);
+  iono_handler_.set_iono_model(iono).set_station(info_->epoch, sol_->blh);
+  iono_handler_.handle(batch_system_, batch_azimuth_, batch_elevation_, iono_slant_);
+  for (size_t k = 0; k < batch_index_.size(); ++k) {
+    auto sat_index = batch_index_[k];
+    auto& obs = obs_handler_->at(sat_index);
+    (*trop_error_)[sat_index] = trop_slant_[k];
+    (*iono_error_)[sat_index] = iono_slant_[k];
+    atmosphere_cache_.insert_or_assign(
+        obs.sv_info->sv,
+        AtmosphereCache{info_->epoch, obs.sv_info->elevation, (*trop_error_)[sat_index], (*iono_error_)[sat_index]});
   }
 }
 
 f64 __SppPayload::_position_iter_once() noexcept {
   wls_->correct();
+  ++sol_->iter;
   sol_->position = wls_->parameter().block(0, 0, 3, 1);
   sol_->blh = sol_->position.to_blh();
   return wls_->parameter_correction().block(0, 0, 3, 1).norm();
@@ -200,12 +294,84 @@ void __SppPayload::_velocity_evaluate() noexcept {
   sol_->qv[2] = static_cast<f32>(cofactor(0, 2)), sol_->qv[3] = static_cast<f32>(cofactor(1, 1)),
   sol_->qv[4] = static_cast<f32>(cofactor(1, 2)), sol_->qv[5] = static_cast<f32>(cofactor(2, 2));
   sol_->sigma_v = wls_->sigma();
-  wls_.reset();  // reset wls
+  sol_->dtr[5] = wls_->parameter()(3);  // clock drift
+  wls_.reset();                         // reset wls
+}
+
+// detect the inconsistency of the last linearized position model, and exclude the satellite
+// whose removal reduces the residuals most
+// return true if a satellite is excluded, which means the position should be solved again
+bool __SppPayload::_position_fde(std::shared_ptr<spdlog::logger> logger) noexcept {
+  constexpr u8 max_exclusion = sizeof(sol_->excluded) / sizeof(sol_->excluded[0]);
+  if (sol_->nex >= max_exclusion) return false;
+  if (!fde_.factorize(wls_->jacobian(), wls_->weight().diagonal(), wls_->observation())) return false;
+  auto stat = fde_.statistic();
+  // consistent, or no redundancy left to identify the faulty satellite
+  if (stat.consistent() || stat.dof < 2) return false;
+  sig_group_.clear();
+  u16 sig_index = 0;
+  for (auto& obs : *obs_handler_) {
+    sig_group_.push_back(sig_index);
+    sig_index += static_cast<u16>(obs.sig.size());
+  }
+  sig_group_.push_back(sig_index);
+  auto worst = fde_.worst_group(sig_group_);
+  if (worst < 0) return false;
+  _exclude_satellite(static_cast<u16>(worst), logger);
+  return true;
+}
+
+void __SppPayload::_exclude_satellite(u16 index, std::shared_ptr<spdlog::logger> logger) noexcept {
+  sol_->excluded[sol_->nex++] = obs_handler_->at(index).sv_info->sv;
+  obs_handler_->erase(obs_handler_->begin() + index);
+  trop_error_->erase(trop_error_->begin() + index);
+  iono_error_->erase(iono_error_->begin() + index);
+  _set_wls(3 + clock_parameter_number(), signal_number(), logger);
+}
+
+__SppFilterPayload::__SppFilterPayload(u16 capacity) noexcept : kf_(capacity) {}
+
+void __SppFilterPayload::_initialize(const PvtSolutionRecord& sol, u8 clock_number) noexcept {
+  kf_.clear();
+  for (u8 i = 0; i < 3; ++i) kf_.add_state(sol.position(i), 10.0 * 10.0);
+  for (u8 i = 0; i < 3; ++i) kf_.add_state(sol.velocity.allFinite() ? sol.velocity(i) : 0.0, 1.0);
+  kf_.add_state(sol.dtr[5], 1.0);
+  for (u8 i = 0; i < clock_number; ++i) kf_.add_state(0.0, ClockVariance);
+  initialized_ = true;
+}
+
+void __SppFilterPayload::_predict(f64 dt) noexcept {
+  // constant velocity
+  for (u16 i = 0; i < 3; ++i) {
+    kf_.integrate(PositionIndex + i, VelocityIndex + i, dt);
+    kf_.add_process_noise(VelocityIndex + i, AccelerationVariance * dt);
+  }
+  kf_.add_process_noise(ClockDriftIndex, ClockDriftVariance * dt);
+}
+
+Spp::Spp(const TaskConfig& task_config, bool enabled_mt) : Spp(task_config, task_config.rover_station(enabled_mt)) {
+  // only the rover is smoothed, the stations of a task would share the store
+  if (filter_ && !task_config.solution().smoother.empty()) {
+    smoother_ = std::make_unique<algorithm::RtsSmoother>(task_config.solution().smoother);
+  }
 }
 
-Spp::Spp(const TaskConfig& task_config, bool enabled_mt)
-    : rover_(task_config.rover_station(enabled_mt)), solution_(task_config.solution().capacity) {
-  this->_set_clock_map(rover_)._set_maskfilters(task_config);
+Spp::Spp(const TaskConfig& task_config, std::shared_ptr<GnssHandler> station)
+    : rover_(std::move(station)),
+      solution_(task_config.solution().capacity),
+      raim_(task_config.solution().raim),
+      warm_start_(task_config.solution().warm_start),
+      algorithm_(task_config.solution().algorithm) {
+  this->_set_clock_map(rover_)._set_trop_grid(rover_)._set_ionex(rover_)._set_broadcast_iono(rover_)._set_maskfilters(
+      task_config);
+  if (algorithm_ == algorithm::AlgorithmEnum::KalmanFilter) {
+    filter_ = std::make_unique<__SppFilterPayload>(__SppFilterPayload::ClockIndex + clock_parameter_number());
+  }
+  if (algorithm_ == algorithm::AlgorithmEnum::FactorGraphOptimization) {
+    fgo::FactorGraph::Options options;
+    options.threads = task_config.solution().graph_threads;
+    graph_ = std::make_unique<fgo::GnssFactorGraph>(task_config.solution().window, options);
+  }
 }
 
 auto Spp::solution() const noexcept -> const PvtSolutionRecord* { return std::addressof(solution_.last()); }
@@ -239,6 +405,7 @@ void Spp::model_spp_velocity() noexcept {
     doppler[sat_index] /= dopper_obs_num;
   }
   _set_wls(4, sat_nums, rover_->logger());
+  _wls().parameter().setZero();  // velocity model is linear, start from zero
   for (u16 sat_index = 0; sat_index < sat_nums; ++sat_index) {
     auto sv_info = _raw_obs_at(sat_index).sv_info;
     handle_spp_velocity_model(_wls(), solution_.last().position, sv_info, doppler[sat_index], sat_index);
@@ -249,7 +416,9 @@ void Spp::model_spp_velocity() noexcept {
 bool Spp::solve_position() noexcept {
   if (!_position_solvable()) return false;
   u8 iteration = 0;  // iteration number
-  bool atmosphere_corrected = false;
+  // the predicted position is close enough to correct the atmosphere error at once
+  bool atmosphere_corrected = _warm_started();
+  if (atmosphere_corrected) _calculate_atmosphere_error(rover_->settings()->trop, rover_->settings()->iono);
   while (true) {
     model_spp_position();
     auto position_correction = _position_iter_once();
@@ -260,6 +429,11 @@ bool Spp::solve_position() noexcept {
     }
     // iteration end
     if (position_correction < 1e-6 || iteration > 9) {
+      // a satellite is excluded, solve again with the remaining satellites
+      if (raim_ && _position_solvable() && _position_fde(rover_->logger())) {
+        iteration = 0;
+        continue;
+      }
       _position_evaluate();
       break;
     }
@@ -271,7 +445,184 @@ bool Spp::solve_position() noexcept {
 bool Spp::solve_velocity() noexcept {
   if (!_velocity_solvable()) return false;
   model_spp_velocity();
-  auto velocity_correction = _velocity_iter_once();
+  _velocity_iter_once();
+  _velocity_evaluate();
+  return true;
+}
+
+bool Spp::solve_filter() noexcept {
+  if (!_position_solvable()) return false;
+  auto& kf = filter_->_kf();
+  auto& sol = solution_.last();
+  const auto& previous = solution_.previous();
+  auto dt = epoch_diff(sol.time, previous.time);
+  // initialize (or reinitialize after a gap) by least square
+  if (!filter_->_initialized() || previous.mode == SolutionModeEnum::NONE || dt <= 0 || dt > FilterMaxGap) {
+    if (!solve_position() || !solve_velocity()) return false;
+    filter_->_initialize(sol, clock_parameter_number());
+    // a new segment of the smoother
+    if (smoother_) smoother_->filtered(sol.time, kf.state(), kf.covariance());
+    return true;
+  }
+  filter_->_predict(dt);
+
+  // atmosphere error at the predicted position
+  auto state = kf.state();
+  sol.position = state.segment<3>(__SppFilterPayload::PositionIndex);
+  sol.blh = sol.position.to_blh();
+  _calculate_atmosphere_error(rover_->settings()->trop, rover_->settings()->iono);
+
+  // receiver clocks are white noise, reinitialized by the mean residual of each constellation
+  auto clock_number = clock_parameter_number();
+  std::array<f64, 21> clock_residual{};
+  std::array<u16, 21> clock_count{};
+  for (u16 sat_index = 0; sat_index < satellite_number(); ++sat_index) {
+    auto& obs = _raw_obs_at(sat_index);
+    auto view = obs.sv_info->view_vector_to(sol.position);
+    auto clock_index = clock_parameter_index(obs.sv_info->sv);
+    for (auto sig : obs.sig) {
+      clock_residual[clock_index] += sig->pseudorange - view.distance + Constants::CLIGHT * obs.sv_info->dtsv -
+                                     _trop_error_at(sat_index) - _iono_error_at(sat_index);
+      ++clock_count[clock_index];
+    }
+  }
+  for (u8 i = 0; i < clock_number; ++i) {
+    auto value = clock_count[i] ? clock_residual[i] / clock_count[i] : 0.0;
+    kf.reset_state(__SppFilterPayload::ClockIndex + i, value, ClockVariance);
+  }
+  if (smoother_) {
+    // constant velocity, the clocks are not predicted from the previous epoch
+    algorithm::RtsSmoother::Matrix transition = algorithm::RtsSmoother::Matrix::Identity(kf.size(), kf.size());
+    for (u8 i = 0; i < 3; ++i) {
+      transition(__SppFilterPayload::PositionIndex + i, __SppFilterPayload::VelocityIndex + i) = dt;
+    }
+    for (u8 i = 0; i < clock_number; ++i) {
+      transition(__SppFilterPayload::ClockIndex + i, __SppFilterPayload::ClockIndex + i) = 0.0;
+    }
+    smoother_->predicted(sol.time, state, kf.covariance(), transition);
+  }
+
+  // sequential pseudorange and doppler updates, linearized at the latest state
+  const f64 gate = algorithm::details::chisqr_threshold(1);
+  u16 index[4];
+  f64 coeff[4];
+  u8 used = 0;
+  for (u16 sat_index = 0; sat_index < satellite_number(); ++sat_index) {
+    auto& obs = _raw_obs_at(sat_index);
+    auto sv_info = obs.sv_info;
+    u16 clock_index = __SppFilterPayload::ClockIndex + clock_parameter_index(sv_info->sv);
+    bool accepted = false;
+    f64 doppler = 0;
+    for (auto sig : obs.sig) {
+      utils::CoordinateXyz position(state.segment<3>(__SppFilterPayload::PositionIndex));
+      auto view = sv_info->view_vector_to(position);
+      index[0] = 0, index[1] = 1, index[2] = 2, index[3] = clock_index;
+      coeff[0] = view.x, coeff[1] = view.y, coeff[2] = view.z, coeff[3] = 1;
+      auto innovation = sig->pseudorange - view.distance - state(clock_index) + Constants::CLIGHT * sv_info->dtsv -
+                        _iono_error_at(sat_index) - _trop_error_at(sat_index);
+      accepted |= kf.update(index, coeff, innovation, sig->code_var, gate);
+      doppler += sig->doppler * Constants::wave_length(sig->freq);
+    }
+    used += accepted;
+    if (obs.sig.empty()) continue;
+    // average doppler on single frequency, range rate = -lambda * doppler
+    doppler /= obs.sig.size();
+    utils::CoordinateXyz position(state.segment<3>(__SppFilterPayload::PositionIndex));
+    auto view = sv_info->view_vector_to(position);
+    utils::NavVector3f64 los(view.x, view.y, view.z);
+    index[0] = 3, index[1] = 4, index[2] = 5, index[3] = __SppFilterPayload::ClockDriftIndex;
+    coeff[0] = view.x, coeff[1] = view.y, coeff[2] = view.z, coeff[3] = 1;
+    auto innovation = -doppler + los.dot(sv_info->vel) + Constants::CLIGHT * sv_info->fd_dtsv -
+                      los.dot(state.segment<3>(__SppFilterPayload::VelocityIndex)) -
+                      state(__SppFilterPayload::ClockDriftIndex);
+    kf.update(index, coeff, innovation, DopplerVariance, gate);
+  }
+
+  // solution
+  auto covariance = kf.covariance();
+  sol.position = state.segment<3>(__SppFilterPayload::PositionIndex);
+  sol.velocity = state.segment<3>(__SppFilterPayload::VelocityIndex);
+  sol.blh = sol.position.to_blh();
+  for (u8 i = 0, k = 0; i < 3; ++i) {
+    for (u8 j = i; j < 3; ++j, ++k) {
+      sol.qr[k] = static_cast<f32>(covariance(i, j));
+      sol.qv[k] = static_cast<f32>(covariance(3 + i, 3 + j));
+    }
+  }
+  sol.sigma_r = sol.sigma_v = 1.0;
+  if (auto bds = clock_parameter_index(ConstellationEnum::BDS); bds >= 0) {
+    sol.dtr[0] = state(__SppFilterPayload::ClockIndex + bds);
+  }
+  if (auto gps = clock_parameter_index(ConstellationEnum::GPS); gps >= 0) {
+    sol.dtr[1] = state(__SppFilterPayload::ClockIndex + gps);
+  }
+  sol.dtr[5] = state(__SppFilterPayload::ClockDriftIndex);
+  sol.mode = SolutionModeEnum::SINGLE;
+  sol.type = 0;
+  sol.ns = used;
+  if (smoother_) smoother_->filtered(sol.time, state, covariance);
+  return true;
+}
+
+bool Spp::smooth(const std::function<void(const PvtSolutionRecord&)>& callback) {
+  if (!smoother_) return false;
+  PvtSolutionRecord sol;
+  auto bds = clock_parameter_index(ConstellationEnum::BDS), gps = clock_parameter_index(ConstellationEnum::GPS);
+  return smoother_->smooth([&](const EpochUtc& epoch, const algorithm::RtsSmoother::Vector& state,
+                               const algorithm::RtsSmoother::Matrix& covariance) {
+    sol.time = epoch;
+    sol.position = state.segment<3>(__SppFilterPayload::PositionIndex);
+    sol.velocity = state.segment<3>(__SppFilterPayload::VelocityIndex);
+    sol.blh = sol.position.to_blh();
+    for (u8 i = 0, k = 0; i < 3; ++i) {
+      for (u8 j = i; j < 3; ++j, ++k) {
+        sol.qr[k] = static_cast<f32>(covariance(i, j));
+        sol.qv[k] = static_cast<f32>(covariance(3 + i, 3 + j));
+      }
+    }
+    sol.sigma_r = sol.sigma_v = 1.0;
+    if (bds >= 0) sol.dtr[0] = state(__SppFilterPayload::ClockIndex + bds);
+    if (gps >= 0) sol.dtr[1] = state(__SppFilterPayload::ClockIndex + gps);
+    sol.dtr[5] = state(__SppFilterPayload::ClockDriftIndex);
+    sol.mode = SolutionModeEnum::SINGLE;
+    sol.type = 0;
+    callback(sol);
+  });
+}
+
+bool Spp::solve_graph() noexcept {
+  // the least square solution linearizes the new epoch and corrects its atmosphere error
+  if (!solve_position()) return false;
+  auto& sol = solution_.last();
+  const auto& previous = solution_.previous();
+  auto dt = epoch_diff(sol.time, previous.time);
+  if (previous.mode == SolutionModeEnum::NONE || dt <= 0 || dt > FilterMaxGap) graph_->clear();
+
+  std::vector<fgo::PseudorangeObservation> observations;
+  for (u16 sat_index = 0; sat_index < satellite_number(); ++sat_index) {
+    auto& obs = _raw_obs_at(sat_index);
+    auto sv_info = obs.sv_info;
+    auto clock_index = clock_parameter_index(sv_info->sv);
+    for (auto sig : obs.sig) {
+      observations.push_back({.sv_pos = sv_info->pos,
+                              .pseudorange = sig->pseudorange + Constants::CLIGHT * sv_info->dtsv -
+                                             _trop_error_at(sat_index) - _iono_error_at(sat_index),
+                              .variance = sig->code_var,
+                              .clock = clock_index});
+    }
+  }
+  graph_->add_epoch(sol.time, sol.position, observations);
+  // keep the least square solution if the window is not solved
+  if (!graph_->optimize()) {
+    rover_->logger()->debug("Factor graph not solved at {}, keep the least square solution", sol.time);
+    solve_velocity();
+    return true;
+  }
+  sol.position = graph_->position();
+  sol.blh = sol.position.to_blh();
+  if (auto bds = clock_parameter_index(ConstellationEnum::BDS); bds >= 0) sol.dtr[0] = graph_->clock(bds);
+  if (auto gps = clock_parameter_index(ConstellationEnum::GPS); gps >= 0) sol.dtr[1] = graph_->clock(gps);
+  solve_velocity();
   return true;
 }
 
@@ -282,6 +633,8 @@ bool Spp::load_next_epoch() noexcept {
 
 bool Spp::solve() noexcept {
   load_spp_payload();
+  if (algorithm_ == algorithm::AlgorithmEnum::KalmanFilter) return solve_filter();
+  if (algorithm_ == algorithm::AlgorithmEnum::FactorGraphOptimization) return solve_graph();
   bool done = false;
   done = solve_position();
   done = solve_velocity();
@@ -15,9 +15,18 @@ TaskConfig::TaskConfig(std::string_view cfg_path) : config_(cfg_path) {
   __solution.mode = config_.solution_mode();
   __solution.algorithm = config_.algorithm();
   __solution.capacity = config_.capacity();
+  __solution.raim = config_.raim();
+  __solution.warm_start = config_.warm_start();
+  __solution.base_max_age = config_.base_max_age();
+  __solution.network_mode = config_.network_mode();
+  __solution.window = config_.window();
+  __solution.graph_threads = config_.graph_threads();
+  __solution.smoother = config_.smoother();
 
   // output
   __output.output_dir = config_.output_dir();
+  __output.file_type = static_cast<io::custom::SolutionFileEnum>(config_.output_format());
+  __output.format_options = config_.output_options();
   if (!std::filesystem::exists(__output.output_dir)) {
     try {
       std::filesystem::create_directories(__output.output_dir);
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <source_location>
+#include <utility>
 
 #define _normal_logger_pattern "[%Y-%m-%d %H:%M:%S.%e] [%l] [thread %t] %v"
 #define _data_logger_pattern "%v"
@@ -54,6 +55,22 @@ std::string source_information(std::source_location location) {
                     location.function_name());
 }
 
+auto LogRateLimiter::allow(u64 key) noexcept -> std::optional<u32> {
+  auto now = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& state = states_.try_emplace(key, KeyState{.begin = now, .passed = 0, .suppressed = 0}).first->second;
+  if (now - state.begin >= period_) {
+    state.begin = now;
+    state.passed = 0;
+  }
+  if (state.passed >= burst_) {
+    ++state.suppressed;
+    return std::nullopt;
+  }
+  ++state.passed;
+  return std::exchange(state.suppressed, 0);
+}
+
 namespace details {
 
 std::shared_ptr<spdlog::logger> global_formatted_logger = create_common_spdlogger("navlogger.log", "nav_info_logger");
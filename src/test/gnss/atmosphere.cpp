@@ -0,0 +1,58 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <chrono>
+#include <vector>
+
+#include "../doctest.h"
+#include "sensors/gnss/atmosphere.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+
+static constexpr navp::details::Date date = {.year = 2021, .month = 11, .day = 14, .hour = 3};
+
+TEST_CASE("batched trop error equals the one of each satellite") {
+  auto epoch = EpochUtc::from_date(date);
+  std::vector<f64> elevation, trop(40);
+  for (u16 i = 0; i < 40; ++i) elevation.push_back(-0.1 + 0.04 * i);
+  for (f64 lat : {-0.7, 0.1, 0.5, 1.2}) {
+    for (f64 hgt : {-50.0, 30.0, 2000.0}) {
+      utils::CoordinateBlh pos(lat, 2.0, hgt);
+      TropHandler handler;
+      handler.set_station(epoch, pos).handle(elevation, trop);
+      for (u16 i = 0; i < elevation.size(); ++i) {
+        EphemerisResult sv_info;
+        sv_info.elevation = elevation[i];
+        auto expected = AtmosphereHandler{}.set_time(epoch).set_sv_info(&sv_info).handle_trop(&pos);
+        CHECK(trop[i] == doctest::Approx(expected).epsilon(1e-12));
+        if (elevation[i] < 0) CHECK(trop[i] == 0.0);
+      }
+    }
+  }
+}
+
+TEST_CASE("zenith delays are kept while the station barely moves") {
+  auto epoch = EpochUtc::from_date(date);
+  utils::CoordinateBlh pos(0.5, 2.0, 30.0);
+  TropHandler handler;
+  handler.set_station(epoch, pos);
+  auto dry = handler.dry_zenith(), wet = handler.wet_zenith();
+  CHECK(dry > 2.0);
+  CHECK(wet > 0.0);
+
+  // same day, within the tolerances
+  utils::CoordinateBlh near(0.5 + 0.5 * TropHandler::LatitudeTolerance, 2.1, 30.5);
+  handler.set_station(epoch + std::chrono::hours(1), near);
+  CHECK(handler.dry_zenith() == dry);
+
+  // the station moves up
+  utils::CoordinateBlh up(0.5, 2.0, 500.0);
+  handler.set_station(epoch, up);
+  CHECK(handler.dry_zenith() < dry);
+
+  // out of the model
+  std::vector<f64> elevation{0.5, 1.0}, trop(2, 1.0);
+  utils::CoordinateBlh space(0.5, 2.0, 3e4);
+  handler.set_station(epoch, space).handle(elevation, trop);
+  CHECK(trop[0] == 0.0);
+  CHECK(trop[1] == 0.0);
+}
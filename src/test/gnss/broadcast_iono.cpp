@@ -0,0 +1,214 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <initializer_list>
+#include <numbers>
+#include <vector>
+
+#include "../doctest.h"
+#include "sensors/gnss/atmosphere.hpp"
+#include "sensors/gnss/constants.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+
+static constexpr navp::details::Date date = {.year = 2021, .month = 11, .day = 14};
+static constexpr f64 pi = std::numbers::pi, d2r = pi / 180;
+// delay on GPS L1 of 1 TECU (m)
+static constexpr f64 factor = 40.3E16 / (1575.42E6 * 1575.42E6);
+
+static void add(Navigation& nav, ConstellationEnum system, NavMsgTypeEnum type, utils::GTime ttm,
+                std::initializer_list<f64> values) {
+  auto& ion = nav.ionMap[system][type][ttm];
+  ion.type = type;
+  ion.sv.system() = system;
+  ion.ttm = ttm;
+  std::ranges::copy(values, ion.vals);
+}
+
+// klobuchar of IS-GPS-200, one satellite
+static f64 klobuchar_reference(const ION& ion, f64 tow, f64 lat, f64 lon, f64 az, f64 el) {
+  f64 psi = 0.0137 / (el / pi + 0.11) - 0.022;
+  f64 phi = std::clamp(lat / pi + psi * std::cos(az), -0.416, 0.416);
+  f64 lam = lon / pi + psi * std::sin(az) / std::cos(phi * pi);
+  phi += 0.064 * std::cos((lam - 1.617) * pi);
+  f64 tt = 43200.0 * lam + tow;
+  tt -= std::floor(tt / 86400.0) * 86400.0;
+  f64 f = 1.0 + 16.0 * std::pow(0.53 - el / pi, 3.0);
+  f64 amp = std::max(ion.a0 + phi * (ion.a1 + phi * (ion.a2 + phi * ion.a3)), 0.0);
+  f64 per = std::max(ion.b0 + phi * (ion.b1 + phi * (ion.b2 + phi * ion.b3)), 72000.0);
+  f64 x = 2.0 * pi * (tt - 50400.0) / per;
+  return Constants::CLIGHT * f * (std::abs(x) < 1.57 ? 5E-9 + amp * (1.0 + x * x * (-0.5 + x * x / 24.0)) : 5E-9);
+}
+
+static constexpr std::initializer_list<f64> gps_header{0.1118E-07, -0.7451E-08, -0.5961E-07, 0.1192E-06,
+                                                       0.1167E+06, -0.2294E+06, -0.1311E+06, 0.1049E+07};
+
+TEST_CASE("the newest coefficients are selected once per validity") {
+  auto epoch = EpochUtc::from_date(date);
+  utils::GTime time(epoch), later(epoch + std::chrono::hours(2));
+  Navigation nav, other;
+  add(nav, ConstellationEnum::GPS, NavMsgTypeEnum::LNAV, {}, gps_header);
+  add(nav, ConstellationEnum::GPS, NavMsgTypeEnum::LNAV, later, {2E-8});
+  add(nav, ConstellationEnum::BDS, NavMsgTypeEnum::D1D2, {}, {3E-8});
+  add(nav, ConstellationEnum::BDS, NavMsgTypeEnum::CNVX, {}, {4E-8});
+  add(nav, ConstellationEnum::GAL, NavMsgTypeEnum::IFNV, {}, {80.0, 0.4, 0.0});
+  add(other, ConstellationEnum::GPS, NavMsgTypeEnum::CNAV, utils::GTime(epoch + std::chrono::hours(4)), {5E-8});
+
+  BroadcastIonoCoefficients coefficients;
+  CHECK(!coefficients.select(time));
+  CHECK(!coefficients.ion(BroadcastIonoModel::GPS_KLOBUCHAR));
+
+  coefficients.set_navigation({&nav, &other});
+  CHECK(coefficients.select(time));
+  REQUIRE(coefficients.ion(BroadcastIonoModel::GPS_KLOBUCHAR));
+  CHECK(coefficients.ion(BroadcastIonoModel::GPS_KLOBUCHAR)->a0 == 0.1118E-07);
+  // the BDGIM coefficients of the BDS CNAV messages are not klobuchar ones
+  CHECK(coefficients.ion(BroadcastIonoModel::BDS_KLOBUCHAR)->a0 == 3E-8);
+  CHECK(coefficients.ion(BroadcastIonoModel::NEQUICK_G)->ai1 == 0.4);
+  // kept until the next message
+  CHECK(!coefficients.select(utils::GTime(epoch + std::chrono::hours(1))));
+  CHECK(coefficients.select(utils::GTime(epoch + std::chrono::hours(3))));
+  CHECK(coefficients.ion(BroadcastIonoModel::GPS_KLOBUCHAR)->a0 == 2E-8);
+  // the newest of every record
+  CHECK(coefficients.select(utils::GTime(epoch + std::chrono::hours(5))));
+  CHECK(coefficients.ion(BroadcastIonoModel::GPS_KLOBUCHAR)->a0 == 5E-8);
+  // back in time
+  CHECK(coefficients.select(time));
+  CHECK(coefficients.ion(BroadcastIonoModel::GPS_KLOBUCHAR)->a0 == 0.1118E-07);
+}
+
+TEST_CASE("klobuchar of gps and bds for every satellite") {
+  Navigation nav;
+  add(nav, ConstellationEnum::GPS, NavMsgTypeEnum::LNAV, {}, gps_header);
+  const auto& ion = nav.ionMap[ConstellationEnum::GPS][NavMsgTypeEnum::LNAV].begin()->second;
+  f64 lat = 30 * d2r, lon = 114 * d2r, tow = 3 * 86400 + 5 * 3600;
+
+  std::vector<f64> azimuth{0, 1, 2.5, 4, 0}, elevation{pi / 2, 0.2, 0.6, 1.0, -0.1}, iono(5);
+  klobuchar(ion, BroadcastIonoModel::GPS_KLOBUCHAR, tow, lat, lon, azimuth, elevation, iono);
+  for (size_t i = 0; i < 4; ++i) {
+    CHECK(iono[i] == doctest::Approx(klobuchar_reference(ion, tow, lat, lon, azimuth[i], elevation[i])));
+  }
+  CHECK(iono[1] > iono[0]);
+  CHECK(iono[4] == 0.0);
+
+  // the night floor of bds on B1I, scaled to GPS L1
+  klobuchar(ion, BroadcastIonoModel::BDS_KLOBUCHAR, 0, 0, 0, azimuth, elevation, iono);
+  constexpr f64 scale = (1561.098E6 * 1561.098E6) / (1575.42E6 * 1575.42E6);
+  CHECK(iono[0] == doctest::Approx(Constants::CLIGHT * 5E-9 * scale));
+  CHECK(iono[1] > 2 * iono[0]);
+  CHECK(iono[4] == 0.0);
+}
+
+TEST_CASE("nequick-approx rays integrate the profiles") {
+  f64 lat = 30 * d2r, lon = 114 * d2r;
+  NequickApprox nequick;
+  // local noon
+  nequick.set_coefficients({80.0, 0.4, 0.0}).set_station(lat, lon, 50, 11, 4.4);
+  CHECK(nequick.az() > 80.0);
+
+  auto profile = nequick.profile(lat, lon, 4.4);
+  CHECK(profile.hmF2 > 200);
+  CHECK(profile.hmF2 < 500);
+  CHECK(profile.hmF1 > profile.hmE);
+  CHECK(NequickApprox::density(profile, profile.hmF2) == doctest::Approx(profile.AF2 / 4).epsilon(0.1));
+  CHECK(NequickApprox::density(profile, 90) == 0.0);
+
+  // the vertical ray against a fine sum of the profile
+  f64 vertical = 0;
+  for (f64 h = 100, step = 0.25; h < NequickApprox::TopHeight; h += step) {
+    if (h > 2000) step = 5;
+    vertical += 0.5 * (NequickApprox::density(profile, h) + NequickApprox::density(profile, h + step)) * step * 0.01;
+  }
+  std::vector<f64> azimuth{0, 0, 2, pi}, elevation{pi / 2, 0.3, 0.3, -0.1}, tec(4);
+  nequick.stec(azimuth, elevation, tec);
+  CHECK(tec[0] == doctest::Approx(vertical).epsilon(0.01));
+  CHECK(tec[0] > 5);
+  CHECK(tec[0] < 150);
+  CHECK(tec[1] > 2 * tec[0]);
+  CHECK(tec[3] == 0.0);
+
+  // lower at night
+  std::vector<f64> night(4);
+  nequick.set_station(lat, lon, 50, 11, 16.4).stec(azimuth, elevation, night);
+  CHECK(night[0] < tec[0] / 2);
+}
+
+TEST_CASE("nequick-approx profiles memoized per pierce point cell") {
+  f64 lat = 30 * d2r, lon = 114 * d2r;
+  std::vector<f64> azimuth, elevation;
+  for (f64 az = 0; az < 2 * pi; az += pi / 8) {
+    azimuth.push_back(az), elevation.push_back(0.5);
+    azimuth.push_back(az), elevation.push_back(1.2);
+  }
+  std::vector<f64> exact(azimuth.size()), memoized(azimuth.size());
+  NequickApprox nequick, cells;
+  nequick.set_coefficients({80.0, 0.4, 0.0}).set_station(lat, lon, 50, 11, 4.4).stec(azimuth, elevation, exact);
+  cells.set_coefficients({80.0, 0.4, 0.0}).set_cell_size(2.5).set_station(lat, lon, 50, 11, 4.4);
+  cells.stec(azimuth, elevation, memoized);
+  // the low rays cross the horizontal gradients with the profile of their pierce point
+  for (size_t i = 0; i < exact.size(); ++i) CHECK(memoized[i] == doctest::Approx(exact[i]).epsilon(0.15));
+  auto count = cells.memoized();
+  CHECK(count > 0);
+  CHECK(count < azimuth.size());
+
+  // kept in the same quarter of an hour and a slightly moved station
+  cells.set_station(lat + 1E-7, lon, 60, 11, 4.45).stec(azimuth, elevation, memoized);
+  CHECK(cells.memoized() == count);
+  // dropped in the next one
+  cells.set_station(lat, lon, 50, 11, 4.7);
+  CHECK(cells.memoized() == 0);
+  cells.set_coefficients({80.0, 0.5, 0.0}).set_station(lat, lon, 50, 11, 4.7).stec(azimuth, elevation, memoized);
+  CHECK(cells.memoized() == count);
+}
+
+TEST_CASE("satellites are routed to the broadcast model of their constellation") {
+  auto epoch = EpochUtc::from_date(date) + std::chrono::hours(5);
+  utils::CoordinateBlh pos(30 * d2r, 114 * d2r, 50);
+  Navigation nav;
+  add(nav, ConstellationEnum::GPS, NavMsgTypeEnum::LNAV, {}, gps_header);
+  add(nav, ConstellationEnum::BDS, NavMsgTypeEnum::D1D2, {}, gps_header);
+  add(nav, ConstellationEnum::GAL, NavMsgTypeEnum::IFNV, {}, {80.0, 0.4, 0.0});
+
+  std::vector<ConstellationEnum> system{ConstellationEnum::GPS, ConstellationEnum::BDS, ConstellationEnum::GAL,
+                                        ConstellationEnum::GLO};
+  std::vector<f64> azimuth(4, 1.0), elevation(4, 0.5), iono(4);
+  IonoHandler handler;
+  handler.set_iono_model(IonoModelEnum::BROADCAST).set_navigation({&nav}).set_station(epoch, pos);
+  handler.handle(system, azimuth, elevation, iono);
+  utils::GTow tow = utils::GTime(epoch);
+  const auto& ion = nav.ionMap[ConstellationEnum::GPS][NavMsgTypeEnum::LNAV].begin()->second;
+  CHECK(iono[0] == doctest::Approx(klobuchar_reference(ion, tow, pos.x(), pos.y(), 1.0, 0.5)));
+  CHECK(iono[1] > 0);
+  CHECK(iono[1] != doctest::Approx(iono[0]));
+  NequickApprox reference;
+  std::vector<f64> tec(1);
+  reference.set_coefficients({80.0, 0.4, 0.0}).set_station(pos.x(), pos.y(), pos.z(), 11, 5.0);
+  reference.stec(std::span(azimuth).first(1), std::span(elevation).first(1), tec);
+  CHECK(iono[2] == doctest::Approx(factor * tec[0]));
+  CHECK(iono[3] == iono[0]);
+
+  // one model for every satellite
+  std::vector<f64> nequick(4);
+  handler.set_iono_model(IonoModelEnum::NEQUICK_APPROX)
+      .set_station(epoch, pos)
+      .handle(system, azimuth, elevation, nequick);
+  CHECK(nequick[0] == doctest::Approx(iono[2]));
+  CHECK(nequick[1] == doctest::Approx(iono[2]));
+  handler.set_iono_model(IonoModelEnum::KLOBUCHAR).set_station(epoch, pos).handle(system, azimuth, elevation, iono);
+  CHECK(iono[2] == iono[0]);
+
+  // the klobuchar of gps for a constellation without messages
+  Navigation gps;
+  add(gps, ConstellationEnum::GPS, NavMsgTypeEnum::LNAV, {}, gps_header);
+  handler.set_iono_model(IonoModelEnum::BROADCAST).set_navigation({&gps}).set_station(epoch, pos);
+  handler.handle(system, azimuth, elevation, iono);
+  CHECK(iono[2] == iono[0]);
+  CHECK(iono[1] == iono[0]);
+
+  // without messages
+  IonoHandler none;
+  none.set_iono_model(IonoModelEnum::BROADCAST).set_station(epoch, pos).handle(system, azimuth, elevation, iono);
+  CHECK(iono[0] == 0.0);
+}
@@ -0,0 +1,118 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <numbers>
+#include <string>
+#include <vector>
+
+#include "../doctest.h"
+#include "ionex_writer.hpp"
+#include "sensors/gnss/atmosphere.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+using namespace navp::test;
+
+static constexpr navp::details::Date date = {.year = 2021, .month = 11, .day = 14};
+static constexpr f64 d2r = std::numbers::pi / 180;
+
+// tec of the synthetic maps, linear in latitude and longitude
+static f64 field(u32 map, f64 lat, f64 lon) { return 100 + lat + 0.1 * (lon + 180) + 10 * map; }
+
+// hourly maps of 2021-11-14 with a missing node in the first map and the rms of the second one
+static auto write_ionex(const char* name) -> std::filesystem::path {
+  auto path = std::filesystem::temp_directory_path() / name;
+  std::ofstream stream(path);
+  stream << ionex_record("     1.0            IONOSPHERE MAPS     GPS", "IONEX VERSION / TYPE");
+  stream << ionex_record(ionex_epoch(2021, 11, 14, 0), "EPOCH OF FIRST MAP");
+  stream << ionex_record(ionex_epoch(2021, 11, 14, 2), "EPOCH OF LAST MAP");
+  stream << ionex_record("  3600", "INTERVAL");
+  stream << ionex_record("     3", "# OF MAPS IN FILE");
+  stream << ionex_record("  COSZ", "MAPPING FUNCTION");
+  write_ionex_grid(stream);
+  for (u32 map = 0; map < 3; ++map) {
+    write_ionex_map(stream, false, map, ionex_epoch(2021, 11, 14, map), [map](f64 lat, f64 lon) {
+      return map == 0 && lat == 62.5 && lon == -130 ? 9999 : std::lround(field(map, lat, lon) * 10);
+    });
+  }
+  write_ionex_map(stream, true, 1, ionex_epoch(2021, 11, 14, 1), [](f64, f64) { return 25; });
+  stream << ionex_record("", "END OF FILE");
+  return path;
+}
+
+static f64 mjd_of(const EpochUtc& epoch) { return utils::MjDateUtc(utils::GTime(epoch)).to_double(); }
+
+TEST_CASE("ionex maps are read into dense arrays") {
+  auto ionex = Ionex::load(write_ionex("test_ionex.21i"));
+  CHECK(Ionex::load(std::filesystem::temp_directory_path() / "test_ionex.21i") == ionex);
+  CHECK(ionex->rows() == 71);
+  CHECK(ionex->cols() == 73);
+  REQUIRE(ionex->epochs().size() == 3);
+  CHECK(ionex->epochs()[1] - ionex->epochs()[0] == doctest::Approx(1.0 / 24));
+  CHECK(ionex->height() == 450e3);
+  CHECK(ionex->radius() == 6371e3);
+  CHECK(ionex->has_rms());
+  CHECK(ionex->tec(0, 0, 0) == doctest::Approx(field(0, 87.5, -180)));
+  CHECK(ionex->tec(2, 70, 72) == doctest::Approx(field(2, -87.5, 180)));
+  CHECK(std::isnan(ionex->tec(0, 10, 10)));
+
+  std::ofstream(std::filesystem::temp_directory_path() / "test_ionex_invalid.21i") << "not an ionex file\n";
+  CHECK_THROWS_AS(Ionex(std::filesystem::temp_directory_path() / "test_ionex_invalid.21i"), IonexRuntimeError);
+}
+
+TEST_CASE("bilinear in space and linear in time with the rotated maps") {
+  auto ionex = Ionex::load(write_ionex("test_ionex.21i"));
+  auto epoch = EpochUtc::from_date(date);
+  Ionex::MapTime time;
+  REQUIRE(ionex->map_time(mjd_of(epoch + std::chrono::minutes(30)), time));
+  CHECK(time.map == std::array<u32, 2>{0, 1});
+  CHECK(time.weight[1] == doctest::Approx(0.5));
+  CHECK(time.rotation[0] == doctest::Approx(7.5));
+  CHECK(time.rotation[1] == doctest::Approx(-7.5));
+
+  f64 rms;
+  auto vtec = ionex->vtec(time, 41.3, 20.2, &rms);
+  CHECK(vtec == doctest::Approx(0.5 * field(0, 41.3, 27.7) + 0.5 * field(1, 41.3, 12.7)));
+  CHECK(std::isnan(rms));
+  // longitudes wrap around the earth
+  CHECK(ionex->vtec(time, 41.3, 20.2 + 360) == doctest::Approx(vtec));
+
+  REQUIRE(ionex->map_time(mjd_of(epoch + std::chrono::hours(1)), time));
+  CHECK(ionex->vtec(time, -10, 30, &rms) == doctest::Approx(field(1, -10, 30)));
+  CHECK(rms == doctest::Approx(2.5));
+  // the missing node
+  REQUIRE(ionex->map_time(mjd_of(epoch), time));
+  CHECK(std::isnan(ionex->vtec(time, 62.5, -130)));
+  // out of the maps
+  CHECK(!ionex->map_time(mjd_of(epoch + std::chrono::hours(3)), time));
+}
+
+TEST_CASE("pierce points of every satellite of an epoch") {
+  auto epoch = EpochUtc::from_date(date) + std::chrono::minutes(30);
+  utils::CoordinateBlh pos(30 * d2r, 114 * d2r, 50);
+  auto ionex = Ionex::load(write_ionex("test_ionex.21i"));
+  IonoHandler handler;
+  handler.set_iono_model(IonoModelEnum::IONEX).set_ionex(ionex);
+  handler.set_station(epoch, pos);
+
+  // zenith, north, south, below the horizon
+  std::vector<f64> azimuth{0, 0, std::numbers::pi, 0}, elevation{std::numbers::pi / 2, 0.3, 0.3, -0.1}, iono(4);
+  handler.handle(azimuth, elevation, iono);
+  constexpr f64 factor = 40.3E16 / (1575.42E6 * 1575.42E6);
+  Ionex::MapTime time;
+  ionex->map_time(mjd_of(epoch), time);
+  CHECK(iono[0] == doctest::Approx(factor * ionex->vtec(time, 30, 114)));
+  // the tec grows northward, both have the same mapping function
+  CHECK(iono[1] > iono[2]);
+  CHECK(iono[2] > 2 * iono[0]);
+  CHECK(iono[3] == 0.0);
+
+  // out of the maps
+  handler.set_station(epoch + std::chrono::hours(5), pos).handle(azimuth, elevation, iono);
+  CHECK(iono[0] == 0.0);
+  // without the maps
+  IonoHandler none;
+  none.set_station(epoch, pos).handle(azimuth, elevation, iono);
+  CHECK(iono[1] == 0.0);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdio>
+#include <ostream>
+#include <string>
+
+#include "utils/types.hpp"
+
+// synthetic ionex files of the ionex tests and benchmarks
+// - global maps of 2.5 x 5 degree at 450 km, the values in 0.1 tecu (exponent -1)
+namespace navp::test {
+
+// record with its label from column 61
+inline auto ionex_record(const std::string& content, const char* label) -> std::string {
+  auto line = content;
+  line.resize(60, ' ');
+  return line + label + '\n';
+}
+
+// content of the epoch records
+inline auto ionex_epoch(i32 year, i32 month, i32 day, i32 hour) -> std::string {
+  char buffer[64];
+  std::snprintf(buffer, sizeof(buffer), "%6d%6d%6d%6d%6d%6d", year, month, day, hour, 0, 0);
+  return buffer;
+}
+
+// records of the grid, the last ones of the header
+inline void write_ionex_grid(std::ostream& stream) {
+  stream << ionex_record("  6371.0", "BASE RADIUS");
+  stream << ionex_record("     2", "MAP DIMENSION");
+  stream << ionex_record("   450.0 450.0   0.0", "HGT1 / HGT2 / DHGT");
+  stream << ionex_record("    87.5 -87.5  -2.5", "LAT1 / LAT2 / DLAT");
+  stream << ionex_record("  -180.0 180.0   5.0", "LON1 / LON2 / DLON");
+  stream << ionex_record("    -1", "EXPONENT");
+  stream << ionex_record("", "END OF HEADER");
+}
+
+// tec or rms map of the grid, `value(lat, lon)` in 0.1 tecu and 9999 for a missing node
+template <typename Value>
+void write_ionex_map(std::ostream& stream, bool rms, u32 map, const std::string& epoch, Value&& value) {
+  char buffer[64];
+  std::snprintf(buffer, sizeof(buffer), "%6d", map + 1);
+  stream << ionex_record(buffer, rms ? "START OF RMS MAP" : "START OF TEC MAP");
+  stream << ionex_record(epoch, "EPOCH OF CURRENT MAP");
+  for (f64 lat = 87.5; lat > -90; lat -= 2.5) {
+    std::snprintf(buffer, sizeof(buffer), "  %6.1f%6.1f%6.1f%6.1f%6.1f", lat, -180.0, 180.0, 5.0, 450.0);
+    stream << ionex_record(buffer, "LAT/LON1/LON2/DLON/H");
+    for (u32 col = 0; col < 73; ++col) {
+      std::snprintf(buffer, sizeof(buffer), "%5d", static_cast<i32>(value(lat, -180.0 + 5.0 * col)));
+      stream << buffer << (col % 16 == 15 || col == 72 ? "\n" : "");
+    }
+  }
+  std::snprintf(buffer, sizeof(buffer), "%6d", map + 1);
+  stream << ionex_record(buffer, rms ? "END OF RMS MAP" : "END OF TEC MAP");
+}
+
+}  // namespace navp::test
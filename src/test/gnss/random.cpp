@@ -0,0 +1,116 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <cmath>
+#include <numbers>
+#include <thread>
+#include <vector>
+
+#include "../doctest.h"
+#include "sensors/gnss/random.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+
+static constexpr f64 d2r = std::numbers::pi / 180;
+
+// signals of an epoch with their satellite elevations, the last one without snr
+struct Epoch {
+  Epoch() {
+    for (f64 el : {90.0, 45.0, 20.0, 10.0, 2.0}) {
+      auto& sig = signals.emplace_back();
+      sig.snr = static_cast<f32>(30 + el / 4);
+      elevation.push_back(el * d2r);
+    }
+    signals.back().valid = RawSig::MissingSnr;
+    for (auto& sig : signals) sigs.push_back(&sig);
+  }
+
+  std::vector<Sig> signals;
+  std::vector<Sig*> sigs;
+  std::vector<f64> elevation;
+};
+
+static f64 elevation_var(f64 a, f64 el) {
+  f64 sin_el = std::max(std::sin(el), std::sin(5 * d2r));
+  return a * a * (1 + 1 / (sin_el * sin_el));
+}
+
+TEST_CASE("standard and elevation models") {
+  Epoch epoch;
+  GnssRandomHandler{}.handle(epoch.sigs, epoch.elevation);
+  CHECK(epoch.signals[2].code_var == doctest::Approx(1.0));
+  CHECK(epoch.signals[2].phase_var == doctest::Approx(0.02 * 0.02));
+
+  GnssRandomHandler{}.set_model(RandomModelEnum::ELEVATION_DEPENDENT).handle(epoch.sigs, epoch.elevation);
+  for (size_t i = 0; i < epoch.signals.size(); ++i) {
+    CHECK(epoch.signals[i].code_var == doctest::Approx(elevation_var(0.3, epoch.elevation[i])));
+    CHECK(epoch.signals[i].phase_var == doctest::Approx(elevation_var(0.003, epoch.elevation[i])));
+  }
+  // bounded below 5 degrees
+  CHECK(epoch.signals[4].code_var == doctest::Approx(elevation_var(0.3, 5 * d2r)));
+}
+
+TEST_CASE("snr model falls back to the elevation model without snr") {
+  Epoch epoch;
+  GnssRandomHandler{}.set_model(RandomModelEnum::SNR_DEPENDENT).handle(epoch.sigs, epoch.elevation);
+  for (size_t i = 0; i < 4; ++i) {
+    f64 snr = epoch.signals[i].snr;
+    CHECK(epoch.signals[i].code_var == doctest::Approx(1.61e4 * std::pow(10, -snr / 10)));
+    CHECK(epoch.signals[i].phase_var == doctest::Approx(1.61 * std::pow(10, -snr / 10)));
+  }
+  CHECK(epoch.signals[0].code_var < epoch.signals[3].code_var);
+  CHECK(epoch.signals[4].code_var == doctest::Approx(elevation_var(0.3, epoch.elevation[4])));
+}
+
+TEST_CASE("custom model compiled once") {
+  auto expression = RandomExpression::compile("(carrier ? 0.003^2 : 0.3^2) * (1 + 1 / sin(el)^2) + snr / 1e4");
+  CHECK(expression->evaluate(std::numbers::pi / 2, 0, false) == doctest::Approx(0.18));
+  CHECK(expression->evaluate(std::numbers::pi / 2, 0, true) == doctest::Approx(0.003 * 0.003 * 2));
+
+  Epoch epoch;
+  auto handler = GnssRandomHandler{}.set_model(RandomModelEnum::CUSTOM).set_expression(expression);
+  handler.handle(epoch.sigs, epoch.elevation);
+  // a missing snr is 0, the elevation is not bounded
+  for (size_t i = 0; i < epoch.signals.size(); ++i) {
+    f64 sin_el = std::sin(epoch.elevation[i]), snr = i < 4 ? epoch.signals[i].snr : 0.0;
+    CHECK(epoch.signals[i].code_var == doctest::Approx(0.09 * (1 + 1 / (sin_el * sin_el)) + snr / 1e4));
+  }
+
+  // without expression
+  GnssRandomHandler{}.set_model(RandomModelEnum::CUSTOM).handle(epoch.sigs, epoch.elevation);
+  CHECK(epoch.signals[0].code_var == doctest::Approx(1.0));
+
+  CHECK_THROWS_AS(RandomExpression::compile("el +* snr"), RandomModelRuntimeError);
+  CHECK_THROWS_AS(RandomExpression::compile("elevation * 2"), RandomModelRuntimeError);
+}
+
+TEST_CASE("custom model evaluated concurrently") {
+  auto expression = RandomExpression::compile("el * 1000 + snr");
+  std::vector<std::vector<f64>> variances(4, std::vector<f64>(2000));
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < variances.size(); ++t) {
+    threads.emplace_back([&, t] {
+      for (size_t i = 0; i < variances[t].size(); ++i) variances[t][i] = expression->evaluate(t, i, false);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  // every thread reads its own variables
+  for (size_t t = 0; t < variances.size(); ++t) {
+    for (size_t i = 0; i < variances[t].size(); ++i) REQUIRE(variances[t][i] == t * 1000.0 + i);
+  }
+}
+
+TEST_CASE("options and single signals") {
+  Epoch epoch;
+  GnssRandomHandler{}
+      .set_model(RandomModelEnum::ELEVATION_DEPENDENT)
+      .set_options(GnssRandomHandler::Pseudorange)
+      .handle(epoch.sigs, epoch.elevation);
+  CHECK(epoch.signals[1].code_var == doctest::Approx(elevation_var(0.3, 45 * d2r)));
+  CHECK(epoch.signals[1].phase_var == 0.0);
+
+  // a signal without satellite is at the zenith
+  Sig sig;
+  CHECK(GnssRandomHandler{}.set_model(RandomModelEnum::ELEVATION_DEPENDENT).handle(&sig) == &sig);
+  CHECK(sig.code_var == doctest::Approx(0.18));
+  CHECK(GnssRandomHandler{}.handle(nullptr) == nullptr);
+}
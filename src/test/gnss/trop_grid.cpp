@@ -0,0 +1,155 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <chrono>
+#include <fstream>
+#include <numbers>
+#include <vector>
+
+#include "../doctest.h"
+#include "sensors/gnss/atmosphere.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+
+static constexpr navp::details::Date date = {.year = 2021, .month = 11, .day = 14, .hour = 3};
+
+static auto grid_path(const char* name) -> std::filesystem::path {
+  return std::filesystem::temp_directory_path() / name;
+}
+
+// 5 degree gpt2w grid of a standard atmosphere, no seasonal terms
+static auto write_gpt2w(const char* name) -> std::filesystem::path {
+  auto path = grid_path(name);
+  std::filesystem::remove(path.string() + ".bin");
+  std::ofstream stream(path);
+  stream << "%  lat    lon   p:a0 ...\n";
+  for (f64 lat = 87.5; lat > -90; lat -= 5) {
+    for (f64 lon = 2.5; lon < 360; lon += 5) {
+      stream << lat << ' ' << lon;
+      // pressure (Pa), temperature (K), humidity (g/kg), lapse rate (mK/m)
+      for (f64 mean : {101325.0, 288.15, 6.0, -6.5}) stream << ' ' << mean << " 0 0 0 0";
+      // undulation and height, ah and aw (1e-3), water vapour decrease factor, mean temperature (K)
+      stream << " 0 0";
+      for (f64 mean : {1.23, 0.55, 3.0, 270.0}) stream << ' ' << mean << " 0 0 0 0";
+      stream << '\n';
+    }
+  }
+  return path;
+}
+
+// 5 degree vmf3 grid of one epoch with a uniform zenith hydrostatic delay
+static auto write_vmf3(const char* name, u8 hour, f64 zhd) -> std::filesystem::path {
+  auto path = grid_path(name);
+  std::ofstream stream(path);
+  stream << "! Data_types:         VMF3 (lat lon ah aw zhd zwd)\n";
+  stream << "! Epoch:              2021 11 14 " << static_cast<int>(hour) << " 00  0.0\n";
+  for (f64 lat = 87.5; lat > -90; lat -= 5) {
+    for (f64 lon = 2.5; lon < 360; lon += 5) {
+      stream << lat << ' ' << lon << " 0.00121 0.00055 " << zhd << " 0.15\n";
+    }
+  }
+  return path;
+}
+
+TEST_CASE("gpt2w text grid is converted once and shared") {
+  auto text = write_gpt2w("test_trop_grid.grd");
+  auto grid = TropGrid::load(text);
+  REQUIRE(grid);
+  CHECK(std::filesystem::exists(text.string() + ".bin"));
+  CHECK(grid->kind() == TropGridKind::GPT2W);
+  CHECK(grid->header().rows == 36);
+  CHECK(grid->header().cols == 72);
+  CHECK(grid->gpt2(0).pressure[0] == 101325.0);
+  CHECK(grid->gpt2(0).humidity[0] == doctest::Approx(6e-3));
+  CHECK(TropGrid::load(text) == grid);
+  // the binary file is loaded as it is
+  auto binary = TropGrid::load(text.string() + ".bin");
+  CHECK(binary->gpt2(100).tm[0] == 270.0);
+
+  std::ofstream(grid_path("test_trop_grid_invalid.grd")) << "1 2 3\n";
+  CHECK_THROWS_AS(TropGrid::load(grid_path("test_trop_grid_invalid.grd")), TropGridRuntimeError);
+}
+
+TEST_CASE("surrounding nodes and weights") {
+  auto grid = TropGrid::load(write_gpt2w("test_trop_grid_nodes.grd"));
+  std::array<u32, 4> index;
+  std::array<f64, 4> weight;
+  constexpr f64 d2r = std::numbers::pi / 180;
+
+  // on a node
+  grid->surrounding(42.5 * d2r, 12.5 * d2r, index, weight);
+  CHECK(index[0] == grid->node_index(9, 2));
+  CHECK(weight[0] == doctest::Approx(1.0));
+
+  // between four nodes, the columns wrap at 0 degree
+  grid->surrounding(40.0 * d2r, -1.0 * d2r, index, weight);
+  CHECK(index[0] == grid->node_index(9, 71));
+  CHECK(index[3] == grid->node_index(10, 0));
+  f64 sum = 0;
+  for (auto w : weight) sum += w;
+  CHECK(sum == doctest::Approx(1.0));
+  CHECK(weight[0] == doctest::Approx(0.5 * 0.7));
+
+  // the nearest node at the poles
+  grid->surrounding(89.0 * d2r, 0.1, index, weight);
+  CHECK(index[0] / grid->header().cols == 0);
+  CHECK(weight[0] == 1.0);
+}
+
+TEST_CASE("gpt2 zenith delays are close to saastamoinen at sea level") {
+  auto epoch = EpochUtc::from_date(date);
+  utils::CoordinateBlh pos(0.5, 2.0, 0.0);
+  TropHandler standard, gpt2;
+  standard.set_station(epoch, pos);
+  gpt2.set_trop_model(TropModelEnum::GPT2).set_grid(TropGrid::load(write_gpt2w("test_trop_grid_gpt2.grd")));
+  gpt2.set_station(epoch, pos);
+  CHECK(gpt2.dry_zenith() == doctest::Approx(standard.dry_zenith()).epsilon(0.01));
+  CHECK(gpt2.wet_zenith() > 0.05);
+  CHECK(gpt2.wet_zenith() < 0.3);
+
+  std::vector<f64> elevation{-0.1, 0.2, std::numbers::pi / 2}, trop(3);
+  gpt2.handle(elevation, trop);
+  CHECK(trop[0] == 0.0);
+  CHECK(trop[1] > 3 * trop[2]);
+  CHECK(trop[2] == doctest::Approx(gpt2.dry_zenith() + gpt2.wet_zenith()).epsilon(1e-3));
+
+  // the model without its grid
+  TropHandler missing;
+  missing.set_trop_model(TropModelEnum::VMF3).set_station(epoch, pos).handle(elevation, trop);
+  CHECK(trop[2] == 0.0);
+}
+
+TEST_CASE("vmf3 grids are interpolated in time") {
+  auto binary = grid_path("test_trop_grid_vmf3.bin");
+  std::vector<std::filesystem::path> grids{write_vmf3("test_trop_grid_vmf3_06.txt", 6, 2.4),
+                                           write_vmf3("test_trop_grid_vmf3_00.txt", 0, 2.3)};
+  {
+    std::ofstream orography(grid_path("test_trop_grid_orography.txt"));
+    for (u32 i = 0; i < 36 * 72; ++i) orography << "0.0\n";
+  }
+  TropGrid::convert_vmf3(grids, grid_path("test_trop_grid_orography.txt"), binary);
+  auto grid = TropGrid::load(binary);
+  REQUIRE(grid->kind() == TropGridKind::VMF3);
+  REQUIRE(grid->epochs().size() == 2);
+  CHECK(grid->epochs()[0] < grid->epochs()[1]);
+
+  TropHandler handler;
+  handler.set_trop_model(TropModelEnum::VMF3).set_grid(grid);
+  utils::CoordinateBlh pos(0.5, 2.0, 0.0);
+  auto epoch = EpochUtc::from_date(date);
+  handler.set_station(epoch, pos);
+  CHECK(handler.dry_zenith() == doctest::Approx(2.35));
+  CHECK(handler.wet_zenith() == doctest::Approx(0.15));
+  handler.set_station(epoch + std::chrono::hours(6), pos);
+  CHECK(handler.dry_zenith() == doctest::Approx(2.4));
+
+  // reduced to the station height
+  utils::CoordinateBlh up(0.5, 2.0, 1000.0);
+  handler.set_station(epoch, up);
+  CHECK(handler.dry_zenith() < 2.35 * 0.9);
+  CHECK(handler.wet_zenith() == doctest::Approx(0.15 * std::exp(-0.5)));
+
+  std::vector<f64> elevation{0.1, std::numbers::pi / 2}, trop(2);
+  handler.handle(elevation, trop);
+  CHECK(trop[0] > 5 * trop[1]);
+  CHECK(trop[1] == doctest::Approx(handler.dry_zenith() + handler.wet_zenith()).epsilon(1e-3));
+}
@@ -0,0 +1,154 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <random>
+
+#include "algorithm/ambiguity_fixer.hpp"
+#include "doctest.h"
+#include "utils/eigen.hpp"
+
+using namespace navp;
+using utils::NavMatrix33f64;
+using utils::NavMatrixDf64;
+using utils::NavVector3f64;
+using utils::NavVectorDf64;
+using algorithm::AmbiguityFixer;
+
+// correlated ambiguity covariance of a short baseline : Q = G Cb G' + s I
+static NavMatrixDf64 make_covariance(std::mt19937& gen, u16 n, f64 geometry_variance, f64 noise_variance) {
+  std::normal_distribution<f64> g(0, 5);
+  NavMatrixDf64 G(n, 3);
+  for (u16 i = 0; i < n; ++i)
+    for (u16 j = 0; j < 3; ++j) G(i, j) = g(gen);
+  NavMatrixDf64 Q = geometry_variance * G * G.transpose();
+  Q.diagonal().array() += noise_variance;
+  return Q;
+}
+
+// float ambiguities around the integers, drawn from N(0, scale^2 * Q)
+static NavVectorDf64 make_float(std::mt19937& gen, const NavVectorDf64& integers, const NavMatrixDf64& Q, f64 scale) {
+  std::normal_distribution<f64> noise(0, 1);
+  NavVectorDf64 e(integers.size());
+  for (auto& v : e) v = noise(gen);
+  NavMatrixDf64 L = Q.llt().matrixL();
+  return integers + scale * L * e;
+}
+
+TEST_CASE("full resolution recovers the integers") {
+  std::mt19937 gen(31);
+  std::uniform_int_distribution<i32> integer(-1000000, 1000000);
+  AmbiguityFixer fixer(64);
+  for (u16 n : {6, 10, 24, 40}) {
+    NavVectorDf64 integers(n);
+    for (auto& v : integers) v = integer(gen);
+    auto Q = make_covariance(gen, n, 1e-3, 1e-3);
+    auto a = make_float(gen, integers, Q, 0.1);
+    REQUIRE(fixer.resolve(a, Q));
+    CHECK(fixer.state() == AmbiguityFixer::State::Fixed);
+    CHECK(fixer.fixed_size() == n);
+    CHECK(fixer.ratio() >= fixer.options().ratio_threshold);
+    CHECK(fixer.success_rate() >= fixer.options().min_success_rate);
+    CHECK((fixer.fixed_ambiguity() - integers).cwiseAbs().maxCoeff() == 0);
+  }
+}
+
+TEST_CASE("search equals the brute force integer least square") {
+  std::mt19937 gen(32);
+  constexpr u16 n = 4;
+  AmbiguityFixer::Options options;
+  options.ratio_threshold = 1.0, options.min_success_rate = 0.0, options.min_fixed = 1;
+  AmbiguityFixer fixer(n, options);
+  for (u16 trial = 0; trial < 20; ++trial) {
+    NavVectorDf64 integers = NavVectorDf64::Zero(n);
+    auto Q = make_covariance(gen, n, 1e-3, 0.05);
+    auto a = make_float(gen, integers, Q, 1.0);
+    NavMatrixDf64 W = Q.inverse();
+    f64 best = std::numeric_limits<f64>::infinity(), second = best;
+    NavVectorDf64 best_candidate(n), c(n);
+    for (i32 k = 0; k < 9 * 9 * 9 * 9; ++k) {
+      for (i32 i = 0, r = k; i < n; ++i, r /= 9) c(i) = std::round(a(i)) + r % 9 - 4;
+      f64 d = (a - c).dot(W * (a - c));
+      if (d < best) {
+        second = best, best = d;
+        best_candidate = c;
+      } else if (d < second) {
+        second = d;
+      }
+    }
+    REQUIRE(fixer.resolve(a, Q));
+    CHECK(fixer.fixed_size() == n);
+    CHECK((fixer.fixed_ambiguity() - best_candidate).cwiseAbs().maxCoeff() == 0);
+    CHECK(fixer.ratio() == doctest::Approx(second / best).epsilon(1e-9));
+  }
+}
+
+TEST_CASE("partial resolution leaves the unreliable ambiguity float") {
+  constexpr u16 n = 6;
+  NavVectorDf64 integers(n), a(n);
+  integers << 3, -7, 12, 5, -1, 8;
+  a = integers + NavVectorDf64::Constant(n, 0.02);
+  a(2) += 0.4;
+  NavMatrixDf64 Q = NavMatrixDf64::Identity(n, n) * 1e-3;
+  Q(2, 2) = 4.0;  // e.g. a newly tracked satellite
+  AmbiguityFixer fixer(n);
+  REQUIRE(fixer.resolve(a, Q));
+  CHECK(fixer.fixed_size() == n - 1);
+  for (u16 i = 0; i < n; ++i) {
+    if (i == 2) {
+      CHECK(fixer.fixed_ambiguity()(i) == doctest::Approx(a(i)));
+    } else {
+      CHECK(fixer.fixed_ambiguity()(i) == doctest::Approx(integers(i)));
+    }
+  }
+
+  // no subset is reliable enough
+  Q *= 1e3;
+  CHECK_FALSE(fixer.resolve(a, Q));
+  CHECK(fixer.state() == AmbiguityFixer::State::LowSuccessRate);
+}
+
+TEST_CASE("fixed baseline equals the dense conditional solution") {
+  std::mt19937 gen(33);
+  constexpr u16 n = 12;
+  std::normal_distribution<f64> g(0, 1);
+  NavMatrixDf64 H(2 * n, 3 + n);
+  for (auto& v : H.reshaped()) v = g(gen);
+  NavMatrixDf64 qxx = (H.transpose() * H).inverse() * 1e-3;
+  NavVectorDf64 integers = NavVectorDf64::LinSpaced(n, -20, 20).array().round();
+  auto a = make_float(gen, integers, qxx.bottomRightCorner(n, n), 0.1);
+  NavVector3f64 b(1.0, 2.0, 3.0);
+
+  AmbiguityFixer fixer(n);
+  REQUIRE(fixer.fix(b, a, qxx));
+  REQUIRE(fixer.fixed_size() == n);
+  NavMatrixDf64 qaa_inv = qxx.bottomRightCorner(n, n).inverse();
+  NavMatrixDf64 qba = qxx.topRightCorner(3, n);
+  NavVector3f64 fixed_baseline = b - qba * qaa_inv * (a - fixer.fixed_ambiguity());
+  NavMatrix33f64 fixed_qbb = qxx.topLeftCorner(3, 3) - qba * qaa_inv * qba.transpose();
+  CHECK((fixer.fixed_baseline() - fixed_baseline).norm() < 1e-8);
+  CHECK((fixer.fixed_qbb() - fixed_qbb).norm() < 1e-8 * fixed_qbb.norm() + 1e-15);
+}
+
+TEST_CASE("invalid input and bounded search") {
+  AmbiguityFixer fixer(8);
+  NavVectorDf64 a = NavVectorDf64::Constant(6, 0.5);
+  NavMatrixDf64 Q = NavMatrixDf64::Identity(6, 6) * 1e-3;
+  CHECK_FALSE(fixer.resolve(a, NavMatrixDf64::Identity(5, 5)));
+  CHECK(fixer.state() == AmbiguityFixer::State::InvalidInput);
+  Q(3, 3) = -1;
+  CHECK_FALSE(fixer.resolve(a, Q));
+  CHECK(fixer.state() == AmbiguityFixer::State::InvalidInput);
+
+  std::mt19937 gen(34);
+  Q = make_covariance(gen, 6, 1e-3, 1e-3);
+  a = make_float(gen, NavVectorDf64::Zero(6), Q, 0.1);
+  fixer.options().max_search_loop = 1;
+  CHECK_FALSE(fixer.resolve(a, Q));
+  CHECK(fixer.state() == AmbiguityFixer::State::SearchExhausted);
+  CHECK(fixer.search_loop() == 1);
+
+  // the workspace grows on demand
+  fixer.options().max_search_loop = 10000;
+  Q = make_covariance(gen, 16, 1e-3, 1e-3);
+  a = make_float(gen, NavVectorDf64::Zero(16), Q, 0.1);
+  CHECK(fixer.resolve(a, Q));
+  CHECK(fixer.capacity() == 16);
+}
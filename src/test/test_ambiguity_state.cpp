@@ -0,0 +1,117 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "solution/ambiguity_state.hpp"
+#include "utils/eigen.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+using solution::AmbiguityKey;
+using solution::AmbiguityState;
+using utils::NavMatrixDf64;
+using utils::NavVector3f64;
+using utils::NavVectorDf64;
+
+static Sv gps(u8 prn) { return Sv{.prn = prn, .constellation = Constellation{.id = ConstellationEnum::GPS}}; }
+
+static std::vector<AmbiguityKey> make_keys(std::initializer_list<u8> movs, u8 ref,
+                                           ObsCodeEnum code = ObsCodeEnum::L1C) {
+  std::vector<AmbiguityKey> keys;
+  for (auto prn : movs) keys.push_back({.sv = gps(prn), .code = code, .ref = gps(ref)});
+  return keys;
+}
+
+// carried state : N(s, 1) for s = 2, 3, 4
+static void carry(AmbiguityState& state, EpochUtc epoch, NavVectorDf64& value, NavMatrixDf64& covariance) {
+  auto keys = make_keys({2, 3, 4}, 1);
+  state.predict(epoch, keys);
+  value = NavVector3f64(10.2, -3.1, 7.4);
+  NavMatrixDf64 a(3, 3);
+  a << 1.0, 0.2, 0.1, 0.3, 0.9, 0.4, 0.0, 0.5, 1.1;
+  covariance = a * a.transpose() * 1e-2;
+  state.update(value, covariance);
+}
+
+TEST_CASE("ambiguities are carried with the same reference") {
+  AmbiguityState state;
+  EpochUtc epoch;
+  NavVectorDf64 value;
+  NavMatrixDf64 covariance;
+  carry(state, epoch, value, covariance);
+
+  // satellite 3 is lost, satellite 5 rises
+  auto keys = make_keys({2, 4, 5}, 1);
+  CHECK(state.predict(epoch + std::chrono::seconds(1), keys) == 2);
+  auto& index = state.prior_index();
+  REQUIRE(index.size() == 3);
+  CHECK(index[0] == 0);
+  CHECK(index[1] == 1);
+  CHECK(index[2] == -1);
+  CHECK(state.prior_value()(0) == doctest::Approx(value(0)));
+  CHECK(state.prior_value()(1) == doctest::Approx(value(2)));
+  CHECK(state.prior_covariance()(0, 1) == doctest::Approx(covariance(0, 2)));
+  CHECK(state.prior_covariance()(1, 1) == doctest::Approx(covariance(2, 2)));
+}
+
+TEST_CASE("reference satellite change re-differences the ambiguities") {
+  AmbiguityState state;
+  EpochUtc epoch;
+  NavVectorDf64 value;
+  NavMatrixDf64 covariance;
+  carry(state, epoch, value, covariance);
+
+  // new reference 3 : N(s, 3) = N(s, 1) - N(3, 1), N(1, 3) = -N(3, 1)
+  auto keys = make_keys({1, 2, 4}, 3);
+  REQUIRE(state.predict(epoch + std::chrono::seconds(1), keys) == 3);
+  NavMatrixDf64 T(3, 3);
+  T << 0, -1, 0, 1, -1, 0, 0, -1, 1;
+  NavVectorDf64 expected_value = T * value;
+  NavMatrixDf64 expected_covariance = T * covariance * T.transpose();
+  CHECK((state.prior_value() - expected_value).norm() < 1e-12);
+  CHECK((state.prior_covariance() - expected_covariance).norm() < 1e-12);
+}
+
+TEST_CASE("cycle slips and gaps drop the ambiguities") {
+  AmbiguityState state;
+  EpochUtc epoch;
+  NavVectorDf64 value;
+  NavMatrixDf64 covariance;
+  carry(state, epoch, value, covariance);
+
+  // slip of a moving satellite only drops its own ambiguity
+  state.reset(gps(3), ObsCodeEnum::L1C);
+  CHECK(state.size() == 2);
+  CHECK_FALSE(state.contains({.sv = gps(3), .code = ObsCodeEnum::L1C, .ref = gps(1)}));
+  auto keys = make_keys({2, 3, 4}, 1);
+  REQUIRE(state.predict(epoch + std::chrono::seconds(1), keys) == 2);
+  CHECK(state.prior_value()(1) == doctest::Approx(value(2)));
+  CHECK(state.prior_covariance()(0, 1) == doctest::Approx(covariance(0, 2)));
+
+  // other codes are not affected, a slip of the reference satellite drops the whole code
+  state.reset(gps(1), ObsCodeEnum::L2W);
+  CHECK(state.size() == 2);
+  state.reset(gps(1), ObsCodeEnum::L1C);
+  CHECK(state.size() == 0);
+
+  // data gap
+  carry(state, epoch, value, covariance);
+  CHECK(state.predict(epoch + std::chrono::seconds(60), keys) == 0);
+  CHECK(state.size() == 0);
+}
+
+TEST_CASE("fixed ambiguities are held") {
+  AmbiguityState state;
+  EpochUtc epoch;
+  NavVectorDf64 value;
+  NavMatrixDf64 covariance;
+  carry(state, epoch, value, covariance);
+  state.hold(NavVector3f64(10, -3, 7));
+  CHECK(state.is_held({.sv = gps(2), .code = ObsCodeEnum::L1C, .ref = gps(1)}));
+
+  // re-differenced held ambiguities are still integers
+  auto keys = make_keys({1, 2, 4}, 3);
+  REQUIRE(state.predict(epoch + std::chrono::seconds(1), keys) == 3);
+  CHECK((state.prior_value() - NavVector3f64(3, 13, 10)).norm() < 1e-12);
+  CHECK(state.prior_covariance()(1, 1) == doctest::Approx(2 * AmbiguityState::HoldVariance));
+  state.update(state.prior_value(), state.prior_covariance());
+  CHECK(state.is_held({.sv = gps(4), .code = ObsCodeEnum::L1C, .ref = gps(3)}));
+}
@@ -0,0 +1,160 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "sensors/gnss/constants.hpp"
+#include "solution/base_station.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+using solution::BaseStation;
+
+static Sv gps(u8 prn) { return Sv{.prn = prn, .constellation = Constellation{.id = ConstellationEnum::GPS}}; }
+
+// satellites moving at constant velocity, base clock drifting at 0.3 m/s
+struct BaseScene {
+  static constexpr f64 ClockDrift = 0.3, SatClockDrift = 1e-11;
+
+  BaseScene(f64 t = 0.0) {
+    base = utils::CoordinateXyz(utils::NavVector3f64(-2267810.0, 5009330.0, 3221000.0));
+    for (u8 prn : {7, 3, 12, 5}) {
+      auto sv = gps(prn);
+      auto& eph = sv_map[sv];
+      eph.sv = sv;
+      eph.vel = utils::CoordinateXyz(utils::NavVector3f64(-800.0 * prn, 2000.0, 1000.0));
+      eph.pos = utils::CoordinateXyz(
+          utils::NavVector3f64(base + utils::NavVector3f64(1e6 * prn, 2.0e7, 1e7) + eph.vel * t));
+      eph.fd_dtsv = SatClockDrift;
+      f64 clock = (ClockDrift - Constants::CLIGHT * SatClockDrift) * t;
+      auto obs = std::make_shared<GObs>();
+      obs->sv = sv;
+      Sig sig;
+      sig.code = ObsCodeEnum::L1C, sig.freq = FreTypeEnum::F1;
+      sig.pseudorange = (base - eph.pos).norm() + clock + 10.0;
+      sig.carrier = ((base - eph.pos).norm() + clock + 2.0) / Constants::code_to_wave_length(sv.system(), sig.code);
+      obs->sigs_list[FreTypeEnum::F1].push_back(sig);
+      obs_map.emplace(sv, obs);
+    }
+    // satellite without ephemeris
+    auto obs = std::make_shared<GObs>();
+    obs->sv = gps(30);
+    obs_map.emplace(obs->sv, obs);
+  }
+
+  auto preprocess(EpochUtc epoch) const {
+    return BaseStation::preprocess(epoch, base, obs_map, sv_map, GnssRandomHandler{});
+  }
+
+  utils::CoordinateXyz base;
+  GnssObsRecord::ObsMap obs_map;
+  EphemerisSolver::SvMap sv_map;
+};
+
+TEST_CASE("base epoch preprocessing") {
+  BaseScene scene;
+  auto base_epoch = scene.preprocess(EpochUtc());
+  REQUIRE(base_epoch->satellites.size() == 4);
+  CHECK(std::ranges::is_sorted(base_epoch->satellites, {}, [](auto& sat) { return sat.eph.sv; }));
+  CHECK(base_epoch->find(gps(30)) == nullptr);
+  auto sat = base_epoch->find(gps(12));
+  REQUIRE(sat != nullptr);
+  CHECK(sat->distance == doctest::Approx((scene.base - scene.sv_map.at(gps(12)).pos).norm()));
+  auto sig = sat->find_code(ObsCodeEnum::L1C);
+  REQUIRE(sig != nullptr);
+  CHECK(sat->find_code(ObsCodeEnum::L2W) == nullptr);
+  CHECK(sig->pseudorange_residual == doctest::Approx(10.0));
+  CHECK(sig->carrier_residual == doctest::Approx(2.0).epsilon(1e-6));
+  CHECK(sig->code_var > 0.0);
+  CHECK(sig->phase_var > 0.0);
+  // the source observation is not touched
+  CHECK(scene.obs_map.at(gps(12))->find_code(ObsCodeEnum::L1C)->code_var == 0.0);
+}
+
+TEST_CASE("published epochs are kept up to the history") {
+  BaseScene scene;
+  BaseStation base(2);
+  CHECK(base.latest() == nullptr);
+  CHECK_FALSE(base.has_source());
+  CHECK_FALSE(base.load_next_epoch());
+  for (i32 t = 0; t < 3; ++t) {
+    base.publish(scene.preprocess(EpochUtc() + std::chrono::seconds(t)));
+  }
+  REQUIRE(base.latest() != nullptr);
+  CHECK(base.latest()->epoch == EpochUtc() + std::chrono::seconds(2));
+  CHECK(base.at(EpochUtc() + std::chrono::seconds(1)) != nullptr);
+  CHECK(base.at(EpochUtc()) == nullptr);
+  // readers keep their epoch alive after it leaves the history
+  auto held = base.at(EpochUtc() + std::chrono::seconds(1));
+  base.publish(scene.preprocess(EpochUtc() + std::chrono::seconds(3)));
+  CHECK(base.at(EpochUtc() + std::chrono::seconds(1)) == nullptr);
+  CHECK(held->satellites.size() == 4);
+}
+
+TEST_CASE("base epochs predicted at the rover epoch") {
+  BaseStation base;
+  auto t0 = EpochUtc(), t1 = t0 + std::chrono::seconds(1);
+  base.publish(BaseScene(0.0).preprocess(t0));
+  // no rates from a single epoch
+  CHECK(base.predict(t0, 1.0) == base.latest());
+  CHECK(base.predict(t0 + std::chrono::milliseconds(500), 1.0) == nullptr);
+  base.publish(BaseScene(1.0).preprocess(t1));
+  CHECK(base.latest()->clock_drift == doctest::Approx(BaseScene::ClockDrift).epsilon(1e-6));
+  CHECK(base.latest()->rate_interval == doctest::Approx(1.0));
+
+  auto check_prediction = [&](i32 ms, f64 max_age) {
+    auto epoch = t0 + std::chrono::milliseconds(ms);
+    auto predicted = base.predict(epoch, max_age);
+    REQUIRE(predicted != nullptr);
+    CHECK(predicted->epoch == epoch);
+    BaseScene truth(ms * 1e-3);
+    for (auto& [sv, obs] : truth.obs_map) {
+      auto sat = predicted->find(sv);
+      if (!truth.sv_map.contains(sv)) continue;
+      REQUIRE(sat != nullptr);
+      auto& eph = truth.sv_map.at(sv);
+      CHECK(sat->distance == doctest::Approx((truth.base - eph.pos).norm()).epsilon(1e-9));
+      auto sig = sat->find_code(ObsCodeEnum::L1C);
+      REQUIRE(sig != nullptr);
+      auto truth_sig = obs->find_code(ObsCodeEnum::L1C);
+      // the satellite moves on a straight line, the remaining error is the range curvature
+      CHECK(std::abs(sig->pseudorange - truth_sig->pseudorange) < 1e-3);
+      CHECK(std::abs(sig->carrier - truth_sig->carrier) < 1e-2);
+    }
+    return predicted;
+  };
+
+  SUBCASE("interpolation between base epochs") {
+    auto predicted = check_prediction(300, 1.0);
+    CHECK(predicted->age == doctest::Approx(0.3));
+    // cached for the other rovers at the same epoch
+    CHECK(base.predict(t0 + std::chrono::milliseconds(300), 1.0) == predicted);
+    CHECK(base.predict(t0 + std::chrono::milliseconds(300), 0.2) == nullptr);
+  }
+
+  SUBCASE("extrapolation after the latest base epoch") {
+    auto predicted = check_prediction(1800, 1.0);
+    CHECK(predicted->age == doctest::Approx(0.8));
+    CHECK(base.predict(t0 + std::chrono::milliseconds(2500), 1.0) == nullptr);
+    CHECK(base.predict(t0 + std::chrono::milliseconds(1800), 0.5) == nullptr);
+  }
+
+  SUBCASE("only aligned epochs without max age") {
+    CHECK(base.predict(t1, 0.0) == base.latest());
+    CHECK(base.predict(t0 + std::chrono::milliseconds(500), 0.0) == nullptr);
+    CHECK(base.predict(t0 - std::chrono::milliseconds(500), 1.0) == nullptr);
+  }
+}
+
+TEST_CASE("slipped base signals follow the clock drift") {
+  BaseStation base;
+  auto t0 = EpochUtc(), t1 = t0 + std::chrono::seconds(1);
+  base.publish(BaseScene(0.0).preprocess(t0));
+  BaseScene scene(1.0);
+  auto& slipped = scene.obs_map.at(gps(7))->sigs_list[FreTypeEnum::F1].front();
+  slipped.carrier += 100.0;
+  slipped.valid = Sig::CycleSlip;
+  base.publish(scene.preprocess(t1));
+  // the drift is the median of the continuous signals
+  CHECK(base.latest()->clock_drift == doctest::Approx(BaseScene::ClockDrift).epsilon(1e-6));
+  auto sig = base.latest()->find(gps(7))->find_code(ObsCodeEnum::L1C);
+  CHECK(sig->carrier_rate ==
+        doctest::Approx(BaseScene::ClockDrift - Constants::CLIGHT * BaseScene::SatClockDrift).epsilon(1e-6));
+}
@@ -0,0 +1,137 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "sensors/gnss/constants.hpp"
+#include "sensors/gnss/cycle_slip.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+
+static Sv gps(u8 prn) { return Sv{.prn = prn, .constellation = Constellation{.id = ConstellationEnum::GPS}}; }
+
+// synthetic dual-frequency (L1C, L2W) observations of `sat_number` gps satellites, 1 Hz
+struct SlipScene {
+  static constexpr f64 f1 = 1575.42E6, f2 = 1227.60E6;
+  static constexpr f64 lambda1 = Constants::CLIGHT / f1, lambda2 = Constants::CLIGHT / f2;
+
+  SlipScene(u8 sat_number) {
+    for (u8 prn = 1; prn <= sat_number; ++prn) {
+      range.push_back(2.0e7 + 1.0e5 * prn);
+      velocity.push_back(-800.0 + 120.0 * prn);
+      iono.push_back(2.0 + 0.3 * prn);
+      n1.push_back(1000 * prn), n2.push_back(-700 * prn);
+    }
+  }
+
+  // observation at t (s), `clock` is a receiver clock jump (m) common to all signals
+  GnssObsRecord::ObsMap epoch(f64 t, f64 clock = 0.0, bool dual = true) {
+    GnssObsRecord::ObsMap obs_map;
+    for (u8 i = 0; i < range.size(); ++i) {
+      auto obs = std::make_shared<GObs>();
+      obs->sv = gps(i + 1);
+      f64 rho = range[i] + velocity[i] * t + clock;
+      f64 i1 = iono[i] + 1e-4 * t, i2 = i1 * (f1 * f1) / (f2 * f2);
+      Sig sig1, sig2;
+      sig1.code = ObsCodeEnum::L1C, sig1.freq = FreTypeEnum::F1;
+      sig1.pseudorange = rho + i1;
+      sig1.carrier = (rho - i1) / lambda1 + n1[i];
+      sig1.doppler = static_cast<f32>(-velocity[i] / lambda1);
+      sig1.snr = 45;
+      obs->sigs_list[FreTypeEnum::F1].push_back(sig1);
+      if (dual) {
+        sig2.code = ObsCodeEnum::L2W, sig2.freq = FreTypeEnum::F2;
+        sig2.pseudorange = rho + i2;
+        sig2.carrier = (rho - i2) / lambda2 + n2[i];
+        sig2.doppler = static_cast<f32>(-velocity[i] / lambda2);
+        sig2.snr = 40;
+        obs->sigs_list[FreTypeEnum::F2].push_back(sig2);
+      }
+      obs_map.emplace(obs->sv, obs);
+    }
+    return obs_map;
+  }
+
+  std::vector<f64> range, velocity, iono;
+  std::vector<f64> n1, n2;
+};
+
+static const Sig& sig_of(const GnssObsRecord::ObsMap& obs_map, u8 prn, FreTypeEnum freq) {
+  return obs_map.at(gps(prn))->sigs_list.at(freq).front();
+}
+
+static u32 run(CycleSlip& detector, SlipScene& scene, i32 epochs, i32 begin = 0) {
+  u32 count = 0;
+  for (i32 t = begin; t < begin + epochs; ++t) {
+    count += detector.detect(EpochUtc() + std::chrono::seconds(t), scene.epoch(t));
+  }
+  return count;
+}
+
+TEST_CASE("continuous tracks are not flagged") {
+  SlipScene scene(10);
+  CycleSlip detector;
+  CHECK(run(detector, scene, 30) == 0);
+  CHECK(detector.size() == 10);
+}
+
+TEST_CASE("a single cycle slip on one frequency is flagged on both signals") {
+  SlipScene scene(10);
+  CycleSlip detector;
+  REQUIRE(run(detector, scene, 10) == 0);
+  scene.n1[3] += 1;
+  auto obs_map = scene.epoch(10);
+  CHECK(detector.detect(EpochUtc() + std::chrono::seconds(10), obs_map) == 2);
+  CHECK(sig_of(obs_map, 4, FreTypeEnum::F1).is_cycle_slip());
+  CHECK(sig_of(obs_map, 4, FreTypeEnum::F2).is_cycle_slip());
+  CHECK_FALSE(sig_of(obs_map, 3, FreTypeEnum::F1).is_cycle_slip());
+  // the track continues after the slip
+  CHECK(run(detector, scene, 10, 11) == 0);
+}
+
+TEST_CASE("a slip hidden to the geometry-free test is flagged by MW") {
+  SlipScene scene(8);
+  CycleSlip detector;
+  detector.options().doppler_threshold = std::numeric_limits<f64>::infinity();
+  REQUIRE(run(detector, scene, 10) == 0);
+  // 9 * lambda1 - 7 * lambda2 is a few millimeter, the wide-lane ambiguity jumps 2 cycles
+  scene.n1[0] += 9, scene.n2[0] += 7;
+  auto obs_map = scene.epoch(10);
+  CHECK(detector.detect(EpochUtc() + std::chrono::seconds(10), obs_map) == 2);
+  CHECK(sig_of(obs_map, 1, FreTypeEnum::F1).is_cycle_slip());
+}
+
+TEST_CASE("doppler test on single frequency tracks") {
+  SlipScene scene(8);
+  CycleSlip detector;
+  for (i32 t = 0; t < 10; ++t) {
+    REQUIRE(detector.detect(EpochUtc() + std::chrono::seconds(t), scene.epoch(t, 0.0, false)) == 0);
+  }
+  scene.n1[5] += 10;
+  auto obs_map = scene.epoch(10, 0.0, false);
+  CHECK(detector.detect(EpochUtc() + std::chrono::seconds(10), obs_map) == 1);
+  CHECK(sig_of(obs_map, 6, FreTypeEnum::F1).is_cycle_slip());
+}
+
+TEST_CASE("receiver clock jump is not a cycle slip") {
+  SlipScene scene(10);
+  CycleSlip detector;
+  REQUIRE(run(detector, scene, 10) == 0);
+  // 1 ms jump
+  CHECK(detector.detect(EpochUtc() + std::chrono::seconds(10), scene.epoch(10, 1e-3 * Constants::CLIGHT)) == 0);
+}
+
+TEST_CASE("loss of lock and data gap") {
+  SlipScene scene(6);
+  CycleSlip detector;
+  REQUIRE(run(detector, scene, 5) == 0);
+
+  auto obs_map = scene.epoch(5);
+  obs_map.at(gps(2))->sigs_list.at(FreTypeEnum::F2).front().lli = true;
+  CHECK(detector.detect(EpochUtc() + std::chrono::seconds(5), obs_map) == 1);
+  CHECK(sig_of(obs_map, 2, FreTypeEnum::F2).is_cycle_slip());
+  CHECK_FALSE(sig_of(obs_map, 2, FreTypeEnum::F1).is_cycle_slip());
+
+  // tracks are re-initialized after a gap, a slip across it is not tested
+  scene.n1[0] += 1;
+  CHECK(detector.detect(EpochUtc() + std::chrono::seconds(100), scene.epoch(100)) == 0);
+  CHECK(run(detector, scene, 5, 101) == 0);
+}
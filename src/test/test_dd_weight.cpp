@@ -0,0 +1,62 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <random>
+
+#include "algorithm/dd_weight.hpp"
+#include "doctest.h"
+#include "utils/eigen.hpp"
+
+using namespace navp;
+
+// dense path : Q = D + a * 11', P = Q^-1
+static utils::NavMatrixDf64 dense_dd_weight(f64 ref_variance, const utils::NavVectorDf64& mov_variance) {
+  auto size = mov_variance.size();
+  utils::NavMatrixDf64 covariance = utils::NavMatrixDf64::Constant(size, size, ref_variance);
+  covariance.diagonal() += mov_variance;
+  return covariance.inverse();
+}
+
+TEST_CASE("closed form dd weight equals the dense inverse") {
+  std::mt19937 gen(30);
+  std::uniform_real_distribution<f64> pseudorange_var(0.05, 4.0), carrier_var(1e-6, 4e-4);
+  for (u16 n : {1, 2, 5, 12, 30}) {
+    utils::NavVectorDf64 d(n);
+    for (u16 i = 0; i < n; ++i) d(i) = pseudorange_var(gen);
+    f64 a = pseudorange_var(gen);
+    utils::NavMatrixDf64 weight(n, n);
+    algorithm::dd_weight(weight.block(0, 0, n, n), a, d);
+    auto dense = dense_dd_weight(a, d);
+    CHECK((weight - dense).norm() <= 1e-10 * dense.norm());
+    CHECK((weight - weight.transpose()).norm() == 0);
+
+    for (u16 i = 0; i < n; ++i) d(i) = carrier_var(gen);
+    a = carrier_var(gen);
+    algorithm::dd_weight(weight.block(0, 0, n, n), a, d);
+    dense = dense_dd_weight(a, d);
+    CHECK((weight - dense).norm() <= 1e-10 * dense.norm());
+  }
+}
+
+TEST_CASE("closed form dd weight into a sub block with strided variance") {
+  constexpr u16 n = 6;
+  // interleaved | pseudorange | carrier | variance, like the single difference random cache
+  f64 interleaved[2 * (n + 1)];
+  for (u16 i = 0; i < n + 1; ++i) interleaved[2 * i] = 0.1 * (i + 1), interleaved[2 * i + 1] = 1e-5 * (i + 1);
+  using VarianceMap = Eigen::Map<const utils::NavVectorDf64, Eigen::Unaligned, Eigen::InnerStride<2>>;
+
+  utils::NavMatrixDf64 weight = utils::NavMatrixDf64::Zero(2 * n + 2, 2 * n + 2);
+  algorithm::dd_weight(weight.block(1, 1, n, n), interleaved[0], VarianceMap(interleaved + 2, n));
+  algorithm::dd_weight(weight.block(n + 1, n + 1, n, n), interleaved[1], VarianceMap(interleaved + 3, n));
+
+  utils::NavVectorDf64 d(n);
+  for (u16 i = 0; i < n; ++i) d(i) = interleaved[2 * (i + 1)];
+  auto pseudorange = dense_dd_weight(interleaved[0], d);
+  for (u16 i = 0; i < n; ++i) d(i) = interleaved[2 * (i + 1) + 1];
+  auto carrier = dense_dd_weight(interleaved[1], d);
+
+  CHECK((weight.block(1, 1, n, n) - pseudorange).norm() <= 1e-10 * pseudorange.norm());
+  CHECK((weight.block(n + 1, n + 1, n, n) - carrier).norm() <= 1e-10 * carrier.norm());
+  // off block entries are untouched
+  CHECK(weight.row(0).isZero());
+  CHECK(weight.col(2 * n + 1).isZero());
+  CHECK(weight.block(1, n + 1, n, n).isZero());
+}
@@ -0,0 +1,170 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <thread>
+#include <vector>
+
+#include "doctest.h"
+#include "io/rtcm/epoch_assembler.hpp"
+#include "sensors/gnss/observation.hpp"
+
+using namespace navp;
+using namespace navp::io::rtcm;
+using namespace navp::sensors::gnss;
+using namespace std::chrono_literals;
+using navp::utils::GTime;
+using navp::utils::GTow;
+using navp::utils::GWeek;
+
+// big endian bit writer of payloads
+struct BitWriter {
+  std::vector<u8> bytes;
+  u32 pos = 0;
+
+  BitWriter& put(i64 value, u32 len) {
+    for (u32 i = 0; i < len; ++i, ++pos) {
+      if (pos % 8 == 0) bytes.push_back(0);
+      if ((static_cast<u64>(value) >> (len - 1 - i)) & 1) bytes.back() |= 0x80 >> (pos % 8);
+    }
+    return *this;
+  }
+
+  // frame of the payload with the header and crc
+  auto frame() const -> std::vector<u8> {
+    std::vector<u8> frame{Rtcm3Decoder::Preamble, static_cast<u8>(bytes.size() >> 8), static_cast<u8>(bytes.size())};
+    frame.insert(frame.end(), bytes.begin(), bytes.end());
+    auto crc = crc24q(frame);
+    frame.insert(frame.end(), {static_cast<u8>(crc >> 16), static_cast<u8>(crc >> 8), static_cast<u8>(crc)});
+    return frame;
+  }
+};
+
+constexpr u32 TowMs = 100001000;  // gps time of week 2200 (ms)
+
+// msm4 of one satellite and one signal at `second` after `TowMs`, gps (1074) or galileo (1094) of the same epoch
+auto msm4(u16 type, u8 prn, u32 second, bool multiple) -> std::vector<u8> {
+  BitWriter bits;
+  bits.put(type, 12).put(1, 12).put(TowMs + second * 1000, 30).put(multiple, 1).put(0, 3 + 7 + 2 + 2 + 1 + 3);
+  for (u8 i = 1; i <= 64; ++i) bits.put(i == prn, 1);
+  for (u8 i = 1; i <= 32; ++i) bits.put(i == 2, 1);
+  bits.put(1, 1);
+  bits.put(70, 8).put(256, 10);
+  bits.put(1000, 15).put(2000, 22).put(10, 4).put(0, 1).put(720, 6);
+  return bits.frame();
+}
+
+auto assembler_of(const EpochAssemblerOptions& options = {}) -> std::unique_ptr<EpochAssembler> {
+  auto assembler = std::make_unique<EpochAssembler>(options);
+  assembler->decoder().set_reference_time(GTime(GWeek(2200), GTow(100000.0)));
+  return assembler;
+}
+
+TEST_CASE("epoch released on its last msm") {
+  auto assembler = assembler_of();
+  auto t0 = EpochAssembler::Clock::now();
+  CHECK(assembler->decode(msm4(1074, 5, 0, true), t0) == 1);
+  CHECK_FALSE(assembler->next());
+  CHECK(assembler->decode(msm4(1094, 11, 0, false), t0 + 40ms) == 1);
+
+  auto epoch = assembler->next();
+  REQUIRE(epoch);
+  CHECK(epoch->complete);
+  CHECK(epoch->messages == 2);
+  CHECK(epoch->obs_map.size() == 2);
+  CHECK(epoch->epoch == EpochUtc(GTime(GWeek(2200), GTow(100001.0))));
+  CHECK(epoch->latency == doctest::Approx(0.04));
+  CHECK_FALSE(assembler->next());
+
+  auto statistics = assembler->statistics();
+  CHECK(statistics.complete == 1);
+  CHECK(statistics.incomplete == 0);
+  CHECK(statistics.completeness() == 1.0);
+  CHECK(statistics.max_latency == doctest::Approx(0.04));
+}
+
+TEST_CASE("partial epoch released by its deadline, late msm dropped") {
+  auto assembler = assembler_of({.deadline = 500ms});
+  auto t0 = EpochAssembler::Clock::now();
+  assembler->decode(msm4(1074, 5, 0, true), t0);
+  CHECK_FALSE(assembler->poll(t0 + 499ms));
+  CHECK(assembler->poll(t0 + 500ms));
+
+  auto epoch = assembler->next();
+  REQUIRE(epoch);
+  CHECK_FALSE(epoch->complete);
+  CHECK(epoch->messages == 1);
+  CHECK(epoch->obs_map.size() == 1);
+  CHECK(epoch->latency == doctest::Approx(0.5));
+
+  // the galileo msm of the released epoch
+  assembler->decode(msm4(1094, 11, 0, false), t0 + 600ms);
+  CHECK_FALSE(assembler->poll(t0 + 2s));
+  CHECK_FALSE(assembler->next());
+  auto statistics = assembler->statistics();
+  CHECK(statistics.late == 1);
+  CHECK(statistics.incomplete == 1);
+  CHECK(statistics.completeness() == 0.0);
+}
+
+TEST_CASE("the next epoch releases the partial one") {
+  auto assembler = assembler_of({.capacity = 2});
+  auto t0 = EpochAssembler::Clock::now();
+  for (u32 second = 0; second < 3; ++second) {
+    auto t = t0 + std::chrono::seconds(second);
+    if (second != 1) assembler->decode(msm4(1074, 5, second, true), t);  // the gps msm of epoch 1 is lost
+    assembler->decode(msm4(1094, 11, second, false), t + 100ms);
+  }
+  // epoch 3 misses its galileo msm, released by the first msm of epoch 4
+  assembler->decode(msm4(1074, 5, 3, true), t0 + 3s);
+  assembler->decode(msm4(1074, 5, 4, true), t0 + 4s);
+
+  auto statistics = assembler->statistics();
+  CHECK(statistics.complete == 3);
+  CHECK(statistics.incomplete == 1);
+  CHECK(statistics.overflows == 2);  // epochs 0 and 1 were not taken
+  CHECK(statistics.completeness() == doctest::Approx(0.75));
+  CHECK(statistics.mean_latency == doctest::Approx((0.1 + 0.0 + 0.1 + 1.0) / 4));
+
+  auto epoch = assembler->next();
+  REQUIRE(epoch);
+  CHECK(epoch->complete);
+  CHECK(epoch->messages == 2);
+  epoch = assembler->next();
+  REQUIRE(epoch);
+  CHECK_FALSE(epoch->complete);
+  CHECK(epoch->epoch == EpochUtc(GTime(GWeek(2200), GTow(100004.0))));
+}
+
+TEST_CASE("epochs loaded into the record across threads") {
+  constexpr u32 Epochs = 50;
+  auto assembler = assembler_of({.deadline = 20ms, .max_wait = 2000ms, .capacity = Epochs});
+  GnssObsRecord record(nullptr);
+  record.set_storage(5);
+
+  std::thread stream([&] {
+    for (u32 second = 0; second < Epochs; ++second) {
+      assembler->decode(msm4(1074, 5, second, true));
+      if (second % 10 != 9) assembler->decode(msm4(1094, 11, second, false));  // left to the deadline
+      std::this_thread::sleep_for(1ms);
+    }
+  });
+  u32 loaded = 0, complete = 0;
+  while (loaded < Epochs && assembler->load_next(record)) {
+    CHECK(record.latest().first == EpochUtc(GTime(GWeek(2200), GTow(100001.0 + loaded))));
+    complete += record.latest().second.size() == 2;
+    ++loaded;
+  }
+  stream.join();
+  CHECK(loaded == Epochs);
+  CHECK(complete == Epochs - Epochs / 10);
+  CHECK(record.epoches().size() == 5);
+  CHECK(record.code_map().size() == 2);
+  CHECK(assembler->statistics().complete == Epochs - Epochs / 10);
+
+  // nothing more within the wait, and nothing once closed
+  auto start = EpochAssembler::Clock::now();
+  CHECK_FALSE(assembler_of({.max_wait = 30ms})->load_next(record));
+  CHECK(EpochAssembler::Clock::now() - start >= 30ms);
+  assembler->close();
+  CHECK(assembler->closed());
+  CHECK_FALSE(assembler->load_next(record));
+  CHECK(assembler->decode(msm4(1074, 5, Epochs, false)) == 0);
+}
@@ -0,0 +1,139 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <memory>
+#include <random>
+
+#include "algorithm/factor/batch_factor.hpp"
+#include "algorithm/factor/pseudorange_factor.hpp"
+#include "doctest.h"
+
+using namespace navp;
+using namespace navp::fgo;
+
+// central difference jacobians of every parameter block, row major as ceres
+// the ranges are ~2e7 m, a 1 m step keeps the rounding error small and the curvature error negligible
+static auto numeric_jacobians(const ceres::CostFunction& factor, std::vector<std::vector<double>> parameters) {
+  auto n = factor.num_residuals();
+  auto& sizes = factor.parameter_block_sizes();
+  std::vector<std::vector<double>> jacobians;
+  std::vector<double> plus(n), minus(n);
+  for (size_t k = 0; k < sizes.size(); ++k) {
+    auto& jacobian = jacobians.emplace_back(n * sizes[k]);
+    for (i32 j = 0; j < sizes[k]; ++j) {
+      auto value = parameters[k][j];
+      std::vector<const double*> blocks;
+      for (auto& block : parameters) blocks.push_back(block.data());
+      parameters[k][j] = value + 1.0;
+      factor.Evaluate(blocks.data(), plus.data(), nullptr);
+      parameters[k][j] = value - 1.0;
+      factor.Evaluate(blocks.data(), minus.data(), nullptr);
+      parameters[k][j] = value;
+      for (i32 i = 0; i < n; ++i) jacobian[i * sizes[k] + j] = (plus[i] - minus[i]) / 2.0;
+    }
+  }
+  return jacobians;
+}
+
+// evaluate with analytic jacobians and compare them with the numeric ones
+static void check_jacobians(const ceres::CostFunction& factor, const std::vector<std::vector<double>>& parameters,
+                            f64 epsilon) {
+  auto n = factor.num_residuals();
+  std::vector<double> residuals(n);
+  std::vector<std::vector<double>> jacobians;
+  std::vector<const double*> blocks;
+  std::vector<double*> jacobian_blocks;
+  for (size_t k = 0; k < parameters.size(); ++k) {
+    blocks.push_back(parameters[k].data());
+    jacobian_blocks.push_back(jacobians.emplace_back(n * parameters[k].size()).data());
+  }
+  REQUIRE(factor.Evaluate(blocks.data(), residuals.data(), jacobian_blocks.data()));
+  auto expected = numeric_jacobians(factor, parameters);
+  for (size_t k = 0; k < parameters.size(); ++k) {
+    for (size_t i = 0; i < jacobians[k].size(); ++i) {
+      CHECK(jacobians[k][i] == doctest::Approx(expected[k][i]).epsilon(epsilon));
+    }
+  }
+}
+
+struct Sky {
+  Sky(u8 number) {
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<f64> angle(0, 2 * EIGEN_PI), elevation(0.2, 1.5);
+    receiver = utils::NavVector3f64(-2267810.0, 5009330.0, 3221000.0);
+    for (u8 i = 0; i < number; ++i) {
+      f64 az = angle(gen), el = elevation(gen);
+      utils::NavVector3f64 los(std::cos(el) * std::sin(az), std::cos(el) * std::cos(az), std::sin(el));
+      sv_pos.emplace_back(receiver + 2.2e7 * los);
+    }
+  }
+
+  utils::NavVector3f64 receiver;
+  std::vector<utils::NavVector3f64> sv_pos;
+};
+
+TEST_CASE("batched pseudorange factor equals the per satellite factors") {
+  Sky sky(12);
+  std::vector<double> position{sky.receiver.x() + 3.0, sky.receiver.y() - 2.0, sky.receiver.z() + 1.0};
+  std::vector<double> clocks{10.0, -25.0};
+  PseudorangeBatchFactor batch(2);
+  for (size_t i = 0; i < sky.sv_pos.size(); ++i) {
+    batch.add(sky.sv_pos[i], (sky.receiver - sky.sv_pos[i]).norm() + 0.5 * i, 0.3 + 0.1 * i, i % 2);
+  }
+  REQUIRE(batch.num_residuals() == 12);
+  REQUIRE(batch.parameter_block_sizes() == std::vector<i32>{3, 1, 1});
+  std::vector<const double*> blocks{position.data(), &clocks[0], &clocks[1]};
+  std::vector<double> residuals(12), jacobian_position(36), jacobian_clock0(12), jacobian_clock1(12);
+  std::vector<double*> jacobians{jacobian_position.data(), jacobian_clock0.data(), jacobian_clock1.data()};
+  REQUIRE(batch.Evaluate(blocks.data(), residuals.data(), jacobians.data()));
+  for (size_t i = 0; i < sky.sv_pos.size(); ++i) {
+    std::unique_ptr<PseudorangeFactor> single(PseudorangeFactor::Create(
+        &sky.sv_pos[i], batch.pseudorange[i], 1.0 / batch.weight[i]));
+    double residual, jacobian[3], jacobian_clock;
+    double* single_jacobians[2] = {jacobian, &jacobian_clock};
+    const double* single_blocks[2] = {position.data(), &clocks[i % 2]};
+    REQUIRE(single->Evaluate(single_blocks, &residual, single_jacobians));
+    CHECK(residuals[i] == doctest::Approx(residual));
+    for (u8 j = 0; j < 3; ++j) CHECK(jacobian_position[3 * i + j] == doctest::Approx(jacobian[j]));
+    CHECK((i % 2 ? jacobian_clock1 : jacobian_clock0)[i] == doctest::Approx(jacobian_clock));
+    CHECK((i % 2 ? jacobian_clock0 : jacobian_clock1)[i] == 0.0);
+  }
+  // residuals without jacobians
+  std::vector<double> only_residuals(12);
+  CHECK(batch.Evaluate(blocks.data(), only_residuals.data(), nullptr));
+  CHECK(only_residuals == residuals);
+  check_jacobians(batch, {position, {clocks[0]}, {clocks[1]}}, 1e-5);
+  // reused for another epoch
+  batch.reset(1);
+  batch.add(sky.sv_pos[0], 2.2e7, 1.0, 0);
+  CHECK(batch.num_residuals() == 1);
+  CHECK(batch.parameter_block_sizes() == std::vector<i32>{3, 1});
+}
+
+TEST_CASE("batched doppler and dd carrier jacobians") {
+  Sky sky(8);
+  SUBCASE("doppler") {
+    DopplerBatchFactor batch;
+    for (size_t i = 0; i < sky.sv_pos.size(); ++i) {
+      utils::NavVector3f64 los = (sky.receiver - sky.sv_pos[i]).normalized();
+      batch.add(los, 100.0 * i - 300.0, 0.1);
+    }
+    CHECK(batch.num_residuals() == 8);
+    check_jacobians(batch, {{1.0, -2.0, 0.5}, {3.0}}, 1e-6);
+  }
+  SUBCASE("dd carrier") {
+    DdCarrierBatchFactor batch;
+    for (size_t i = 1; i < sky.sv_pos.size(); ++i) {
+      f64 dd = (sky.receiver - sky.sv_pos[i]).norm() - (sky.receiver - sky.sv_pos[0]).norm();
+      batch.add(sky.sv_pos[0], sky.sv_pos[i], dd + 0.19 * i, 0.19, 0.003);
+    }
+    CHECK(batch.num_residuals() == 7);
+    CHECK(batch.parameter_block_sizes() == std::vector<i32>{3, 7});
+    std::vector<double> position{sky.receiver.x() + 0.3, sky.receiver.y() - 0.2, sky.receiver.z() + 0.1};
+    check_jacobians(batch, {position, {1, 2, 3, 4, 5, 6, 7}}, 1e-5);
+    // exact at the true position and ambiguities
+    std::vector<double> truth{sky.receiver.x(), sky.receiver.y(), sky.receiver.z()}, ambiguity{1, 2, 3, 4, 5, 6, 7};
+    std::vector<const double*> blocks{truth.data(), ambiguity.data()};
+    std::vector<double> residuals(7);
+    REQUIRE(batch.Evaluate(blocks.data(), residuals.data(), nullptr));
+    for (auto residual : residuals) CHECK(residual == doctest::Approx(0.0).epsilon(1e-6));
+  }
+}
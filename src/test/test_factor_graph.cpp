@@ -0,0 +1,142 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <random>
+
+#include "algorithm/factor_graph.hpp"
+#include "doctest.h"
+
+using namespace navp;
+using namespace navp::fgo;
+using utils::NavMatrix33f64;
+using utils::NavMatrixDf64;
+using utils::NavVector3f64;
+using utils::NavVectorDf64;
+
+constexpr u8 Satellites = 8;
+constexpr f64 Variance = 0.25;  // pseudorange variance (m^2)
+
+// the window and the prior exposed to the test
+struct WindowGraph : GnssFactorGraph {
+  using GnssFactorGraph::GnssFactorGraph;
+  using GnssFactorGraph::prior_;
+  using GnssFactorGraph::window_;
+};
+
+// static receiver seen by 8 satellites, the first five on clock 0 and the others on clock 2
+struct Scene {
+  Scene() : gen(7) {
+    std::uniform_real_distribution<f64> angle(0, 2 * EIGEN_PI), elevation(0.2, 1.5);
+    receiver = NavVector3f64(-2267810.0, 5009330.0, 3221000.0);
+    for (u8 i = 0; i < Satellites; ++i) {
+      f64 az = angle(gen), el = elevation(gen);
+      NavVector3f64 los(std::cos(el) * std::sin(az), std::cos(el) * std::cos(az), std::sin(el));
+      sv_pos.emplace_back(receiver + 2.2e7 * los);
+    }
+  }
+
+  // noisy pseudoranges of one epoch
+  auto observe() -> std::vector<PseudorangeObservation> {
+    std::normal_distribution<f64> noise(0, std::sqrt(Variance));
+    std::vector<PseudorangeObservation> observations;
+    for (u8 i = 0; i < Satellites; ++i) {
+      u8 clock = i < 5 ? 0 : 2;
+      f64 pseudorange = (receiver - sv_pos[i]).norm() + (clock == 0 ? 100.0 : -50.0) + noise(gen);
+      observations.push_back({.sv_pos = sv_pos[i], .pseudorange = pseudorange, .variance = Variance, .clock = clock});
+    }
+    return observations;
+  }
+
+  std::mt19937 gen;
+  NavVector3f64 receiver;
+  std::vector<NavVector3f64> sv_pos;
+};
+
+static auto to_f64(const std::array<double, 3>& block) -> NavVector3f64 {
+  return NavVector3f64(block[0], block[1], block[2]);
+}
+
+TEST_CASE("gnss factor graph converges to the receiver") {
+  Scene scene;
+  WindowGraph graph(4);
+  NavVector3f64 start = scene.receiver + NavVector3f64(30.0, -20.0, 10.0);
+  for (u32 t = 0; t < 6; ++t) {
+    graph.add_epoch(EpochUtc() + std::chrono::seconds(t), t == 0 ? start : graph.position(), scene.observe());
+    REQUIRE(graph.optimize());
+    CHECK(graph.size() == std::min<size_t>(t + 1, 4));
+  }
+  CHECK((graph.position() - scene.receiver).norm() < 2.0);
+  CHECK(graph.clock(0) == doctest::Approx(100.0).epsilon(0.02));
+  CHECK(graph.clock(2) == doctest::Approx(-50.0).epsilon(0.04));
+  CHECK(graph.clock(1) == 0.0);
+
+  // a shorter window marginalizes the first epochs
+  graph.set_slide_window_length(2);
+  CHECK(graph.size() == 2);
+  REQUIRE(graph.optimize());
+  CHECK((graph.position() - scene.receiver).norm() < 2.0);
+}
+
+TEST_CASE("marginal prior is the schur complement of the oldest epoch") {
+  Scene scene;
+  WindowGraph graph(3);
+  graph.set_position_noise(4.0);
+  std::vector<std::vector<PseudorangeObservation>> epochs;
+  for (u32 t = 0; t < 3; ++t) {
+    epochs.push_back(scene.observe());
+    graph.add_epoch(EpochUtc() + std::chrono::seconds(t), scene.receiver + NavVector3f64(3.0, 2.0, -1.0), epochs[t]);
+  }
+  REQUIRE(graph.optimize());
+
+  // dense jacobian and residuals of the oldest epoch : | position(3) | clock 0 | clock 2 | next position(3) |
+  auto& oldest = graph.window_[0];
+  auto& next = graph.window_[1];
+  NavVector3f64 p0 = to_f64(oldest.position), p1 = to_f64(next.position);
+  f64 w = 1.0 / std::sqrt(Variance), s = std::sqrt(4.0 * 1.0);
+  NavMatrixDf64 jacobian = NavMatrixDf64::Zero(Satellites + 3, 8);
+  NavVectorDf64 residual(Satellites + 3);
+  for (u8 i = 0; i < Satellites; ++i) {
+    u8 column = i < 5 ? 3 : 4;
+    f64 clock = static_cast<f64>(oldest.clock[i < 5 ? 0 : 2]);
+    NavVector3f64 u = (p0 - scene.sv_pos[i]).normalized();
+    jacobian.block<1, 3>(i, 0) = -w * u.transpose();
+    jacobian(i, column) = -w;
+    residual(i) = w * (epochs[0][i].pseudorange - (p0 - scene.sv_pos[i]).norm() - clock);
+  }
+  jacobian.block<3, 3>(Satellites, 0) = -NavMatrix33f64::Identity() / s;
+  jacobian.block<3, 3>(Satellites, 5) = NavMatrix33f64::Identity() / s;
+  residual.tail<3>() = (p1 - p0) / s;
+  NavMatrixDf64 h = jacobian.transpose() * jacobian;
+  NavVectorDf64 b = jacobian.transpose() * residual;
+  NavMatrixDf64 h_mm_inv = h.topLeftCorner(5, 5).inverse();
+  NavMatrix33f64 h_prior = h.bottomRightCorner<3, 3>() - h.bottomLeftCorner(3, 5) * h_mm_inv * h.topRightCorner(5, 3);
+  NavVector3f64 b_prior = b.tail<3>() - h.bottomLeftCorner(3, 5) * h_mm_inv * b.head(5);
+
+  // the next epoch slides the window
+  graph.add_epoch(EpochUtc() + std::chrono::seconds(3), p1, scene.observe());
+  CHECK(graph.size() == 3);
+  NavMatrix33f64 sqrt_information = graph.prior_.sqrt_information.cast<f64>();
+  NavVector3f64 residual0 = graph.prior_.residual0.cast<f64>();
+  CHECK((sqrt_information.transpose() * sqrt_information - h_prior).norm() < 1e-6 * h_prior.norm());
+  CHECK((sqrt_information.transpose() * residual0 - b_prior).norm() < 1e-6 * (1.0 + b_prior.norm()));
+  CHECK((graph.prior_.x0.cast<f64>() - p1).norm() == 0.0);
+  CHECK((to_f64(graph.window_.front().position) - p1).norm() == 0.0);
+}
+
+TEST_CASE("sliding window keeps the solution of the full batch") {
+  Scene scene;
+  std::vector<std::vector<PseudorangeObservation>> epochs;
+  for (u32 t = 0; t < 6; ++t) epochs.push_back(scene.observe());
+  NavVector3f64 start = scene.receiver + NavVector3f64(5.0, -5.0, 5.0);
+
+  auto solve = [&](u8 window_length) {
+    WindowGraph graph(window_length);
+    for (u32 t = 0; t < epochs.size(); ++t) {
+      graph.add_epoch(EpochUtc() + std::chrono::seconds(t), t == 0 ? start : graph.position(), epochs[t]);
+      REQUIRE(graph.optimize());
+      CHECK(graph.size() <= window_length);
+    }
+    return graph.position();
+  };
+  // the pseudoranges are close to linear around the solution, the marginalization loses next to nothing
+  CHECK((solve(3) - solve(10)).norm() < 1e-3);
+  CHECK((solve(2) - solve(10)).norm() < 1e-3);
+}
@@ -1,8 +1,11 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <algorithm>
 #include <cpptrace/from_current.hpp>
+#include <vector>
 
 #include "doctest.h"
 #include "filter/filter.hpp"
+#include "utils/angle.hpp"
 
 using namespace navp::filter;
 
@@ -50,4 +53,47 @@ TEST_CASE("MutiFilter") {
   CHECK(f.apply(item3) == false);
   CHECK(f.apply(item4) == true);
   CHECK(f.apply(item5) == true);
-}
\ No newline at end of file
+}
+
+TEST_CASE("CompiledFilter") {
+  using navp::EpochUtc, navp::f64, navp::to_radians, navp::u8;
+  using navp::sensors::gnss::ConstellationEnum;
+  auto s = ">=2024-10-01 08:00:00, <2024-10-02 00:00:00, !=G01, !=C10, >15e, >35s, <=50s, !=GLO, !=L1";
+  auto f = MaskFilters::from_str(s).unwrap_throw();
+  // every check of the compiled predicate agrees with the filters one by one
+  auto filters_apply = [&](const FilterItem& item) {
+    return std::ranges::all_of(f.__filter, [&](const Filter& filter) { return filter.apply(item); });
+  };
+  for (auto item : {item0, item1, item2, item3, item4, item5}) CHECK(f.apply(item) == filters_apply(item));
+
+  CHECK(f.apply(std::get<EpochItem>(item0)) == true);
+  CHECK(f.apply(EpochUtc::from_str("%Y-%m-%d %H:%M:%S", "2024-10-02 00:00:00").unwrap_throw()) == false);
+  CHECK(f.apply(Sv::from_str("G01").unwrap_throw()) == false);
+  CHECK(f.apply(Sv::from_str("G02").unwrap_throw()) == true);
+  CHECK(f.apply(Sv::from_str("C10").unwrap_throw()) == false);
+  CHECK(f.apply(Constellation{.id = ConstellationEnum::GLO}) == false);
+  CHECK(f.apply(ElevationItem{to_radians(15.0)}) == false);
+  CHECK(f.apply(SnrItem{35.0}) == false);
+  CHECK(f.apply(SnrItem{50.0}) == true);
+
+  // elevations and snr of the signals of an epoch at once
+  std::vector<f64> elevation{to_radians(10.0), to_radians(30.0), to_radians(60.0), to_radians(45.0)};
+  std::vector<f64> snr{40.0, 35.0, 45.0, 51.0};
+  std::vector<u8> mask(4, 1);
+  f.__predicate.apply_elevation(elevation, mask);
+  f.__predicate.apply_snr(snr, mask);
+  CHECK(mask == std::vector<u8>{0, 0, 1, 0});
+}
+
+TEST_CASE("DefaultFilter") {
+  using navp::f64, navp::u8;
+  // no filter allows everything, built directly or from an empty list
+  for (const auto& f : {MaskFilters{}, MaskFilters::from_str("").unwrap_throw()}) {
+    for (auto item : {item0, item1, item2, item3, item4, item5}) CHECK(f.apply(item) == true);
+    CHECK(f.apply(Sv::from_str("C10").unwrap_throw()) == true);
+    std::vector<f64> snr{0.0, 35.0};
+    std::vector<u8> mask(2, 1);
+    f.__predicate.apply_snr(snr, mask);
+    CHECK(mask == std::vector<u8>{1, 1});
+  }
+}
@@ -0,0 +1,72 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <random>
+
+#include "algorithm/kalman_filter.hpp"
+#include "doctest.h"
+#include "utils/eigen.hpp"
+
+using namespace navp;
+
+TEST_CASE("sequential update equals batch solution") {
+  std::mt19937 gen(7);
+  std::normal_distribution<f64> noise(0, 1);
+  constexpr u16 n = 5, m = 12;
+  utils::NavMatrixDf64 h = utils::NavMatrixDf64::Zero(m, n);
+  utils::NavVectorDf64 z(m), r(m), x0(n), p0(n);
+  for (u16 j = 0; j < n; ++j) x0(j) = noise(gen), p0(j) = 10.0 + j;
+  for (u16 i = 0; i < m; ++i) {
+    h(i, i % n) = noise(gen);
+    h(i, (i + 2) % n) = noise(gen);
+    z(i) = noise(gen);
+    r(i) = 0.5 + 0.1 * i;
+  }
+
+  algorithm::KalmanFilter<f64> kf(16);
+  for (u16 j = 0; j < n; ++j) kf.add_state(x0(j), p0(j));
+  for (u16 i = 0; i < m; ++i) {
+    u16 index[2] = {static_cast<u16>(i % n), static_cast<u16>((i + 2) % n)};
+    f64 coeff[2] = {h(i, index[0]), h(i, index[1])};
+    f64 innovation = z(i) - h.row(i).dot(kf.state());
+    CHECK(kf.update(index, coeff, innovation, r(i)));
+  }
+
+  // information form
+  utils::NavMatrixDf64 info = p0.cwiseInverse().asDiagonal();
+  info += h.transpose() * r.cwiseInverse().asDiagonal() * h;
+  utils::NavVectorDf64 b = p0.cwiseInverse().cwiseProduct(x0) + h.transpose() * r.cwiseInverse().cwiseProduct(z);
+  utils::NavMatrixDf64 p = info.inverse();
+  utils::NavVectorDf64 x = p * b;
+
+  CHECK((kf.state() - x).norm() == doctest::Approx(0).epsilon(1e-9));
+  CHECK((kf.covariance() - p).norm() == doctest::Approx(0).epsilon(1e-9));
+  CHECK((kf.covariance() - kf.covariance().transpose()).norm() < 1e-12);
+}
+
+TEST_CASE("integrate and remove states") {
+  algorithm::KalmanFilter<f64> kf(4);
+  kf.add_state(1.0, 1.0);  // position
+  kf.add_state(2.0, 4.0);  // velocity
+  kf.add_state(3.0, 9.0);  // extra
+  kf.integrate(0, 1, 0.5);
+  CHECK(kf.state()(0) == doctest::Approx(2.0));
+  CHECK(kf.covariance()(0, 0) == doctest::Approx(1.0 + 0.25 * 4.0));
+  CHECK(kf.covariance()(0, 1) == doctest::Approx(0.5 * 4.0));
+  CHECK(kf.covariance()(1, 0) == doctest::Approx(0.5 * 4.0));
+
+  // the last state moves to the removed place
+  CHECK(kf.remove_state(1) == 2);
+  CHECK(kf.size() == 2);
+  CHECK(kf.state()(1) == doctest::Approx(3.0));
+  CHECK(kf.covariance()(1, 1) == doctest::Approx(9.0));
+  CHECK(kf.covariance()(0, 1) == 0);
+
+  // gate rejects an outlier
+  u16 index[1] = {0};
+  f64 coeff[1] = {1.0};
+  CHECK_FALSE(kf.update(index, coeff, 100.0, 1.0, 10.8));
+  CHECK(kf.state()(0) == doctest::Approx(2.0));
+
+  kf.add_state(0.0, 1.0);
+  kf.add_state(0.0, 1.0);
+  CHECK_THROWS_AS(kf.add_state(0.0, 1.0), algorithm::KalmanRuntimeError);
+}
@@ -0,0 +1,190 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <random>
+
+#include "doctest.h"
+#include "sensors/gnss/constants.hpp"
+#include "solution/network_rtk.hpp"
+
+using namespace navp;
+using namespace navp::sensors::gnss;
+using solution::BaseEpoch;
+using solution::BaseStation;
+using solution::NetworkRtk;
+using solution::PvtSolutionRecord;
+using solution::SolutionModeEnum;
+using utils::CoordinateXyz;
+using utils::NavVector3f64;
+using RtkPayload = solution::__RtkPayload;
+using SystemPayload = solution::__RtkPayload::SystemPayload;
+
+constexpr u8 Satellites = 8;
+constexpr std::array<ObsCodeEnum, 2> Codes = {ObsCodeEnum::L1C, ObsCodeEnum::L2W};
+
+// synthetic rover and three base stations about 20 km around it : gps L1/L2, integer ambiguities and white noise
+struct NetworkScene {
+  NetworkScene() {
+    std::mt19937 gen(20241203);
+    std::uniform_real_distribution<f64> angle(0, 2 * EIGEN_PI), elevation(0.3, 1.5);
+    std::uniform_int_distribution<i32> ambiguity(-100000, 100000);
+    std::normal_distribution<f64> noise(0, 1);
+    rover = CoordinateXyz(NavVector3f64(-2267810.0, 5009330.0, 3221000.0));
+    for (u8 i = 0; i < Satellites; ++i) {
+      Sv sv{.prn = static_cast<u8>(i + 1), .constellation = Constellation{.id = ConstellationEnum::GPS}};
+      auto& eph = sv_map[sv];
+      eph.sv = sv;
+      f64 az = angle(gen), el = elevation(gen);
+      NavVector3f64 los(std::cos(el) * std::sin(az), std::cos(el) * std::cos(az), std::sin(el));
+      eph.pos = CoordinateXyz(NavVector3f64(rover + 2.2e7 * los));
+    }
+    auto observe = [&](const CoordinateXyz& station) {
+      GnssObsRecord::ObsMap obs_map;
+      for (auto& [sv, eph] : sv_map) {
+        auto obs = std::make_shared<GObs>();
+        obs->sv = sv;
+        f64 distance = (station - eph.pos).norm();
+        for (auto code : Codes) {
+          Sig sig;
+          f64 lambda = Constants::code_to_wave_length(sv.system(), code);
+          sig.code = code, sig.freq = Constants::code_to_freq_enum(sv.constellation.id, code);
+          sig.pseudorange = distance + 0.3 * noise(gen);
+          sig.carrier = (distance + 0.003 * noise(gen)) / lambda + ambiguity(gen);
+          sig.code_var = 0.09, sig.phase_var = 9e-6;
+          obs->sigs_list[sig.freq].push_back(sig);
+        }
+        obs_map.emplace(sv, obs);
+      }
+      return obs_map;
+    };
+    rover_obs = observe(rover);
+    for (auto offset : {NavVector3f64(2e4, 0, 0), NavVector3f64(0, 2e4, 0), NavVector3f64(-1.4e4, -1.4e4, 0)}) {
+      CoordinateXyz base(NavVector3f64(rover + offset));
+      bases.emplace_back(BaseStation::preprocess(EpochUtc(), base, observe(base), sv_map, GnssRandomHandler{}));
+    }
+    for (auto& base : bases) payloads.emplace_back(payload_of(*base));
+  }
+
+  // dd payload of the rover against `base`, the first satellite is the reference
+  SystemPayload payload_of(const BaseEpoch& base) const {
+    SystemPayload payload;
+    for (u8 i = 0; i < Satellites; ++i) {
+      Sv sv{.prn = static_cast<u8>(i + 1), .constellation = Constellation{.id = ConstellationEnum::GPS}};
+      payload.public_view_satellites.emplace_back(sv);
+      payload.rover_eph.emplace_back(std::addressof(sv_map.at(sv)));
+      payload.bt_base_satellites_distance.emplace_back(base.find(sv)->distance);
+    }
+    payload.available_code_set.insert(Codes.begin(), Codes.end());
+    for (auto code : payload.available_code_set) {
+      for (auto sv : payload.public_view_satellites) {
+        payload.rover_sigs.emplace_back(rover_obs.at(sv)->find_code(code));
+        payload.base_sigs.emplace_back(base.find(sv)->find_code(code));
+      }
+    }
+    return payload;
+  }
+
+  CoordinateXyz rover;
+  EphemerisSolver::SvMap sv_map;
+  GnssObsRecord::ObsMap rover_obs;
+  std::vector<std::shared_ptr<const BaseEpoch>> bases;
+  std::vector<SystemPayload> payloads;
+};
+
+// float solution of the dd models of `payloads` stacked on one rover position, iterated from `start` as the rtk does
+static auto solve_float(std::span<const SystemPayload* const> payloads, const CoordinateXyz& start)
+    -> PvtSolutionRecord {
+  u16 ambiguity_size = 0;
+  for (auto payload : payloads) ambiguity_size += payload->dd_ambiguity_size();
+  algorithm::WeightedLeastSquare<f64> wls(3 + ambiguity_size, 2 * ambiguity_size, spdlog::default_logger());
+  PvtSolutionRecord sol;
+  sol.position = start;
+  wls.parameter().block(0, 0, 3, 1) = sol.position;
+  auto for_each_payload = [&](auto&& build) {
+    u16 dd_ambiguity_index = 0;
+    for (auto payload : payloads) {
+      build(payload, dd_ambiguity_index);
+      dd_ambiguity_index += payload->dd_ambiguity_size();
+    }
+  };
+  for_each_payload([&](auto payload, u16 index) { payload->build_dd_model(&wls, index, sol.position); });
+  for (sol.iter = 1; sol.iter <= RtkPayload::MaxIteration; ++sol.iter) {
+    wls.correct();
+    sol.position = wls.parameter().block(0, 0, 3, 1);
+    if (wls.parameter_correction().block(0, 0, 3, 1).norm() < RtkPayload::ConvergeLimit) break;
+    for_each_payload([&](auto payload, u16 index) { payload->update_dd_geometry(&wls, index, sol.position); });
+  }
+  REQUIRE(sol.iter <= RtkPayload::MaxIteration);
+  utils::NavMatrixDf64 covariance = wls.cofactor().inverse();
+  wls.evaluate();
+  RtkPayload::evaluate_float(sol, wls, covariance);
+  return sol;
+}
+
+static utils::NavMatrix33f64 covariance_of(const PvtSolutionRecord& sol) {
+  auto& qr = sol.qr;
+  utils::NavMatrix33f64 covariance;
+  covariance << qr[0], qr[1], qr[2], qr[1], qr[3], qr[4], qr[2], qr[4], qr[5];
+  return covariance;
+}
+
+TEST_CASE("independent baselines combine into the joint solution") {
+  NetworkScene scene;
+  CoordinateXyz start(NavVector3f64(scene.rover + NavVector3f64(3.0, -2.0, 4.0)));
+
+  // independent : every baseline alone, then the inverse covariance weighted mean
+  std::vector<PvtSolutionRecord> independent;
+  for (auto& payload : scene.payloads) {
+    const SystemPayload* payloads[] = {std::addressof(payload)};
+    auto& sol = independent.emplace_back(solve_float(payloads, start));
+    CHECK((sol.position - scene.rover).norm() < 5.0 * std::sqrt(covariance_of(sol).trace()));
+  }
+  std::vector<const PvtSolutionRecord*> solutions;
+  for (auto& sol : independent) solutions.push_back(std::addressof(sol));
+  PvtSolutionRecord combined;
+  REQUIRE(NetworkRtk::combine(solutions, combined));
+  CHECK(combined.mode == SolutionModeEnum::FLOAT);
+
+  // joint : the dd models of every baseline stacked on one rover position
+  std::vector<const SystemPayload*> payloads;
+  for (auto& payload : scene.payloads) payloads.push_back(std::addressof(payload));
+  auto joint = solve_float(payloads, start);
+
+  // the baselines only share the rover position and are not correlated in the weight, so the information of the
+  // joint solution is the sum of the information of every baseline
+  CHECK((combined.position - joint.position).norm() < 1e-4);
+  utils::NavMatrix33f64 joint_covariance = covariance_of(joint);
+  CHECK((covariance_of(combined) - joint_covariance).norm() < 1e-4 * joint_covariance.norm());
+  for (auto& sol : independent) CHECK(joint_covariance.trace() < covariance_of(sol).trace());
+}
+
+TEST_CASE("independent combination of fixed and float baselines") {
+  auto record_of = [](NavVector3f64 position, f32 variance, SolutionModeEnum mode) {
+    PvtSolutionRecord sol;
+    sol.position = CoordinateXyz(position);
+    sol.qr[0] = sol.qr[3] = sol.qr[5] = variance;
+    sol.qr[1] = sol.qr[2] = sol.qr[4] = 0;
+    sol.mode = mode;
+    return sol;
+  };
+  NavVector3f64 origin(-2267810.0, 5009330.0, 3221000.0);
+  auto a = record_of(origin, 1.0f, SolutionModeEnum::FLOAT);
+  auto b = record_of(NavVector3f64(origin + NavVector3f64(1.0, 2.0, -1.0)), 4.0f, SolutionModeEnum::FLOAT);
+  auto c = record_of(NavVector3f64(origin + NavVector3f64(0.5, 0.0, 0.0)), 1e-4f, SolutionModeEnum::FIXED);
+  PvtSolutionRecord sol;
+
+  // float baselines weighted by their information, 1 and 1/4
+  const PvtSolutionRecord* floats[] = {&a, &b};
+  REQUIRE(NetworkRtk::combine(floats, sol));
+  CHECK(sol.mode == SolutionModeEnum::FLOAT);
+  CHECK((sol.position - NavVector3f64(origin + NavVector3f64(0.2, 0.4, -0.2))).norm() < 1e-6);
+  CHECK(sol.qr[0] == doctest::Approx(0.8));
+  CHECK(sol.qr[1] == doctest::Approx(0.0));
+
+  // a fixed baseline leaves the float ones out
+  const PvtSolutionRecord* mixed[] = {&a, &c, &b};
+  REQUIRE(NetworkRtk::combine(mixed, sol));
+  CHECK(sol.mode == SolutionModeEnum::FIXED);
+  CHECK((sol.position - c.position).norm() < 1e-6);
+  CHECK(sol.qr[0] == doctest::Approx(1e-4));
+
+  CHECK_FALSE(NetworkRtk::combine({}, sol));
+}
@@ -0,0 +1,155 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "doctest.h"
+#include "io/ntrip/ntrip.hpp"
+#include "io/rtcm/rtcm3.hpp"
+
+using namespace navp;
+using namespace navp::io::ntrip;
+using namespace navp::io::rtcm;
+using namespace std::chrono_literals;
+
+// 1005 frames of increasing station ids
+static auto station_frames(u16 count) -> std::vector<u8> {
+  std::vector<u8> data;
+  for (u16 station = 0; station < count; ++station) {
+    std::vector<u8> payload(19);
+    payload[0] = 1005 >> 4, payload[1] = (1005 & 0xF) << 4 | station >> 8, payload[2] = station & 0xFF;
+    std::vector<u8> frame{Rtcm3Decoder::Preamble, 0, static_cast<u8>(payload.size())};
+    frame.insert(frame.end(), payload.begin(), payload.end());
+    auto crc = crc24q(frame);
+    frame.insert(frame.end(), {static_cast<u8>(crc >> 16), static_cast<u8>(crc >> 8), static_cast<u8>(crc)});
+    data.insert(data.end(), frame.begin(), frame.end());
+  }
+  return data;
+}
+
+static auto write_file(std::string_view name, const std::vector<u8>& data) -> std::string {
+  auto filename = (std::filesystem::temp_directory_path() / name).string();
+  std::ofstream file(filename, std::ios::binary);
+  file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+  return filename;
+}
+
+template <typename Predicate>
+static bool wait_until(Predicate predicate, std::chrono::milliseconds timeout = 5000ms) {
+  auto deadline = SteadyClock::now() + timeout;
+  while (!predicate()) {
+    if (SteadyClock::now() > deadline) return false;
+    std::this_thread::sleep_for(1ms);
+  }
+  return true;
+}
+
+TEST_CASE("stream endpoint") {
+  auto endpoint = StreamEndpoint::from_str("user:pass@caster.example.com:2102/MOUNT1");
+  CHECK(endpoint.user == "user");
+  CHECK(endpoint.password == "pass");
+  CHECK(endpoint.host == "caster.example.com");
+  CHECK(endpoint.port == 2102);
+  CHECK(endpoint.mountpoint == "MOUNT1");
+
+  endpoint = StreamEndpoint::from_str("10.0.0.1:9000");
+  CHECK(endpoint.host == "10.0.0.1");
+  CHECK(endpoint.mountpoint.empty());
+  CHECK_THROWS_AS(StreamEndpoint::from_str("host:70000/M"), NtripRuntimeError);
+}
+
+TEST_CASE("frames of many streams reach their decoders") {
+  constexpr u16 Frames = 500;
+  constexpr u32 Streams = 64;
+  auto data = station_frames(Frames);
+  LocalCaster caster;
+  caster.add_mountpoint("A", write_file("navp_ntrip_a.rtcm3", data), 700);  // frames split across reads
+  caster.start();
+
+  IngestionLoop loop({.threads = 2, .min_backoff = 10s});
+  std::vector<std::unique_ptr<Rtcm3Decoder>> decoders;
+  std::atomic<bool> framed = true;
+  for (u32 i = 0; i < Streams; ++i) {
+    auto& decoder = *decoders.emplace_back(std::make_unique<Rtcm3Decoder>());
+    loop.add_stream({.port = caster.port(), .mountpoint = "A"}, [&](std::span<const u8> frames) {
+      if (decoder.decode(frames) != frames.size() / 25) framed = false;  // frames of 25 bytes
+    });
+  }
+  loop.start();
+  CHECK(wait_until([&] {
+    for (u32 i = 0; i < Streams; ++i) {
+      if (loop.statistics(i).frames != Frames) return false;
+    }
+    return true;
+  }));
+  loop.stop();  // the decoders are read once the loops stopped
+  CHECK(framed);
+
+  for (u32 i = 0; i < Streams; ++i) {
+    auto statistics = loop.statistics(i);
+    CHECK(statistics.frames == Frames);
+    CHECK(statistics.bytes == data.size() + std::string_view("ICY 200 OK\r\n").size());
+    CHECK(statistics.dropped_bytes == 0);
+    CHECK(statistics.connects == 1);
+    CHECK(statistics.max_latency >= statistics.mean_latency);
+    CHECK(decoders[i]->messages() == Frames);
+    CHECK(decoders[i]->crc_errors() == 0);
+    CHECK(decoders[i]->message().station == Frames - 1);
+  }
+  CHECK(caster.clients() == Streams);
+}
+
+TEST_CASE("bytes between frames are dropped") {
+  auto data = station_frames(10);
+  data.insert(data.begin() + 25, {0x00, 0xD3, 0xFF, 0x12});  // after the first frame
+  LocalCaster caster;
+  caster.add_mountpoint("NOISE", write_file("navp_ntrip_noise.rtcm3", data), 5);
+  caster.start();
+
+  IngestionLoop loop;
+  std::atomic<u64> frames = 0;
+  auto id = loop.add_stream({.port = caster.port(), .mountpoint = "NOISE"}, [&](std::span<const u8> span) {
+    frames += Rtcm3Decoder().decode(span);
+  });
+  loop.start();
+  CHECK(wait_until([&] { return frames == 10; }));
+  CHECK(loop.statistics(id).dropped_bytes == 4);
+}
+
+TEST_CASE("host names are resolved when the stream is added") {
+  LocalCaster caster;
+  caster.add_mountpoint("NAMED", write_file("navp_ntrip_named.rtcm3", station_frames(5)));
+  caster.start();
+
+  IngestionLoop loop;
+  std::atomic<u64> frames = 0;
+  loop.add_stream({.host = "localhost", .port = caster.port(), .mountpoint = "NAMED"},
+                  [&](std::span<const u8> span) { frames += Rtcm3Decoder().decode(span); });
+  loop.start();
+  CHECK(wait_until([&] { return frames == 5; }));
+}
+
+TEST_CASE("streams reconnect after a backoff") {
+  auto data = station_frames(100);
+  LocalCaster caster;
+  caster.add_mountpoint("LOOP", write_file("navp_ntrip_loop.rtcm3", data), 256, 1ms, true);
+  caster.start();
+
+  IngestionLoop loop({.min_backoff = 20ms, .max_backoff = 100ms});
+  auto id = loop.add_stream({.port = caster.port(), .mountpoint = "LOOP"}, [](std::span<const u8>) {});
+  auto missing = loop.add_stream({.port = caster.port(), .mountpoint = "MISSING"}, [](std::span<const u8>) {});
+  loop.start();
+  CHECK(wait_until([&] { return loop.statistics(id).frames > 0; }));
+  caster.disconnect_all();
+  CHECK(wait_until([&] { return loop.statistics(id).connects == 2; }));
+  CHECK(loop.statistics(id).failures == 1);
+  CHECK(wait_until([&] { return loop.statistics(id).state == StreamStateEnum::STREAMING; }));
+
+  // refused by the caster
+  CHECK(wait_until([&] { return loop.statistics(missing).failures >= 3; }));
+  CHECK(loop.statistics(missing).connects == 0);
+  CHECK(loop.statistics(missing).frames == 0);
+}
@@ -0,0 +1,91 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <random>
+
+#include "algorithm/raim.hpp"
+#include "doctest.h"
+#include "utils/eigen.hpp"
+
+using namespace navp;
+
+struct RaimModel {
+  RaimModel(u16 sat_number, u8 clock_number, u8 sig_per_sat) {
+    std::mt19937 gen(1);
+    std::normal_distribution<f64> noise(0, 1);
+    u16 rows = sat_number * sig_per_sat;
+    jacobian.setZero(rows, 3 + clock_number);
+    observation.resize(rows);
+    weight.resize(rows);
+    for (u16 sat = 0; sat < sat_number; ++sat) {
+      group.push_back(sat * sig_per_sat);
+      utils::NavVector3f64 los(noise(gen), noise(gen), std::abs(noise(gen)));
+      los.normalize();
+      for (u8 k = 0; k < sig_per_sat; ++k) {
+        u16 row = sat * sig_per_sat + k;
+        jacobian.row(row).head(3) = -los;
+        jacobian(row, 3 + sat % clock_number) = 1;
+        weight(row) = 1.0 / (k + 1);
+        observation(row) = 0.5 * noise(gen) / std::sqrt(weight(row));
+      }
+    }
+    group.push_back(rows);
+  }
+
+  // weighted residual sum of squares by solving the normal equation again
+  f64 sse_without(size_t g) const {
+    utils::NavVectorDf64 w = weight;
+    w.segment(group[g], group[g + 1] - group[g]).setZero();
+    utils::NavMatrixDf64 normal = jacobian.transpose() * w.asDiagonal() * jacobian;
+    utils::NavVectorDf64 dx = normal.llt().solve(jacobian.transpose() * (w.array() * observation.array()).matrix());
+    return ((observation - jacobian * dx).array().square() * w.array()).sum();
+  }
+
+  utils::NavMatrixDf64 jacobian;
+  utils::NavVectorDf64 observation, weight;
+  std::vector<u16> group;
+};
+
+TEST_CASE("chi-square threshold") {
+  CHECK(algorithm::details::chisqr_threshold(1) == doctest::Approx(10.8));
+  CHECK(algorithm::details::chisqr_threshold(100) == doctest::Approx(149));
+  // approximation is continuous with the table
+  CHECK(algorithm::details::chisqr_threshold(101) == doctest::Approx(149.4).epsilon(0.01));
+}
+
+TEST_CASE("leave-one-out by downdate") {
+  RaimModel model(20, 3, 2);
+  algorithm::FaultDetectionExclusion<f64> fde(model.jacobian.cols());
+  REQUIRE(fde.factorize(model.jacobian, model.weight, model.observation));
+  CHECK(fde.statistic().consistent());
+  CHECK(fde.statistic().dof == 40 - 6);
+  for (size_t g = 0; g + 1 < model.group.size(); ++g) {
+    auto stat = fde.leave_out(model.group[g], 2);
+    CHECK(stat.sse == doctest::Approx(model.sse_without(g)));
+    CHECK(stat.dof == 38 - 6);
+  }
+  CHECK(fde.worst_group(model.group) >= 0);
+}
+
+TEST_CASE("detection and exclusion") {
+  RaimModel model(40, 4, 2);
+  model.observation.segment(model.group[7], 2).array() += 30.0;
+  algorithm::FaultDetectionExclusion<f64> fde(model.jacobian.cols());
+  REQUIRE(fde.factorize(model.jacobian, model.weight, model.observation));
+  CHECK_FALSE(fde.statistic().consistent());
+  CHECK(fde.worst_group(model.group) == 7);
+  REQUIRE(fde.exclude(model.group[7], 2));
+  auto stat = fde.statistic();
+  CHECK(stat.consistent());
+  CHECK(stat.sse == doctest::Approx(model.sse_without(7)));
+}
+
+TEST_CASE("unremovable satellite") {
+  // only one satellite observes the last clock, its removal makes the geometry singular
+  RaimModel model(9, 2, 1);
+  model.jacobian.conservativeResize(Eigen::NoChange, 6);
+  model.jacobian.col(5).setZero();
+  model.jacobian(8, 4) = 0;
+  model.jacobian(8, 5) = 1;
+  algorithm::FaultDetectionExclusion<f64> fde(6);
+  REQUIRE(fde.factorize(model.jacobian, model.weight, model.observation));
+  CHECK_FALSE(fde.leave_out(8, 1).valid());
+}
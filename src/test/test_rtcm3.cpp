@@ -0,0 +1,192 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "doctest.h"
+#include "io/rtcm/rtcm3.hpp"
+#include "sensors/gnss/constants.hpp"
+#include "sensors/gnss/navigation.hpp"
+#include "sensors/gnss/observation.hpp"
+
+using namespace navp;
+using namespace navp::io::rtcm;
+using namespace navp::sensors::gnss;
+using navp::utils::GTime;
+using navp::utils::GTow;
+using navp::utils::GWeek;
+
+// big endian bit writer of payloads
+struct BitWriter {
+  std::vector<u8> bytes;
+  u32 pos = 0;
+
+  BitWriter& put(i64 value, u32 len) {
+    for (u32 i = 0; i < len; ++i, ++pos) {
+      if (pos % 8 == 0) bytes.push_back(0);
+      if ((static_cast<u64>(value) >> (len - 1 - i)) & 1) bytes.back() |= 0x80 >> (pos % 8);
+    }
+    return *this;
+  }
+
+  // frame of the payload with the header and crc
+  auto frame() const -> std::vector<u8> {
+    std::vector<u8> frame{Rtcm3Decoder::Preamble, static_cast<u8>(bytes.size() >> 8), static_cast<u8>(bytes.size())};
+    frame.insert(frame.end(), bytes.begin(), bytes.end());
+    auto crc = crc24q(frame);
+    frame.insert(frame.end(), {static_cast<u8>(crc >> 16), static_cast<u8>(crc >> 8), static_cast<u8>(crc)});
+    return frame;
+  }
+};
+
+constexpr f64 RoughRange = 70.25, FineRange = 1.5e-5, FinePhase = 2.5e-5;  // ms
+constexpr f64 RoughRate = 512, FineRate = 0.125;                            // m/s
+constexpr u32 TowMs = 100001000;                                            // gps time of week 2200 (ms)
+
+// msm7 of one satellite and two signals, L1C/L2L (gps) or L1C/L2C (glonass)
+auto msm7(u16 type, u8 prn, u32 epoch, bool multiple, u8 info) -> std::vector<u8> {
+  BitWriter bits;
+  bits.put(type, 12).put(1, 12).put(epoch, 30).put(multiple, 1).put(0, 3 + 7 + 2 + 2 + 1 + 3);
+  for (u8 i = 1; i <= 64; ++i) bits.put(i == prn, 1);
+  u8 signal = type == 1077 ? 16 : 8;
+  for (u8 i = 1; i <= 32; ++i) bits.put(i == 2 || i == signal, 1);
+  bits.put(0b11, 2);
+  bits.put(70, 8).put(info, 4).put(std::lround(0.25 * 1024), 10).put(RoughRate, 14);
+  for (i32 k = 0; k < 2; ++k) bits.put(std::lround(FineRange * std::ldexp(1.0, 29)), 20);
+  for (i32 k = 0; k < 2; ++k) bits.put(std::lround(FinePhase * std::ldexp(1.0, 31)), 24);
+  for (i32 k = 0; k < 2; ++k) bits.put(100, 10);
+  bits.put(0, 2);
+  for (i32 k = 0; k < 2; ++k) bits.put(45 * 16, 10);
+  for (i32 k = 0; k < 2; ++k) bits.put(std::lround(FineRate * 1e4), 15);
+  return bits.frame();
+}
+
+auto reference_time() -> GTime { return GTime(GWeek(2200), GTow(100000.0)); }
+
+auto epoch_frames() -> std::vector<u8> {
+  // moscow time of the same epoch, leap seconds of 18 s
+  u32 tod = (TowMs - 86400000 - 18000 + 10800000) | (1u << 27);
+  auto frames = msm7(1077, 5, TowMs, true, 0);
+  auto glonass = msm7(1087, 3, tod, false, 4);  // frequency channel -3
+  frames.insert(frames.end(), glonass.begin(), glonass.end());
+  return frames;
+}
+
+TEST_CASE("crc-24q") {
+  std::string_view check = "123456789";
+  CHECK(crc24q(std::span(reinterpret_cast<const u8*>(check.data()), check.size())) == 0xCDE703);
+  CHECK(crc24q({}) == 0);
+}
+
+TEST_CASE("msm7 of an epoch split across buffers") {
+  GnssObsRecord record(nullptr);
+  Rtcm3Decoder decoder;
+  u32 epoch_ends = 0;
+  decoder.set_observation(&record).set_reference_time(reference_time()).set_callback([&](const Rtcm3Message& message) {
+    epoch_ends += message.is_epoch_end();
+  });
+
+  auto frames = epoch_frames();
+  frames.insert(frames.begin(), {0xD3, 0x04, 0x00, 0x12});  // noise before the frames
+  size_t decoded = 0;
+  for (size_t pos = 0; pos < frames.size(); pos += 7) {
+    decoded += decoder.decode(std::span(frames).subspan(pos, std::min<size_t>(7, frames.size() - pos)));
+  }
+  CHECK(decoded == 2);
+  CHECK(decoder.messages() == 2);
+  CHECK(epoch_ends == 1);
+  CHECK(decoder.message().type == 1087);
+
+  // one epoch of both constellations
+  auto expected = GTime(GWeek(2200), GTow(TowMs * 1e-3));
+  CHECK(decoder.message().time == expected);
+  REQUIRE(record.epoches().size() == 1);
+  auto& [time, obs_map] = record.latest();
+  CHECK(time == EpochUtc(expected));
+  CHECK(obs_map.size() == 2);
+
+  auto gps = record.at(time, Sv{.prn = 5, .constellation = {.id = ConstellationEnum::GPS}});
+  REQUIRE(gps);
+  const auto& l1 = gps->sigs_list.at(FreTypeEnum::F1).front();
+  CHECK(l1.code == ObsCodeEnum::L1C);
+  CHECK(l1.valid == Sig::Valid);
+  CHECK(l1.pseudorange == doctest::Approx((RoughRange + FineRange) * Constants::CLIGHT * 1e-3));
+  CHECK(l1.carrier == doctest::Approx((RoughRange + FinePhase) * Constants::frequency(FreTypeEnum::F1) * 1e-3));
+  CHECK(l1.doppler ==
+        doctest::Approx(-(RoughRate + FineRate) * Constants::frequency(FreTypeEnum::F1) / Constants::CLIGHT));
+  CHECK(l1.snr == doctest::Approx(45.0));
+  CHECK_FALSE(l1.lli);
+  CHECK(gps->sigs_list.at(FreTypeEnum::F2).front().code == ObsCodeEnum::L2L);
+  CHECK(record.code_map().at(ConstellationEnum::GPS).contains(ObsCodeEnum::L2L));
+
+  // glonass carriers of the frequency channel
+  auto glonass = record.at(time, Sv{.prn = 3, .constellation = {.id = ConstellationEnum::GLO}});
+  REQUIRE(glonass);
+  const auto& g2 = glonass->sigs_list.at(FreTypeEnum::G2).front();
+  CHECK(g2.code == ObsCodeEnum::L2C);
+  CHECK(g2.carrier == doctest::Approx((RoughRange + FinePhase) * (1246e6 - 3 * 0.4375e6) * 1e-3));
+}
+
+TEST_CASE("frames of a bad crc are skipped") {
+  GnssObsRecord record(nullptr);
+  Rtcm3Decoder decoder;
+  decoder.set_observation(&record).set_reference_time(reference_time());
+  auto frames = epoch_frames();
+  frames[10] ^= 0x01;
+  CHECK(decoder.decode(frames) == 1);
+  CHECK(decoder.crc_errors() == 1);
+  CHECK(decoder.message().type == 1087);
+}
+
+TEST_CASE("gps ephemeris and station position") {
+  Navigation nav;
+  Rtcm3Decoder decoder;
+  decoder.set_navigation(&nav).set_reference_time(reference_time());
+
+  BitWriter eph;
+  eph.put(1019, 12).put(7, 6).put(152, 10).put(0, 4).put(1, 2).put(0, 14).put(37, 8).put(100800 / 16, 16);
+  eph.put(0, 8).put(0, 16).put(std::lround(1e-4 * std::ldexp(1.0, 31)), 22).put(37, 10);
+  eph.put(0, 16).put(0, 16).put(0, 32).put(0, 16).put(std::lround(0.01 * std::ldexp(1.0, 33)), 32).put(0, 16);
+  eph.put(std::lround(5153.6 * std::ldexp(1.0, 19)), 32).put(100800 / 16, 16);
+  eph.put(0, 16).put(0, 32).put(0, 16).put(0, 32).put(0, 16).put(0, 32).put(0, 24).put(0, 8).put(0, 6);
+  eph.put(0, 1).put(0, 1);
+  REQUIRE(decoder.decode_frame(eph.frame()));
+  Sv sv{.prn = 7, .constellation = {.id = ConstellationEnum::GPS}};
+  auto& ephs = nav.ephMap[sv][NavMsgTypeEnum::LNAV];
+  REQUIRE(ephs.size() == 1);
+  auto& [toe, decoded] = *ephs.begin();
+  CHECK(toe == GTime(GWeek(2200), GTow(100800.0)));
+  CHECK(decoded.iode == 37);
+  CHECK(decoded.f0 == doctest::Approx(1e-4));
+  CHECK(decoded.e == doctest::Approx(0.01));
+  CHECK(decoded.A == doctest::Approx(5153.6 * 5153.6));
+
+  BitWriter station;
+  i64 x = -22678045263, y = 50093423723, z = 32209918632;
+  station.put(1005, 12).put(12, 12).put(0, 10).put(x, 38).put(0, 2).put(y, 38).put(0, 2).put(z, 38);
+  REQUIRE(decoder.decode_frame(station.frame()));
+  CHECK(decoder.message().station == 12);
+  CHECK(decoder.station_position().x() == doctest::Approx(-2267804.5263));
+  CHECK(decoder.station_position().z() == doctest::Approx(3220991.8632));
+}
+
+TEST_CASE("rtcm3 stream reads a record an epoch") {
+  auto filename = (std::filesystem::temp_directory_path() / "navp_test.rtcm3").string();
+  {
+    std::ofstream file(filename, std::ios::binary);
+    auto frames = epoch_frames();
+    for (i32 i = 0; i < 2; ++i) file.write(reinterpret_cast<const char*>(frames.data()), frames.size());
+  }
+  CHECK(Rtcm3Stream::is_rtcm3_file(filename));
+
+  GnssObsRecord record(nullptr);
+  Rtcm3Stream stream(filename, std::ios::in | std::ios::binary);
+  stream.decoder().set_reference_time(reference_time());
+  record.get_record(stream);
+  CHECK(stream.record_number == 1);
+  CHECK(record.epoches().size() == 1);
+  record.get_record(stream);
+  CHECK(stream.record_number == 2);
+  CHECK(stream.decoder().messages() == 4);
+}
@@ -0,0 +1,147 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <random>
+
+#include "algorithm/rts_smoother.hpp"
+#include "doctest.h"
+
+using namespace navp;
+using algorithm::RtsSmoother;
+using utils::NavMatrix22f64;
+using utils::NavMatrix24f64;
+using utils::NavMatrixDf64;
+using utils::NavMatrixf64;
+using utils::NavVector2f64;
+using utils::NavVectorDf64;
+
+static auto store_path(const char* name) -> std::filesystem::path {
+  return std::filesystem::temp_directory_path() / name;
+}
+
+// constant velocity along one axis, position measured every second
+struct Trajectory {
+  Trajectory(u16 n) : z(n) {
+    std::mt19937 gen(11);
+    std::normal_distribution<f64> noise(0, 1);
+    f = NavMatrix22f64{{1.0, dt}, {0.0, 1.0}};
+    q = NavMatrix22f64{{dt * dt * dt / 3, dt * dt / 2}, {dt * dt / 2, dt}} * 0.1;
+    for (u16 k = 0; k < n; ++k) z(k) = 2.0 * k + noise(gen) * std::sqrt(r);
+  }
+
+  // kalman filter forward pass, every epoch streamed to the smoother
+  void forward(RtsSmoother& smoother, EpochUtc epoch, u16 begin, u16 end) const {
+    NavVector2f64 x = x0;
+    NavMatrix22f64 p = p0;
+    for (u16 k = begin; k < end; ++k, epoch = epoch + std::chrono::seconds(1)) {
+      if (k > begin) {
+        x = f * x;
+        p = f * p * f.transpose() + q;
+        smoother.predicted(epoch, x, p, f);
+      }
+      NavMatrixf64<1, 2> h(1.0, 0.0);
+      NavVector2f64 gain = p * h.transpose() / ((h * p * h.transpose())(0) + r);
+      x += gain * (z(k) - (h * x)(0));
+      p = (NavMatrix22f64::Identity() - gain * h) * p;
+      CHECK(smoother.filtered(epoch, x, p));
+    }
+  }
+
+  // every state of [begin, end) at once in information form
+  void batch(u16 begin, u16 end, NavVectorDf64& x, NavMatrixDf64& p) const {
+    auto n = 2 * (end - begin);
+    NavMatrixDf64 info = NavMatrixDf64::Zero(n, n);
+    NavVectorDf64 b = NavVectorDf64::Zero(n);
+    info.topLeftCorner<2, 2>() = p0.inverse();
+    b.head<2>() = p0.inverse() * x0;
+    NavMatrix22f64 qi = q.inverse();
+    for (u16 k = 0; k < end - begin; ++k) {
+      info(2 * k, 2 * k) += 1.0 / r;
+      b(2 * k) += z(begin + k) / r;
+      if (k == 0) continue;
+      // x(k) - F x(k-1) ~ N(0, Q)
+      NavMatrix24f64 a;
+      a << -f, NavMatrix22f64::Identity();
+      info.block<4, 4>(2 * k - 2, 2 * k - 2) += a.transpose() * qi * a;
+    }
+    p = info.inverse();
+    x = p * b;
+  }
+
+  f64 dt = 1.0, r = 4.0;
+  NavVector2f64 x0{0.0, 0.0};
+  NavMatrix22f64 p0 = NavMatrix22f64::Identity() * 100.0;
+  NavMatrix22f64 f, q;
+  NavVectorDf64 z;
+};
+
+TEST_CASE("smoothed states equal the batch solution") {
+  constexpr u16 n = 50;
+  Trajectory trajectory(n);
+  EpochUtc epoch;
+  NavVectorDf64 x;
+  NavMatrixDf64 p;
+  trajectory.batch(0, n, x, p);
+
+  auto path = store_path("test_rts_smoother.bin");
+  {
+    RtsSmoother smoother(path);
+    trajectory.forward(smoother, epoch, 0, n);
+    CHECK(smoother.size() == n);
+    i32 k = n;
+    REQUIRE(smoother.smooth([&](const EpochUtc& time, const RtsSmoother::Vector& state,
+                                const RtsSmoother::Matrix& covariance) {
+      --k;
+      REQUIRE(k >= 0);
+      CHECK(time == epoch + std::chrono::seconds(k));
+      CHECK((state - x.segment<2>(2 * k)).norm() < 1e-8);
+      CHECK((covariance - p.block<2, 2>(2 * k, 2 * k)).norm() < 1e-8);
+    }));
+    CHECK(k == 0);
+    // the forward pass may be smoothed again
+    i32 count = 0;
+    CHECK(smoother.smooth([&](auto&&...) { ++count; }));
+    CHECK(count == n);
+  }
+  CHECK(!std::filesystem::exists(path));
+}
+
+TEST_CASE("smoothing restarts at an epoch without prediction") {
+  constexpr u16 n = 30, restart = 12;
+  Trajectory trajectory(n);
+  EpochUtc epoch;
+  NavVectorDf64 x1, x2;
+  NavMatrixDf64 p1, p2;
+  trajectory.batch(0, restart, x1, p1);
+  trajectory.batch(restart, n, x2, p2);
+
+  RtsSmoother smoother(store_path("test_rts_smoother_restart.bin"));
+  trajectory.forward(smoother, epoch, 0, restart);
+  // a prediction of another epoch is dropped
+  smoother.predicted(epoch, NavVector2f64::Zero(), NavMatrix22f64::Identity(), NavMatrix22f64::Identity());
+  trajectory.forward(smoother, epoch + std::chrono::seconds(restart), restart, n);
+  i32 k = n;
+  REQUIRE(smoother.smooth([&](const EpochUtc&, const RtsSmoother::Vector& state,
+                              const RtsSmoother::Matrix& covariance) {
+    --k;
+    auto& x = k < restart ? x1 : x2;
+    auto& p = k < restart ? p1 : p2;
+    auto i = k < restart ? k : k - restart;
+    CHECK((state - x.segment<2>(2 * i)).norm() < 1e-8);
+    CHECK((covariance - p.block<2, 2>(2 * i, 2 * i)).norm() < 1e-8);
+  }));
+  CHECK(k == 0);
+}
+
+TEST_CASE("smoothed covariance is not larger than the filtered one") {
+  constexpr u16 n = 20;
+  Trajectory trajectory(n);
+  RtsSmoother smoother(store_path("test_rts_smoother_covariance.bin"));
+  trajectory.forward(smoother, EpochUtc{}, 0, n);
+  std::vector<f64> smoothed;
+  REQUIRE(smoother.smooth([&](const EpochUtc&, const RtsSmoother::Vector&, const RtsSmoother::Matrix& covariance) {
+    smoothed.push_back(covariance(0, 0));
+  }));
+  REQUIRE(smoothed.size() == n);
+  // the last epoch is only filtered, the middle ones see the measurements of both sides
+  CHECK(smoothed[n / 2] < smoothed.front());
+  CHECK(smoothed[n / 2] <= trajectory.r);
+}
@@ -0,0 +1,125 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "doctest.h"
+#include "io/custom/solution_stream.hpp"
+#include "io/custom/solution_writer.hpp"
+#include "solution/solution.hpp"
+
+using namespace navp;
+using namespace navp::io;
+using namespace navp::io::custom;
+
+static auto temp_file(std::string_view name) -> std::string {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+static auto read_file(const std::string& filename) -> std::string {
+  std::ifstream file(filename, std::ios::binary);
+  std::stringstream ss;
+  ss << file.rdbuf();
+  return ss.str();
+}
+
+// solutions of one second, a few centimetres apart
+static auto solutions(size_t count) -> std::vector<solution::PvtSolutionRecord> {
+  std::vector<solution::PvtSolutionRecord> records(count);
+  for (size_t i = 0; i < count; ++i) {
+    auto& record = records[i];
+    record.time = EpochUtc::from_seconds(1.4e9 + static_cast<f64>(i) + 0.25);
+    record.position = utils::CoordinateXyz(utils::NavVector3f64(-2267750.1234 + i * 0.01, 5009154.5678, 3221290.9));
+    record.velocity = utils::CoordinateXyz(utils::NavVector3f64(0.0125, -0.5, 12.75));
+    record.blh = record.position.to_blh();
+    record.mode = solution::SolutionModeEnum::SINGLE;
+    record.ns = static_cast<u8>(5 + i % 20);
+    record.sigma_r = 1.5, record.sigma_v = 0.1;
+    for (u8 k = 0; k < 6; ++k) record.qr[k] = record.qv[k] = 0.5f * k, record.dtr[k] = 1e-9 * k;
+  }
+  return records;
+}
+
+TEST_CASE("binary record round trip") {
+  auto record = solutions(1).front();
+  auto binary = SolutionBinaryRecord::from(record);
+  solution::PvtSolutionRecord restored;
+  binary.to(restored);
+  CHECK(restored.time == record.time);
+  CHECK(restored.position.coord() == record.position.coord());
+  CHECK(restored.blh.coord() == record.blh.coord());
+  CHECK(restored.qr[5] == record.qr[5]);
+  CHECK(restored.ns == record.ns);
+  CHECK(restored.mode == record.mode);
+}
+
+TEST_CASE("text writer writes the lines of SolutionStream") {
+  auto records = solutions(1000);
+  for (auto time_type : {TimeTypeEnum::UTC, TimeTypeEnum::GPS}) {
+    FormatOptions options{.time_type = time_type};
+    auto stream_file = temp_file("navp_solution_stream.sol"), writer_file = temp_file("navp_solution_writer.sol");
+    {
+      SolutionStream stream(stream_file, std::ios::out);
+      stream.set_format_options(options);
+      for (const auto& record : records) record.put_record(stream);
+    }
+    {
+      SolutionWriter writer(writer_file, SolutionFileEnum::TEXT, options, 64);
+      for (const auto& record : records) writer.push(record);
+      writer.close();
+      CHECK(writer.records() == records.size());
+    }
+    CHECK(read_file(writer_file) == read_file(stream_file));
+  }
+
+  // latitude and longitude
+  std::string line;
+  format_solution(SolutionBinaryRecord::from(records.front()),
+                  {.angle_type = AngleTypeEnum::DEG, .coordinate_type = CoordinateTypeEnum::BLH}, line);
+  CHECK(line.find(std::format("{:>5.8f}", to_degress(records.front().blh.x()))) != std::string::npos);
+  CHECK(line.back() == '\n');
+}
+
+TEST_CASE("binary writer converts to the text format") {
+  auto records = solutions(20000);
+  auto binary_file = temp_file("navp_solution.bin"), text_file = temp_file("navp_solution_writer.sol"),
+       converted_file = temp_file("navp_solution_converted.sol");
+  {
+    SolutionWriter binary(binary_file, SolutionFileEnum::BINARY);
+    SolutionWriter text(text_file, SolutionFileEnum::TEXT);
+    for (const auto& record : records) binary.push(record), text.push(record);
+  }
+  CHECK(std::filesystem::file_size(binary_file) ==
+        sizeof(SolutionBinaryRecord::Magic) + records.size() * sizeof(SolutionBinaryRecord));
+  CHECK(convert_solution_binary(binary_file, converted_file) == records.size());
+  CHECK(read_file(converted_file) == read_file(text_file));
+
+  CHECK_THROWS_AS(convert_solution_binary(text_file, converted_file), SolutionWriterRuntimeError);
+  CHECK_THROWS_AS(SolutionWriter(temp_file("navp_missing/solution.sol"), SolutionFileEnum::TEXT),
+                  SolutionWriterRuntimeError);
+}
+
+TEST_CASE("spsc queue keeps the order across threads") {
+  utils::SpscQueue<u64> queue(100);
+  CHECK(queue.capacity() == 128);
+  constexpr u64 Count = 1'000'000;
+  std::thread producer([&] {
+    for (u64 i = 0; i < Count; ++i) {
+      while (!queue.push(i)) std::this_thread::yield();
+    }
+  });
+  u64 expected = 0;
+  bool ordered = true;
+  while (expected < Count) {
+    if (auto value = queue.pop()) {
+      ordered &= *value == expected++;
+    } else {
+      queue.wait();
+    }
+  }
+  producer.join();
+  CHECK(ordered);
+  CHECK_FALSE(queue.pop().has_value());
+}
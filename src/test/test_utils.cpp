@@ -1,11 +1,44 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <chrono>
 #include <print>
+#include <thread>
 
 #include "doctest.h"
 #include "utils/attitude.hpp"
+#include "utils/logger.hpp"
+#include "utils/thread_pool.hpp"
 
 TEST_CASE("attitude") {
   using namespace navp::utils;
   auto euler = EulerAngle{-123.1231, 20.132132, -359.00};
   std::println("{}", euler.format_as_string());
-}
\ No newline at end of file
+}
+
+TEST_CASE("thread pool") {
+  using namespace navp::utils;
+  ThreadPool pool(4);
+  CHECK(pool.size() == 4);
+  std::vector<int> count(64, 0), expected(64, 0);
+  for (size_t job = 0; job < 1000; ++job) {
+    pool.parallel_for(job % count.size(), [&](size_t i) { ++count[i]; });
+    for (size_t i = 0; i < job % count.size(); ++i) ++expected[i];
+  }
+  CHECK(count == expected);
+}
+
+TEST_CASE("log rate limiter") {
+  using namespace std::chrono_literals;
+  navp::LogRateLimiter limiter(2, 100ms);
+  CHECK(limiter.allow(1) == 0u);
+  CHECK(limiter.allow(1) == 0u);
+  CHECK_FALSE(limiter.allow(1).has_value());
+  CHECK_FALSE(limiter.allow(1).has_value());
+  // keys are limited apart
+  CHECK(limiter.allow(2) == 0u);
+
+  // the suppressed messages are reported with the next period
+  std::this_thread::sleep_for(120ms);
+  CHECK(limiter.allow(1) == 2u);
+  CHECK(limiter.allow(1) == 0u);
+  CHECK_FALSE(limiter.allow(1).has_value());
+}
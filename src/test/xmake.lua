@@ -88,6 +88,46 @@ target("test_gnss_combine_obs")
     add_deps("nav_core","plot")
 target_end()
 
+target("test_gnss_atmosphere")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_files("gnss/atmosphere.cpp")
+    add_deps("nav_core")
+target_end()
+
+target("test_gnss_trop_grid")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_files("gnss/trop_grid.cpp")
+    add_deps("nav_core")
+target_end()
+
+target("test_gnss_ionex")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_files("gnss/ionex.cpp")
+    add_deps("nav_core")
+target_end()
+
+target("test_gnss_broadcast_iono")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_files("gnss/broadcast_iono.cpp")
+    add_deps("nav_core")
+target_end()
+
+target("test_gnss_random")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_files("gnss/random.cpp")
+    add_deps("nav_core")
+target_end()
+
 target("test_config")
     set_kind("binary")
     set_languages("c++23")
@@ -102,4 +142,124 @@ target("test_exprtk")
     set_languages("c++23")
     add_files("test_exprtk.cpp")
     add_deps("exprtk")
+target_end()
+
+target("test_raim")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_raim.cpp")
+target_end()
+
+target("test_kalman")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_kalman.cpp")
+target_end()
+
+target("test_dd_weight")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_dd_weight.cpp")
+target_end()
+
+target("test_ambiguity")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_ambiguity.cpp")
+target_end()
+
+target("test_ambiguity_state")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_ambiguity_state.cpp")
+target_end()
+
+target("test_cycle_slip")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_cycle_slip.cpp")
+target_end()
+
+target("test_base_station")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_base_station.cpp")
+target_end()
+
+target("test_network_rtk")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_network_rtk.cpp")
+target_end()
+
+target("test_factor_graph")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_factor_graph.cpp")
+target_end()
+
+target("test_factor")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_factor.cpp")
+target_end()
+
+target("test_rts_smoother")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_rts_smoother.cpp")
+target_end()
+
+target("test_solution_writer")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_solution_writer.cpp")
+target_end()
+
+target("test_rtcm3")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_rtcm3.cpp")
+target_end()
+
+target("test_ntrip")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_ntrip.cpp")
+target_end()
+
+target("test_epoch_assembler")
+    set_kind("binary")
+    set_languages("c++23")
+    set_pcheader("doctest.h")
+    add_deps("nav_core")
+    add_files("test_epoch_assembler.cpp")
 target_end()
\ No newline at end of file